@@ -0,0 +1,879 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Drives the plugin handlers against the stub tcore on a private bus.
+ *
+ *   cmake -DBUILD_TESTS=ON . && make dbus-tapi-bench
+ *   ./dbus-tapi-bench -n 20000 network-search ss-barring
+ *
+ * Notification modes time tcore_server_send_notification() as seen by the
+ * plugin. Request modes time the whole D-Bus round trip, and separately
+ * the plugin's send_response() path ("resp"). allocs/op counts malloc()
+ * calls made by the main loop thread only; the GDBus worker is not in it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <glib.h>
+#include <gio/gio.h>
+
+#include <tcore.h>
+#include <server.h>
+#include <plugin.h>
+#include <communicator.h>
+#include <user_request.h>
+#include <co_network.h>
+#include <co_ss.h>
+#include <co_sms.h>
+#include <co_sat.h>
+#include <co_sap.h>
+
+#include "stub.h"
+#include "common.h"
+#include "sat_manager.h"
+
+#define BENCH_MODEM "bench0"
+#define BENCH_WARMUP 64
+#define BENCH_BATCH 256
+#define BENCH_SS_RECORDS 4
+#define BENCH_SEARCH_RESULTS 10
+#define BENCH_MENU_ITEMS 8
+#define BENCH_SS_CLASS_VOICE 0x11
+
+/* tresp_ss_* keep their records inline or behind a pointer, depending on the libtcore release */
+#define BENCH_SS_RECORD_PTR(resp, storage) \
+	(__builtin_types_compatible_p(__typeof__((resp)->record), __typeof__(&(resp)->record[0])) \
+		? (memcpy((void *)&(resp)->record, &(void *){ (storage) }, sizeof(void *)), &(storage)[0]) \
+		: &(resp)->record[0])
+
+struct bench {
+	struct stub_bus sb;
+	GDBusConnection *server_conn;
+	TcorePlugin *modem;
+	gchar *path;
+	guint iterations;
+
+	/* the one request a round trip mode is waiting to answer */
+	enum tcore_request_command expect;
+	UserRequest *pending;
+};
+
+struct bench_request {
+	const char *interface;
+	const char *method;
+	GVariant *params;
+	enum tcore_request_command request;
+	enum tcore_response_command response;
+	const void *data;
+	unsigned int data_len;
+};
+
+struct bench_call {
+	gboolean done;
+	GVariant *result;
+	GError *error;
+};
+
+typedef void (*bench_step_cb)(struct bench *b);
+
+struct bench_mode {
+	const char *name;
+	gboolean (*run)(struct bench *b, const char *name);
+};
+
+static guint64 _now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (guint64)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static unsigned long _allocs(void)
+{
+	struct stub_alloc_count count;
+
+	stub_alloc_snapshot(&count);
+
+	return count.allocs;
+}
+
+/* lets queued signals reach the daemon and idle work run, outside the timed part */
+static void _settle(struct bench *b)
+{
+	if (b->server_conn)
+		g_dbus_connection_flush_sync(b->server_conn, NULL, NULL);
+
+	while (g_main_context_iteration(NULL, FALSE))
+		;
+}
+
+static TReturn _on_request(UserRequest *ur, enum tcore_request_command command,
+		const void *data, unsigned int data_len, void *user_data)
+{
+	struct bench *b = user_data;
+
+	if (b->expect && command == b->expect && !b->pending) {
+		b->pending = ur;
+		return TCORE_RETURN_SUCCESS;
+	}
+
+	/* terminal responses and anything else go unanswered */
+	stub_counters.dropped++;
+	tcore_user_request_unref(ur);
+
+	return TCORE_RETURN_SUCCESS;
+}
+
+static void _call_done(GObject *source, GAsyncResult *res, gpointer user_data)
+{
+	struct bench_call *call = user_data;
+
+	call->result = g_dbus_connection_call_finish(G_DBUS_CONNECTION(source), res, &call->error);
+	call->done = TRUE;
+}
+
+static void _report_ops(const char *name, guint ops, guint64 ns, unsigned long allocs)
+{
+	printf("%-22s %8u ops %10.0f ns/op %8.1f allocs/op\n", name, ops,
+			(double)ns / ops, (double)allocs / ops);
+}
+
+static void _report_request(const char *name, guint ops, guint64 rtt_ns, unsigned long req_allocs,
+		guint64 resp_ns, unsigned long resp_allocs)
+{
+	printf("%-22s %8u ops %10.0f ns/op (rtt) req %6.1f allocs/op  resp %8.0f ns/op %6.1f allocs/op\n",
+			name, ops, (double)rtt_ns / ops, (double)req_allocs / ops,
+			(double)resp_ns / ops, (double)resp_allocs / ops);
+}
+
+/*
+ * One notification, plus whatever the application would do in reply
+ * (step), timed in batches so the daemon keeps up with the signals.
+ */
+static void _time_notify(struct bench *b, CoreObject *source, enum tcore_notification_command command,
+		unsigned int data_len, const void *data, bench_step_cb step, guint64 *ns, unsigned long *allocs)
+{
+	guint64 t0;
+	unsigned long a0;
+	guint done = 0;
+	guint batch;
+	guint i;
+
+	for (i = 0; i < BENCH_WARMUP; i++) {
+		stub_server_notify(b->sb.server, source, command, data_len, data);
+		if (step)
+			step(b);
+	}
+	_settle(b);
+
+	*ns = 0;
+	*allocs = 0;
+
+	while (done < b->iterations) {
+		batch = MIN(BENCH_BATCH, b->iterations - done);
+
+		a0 = _allocs();
+		t0 = _now_ns();
+		for (i = 0; i < batch; i++) {
+			stub_server_notify(b->sb.server, source, command, data_len, data);
+			if (step)
+				step(b);
+		}
+		*ns += _now_ns() - t0;
+		*allocs += _allocs() - a0;
+
+		done += batch;
+		_settle(b);
+	}
+}
+
+static gboolean _bench_notify(struct bench *b, const char *name, unsigned int type,
+		enum tcore_notification_command command, unsigned int data_len, const void *data,
+		bench_step_cb step)
+{
+	guint64 ns;
+	unsigned long allocs;
+
+	_time_notify(b, stub_plugin_ref_object(b->modem, type), command, data_len, data, step, &ns, &allocs);
+	_report_ops(name, b->iterations, ns, allocs);
+
+	return TRUE;
+}
+
+static gboolean _bench_round_trip(struct bench *b, const struct bench_request *req,
+		guint64 *rtt_ns, unsigned long *req_allocs, guint64 *resp_ns, unsigned long *resp_allocs)
+{
+	struct bench_call call;
+	unsigned long a0;
+	unsigned long a1;
+	guint64 t0;
+	guint64 t1;
+
+	memset(&call, 0, sizeof(struct bench_call));
+	b->pending = NULL;
+	b->expect = req->request;
+
+	t0 = _now_ns();
+	g_dbus_connection_call(b->sb.client, MY_DBUS_SERVICE, b->path, req->interface, req->method,
+			req->params, NULL, G_DBUS_CALL_FLAGS_NONE, -1, NULL, _call_done, &call);
+	a0 = _allocs();
+
+	while (!b->pending && !call.done)
+		g_main_context_iteration(NULL, TRUE);
+
+	b->expect = 0;
+
+	if (!b->pending) {
+		fprintf(stderr, "%s.%s was not dispatched: %s\n", req->interface, req->method,
+				call.error ? call.error->message : "answered without tcore");
+		if (call.error)
+			g_error_free(call.error);
+		if (call.result)
+			g_variant_unref(call.result);
+		return FALSE;
+	}
+
+	a1 = _allocs();
+	*req_allocs += a1 - a0;
+
+	t1 = _now_ns();
+	stub_user_request_respond(b->pending, req->response, req->data_len, req->data);
+	*resp_ns += _now_ns() - t1;
+	*resp_allocs += _allocs() - a1;
+	b->pending = NULL;
+
+	while (!call.done)
+		g_main_context_iteration(NULL, TRUE);
+
+	*rtt_ns += _now_ns() - t0;
+
+	if (call.error) {
+		fprintf(stderr, "%s.%s: %s\n", req->interface, req->method, call.error->message);
+		g_error_free(call.error);
+		return FALSE;
+	}
+
+	g_variant_unref(call.result);
+
+	return TRUE;
+}
+
+static gboolean _bench_request(struct bench *b, const char *name, const struct bench_request *req)
+{
+	guint64 rtt_ns = 0;
+	guint64 resp_ns = 0;
+	unsigned long req_allocs = 0;
+	unsigned long resp_allocs = 0;
+	guint i;
+
+	for (i = 0; i < BENCH_WARMUP; i++) {
+		if (!_bench_round_trip(b, req, &rtt_ns, &req_allocs, &resp_ns, &resp_allocs))
+			return FALSE;
+	}
+
+	rtt_ns = resp_ns = 0;
+	req_allocs = resp_allocs = 0;
+
+	for (i = 0; i < b->iterations; i++) {
+		if (!_bench_round_trip(b, req, &rtt_ns, &req_allocs, &resp_ns, &resp_allocs))
+			return FALSE;
+	}
+
+	_report_request(name, b->iterations, rtt_ns, req_allocs, resp_ns, resp_allocs);
+
+	return TRUE;
+}
+
+/* notifications */
+
+static gboolean _run_sms_incoming(struct bench *b, const char *name)
+{
+	static struct tnoti_sms_umts_msg noti;
+	unsigned int i;
+
+	memset(&noti, 0, sizeof(struct tnoti_sms_umts_msg));
+	for (i = 0; i < SMS_SMSP_ADDRESS_LEN; i++)
+		noti.msgInfo.sca[i] = (unsigned char)(0x10 + i);
+	noti.msgInfo.msgLength = MIN(140, SMS_SMDATA_SIZE_MAX);
+	for (i = 0; i < (unsigned int)noti.msgInfo.msgLength; i++)
+		noti.msgInfo.tpduData[i] = (unsigned char)i;
+
+	return _bench_notify(b, name, CORE_OBJECT_TYPE_SMS, TNOTI_SMS_INCOM_MSG,
+			sizeof(struct tnoti_sms_umts_msg), &noti, NULL);
+}
+
+#define BENCH_FILL_ALPHA_ID(alpha, text) do { \
+	(alpha)->is_exist = TRUE; \
+	(alpha)->dcs.a_format = ALPHABET_FROMAT_8BIT_DATA; \
+	(alpha)->alpha_data_len = MIN(strlen(text), sizeof((alpha)->alpha_data) - 1); \
+	memcpy((alpha)->alpha_data, (text), (alpha)->alpha_data_len); \
+} while (0)
+
+#define BENCH_FILL_MENU_ITEMS(items, count) do { \
+	int bench_i; \
+	for (bench_i = 0; bench_i < (count); bench_i++) { \
+		(items)[bench_i].item_id = bench_i + 1; \
+		(items)[bench_i].text_len = snprintf((char *)(items)[bench_i].text, sizeof((items)[bench_i].text), \
+				"Menu item %d", bench_i + 1); \
+	} \
+} while (0)
+
+static gboolean _run_sat_setup_menu(struct bench *b, const char *name)
+{
+	static struct tnoti_sat_proactive_ind ind;
+	struct tel_sat_setup_menu_tlv *menu = &ind.proactive_ind_data.setup_menu;
+
+	memset(&ind, 0, sizeof(struct tnoti_sat_proactive_ind));
+	ind.cmd_type = SAT_PROATV_CMD_SETUP_MENU;
+	menu->command_detail.cmd_num = 1;
+	menu->command_detail.cmd_type = SAT_PROATV_CMD_SETUP_MENU;
+	menu->device_id.src = DEVICE_ID_SIM;
+	menu->device_id.dest = DEVICE_ID_ME;
+	BENCH_FILL_ALPHA_ID(&menu->alpha_id, "SIM Toolkit");
+	menu->menu_item_cnt = MIN(BENCH_MENU_ITEMS, (int)G_N_ELEMENTS(menu->menu_item));
+	BENCH_FILL_MENU_ITEMS(menu->menu_item, menu->menu_item_cnt);
+
+	return _bench_notify(b, name, CORE_OBJECT_TYPE_SAT, TNOTI_SAT_PROACTIVE_IND,
+			sizeof(struct tnoti_sat_proactive_ind), &ind, NULL);
+}
+
+/* what send_notification() did per event before the modem table: build the path, hash it, free it */
+static TelephonyObjectSkeleton *_route_by_path(struct custom_data *ctx, TcorePlugin *p)
+{
+	TelephonyObjectSkeleton *object;
+	char *path;
+
+	path = g_strdup_printf("%s/%s", MY_DBUS_PATH, tcore_plugin_ref_plugin_name(p));
+	object = g_hash_table_lookup(ctx->objects, path);
+	g_free(path);
+
+	return object;
+}
+
+static TelephonyObjectSkeleton *_route_by_plugin(struct custom_data *ctx, TcorePlugin *p)
+{
+	struct dbus_modem_context *modem;
+
+	modem = dbus_plugin_ref_modem(ctx, p);
+
+	return modem ? modem->object : NULL;
+}
+
+static gboolean _time_route(struct bench *b, const char *name,
+		TelephonyObjectSkeleton *(*route)(struct custom_data *ctx, TcorePlugin *p), guint64 *ns)
+{
+	TelephonyObjectSkeleton *expected;
+	unsigned long a0;
+	guint64 t0;
+	guint i;
+
+	expected = g_hash_table_lookup(b->sb.ctx->objects, b->path);
+
+	a0 = _allocs();
+	t0 = _now_ns();
+	for (i = 0; i < b->iterations; i++) {
+		if (route(b->sb.ctx, b->modem) != expected) {
+			fprintf(stderr, "%s: wrong object\n", name);
+			return FALSE;
+		}
+	}
+	*ns = _now_ns() - t0;
+
+	_report_ops(name, b->iterations, *ns, _allocs() - a0);
+
+	return TRUE;
+}
+
+/*
+ * Notification routing before and after the pointer keyed modem table.
+ * The old per event lookup is replayed next to the current one, and the
+ * difference is applied to a full notification (an unchanged RSSI
+ * report, so the handler itself is cheap) to get both rates.
+ */
+static gboolean _run_notify_route(struct bench *b, const char *name)
+{
+	static struct tnoti_network_icon_info info;
+	guint64 by_path_ns;
+	guint64 by_plugin_ns;
+	guint64 ns;
+	unsigned long allocs;
+	double after;
+	double before;
+
+	if (!_time_route(b, "route-by-path", _route_by_path, &by_path_ns)
+			|| !_time_route(b, "route-by-plugin", _route_by_plugin, &by_plugin_ns))
+		return FALSE;
+
+	memset(&info, 0, sizeof(struct tnoti_network_icon_info));
+	_time_notify(b, stub_plugin_ref_object(b->modem, CORE_OBJECT_TYPE_NETWORK), TNOTI_NETWORK_ICON_INFO,
+			sizeof(struct tnoti_network_icon_info), &info, NULL, &ns, &allocs);
+	_report_ops(name, b->iterations, ns, allocs);
+
+	after = (double)ns / b->iterations;
+	before = after + ((double)by_path_ns - (double)by_plugin_ns) / b->iterations;
+	printf("%-22s %.0f notifications/s, %.0f with path routing\n", "", 1e9 / after, 1e9 / before);
+
+	return TRUE;
+}
+
+/* the SAT UI picks the first item of the command just queued */
+static void _select_first_item(struct bench *b)
+{
+	struct sat_manager_queue *q = b->sb.ctx->queue_sat;
+	GVariant *confirm;
+	guchar item = 1;
+
+	confirm = g_variant_new("(iiv)", q->next_id - 1, USER_CONFIRM_YES,
+			g_variant_new_variant(g_variant_new_fixed_array(G_VARIANT_TYPE_BYTE, &item, 1, 1)));
+	g_variant_ref_sink(confirm);
+
+	sat_manager_handle_user_confirm(b->sb.ctx, b->modem, confirm);
+
+	g_variant_unref(confirm);
+}
+
+static gboolean _run_sat_select_item(struct bench *b, const char *name)
+{
+	static struct tnoti_sat_proactive_ind ind;
+	struct tel_sat_select_item_tlv *select = &ind.proactive_ind_data.select_item;
+
+	memset(&ind, 0, sizeof(struct tnoti_sat_proactive_ind));
+	ind.cmd_type = SAT_PROATV_CMD_SELECT_ITEM;
+	select->command_detail.cmd_num = 2;
+	select->command_detail.cmd_type = SAT_PROATV_CMD_SELECT_ITEM;
+	select->device_id.src = DEVICE_ID_SIM;
+	select->device_id.dest = DEVICE_ID_ME;
+	BENCH_FILL_ALPHA_ID(&select->alpha_id, "Select");
+	select->item_identifier.item_identifier = 1;
+	select->menu_item_cnt = MIN(BENCH_MENU_ITEMS, (int)G_N_ELEMENTS(select->menu_item));
+	BENCH_FILL_MENU_ITEMS(select->menu_item, select->menu_item_cnt);
+
+	return _bench_notify(b, name, CORE_OBJECT_TYPE_SAT, TNOTI_SAT_PROACTIVE_IND,
+			sizeof(struct tnoti_sat_proactive_ind), &ind, _select_first_item);
+}
+
+/* requests */
+
+static gboolean _run_network_search(struct bench *b, const char *name)
+{
+	static struct tresp_network_search resp;
+	struct bench_request req;
+	gboolean ret;
+	unsigned int i;
+
+	memset(&resp, 0, sizeof(struct tresp_network_search));
+	resp.result = 0;
+	resp.list_count = MIN(BENCH_SEARCH_RESULTS, G_N_ELEMENTS(resp.list));
+	for (i = 0; i < (unsigned int)resp.list_count; i++) {
+		snprintf(resp.list[i].plmn, sizeof(resp.list[i].plmn), "450%02u", i);
+		resp.list[i].act = 4; /* UMTS */
+		resp.list[i].status = 1; /* available */
+		/* half come with a name, the rest go through the operator lookup */
+		if (i % 2)
+			snprintf(resp.list[i].name, sizeof(resp.list[i].name), "Operator %u", i);
+	}
+
+	memset(&req, 0, sizeof(struct bench_request));
+	req.interface = "org.tizen.telephony.Network";
+	req.method = "Search";
+	req.params = g_variant_ref_sink(g_variant_new("()"));
+	req.request = TREQ_NETWORK_SEARCH;
+	req.response = TRESP_NETWORK_SEARCH;
+	req.data = &resp;
+	req.data_len = sizeof(struct tresp_network_search);
+
+	ret = _bench_request(b, name, &req);
+	g_variant_unref(req.params);
+
+	return ret;
+}
+
+static gboolean _run_ss_barring(struct bench *b, const char *name)
+{
+	static struct tresp_ss_barring resp;
+	static __typeof__(resp.record[0]) records[BENCH_SS_RECORDS];
+	__typeof__(resp.record[0]) *record;
+	struct bench_request req;
+	gboolean ret;
+	int i;
+
+	memset(&resp, 0, sizeof(struct tresp_ss_barring));
+	memset(records, 0, sizeof(records));
+	record = BENCH_SS_RECORD_PTR(&resp, records);
+	resp.record_num = BENCH_SS_RECORDS;
+	for (i = 0; i < BENCH_SS_RECORDS; i++) {
+		record[i].class = BENCH_SS_CLASS_VOICE;
+		record[i].status = 1;
+		record[i].mode = i;
+	}
+
+	memset(&req, 0, sizeof(struct bench_request));
+	req.interface = "org.tizen.telephony.Ss";
+	req.method = "GetBarringStatus";
+	req.params = g_variant_ref_sink(g_variant_new("(ii)", BENCH_SS_CLASS_VOICE, 0));
+	req.request = TREQ_SS_BARRING_GET_STATUS;
+	req.response = TRESP_SS_BARRING_GET_STATUS;
+	req.data = &resp;
+	req.data_len = sizeof(struct tresp_ss_barring);
+
+	ret = _bench_request(b, name, &req);
+	g_variant_unref(req.params);
+
+	return ret;
+}
+
+static gboolean _run_ss_forwarding(struct bench *b, const char *name)
+{
+	static struct tresp_ss_forwarding resp;
+	static __typeof__(resp.record[0]) records[BENCH_SS_RECORDS];
+	__typeof__(resp.record[0]) *record;
+	struct bench_request req;
+	gboolean ret;
+	int i;
+
+	memset(&resp, 0, sizeof(struct tresp_ss_forwarding));
+	memset(records, 0, sizeof(records));
+	record = BENCH_SS_RECORD_PTR(&resp, records);
+	resp.record_num = BENCH_SS_RECORDS;
+	for (i = 0; i < BENCH_SS_RECORDS; i++) {
+		record[i].class = BENCH_SS_CLASS_VOICE;
+		record[i].status = 1;
+		record[i].mode = i;
+		record[i].time = 20;
+		record[i].number_present = TRUE;
+		snprintf(record[i].number, sizeof(record[i].number), "+8210555%04d", i);
+	}
+
+	memset(&req, 0, sizeof(struct bench_request));
+	req.interface = "org.tizen.telephony.Ss";
+	req.method = "GetForwardingStatus";
+	req.params = g_variant_ref_sink(g_variant_new("(ii)", BENCH_SS_CLASS_VOICE, 0));
+	req.request = TREQ_SS_FORWARDING_GET_STATUS;
+	req.response = TRESP_SS_FORWARDING_GET_STATUS;
+	req.data = &resp;
+	req.data_len = sizeof(struct tresp_ss_forwarding);
+
+	ret = _bench_request(b, name, &req);
+	g_variant_unref(req.params);
+
+	return ret;
+}
+
+static gboolean _run_sap_apdu(struct bench *b, const char *name)
+{
+	static struct tresp_sap_transfer_apdu resp;
+	struct bench_request req;
+	guchar apdu[64];
+	gboolean ret;
+	unsigned int i;
+
+	memset(&resp, 0, sizeof(struct tresp_sap_transfer_apdu));
+	resp.result = 0;
+	resp.resp_apdu_length = MIN(258, sizeof(resp.resp_adpdu));
+	for (i = 0; i < (unsigned int)resp.resp_apdu_length; i++)
+		resp.resp_adpdu[i] = (unsigned char)i;
+
+	for (i = 0; i < sizeof(apdu); i++)
+		apdu[i] = (guchar)(0xA0 + i);
+
+	memset(&req, 0, sizeof(struct bench_request));
+	req.interface = "org.tizen.telephony.Sap";
+	req.method = "TransferAPDU";
+	req.params = g_variant_ref_sink(g_variant_new("(v)",
+			g_variant_new_fixed_array(G_VARIANT_TYPE_BYTE, apdu, sizeof(apdu), 1)));
+	req.request = TREQ_SAP_TRANSFER_APDU;
+	req.response = TRESP_SAP_TRANSFER_APDU;
+	req.data = &resp;
+	req.data_len = sizeof(struct tresp_sap_transfer_apdu);
+
+	ret = _bench_request(b, name, &req);
+	g_variant_unref(req.params);
+
+	return ret;
+}
+
+/* leaves a method call dispatched to tcore and unanswered, for handlers that need a live invocation */
+static UserRequest *_hold_request(struct bench *b, const char *interface, const char *method,
+		enum tcore_request_command command, struct bench_call *call)
+{
+	memset(call, 0, sizeof(struct bench_call));
+	b->pending = NULL;
+	b->expect = command;
+
+	g_dbus_connection_call(b->sb.client, MY_DBUS_SERVICE, b->path, interface, method,
+			NULL, NULL, G_DBUS_CALL_FLAGS_NONE, -1, NULL, _call_done, call);
+
+	while (!b->pending && !call->done)
+		g_main_context_iteration(NULL, TRUE);
+
+	b->expect = 0;
+
+	return b->pending;
+}
+
+static void _release_request(struct bench *b, UserRequest *ur, enum tcore_response_command command,
+		unsigned int data_len, const void *data, struct bench_call *call)
+{
+	if (ur)
+		stub_user_request_respond(ur, command, data_len, data);
+	b->pending = NULL;
+
+	while (!call->done)
+		g_main_context_iteration(NULL, TRUE);
+
+	if (call->error)
+		g_error_free(call->error);
+	if (call->result)
+		g_variant_unref(call->result);
+}
+
+static void _time_make_ur(struct bench *b, const char *name, struct dbus_request_info *held, gboolean tcore_only)
+{
+	UserRequest *ur;
+	unsigned long a0;
+	guint64 t0;
+	guint i;
+
+	a0 = _allocs();
+	t0 = _now_ns();
+	for (i = 0; i < b->iterations; i++) {
+		if (tcore_only)
+			ur = tcore_user_request_new(b->sb.ctx->comm, BENCH_MODEM);
+		else
+			ur = MAKE_UR(b->sb.ctx, held->interface_object, held->invocation);
+		tcore_user_request_unref(ur);
+	}
+
+	_report_ops(name, b->iterations, _now_ns() - t0, _allocs() - a0);
+}
+
+/*
+ * MAKE_UR() + final unref against a real invocation, with the request
+ * record coming from the pool and, once DBUS_REQUEST_POOL_SIZE requests
+ * are outstanding, from calloc(). ur-tcore-only is the part the stub
+ * tcore itself allocates.
+ */
+static gboolean _run_make_ur(struct bench *b, const char *name)
+{
+	static struct tresp_network_get_serving_network resp;
+	UserRequest *outstanding[DBUS_REQUEST_POOL_SIZE];
+	struct dbus_request_pool *pool = &b->sb.ctx->request_pool;
+	struct dbus_request_info *held;
+	struct bench_call call;
+	UserRequest *ur;
+	guint i;
+
+	ur = _hold_request(b, "org.tizen.telephony.Network", "GetServingNetwork",
+			TREQ_NETWORK_GET_SERVING_NETWORK, &call);
+	if (!ur) {
+		fprintf(stderr, "%s: GetServingNetwork was not dispatched\n", name);
+		_release_request(b, NULL, 0, 0, NULL, &call);
+		return FALSE;
+	}
+	held = dbus_plugin_ref_request_info(ur);
+
+	_time_make_ur(b, "ur-tcore-only", held, TRUE);
+	_time_make_ur(b, "make-ur-pooled", held, FALSE);
+
+	for (i = 0; i < DBUS_REQUEST_POOL_SIZE; i++)
+		outstanding[i] = MAKE_UR(b->sb.ctx, held->interface_object, held->invocation);
+
+	_time_make_ur(b, "make-ur-overflow", held, FALSE);
+
+	for (i = 0; i < DBUS_REQUEST_POOL_SIZE; i++)
+		tcore_user_request_unref(outstanding[i]);
+
+	printf("%-22s pool of %d, high water %u, %lu overflow allocations\n", "",
+			DBUS_REQUEST_POOL_SIZE, pool->high_water, pool->overflow);
+
+	memset(&resp, 0, sizeof(struct tresp_network_get_serving_network));
+	_release_request(b, ur, TRESP_NETWORK_GET_SERVING_NETWORK,
+			sizeof(struct tresp_network_get_serving_network), &resp, &call);
+
+	return TRUE;
+}
+
+/*
+ * Per notification cost of the network hooks as modems are added: an
+ * RSSI report from the first and from the newest modem, at 1, 2, 4 and 8
+ * modems. Runs last, the extra modems stay.
+ */
+static gboolean _run_modems(struct bench *b, const char *name)
+{
+	static const guint counts[] = { 1, 2, 4, 8 };
+	static struct tnoti_network_icon_info info;
+	TcorePlugin *newest = b->modem;
+	TcorePlugin *p;
+	char modem_name[16];
+	gchar *path;
+	gboolean exported;
+	guint64 first_ns;
+	guint64 newest_ns;
+	unsigned long allocs;
+	guint modems = 1;
+	guint i;
+
+	memset(&info, 0, sizeof(struct tnoti_network_icon_info));
+
+	for (i = 0; i < G_N_ELEMENTS(counts); i++) {
+		while (modems < counts[i]) {
+			snprintf(modem_name, sizeof(modem_name), "bench%u", modems);
+			p = stub_bus_add_modem(&b->sb, modem_name);
+
+			path = stub_bus_modem_path(modem_name);
+			exported = g_hash_table_lookup(b->sb.ctx->objects, path) != NULL;
+			g_free(path);
+			if (!exported) {
+				fprintf(stderr, "%s: %s was not exported\n", name, modem_name);
+				return FALSE;
+			}
+
+			newest = p;
+			modems++;
+		}
+
+		_time_notify(b, stub_plugin_ref_object(b->modem, CORE_OBJECT_TYPE_NETWORK), TNOTI_NETWORK_ICON_INFO,
+				sizeof(struct tnoti_network_icon_info), &info, NULL, &first_ns, &allocs);
+		_time_notify(b, stub_plugin_ref_object(newest, CORE_OBJECT_TYPE_NETWORK), TNOTI_NETWORK_ICON_INFO,
+				sizeof(struct tnoti_network_icon_info), &info, NULL, &newest_ns, &allocs);
+
+		printf("%-22s %8u modems %10.0f ns/op (first) %10.0f ns/op (newest)\n", name, modems,
+				(double)first_ns / b->iterations, (double)newest_ns / b->iterations);
+	}
+
+	return TRUE;
+}
+
+static const struct bench_mode bench_modes[] = {
+	{ "notify-route", _run_notify_route },
+	{ "make-ur", _run_make_ur },
+	{ "sms-incoming", _run_sms_incoming },
+	{ "sat-setup-menu", _run_sat_setup_menu },
+	{ "sat-select-item", _run_sat_select_item },
+	{ "network-search", _run_network_search },
+	{ "ss-barring", _run_ss_barring },
+	{ "ss-forwarding", _run_ss_forwarding },
+	{ "sap-apdu", _run_sap_apdu },
+	{ "modems", _run_modems },
+};
+
+static const struct bench_mode *_find_mode(const char *name)
+{
+	unsigned int i;
+
+	for (i = 0; i < G_N_ELEMENTS(bench_modes); i++) {
+		if (!g_strcmp0(bench_modes[i].name, name))
+			return &bench_modes[i];
+	}
+
+	return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+	struct bench b;
+	const char *modems[] = { BENCH_MODEM };
+	const struct bench_mode *mode;
+	GOptionContext *options;
+	GError *error = NULL;
+	gint iterations = 10000;
+	gboolean verbose = FALSE;
+	gboolean ok = TRUE;
+	int i;
+
+	GOptionEntry entries[] = {
+		{ "iterations", 'n', 0, G_OPTION_ARG_INT, &iterations, "Operations per mode (10000)", "N" },
+		{ "verbose", 'v', 0, G_OPTION_ARG_NONE, &verbose, "Print the plugin log", NULL },
+		{ NULL }
+	};
+
+	/* every GSlice allocation shows up as malloc() */
+	g_setenv("G_SLICE", "always-malloc", TRUE);
+
+#if !GLIB_CHECK_VERSION(2,35,0)
+	g_type_init();
+#endif
+
+	options = g_option_context_new("[MODE...] - time dbus-tapi handlers against a stub tcore");
+	g_option_context_add_main_entries(options, entries, NULL);
+	if (!g_option_context_parse(options, &argc, &argv, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		return 2;
+	}
+	g_option_context_free(options);
+
+	for (i = 1; i < argc; i++) {
+		if (!_find_mode(argv[i])) {
+			fprintf(stderr, "unknown mode '%s', one of:", argv[i]);
+			for (i = 0; i < (int)G_N_ELEMENTS(bench_modes); i++)
+				fprintf(stderr, " %s", bench_modes[i].name);
+			fprintf(stderr, "\n");
+			return 2;
+		}
+	}
+
+	stub_verbose = verbose;
+
+	memset(&b, 0, sizeof(struct bench));
+	b.iterations = iterations > 0 ? (guint)iterations : 1;
+
+	if (!stub_bus_up(&b.sb, modems, G_N_ELEMENTS(modems))) {
+		stub_bus_down(&b.sb);
+		return 1;
+	}
+
+	stub_server_set_request_handler(b.sb.server, _on_request, &b);
+	b.server_conn = g_bus_get_sync(G_BUS_TYPE_SYSTEM, NULL, NULL);
+	b.modem = tcore_server_find_plugin(b.sb.server, BENCH_MODEM);
+	b.path = stub_bus_modem_path(BENCH_MODEM);
+
+	if (!stub_alloc_counting())
+		printf("(allocation counting needs glibc, allocs/op reads 0)\n");
+
+	for (i = 0; i < (int)G_N_ELEMENTS(bench_modes) && ok; i++) {
+		mode = &bench_modes[i];
+		if (argc > 1) {
+			int j;
+
+			for (j = 1; j < argc && g_strcmp0(argv[j], mode->name); j++)
+				;
+			if (j == argc)
+				continue;
+		}
+
+		ok = mode->run(&b, mode->name);
+		_settle(&b);
+	}
+
+	printf("tcore: %lu requests (%lu answered, %lu dropped), %lu notifications, %lu UI launches, %lu/%lu requests freed\n",
+			stub_counters.dispatched, stub_counters.responded, stub_counters.dropped,
+			stub_counters.notified, stub_counters.ui_launches, stub_counters.ur_free, stub_counters.ur_new);
+
+	g_free(b.path);
+	if (b.server_conn)
+		g_object_unref(b.server_conn);
+	stub_bus_down(&b.sb);
+
+	return ok ? 0 : 1;
+}
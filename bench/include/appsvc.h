@@ -0,0 +1,44 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * The part of <appsvc.h> the plugin uses, for the stub harness
+ * (BUILD_TESTS); bench/stub-platform.c implements it.
+ */
+
+#ifndef __BENCH_APPSVC_H__
+#define __BENCH_APPSVC_H__
+
+#include <bundle.h>
+
+#define APPSVC_OPERATION_CALL "http://tizen.org/appsvc/operation/call"
+
+typedef enum {
+	APPSVC_RES_CANCEL = -2,
+	APPSVC_RES_NOT_OK = -1,
+	APPSVC_RES_OK = 0,
+} appsvc_result_val;
+
+typedef void (*appsvc_res_fn)(bundle *b, int request_code, appsvc_result_val result, void *data);
+
+int appsvc_set_operation(bundle *b, const char *operation);
+int appsvc_set_uri(bundle *b, const char *uri);
+int appsvc_add_data(bundle *b, const char *key, const char *val);
+int appsvc_run_service(bundle *b, int request_code, appsvc_res_fn cbfunc, void *data);
+
+#endif
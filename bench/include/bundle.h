@@ -0,0 +1,33 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * The part of <bundle.h> the plugin uses, for the stub harness
+ * (BUILD_TESTS); bench/stub-platform.c implements it.
+ */
+
+#ifndef __BENCH_BUNDLE_H__
+#define __BENCH_BUNDLE_H__
+
+typedef struct _bundle_t bundle;
+
+bundle *bundle_create(void);
+int bundle_free(bundle *b);
+int bundle_add(bundle *b, const char *key, const char *val);
+
+#endif
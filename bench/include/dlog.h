@@ -0,0 +1,59 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * The part of <dlog.h> libtcore's log.h and the plugin use, for the stub
+ * harness (BUILD_TESTS); bench/stub-platform.c implements it.
+ */
+
+#ifndef __BENCH_DLOG_H__
+#define __BENCH_DLOG_H__
+
+#include <stdarg.h>
+
+typedef enum {
+	LOG_ID_MAIN = 0,
+	LOG_ID_RADIO,
+	LOG_ID_SYSTEM,
+	LOG_ID_APPS,
+	LOG_ID_MAX
+} log_id_t;
+
+typedef enum {
+	DLOG_UNKNOWN = 0,
+	DLOG_DEFAULT,
+	DLOG_VERBOSE,
+	DLOG_DEBUG,
+	DLOG_INFO,
+	DLOG_WARN,
+	DLOG_ERROR,
+	DLOG_FATAL,
+	DLOG_SILENT,
+} log_priority;
+
+#define LOG_(id, prio, tag, fmt, arg...) \
+	({ do { __dlog_print(id, prio, tag, fmt, ##arg); } while (0); })
+
+#define LOG(priority, tag, format, arg...) LOG_(LOG_ID_MAIN, D##priority, tag, format, ##arg)
+#define RLOG(priority, tag, format, arg...) LOG_(LOG_ID_RADIO, D##priority, tag, format, ##arg)
+#define SLOG(priority, tag, format, arg...) LOG_(LOG_ID_SYSTEM, D##priority, tag, format, ##arg)
+
+int __dlog_print(log_id_t log_id, int prio, const char *tag, const char *fmt, ...);
+int __dlog_vprint(log_id_t log_id, int prio, const char *tag, const char *fmt, va_list ap);
+
+#endif
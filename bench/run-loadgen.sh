@@ -0,0 +1,56 @@
+#!/bin/sh
+#
+# Runs tapi-loadgen against the plugin hosted by tapi-stub-host on a
+# private dbus-daemon, so the daemon, the plugin and the load generator
+# are three processes and their CPU time can be told apart.
+#
+#   bench/run-loadgen.sh <build dir> [tapi-loadgen options]
+#
+# TAPI_STUB_HOST_ARGS passes options to the host (modem delays), e.g.
+#   TAPI_STUB_HOST_ARGS="--delay-ms 2 --delay sms=40" bench/run-loadgen.sh . -c 32
+# DBUS_DAEMON picks the dbus-daemon binary.
+
+BUILD_DIR=${1:-.}
+[ $# -gt 0 ] && shift
+
+DBUS_DAEMON=${DBUS_DAEMON:-dbus-daemon}
+WORK_DIR=$(mktemp -d "${TMPDIR:-/tmp}/tapi-loadgen.XXXXXX") || exit 1
+DAEMON_PID=
+HOST_PID=
+
+cleanup() {
+	[ -n "$HOST_PID" ] && kill "$HOST_PID" 2>/dev/null && wait "$HOST_PID"
+	[ -n "$DAEMON_PID" ] && kill "$DAEMON_PID" 2>/dev/null
+	rm -rf "$WORK_DIR"
+}
+trap cleanup EXIT
+trap 'exit 1' INT TERM
+
+cat > "$WORK_DIR/bus.conf" <<EOF
+<!DOCTYPE busconfig PUBLIC "-//freedesktop//DTD D-Bus Bus Configuration 1.0//EN"
+ "http://www.freedesktop.org/standards/dbus/1.0/busconfig.dtd">
+<busconfig>
+  <type>session</type>
+  <listen>unix:path=$WORK_DIR/bus</listen>
+  <limit name="max_replies_per_connection">65536</limit>
+  <policy context="default">
+    <allow send_destination="*" eavesdrop="true"/>
+    <allow eavesdrop="true"/>
+    <allow own="*"/>
+  </policy>
+</busconfig>
+EOF
+
+"$DBUS_DAEMON" --config-file="$WORK_DIR/bus.conf" --fork \
+	--print-address=3 --print-pid=4 3>"$WORK_DIR/address" 4>"$WORK_DIR/pid" || exit 1
+ADDRESS=$(head -n 1 "$WORK_DIR/address")
+DAEMON_PID=$(head -n 1 "$WORK_DIR/pid")
+
+# shellcheck disable=SC2086
+"$BUILD_DIR/tapi-stub-host" --address "$ADDRESS" $TAPI_STUB_HOST_ARGS &
+HOST_PID=$!
+
+"$BUILD_DIR/tapi-loadgen" --address "$ADDRESS" --daemon-pid "$DAEMON_PID" --plugin-pid "$HOST_PID" "$@"
+STATUS=$?
+
+exit $STATUS
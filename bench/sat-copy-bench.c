@@ -0,0 +1,254 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Counts the large copies the plugin makes per SAT command cycle:
+ *
+ *   SETUP MENU   proactive indication, enqueue, app exec result,
+ *                dequeue, terminal response
+ *   SELECT ITEM  proactive indication, enqueue, user confirm,
+ *                dequeue, terminal response
+ *
+ *   cmake -DBUILD_TESTS=ON . && make sat-copy-bench
+ *   ./sat-copy-bench -n 1000 --min-bytes 1024
+ *
+ * Linked with -Wl,--wrap=memcpy,--wrap=memmove against a harness built
+ * with -fno-builtin-memcpy -fno-builtin-memmove (CMakeLists.txt), so
+ * every memcpy() / memmove() call in the plugin and the stub lands here.
+ * Block moves the compiler expands inline (struct assignment) and copies
+ * made inside glib are not seen.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include <gio/gio.h>
+
+#include <tcore.h>
+#include <server.h>
+#include <plugin.h>
+#include <communicator.h>
+#include <user_request.h>
+#include <co_sat.h>
+
+#include "stub.h"
+#include "common.h"
+#include "sat_manager.h"
+
+#define COPY_MODEM "copy0"
+#define COPY_WARMUP 16
+#define COPY_MENU_ITEMS 8
+
+struct copy_count {
+	unsigned long calls;
+	unsigned long large;
+	unsigned long long large_bytes;
+};
+
+/* main loop thread only, like the allocation counters */
+static __thread struct copy_count copies;
+static size_t copy_min_bytes = 1024;
+
+void *__real_memcpy(void *dest, const void *src, size_t n);
+void *__real_memmove(void *dest, const void *src, size_t n);
+void *__wrap_memcpy(void *dest, const void *src, size_t n);
+void *__wrap_memmove(void *dest, const void *src, size_t n);
+
+static void _count(size_t n)
+{
+	copies.calls++;
+	if (n >= copy_min_bytes) {
+		copies.large++;
+		copies.large_bytes += n;
+	}
+}
+
+void *__wrap_memcpy(void *dest, const void *src, size_t n)
+{
+	_count(n);
+	return __real_memcpy(dest, src, n);
+}
+
+void *__wrap_memmove(void *dest, const void *src, size_t n)
+{
+	_count(n);
+	return __real_memmove(dest, src, n);
+}
+
+static void _settle(void)
+{
+	while (g_main_context_iteration(NULL, FALSE))
+		;
+}
+
+#define COPY_FILL_ALPHA_ID(alpha, text) do { \
+	(alpha)->is_exist = TRUE; \
+	(alpha)->dcs.a_format = ALPHABET_FROMAT_8BIT_DATA; \
+	(alpha)->alpha_data_len = MIN(strlen(text), sizeof((alpha)->alpha_data) - 1); \
+	memcpy((alpha)->alpha_data, (text), (alpha)->alpha_data_len); \
+} while (0)
+
+#define COPY_FILL_MENU_ITEMS(items, count) do { \
+	int copy_i; \
+	for (copy_i = 0; copy_i < (count); copy_i++) { \
+		(items)[copy_i].item_id = copy_i + 1; \
+		(items)[copy_i].text_len = snprintf((char *)(items)[copy_i].text, sizeof((items)[copy_i].text), \
+				"Menu item %d", copy_i + 1); \
+	} \
+} while (0)
+
+/* the SAT UI picks the first item of the command just queued */
+static void _select_first_item(struct stub_bus *sb, TcorePlugin *modem)
+{
+	struct sat_manager_queue *q = sb->ctx->queue_sat;
+	GVariant *confirm;
+	guchar item = 1;
+
+	confirm = g_variant_new("(iiv)", q->next_id - 1, USER_CONFIRM_YES,
+			g_variant_new_variant(g_variant_new_fixed_array(G_VARIANT_TYPE_BYTE, &item, 1, 1)));
+	g_variant_ref_sink(confirm);
+
+	sat_manager_handle_user_confirm(sb->ctx, modem, confirm);
+
+	g_variant_unref(confirm);
+}
+
+static void _cycle(struct stub_bus *sb, TcorePlugin *modem, const struct tnoti_sat_proactive_ind *ind)
+{
+	stub_server_notify(sb->server, stub_plugin_ref_object(modem, CORE_OBJECT_TYPE_SAT),
+			TNOTI_SAT_PROACTIVE_IND, sizeof(struct tnoti_sat_proactive_ind), ind);
+
+	if (ind->cmd_type == SAT_PROATV_CMD_SELECT_ITEM)
+		_select_first_item(sb, modem);
+}
+
+static gboolean _run(struct stub_bus *sb, TcorePlugin *modem, const char *name,
+		const struct tnoti_sat_proactive_ind *ind, guint iterations)
+{
+	struct copy_count start;
+	struct copy_count end;
+	guint queued;
+	guint i;
+
+	for (i = 0; i < COPY_WARMUP; i++)
+		_cycle(sb, modem, ind);
+	_settle();
+
+	start = copies;
+	for (i = 0; i < iterations; i++)
+		_cycle(sb, modem, ind);
+	end = copies;
+	_settle();
+
+	printf("%-12s %8u cycles %6.2f copies >= %zu bytes/cycle (%8.0f bytes) %6.1f copies/cycle\n",
+			name, iterations,
+			(double)(end.large - start.large) / iterations, copy_min_bytes,
+			(double)(end.large_bytes - start.large_bytes) / iterations,
+			(double)(end.calls - start.calls) / iterations);
+
+	/* every cycle must have released its command again */
+	queued = sb->ctx->queue_sat ? sb->ctx->queue_sat->count : 0;
+	if (queued) {
+		fprintf(stderr, "%s: %u commands left in the queue\n", name, queued);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+int main(int argc, char *argv[])
+{
+	static struct tnoti_sat_proactive_ind menu_ind;
+	static struct tnoti_sat_proactive_ind select_ind;
+	struct tel_sat_setup_menu_tlv *menu = &menu_ind.proactive_ind_data.setup_menu;
+	struct tel_sat_select_item_tlv *select = &select_ind.proactive_ind_data.select_item;
+	struct stub_bus sb;
+	const char *modems[] = { COPY_MODEM };
+	TcorePlugin *modem;
+	GOptionContext *options;
+	GError *error = NULL;
+	gint iterations = 1000;
+	gint min_bytes = 1024;
+	gboolean verbose = FALSE;
+	gboolean ok;
+
+	GOptionEntry entries[] = {
+		{ "iterations", 'n', 0, G_OPTION_ARG_INT, &iterations, "Cycles per command (1000)", "N" },
+		{ "min-bytes", 'b', 0, G_OPTION_ARG_INT, &min_bytes, "Smallest copy counted as large (1024)", "BYTES" },
+		{ "verbose", 'v', 0, G_OPTION_ARG_NONE, &verbose, "Print the plugin log", NULL },
+		{ NULL }
+	};
+
+#if !GLIB_CHECK_VERSION(2,35,0)
+	g_type_init();
+#endif
+
+	options = g_option_context_new("- count large copies per SAT command cycle");
+	g_option_context_add_main_entries(options, entries, NULL);
+	if (!g_option_context_parse(options, &argc, &argv, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		return 2;
+	}
+	g_option_context_free(options);
+
+	stub_verbose = verbose;
+	copy_min_bytes = min_bytes > 0 ? (size_t)min_bytes : 1;
+	if (iterations <= 0)
+		iterations = 1;
+
+	memset(&menu_ind, 0, sizeof(struct tnoti_sat_proactive_ind));
+	menu_ind.cmd_type = SAT_PROATV_CMD_SETUP_MENU;
+	menu->command_detail.cmd_num = 1;
+	menu->command_detail.cmd_type = SAT_PROATV_CMD_SETUP_MENU;
+	menu->device_id.src = DEVICE_ID_SIM;
+	menu->device_id.dest = DEVICE_ID_ME;
+	COPY_FILL_ALPHA_ID(&menu->alpha_id, "SIM Toolkit");
+	menu->menu_item_cnt = MIN(COPY_MENU_ITEMS, (int)G_N_ELEMENTS(menu->menu_item));
+	COPY_FILL_MENU_ITEMS(menu->menu_item, menu->menu_item_cnt);
+
+	memset(&select_ind, 0, sizeof(struct tnoti_sat_proactive_ind));
+	select_ind.cmd_type = SAT_PROATV_CMD_SELECT_ITEM;
+	select->command_detail.cmd_num = 2;
+	select->command_detail.cmd_type = SAT_PROATV_CMD_SELECT_ITEM;
+	select->device_id.src = DEVICE_ID_SIM;
+	select->device_id.dest = DEVICE_ID_ME;
+	COPY_FILL_ALPHA_ID(&select->alpha_id, "Select");
+	select->item_identifier.item_identifier = 1;
+	select->menu_item_cnt = MIN(COPY_MENU_ITEMS, (int)G_N_ELEMENTS(select->menu_item));
+	COPY_FILL_MENU_ITEMS(select->menu_item, select->menu_item_cnt);
+
+	if (!stub_bus_up(&sb, modems, G_N_ELEMENTS(modems))) {
+		stub_bus_down(&sb);
+		return 1;
+	}
+
+	modem = tcore_server_find_plugin(sb.server, COPY_MODEM);
+
+	printf("proactive indication %zu bytes, queued command %zu bytes, terminal response %zu bytes\n",
+			sizeof(struct tnoti_sat_proactive_ind), sizeof(sat_manager_proactive_data),
+			sizeof(struct treq_sat_terminal_rsp_data));
+
+	ok = _run(&sb, modem, "setup-menu", &menu_ind, (guint)iterations)
+			&& _run(&sb, modem, "select-item", &select_ind, (guint)iterations);
+
+	stub_bus_down(&sb);
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Times the GSM 03.38 conversions of sat_util.c on 160 and 1000
+ * character strings, the old table scans (sat-gsm-old.c) against the
+ * direct lookup tables.
+ *
+ *   cmake -DBUILD_TESTS=ON . && make sat-gsm-bench
+ *   ./sat-gsm-bench -n 100000
+ *
+ * "text" is plain English, the common case; "national" mixes accented
+ * and Greek letters with extension characters ({, }, the euro sign),
+ * which the old code found only at the end of its scans.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+
+#include "stub.h"
+#include "common.h"
+#include "sat_gsm.h"
+#include "sat-gsm-old.h"
+
+#define BENCH_MAX_CHARS 1000
+
+static const char bench_text[] = "Your balance is 12.50 EUR. Reply HELP for the menu, STOP to end. ";
+
+static const unsigned short bench_national[] = {
+	0x00E9, 0x00E8, 0x00F1, 0x0394, 0x03A9, 0x00C5, 0x0020, 0x007B, 0x007D,
+	0x20AC, 0x00E4, 0x00F6, 0x00FC, 0x00DF, 0x0020, 0x005B, 0x005D, 0x007E,
+};
+
+struct bench_result {
+	double old_ns;
+	double new_ns;
+};
+
+static double _ns_per_string(gint64 start, gint64 end, guint iterations)
+{
+	return (double)(end - start) * 1000.0 / iterations;
+}
+
+static void _print(const char *input, int chars, const char *op, const struct bench_result *r)
+{
+	printf("%-9s %4d chars  %-12s  scan %9.1f ns/string %7.1f Mchar/s  table %8.1f ns/string %7.1f Mchar/s  %5.1fx\n",
+			input, chars, op,
+			r->old_ns, r->old_ns > 0 ? chars * 1000.0 / r->old_ns : 0,
+			r->new_ns, r->new_ns > 0 ? chars * 1000.0 / r->new_ns : 0,
+			r->new_ns > 0 ? r->old_ns / r->new_ns : 0);
+}
+
+static void _run(const char *input, const unsigned short *ucs2, int chars, guint iterations)
+{
+	static unsigned short src[BENCH_MAX_CHARS];
+	static unsigned char gsm[BENCH_MAX_CHARS * 2];
+	static unsigned short back[BENCH_MAX_CHARS * 2];
+	struct bench_result r;
+	volatile int sink = 0;
+	gint64 start;
+	int gsm_len;
+	guint n;
+
+	memcpy(src, ucs2, chars * sizeof(unsigned short));
+
+	gsm_len = sat_mgr_convert_ucs2_to_gsm(gsm, src, chars);
+	if (gsm_len <= 0) {
+		fprintf(stderr, "%s: not GSM 03.38 text\n", input);
+		return;
+	}
+
+	start = g_get_monotonic_time();
+	for (n = 0; n < iterations; n++)
+		sink += sat_gsm_old_get_gsm_code_size(src, chars);
+	r.old_ns = _ns_per_string(start, g_get_monotonic_time(), iterations);
+	start = g_get_monotonic_time();
+	for (n = 0; n < iterations; n++)
+		sink += sat_mgr_get_gsm_code_size(src, chars);
+	r.new_ns = _ns_per_string(start, g_get_monotonic_time(), iterations);
+	_print(input, chars, "code size", &r);
+
+	start = g_get_monotonic_time();
+	for (n = 0; n < iterations; n++)
+		sink += sat_gsm_old_ucs2_to_gsm(gsm, src, chars);
+	r.old_ns = _ns_per_string(start, g_get_monotonic_time(), iterations);
+	start = g_get_monotonic_time();
+	for (n = 0; n < iterations; n++)
+		sink += sat_mgr_convert_ucs2_to_gsm(gsm, src, chars);
+	r.new_ns = _ns_per_string(start, g_get_monotonic_time(), iterations);
+	_print(input, chars, "ucs2 to gsm", &r);
+
+	start = g_get_monotonic_time();
+	for (n = 0; n < iterations; n++)
+		sink += sat_gsm_old_gsm_to_ucs2(back, gsm, gsm_len);
+	r.old_ns = _ns_per_string(start, g_get_monotonic_time(), iterations);
+	start = g_get_monotonic_time();
+	for (n = 0; n < iterations; n++)
+		sink += sat_mgr_convert_gsm_to_ucs2(back, gsm, gsm_len);
+	r.new_ns = _ns_per_string(start, g_get_monotonic_time(), iterations);
+	_print(input, chars, "gsm to ucs2", &r);
+
+	(void)sink;
+}
+
+int main(int argc, char **argv)
+{
+	static unsigned short text[BENCH_MAX_CHARS];
+	static unsigned short national[BENCH_MAX_CHARS];
+	static const int lengths[] = { 160, 1000 };
+	GOptionContext *options;
+	GError *error = NULL;
+	gint iterations = 100000;
+	gboolean verbose = FALSE;
+	guint i;
+
+	GOptionEntry entries[] = {
+		{ "iterations", 'n', 0, G_OPTION_ARG_INT, &iterations, "Strings per measurement (100000)", "N" },
+		{ "verbose", 'v', 0, G_OPTION_ARG_NONE, &verbose, "Print the plugin log", NULL },
+		{ NULL }
+	};
+
+	options = g_option_context_new("- time SAT GSM 03.38 conversion");
+	g_option_context_add_main_entries(options, entries, NULL);
+	if (!g_option_context_parse(options, &argc, &argv, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		return 2;
+	}
+	g_option_context_free(options);
+
+	stub_verbose = verbose;
+	if (iterations <= 0)
+		iterations = 1;
+
+	for (i = 0; i < BENCH_MAX_CHARS; i++) {
+		text[i] = (unsigned char)bench_text[i % (sizeof(bench_text) - 1)];
+		national[i] = bench_national[i % G_N_ELEMENTS(bench_national)];
+	}
+
+	for (i = 0; i < G_N_ELEMENTS(lengths); i++) {
+		_run("text", text, lengths[i], (guint)iterations);
+		_run("national", national, lengths[i], (guint)iterations);
+	}
+
+	return 0;
+}
@@ -0,0 +1,221 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * sat_util.c before the GSM 03.38 direct lookup tables, unchanged apart
+ * from the names and the dropped logging.
+ */
+
+#include <glib.h>
+
+#include "sat-gsm-old.h"
+
+#define	tabGsmUniMax2 9
+#define	tabGsmUniMax 42
+
+typedef struct {
+	char gsm;
+	unsigned short unicode;
+} GsmUniTable;
+
+static const GsmUniTable gsm_unicode2_table[] = {
+		{ 0x14, 0x005E }, { 0x28, 0x007B }, { 0x29, 0x007D }, { 0x2F, 0x005C },
+		{ 0x3C, 0x005B }, { 0x3D, 0x007E }, { 0x3E, 0x005D }, { 0x40, 0x007C },
+		{ 0x65, 0x20AC } };
+
+static const GsmUniTable gsm_unicode_table[] = {
+		{ 0x00, 0x0040 }, { 0x01, 0x00A3 }, { 0x02, 0x0024 }, { 0x03, 0x00A5 },
+		{ 0x04, 0x00E8 }, { 0x05, 0x00E9 }, { 0x06, 0x00F9 }, { 0x07, 0x00EC }, { 0x08, 0x00F2 },
+		{ 0x09, 0x00E7 }, { 0x0B, 0x00D8 }, { 0x0C, 0x00F8 }, { 0x0E, 0x00C5 }, { 0x0F, 0x00E5 },
+		{ 0x10, 0x0394 }, { 0x11, 0x005F }, { 0x12, 0x03A6 }, { 0x13, 0x0393 }, { 0x14, 0x039B },
+		{ 0x15, 0x03A9 }, { 0x16, 0x03A0 }, { 0x17, 0x03A8 }, { 0x18, 0x03A3 }, { 0x19,	0x0398 },
+		{ 0x1A, 0x039E }, { 0x1C, 0x00C6 }, { 0x1D, 0x00E6 }, { 0x1E, 0x00DF }, { 0x1F, 0x00C9 },
+		{ 0x24, 0x00A4 }, { 0x40, 0x00A1 }, { 0x5B, 0x00C4 }, { 0x5C, 0x00D6 }, { 0x5D, 0x00D1 },
+		{ 0x5E, 0x00DC }, { 0x5F, 0x00A7 }, { 0x60, 0x00BF }, { 0x7B, 0x00E4 }, { 0x7C, 0x00F6 },
+		{ 0x7D, 0x00F1 }, { 0x7E, 0x00FC }, { 0x7F, 0x00E0 }, };
+
+static gboolean _find_gsm_code_exception_table(unsigned short src)
+{
+	if ((src >= 0x0020 && src <= 0x0023)
+			|| (src >= 0x0025 && src <= 0x003F)
+			|| (src >= 0x0041 && src <= 0x005A)
+			|| (src >= 0x0061 && src <= 0x007A)
+			|| src == 0x000A || src == 0x000D)
+		return TRUE;
+	return FALSE;
+}
+
+int sat_gsm_old_get_gsm_code_size(unsigned short* src, int src_len)
+{
+	gboolean in_table = FALSE;
+	gboolean in_sec_table = FALSE;
+	int i, gsm_len = 0;
+
+	if (NULL == src) {
+		return -1;
+	}
+
+	for (; src_len > 0 && src; src_len--) {
+		if (_find_gsm_code_exception_table(*src) == TRUE) {
+			src++;
+			gsm_len++;
+			continue;
+		}
+		in_table = FALSE;
+		for (i = 0; i < tabGsmUniMax; i++) {
+			if (*src == gsm_unicode_table[i].unicode) {
+				src++;
+				in_table = TRUE;
+				gsm_len++;
+				break;
+			}
+		}
+		if (in_table == FALSE) {
+			in_sec_table = FALSE;
+			for (i = 0; i < tabGsmUniMax2; i++) {/* second table */
+				if (*src == gsm_unicode2_table[i].unicode) {
+					src++;
+					in_table = TRUE;
+					in_sec_table = TRUE;
+					gsm_len += 2;
+					break;
+				}
+			}
+			if (in_sec_table == FALSE) {/* second*/
+				if (_find_gsm_code_exception_table(*src) == FALSE) {
+					return -1;
+				}
+				src++;
+				gsm_len++;
+			}
+		}
+	}
+	return gsm_len;
+}
+
+int sat_gsm_old_ucs2_to_gsm(unsigned char* dest, unsigned short* src, unsigned int src_len)
+{
+	unsigned char* rear = NULL;
+	unsigned short* p;
+	unsigned char temp;
+	gboolean in_table = FALSE;
+	gboolean in_sec_table = FALSE;
+	int i, gc_len = 0;
+
+	if ((!dest) || (!src) || (0x00 == src_len)) {
+		return -1;
+	}
+
+	rear = dest;
+	p = src;
+
+	for (; src_len > 0 && p; src_len--) {
+		in_table = FALSE;
+		for (i = 0; i < tabGsmUniMax; i++) { /* is in table  */
+			if (*p == gsm_unicode_table[i].unicode) {
+				temp = (unsigned char) (gsm_unicode_table[i].gsm);
+				*rear = temp;
+				rear++;
+				p++;
+				in_table = TRUE;
+				gc_len++;
+				break;
+			}
+		}
+		if (in_table == FALSE) {
+			in_sec_table = FALSE;
+			for (i = 0; i < tabGsmUniMax2; i++) { /* second table*/
+				if (*p == gsm_unicode2_table[i].unicode) {
+					*rear = 0x1B;
+					rear++;
+					temp = (unsigned char) (gsm_unicode2_table[i].gsm);
+					*rear = temp;
+					rear++;
+					p++;
+					in_table = TRUE;
+					in_sec_table = TRUE;
+					gc_len += 2;
+					break;
+				}
+			}
+			if (in_sec_table == FALSE) { /* second */
+				if (_find_gsm_code_exception_table(*p) == FALSE)
+					return -1;
+				temp = (unsigned char) (*p); /* isn't in table */
+				*rear = temp;
+				rear++;
+				p++;
+				gc_len++;
+			}
+		}
+	}
+	src = p;
+	return gc_len;
+}
+
+int sat_gsm_old_gsm_to_ucs2(unsigned short* dest, unsigned char* src, unsigned int src_len)
+{
+	int index;
+	unsigned short* org;
+
+	org = dest;
+
+	for(index=0; index < (int)src_len; index++){
+		int table_index=0;
+		gboolean b_tabled = FALSE;
+
+		/*
+		 * if the first byte is 0x1B, it is the escape character.
+		 * The byte value shoulbe be changed to unicode.
+		 */
+		if(*src == 0x1B){
+			src++; index++;//move to next byte
+			for(table_index=0; table_index < tabGsmUniMax2; table_index++){
+				if(*src == gsm_unicode2_table[table_index].gsm){
+					*dest = gsm_unicode2_table[table_index].unicode;
+					b_tabled = TRUE;
+					break;
+				}
+			}
+
+			//if matched data is not in table, it should be changed to NULL;
+			if(!b_tabled){
+				*dest = 0x0020;
+			}
+		}
+		else{
+			for(table_index=0; table_index < tabGsmUniMax; table_index++){
+				if(*src == gsm_unicode_table[table_index].gsm){
+					*dest = gsm_unicode_table[table_index].unicode;
+					b_tabled = TRUE;
+					break;
+				}
+			}
+
+			//if matched data is not in table, it is using original value;
+			if(!b_tabled){
+				*dest = *src;
+			}
+		}
+
+		//move to next position
+		src++; dest++;
+	}
+
+	return (dest - org);
+}
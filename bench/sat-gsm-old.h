@@ -0,0 +1,30 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SAT_GSM_OLD_H_
+#define SAT_GSM_OLD_H_
+
+/*
+ * The GSM 03.38 table scans sat_util.c used before the direct lookup
+ * tables, kept as the reference for test-sat-gsm and sat-gsm-bench.
+ */
+int sat_gsm_old_gsm_to_ucs2(unsigned short *dest, unsigned char *src, unsigned int src_len);
+int sat_gsm_old_ucs2_to_gsm(unsigned char *dest, unsigned short *src, unsigned int src_len);
+int sat_gsm_old_get_gsm_code_size(unsigned short *src, int src_len);
+
+#endif /* SAT_GSM_OLD_H_ */
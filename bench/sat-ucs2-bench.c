@@ -0,0 +1,171 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Times the SAT UCS2 to UTF-8 conversion per string, the iconv path the
+ * plugin used before against the table free encoder in sat_util.c.
+ *
+ *   cmake -DBUILD_TESTS=ON . && make sat-ucs2-bench
+ *   ./sat-ucs2-bench -n 200000
+ *
+ * The old path is reproduced as it was: iconv_open() per string, two
+ * malloc()ed copies to byte swap the input in place, iconv(), and
+ * iconv_close(). It swaps its input back and forth on every call, which
+ * costs the same either way.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <iconv.h>
+#include <glib.h>
+
+#include "stub.h"
+
+/* the encoder is static */
+#include "sat_util.c"
+
+#define BENCH_UNITS_MAX 240
+/* the old path reserves three output bytes per input byte */
+#define BENCH_OUT_MAX (BENCH_UNITS_MAX * 2 * 3 + 1)
+
+struct bench_input {
+	const char *name;
+	unsigned int unit;
+	int units;
+};
+
+static const struct bench_input bench_inputs[] = {
+	{ "ascii", 'A', 16 },
+	{ "ascii", 'A', 64 },
+	{ "ascii", 'A', 240 },
+	{ "hangul", 0xAC00, 16 },
+	{ "hangul", 0xAC00, 64 },
+	{ "hangul", 0xAC00, 240 },
+};
+
+/* sat_util.c before the iconv path was replaced */
+static int _old_convert_ucs2_to_utf8(char *out, unsigned short *out_len, char *in, unsigned short in_len)
+{
+	char *p_o = NULL;
+	size_t src_len = in_len;
+	size_t dest_len = in_len * 3;
+	short *dest = NULL;
+	short *src = NULL;
+	int i = 0;
+
+	iconv_t cd = iconv_open("UTF-8", "UCS2");
+	if (cd == (iconv_t) (-1)) {
+		perror("iconv_open");
+		return 0;
+	}
+
+	src = (short *)malloc(in_len);
+	memcpy(src, in, in_len);
+	dest = (short *)malloc(in_len);
+	memset(dest, 0, in_len);
+	for (i = 0; i < in_len / 2; i++)
+		dest[i] = ((src[i] << 8) + (src[i] >> 8));
+	memcpy(in, dest, in_len);
+	free(dest);
+	free(src);
+
+	p_o = out;
+
+	if (iconv(cd, &in, &src_len, &p_o, &dest_len) != (size_t)(-1))
+		out[in_len * 3 - dest_len] = '\0';
+	*out_len = in_len * 3 - dest_len;
+
+	iconv_close(cd);
+	return 0;
+}
+
+static double _ns_per_string(gint64 start, gint64 end, guint iterations)
+{
+	return (double)(end - start) * 1000.0 / iterations;
+}
+
+static void _run(const struct bench_input *input, guint iterations)
+{
+	unsigned char in[BENCH_UNITS_MAX * 2];
+	char out[BENCH_OUT_MAX];
+	unsigned short out_len = 0;
+	gint64 start;
+	double old_ns;
+	double new_ns;
+	int len = 0;
+	int i;
+	guint n;
+
+	for (i = 0; i < input->units; i++) {
+		in[i * 2] = input->unit >> 8;
+		in[i * 2 + 1] = input->unit & 0xFF;
+	}
+
+	start = g_get_monotonic_time();
+	for (n = 0; n < iterations; n++)
+		_old_convert_ucs2_to_utf8(out, &out_len, (char *)in, input->units * 2);
+	old_ns = _ns_per_string(start, g_get_monotonic_time(), iterations);
+
+	/* the old path leaves the input swapped every other call */
+	for (i = 0; i < input->units; i++) {
+		in[i * 2] = input->unit >> 8;
+		in[i * 2 + 1] = input->unit & 0xFF;
+	}
+
+	start = g_get_monotonic_time();
+	for (n = 0; n < iterations; n++)
+		len = _convert_ucs2_to_utf8(out, sizeof(out), in, input->units, G_BIG_ENDIAN);
+	new_ns = _ns_per_string(start, g_get_monotonic_time(), iterations);
+
+	printf("%-8s %4d units %5d bytes  iconv %9.1f ns/string  direct %8.1f ns/string  %6.1fx\n",
+			input->name, input->units, len, old_ns, new_ns, new_ns > 0 ? old_ns / new_ns : 0);
+}
+
+int main(int argc, char **argv)
+{
+	GOptionContext *options;
+	GError *error = NULL;
+	gint iterations = 200000;
+	gboolean verbose = FALSE;
+	guint i;
+
+	GOptionEntry entries[] = {
+		{ "iterations", 'n', 0, G_OPTION_ARG_INT, &iterations, "Strings per input (200000)", "N" },
+		{ "verbose", 'v', 0, G_OPTION_ARG_NONE, &verbose, "Print the plugin log", NULL },
+		{ NULL }
+	};
+
+	options = g_option_context_new("- time SAT UCS2 to UTF-8 conversion");
+	g_option_context_add_main_entries(options, entries, NULL);
+	if (!g_option_context_parse(options, &argc, &argv, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		return 2;
+	}
+	g_option_context_free(options);
+
+	stub_verbose = verbose;
+	if (iterations <= 0)
+		iterations = 1;
+
+	for (i = 0; i < G_N_ELEMENTS(bench_inputs); i++)
+		_run(&bench_inputs[i], (guint)iterations);
+
+	return 0;
+}
@@ -0,0 +1,207 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Brings the plugin up on a private dbus-daemon: the plugin owns its name
+ * on what it believes is the system bus, the bench talks to it through a
+ * second connection. Everything runs on the default main context.
+ * stub_bus_up() starts its own daemon, stub_bus_up_at() joins one that
+ * runs elsewhere and is left alone by stub_bus_down().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include <gio/gio.h>
+
+#include "stub.h"
+#include "common.h"
+
+#define STUB_BUS_TIMEOUT_MS 10000
+
+struct stub_bus_call_result {
+	gboolean done;
+	GVariant *result;
+	GError *error;
+};
+
+static void _name_appeared(GDBusConnection *conn, const gchar *name, const gchar *owner, gpointer user_data)
+{
+	*(gboolean *)user_data = TRUE;
+}
+
+static gboolean _timeout(gpointer user_data)
+{
+	*(gboolean *)user_data = TRUE;
+
+	return FALSE;
+}
+
+static gboolean _stub_bus_attach(struct stub_bus *sb, const gchar *address, const char **modems, guint modem_count)
+{
+	GDBusConnection *system;
+	Communicator *comm;
+	GError *error = NULL;
+	gboolean owned = FALSE;
+	gboolean expired = FALSE;
+	guint watch;
+	guint timer;
+	guint i;
+
+	/* the plugin asks for G_BUS_TYPE_SYSTEM */
+	g_setenv("DBUS_SYSTEM_BUS_ADDRESS", address, TRUE);
+
+	/* and must not take the process down with the daemon in stub_bus_down() */
+	system = g_bus_get_sync(G_BUS_TYPE_SYSTEM, NULL, &error);
+	if (!system) {
+		fprintf(stderr, "system bus: %s\n", error->message);
+		g_error_free(error);
+		return FALSE;
+	}
+	g_dbus_connection_set_exit_on_close(system, FALSE);
+	g_object_unref(system);
+
+	sb->server = stub_server_new();
+	sb->dbus_plugin = stub_plugin_new(sb->server, "dbus", FALSE);
+	for (i = 0; i < modem_count; i++)
+		stub_plugin_new(sb->server, modems[i], TRUE);
+
+	if (!plugin_define_desc.init(sb->dbus_plugin)) {
+		fprintf(stderr, "plugin init failed\n");
+		return FALSE;
+	}
+
+	comm = tcore_server_find_communicator(sb->server, "dbus");
+	sb->ctx = tcore_communicator_ref_user_data(comm);
+
+	sb->client = g_dbus_connection_new_for_address_sync(address,
+			G_DBUS_CONNECTION_FLAGS_AUTHENTICATION_CLIENT | G_DBUS_CONNECTION_FLAGS_MESSAGE_BUS_CONNECTION,
+			NULL, NULL, &error);
+	if (!sb->client) {
+		fprintf(stderr, "client connection: %s\n", error->message);
+		g_error_free(error);
+		return FALSE;
+	}
+	g_dbus_connection_set_exit_on_close(sb->client, FALSE);
+
+	watch = g_bus_watch_name_on_connection(sb->client, MY_DBUS_SERVICE, G_BUS_NAME_WATCHER_FLAGS_NONE,
+			_name_appeared, NULL, &owned, NULL);
+	timer = g_timeout_add(STUB_BUS_TIMEOUT_MS, _timeout, &expired);
+
+	while (!expired && !(owned && sb->ctx->manager))
+		g_main_context_iteration(NULL, TRUE);
+
+	g_bus_unwatch_name(watch);
+	if (expired) {
+		fprintf(stderr, "%s did not show up on the bus\n", MY_DBUS_SERVICE);
+		return FALSE;
+	}
+	g_source_remove(timer);
+
+	return TRUE;
+}
+
+gboolean stub_bus_up(struct stub_bus *sb, const char **modems, guint modem_count)
+{
+	const gchar *address;
+
+	memset(sb, 0, sizeof(struct stub_bus));
+
+	sb->bus = g_test_dbus_new(G_TEST_DBUS_NONE);
+	g_test_dbus_up(sb->bus);
+	address = g_test_dbus_get_bus_address(sb->bus);
+	if (!address) {
+		fprintf(stderr, "no private dbus-daemon\n");
+		return FALSE;
+	}
+
+	return _stub_bus_attach(sb, address, modems, modem_count);
+}
+
+gboolean stub_bus_up_at(struct stub_bus *sb, const char *address, const char **modems, guint modem_count)
+{
+	memset(sb, 0, sizeof(struct stub_bus));
+
+	return _stub_bus_attach(sb, address, modems, modem_count);
+}
+
+void stub_bus_down(struct stub_bus *sb)
+{
+	if (sb->client) {
+		g_dbus_connection_close_sync(sb->client, NULL, NULL);
+		g_object_unref(sb->client);
+	}
+
+	if (sb->dbus_plugin && sb->ctx)
+		plugin_define_desc.unload(sb->dbus_plugin);
+
+	stub_server_free(sb->server);
+
+	if (sb->bus) {
+		g_test_dbus_down(sb->bus);
+		g_object_unref(sb->bus);
+	}
+
+	memset(sb, 0, sizeof(struct stub_bus));
+}
+
+TcorePlugin *stub_bus_add_modem(struct stub_bus *sb, const char *name)
+{
+	TcorePlugin *p;
+
+	p = stub_plugin_new(sb->server, name, TRUE);
+
+	/* a server wide notification makes the plugin look for new modems */
+	stub_server_notify(sb->server, NULL, TNOTI_SERVER_RUN, 0, NULL);
+
+	return p;
+}
+
+gchar *stub_bus_modem_path(const char *name)
+{
+	return g_strdup_printf("%s/%s", MY_DBUS_PATH, name);
+}
+
+static void _call_done(GObject *source, GAsyncResult *res, gpointer user_data)
+{
+	struct stub_bus_call_result *r = user_data;
+
+	r->result = g_dbus_connection_call_finish(G_DBUS_CONNECTION(source), res, &r->error);
+	r->done = TRUE;
+}
+
+GVariant *stub_bus_call(struct stub_bus *sb, const char *path, const char *interface,
+		const char *method, GVariant *parameters, GError **error)
+{
+	struct stub_bus_call_result r;
+
+	memset(&r, 0, sizeof(struct stub_bus_call_result));
+
+	/* async, the plugin answers from this same main context */
+	g_dbus_connection_call(sb->client, MY_DBUS_SERVICE, path, interface, method, parameters,
+			NULL, G_DBUS_CALL_FLAGS_NONE, -1, NULL, _call_done, &r);
+
+	while (!r.done)
+		g_main_context_iteration(NULL, TRUE);
+
+	if (r.error)
+		g_propagate_error(error, r.error);
+
+	return r.result;
+}
@@ -0,0 +1,219 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Everything else the plugin links against on the target: dlog, the
+ * application launchers and sat_ui_support.c (which shells out to write
+ * desktop files). UI launches are only counted. Also interposes the
+ * allocator so benchmarks can report heap calls per operation.
+ */
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include <glib.h>
+
+#include <dlog.h>
+#include <aul.h>
+#include <appsvc.h>
+#include <bundle.h>
+
+#include "stub.h"
+#include "sat_ui_support.h"
+
+gboolean stub_verbose;
+
+static int stub_bundle;
+
+/* dlog */
+
+int __dlog_vprint(log_id_t log_id, int prio, const char *tag, const char *fmt, va_list ap)
+{
+	if (!stub_verbose)
+		return 0;
+
+	fprintf(stderr, "[%s] ", tag ? tag : "");
+	return vfprintf(stderr, fmt, ap);
+}
+
+int __dlog_print(log_id_t log_id, int prio, const char *tag, const char *fmt, ...)
+{
+	va_list ap;
+	int ret;
+
+	if (!stub_verbose)
+		return 0;
+
+	va_start(ap, fmt);
+	ret = __dlog_vprint(log_id, prio, tag, fmt, ap);
+	va_end(ap);
+
+	return ret;
+}
+
+/* aul / appsvc / bundle */
+
+bundle *bundle_create(void)
+{
+	return (bundle *)&stub_bundle;
+}
+
+int bundle_free(bundle *b)
+{
+	return 0;
+}
+
+int bundle_add(bundle *b, const char *key, const char *val)
+{
+	return 0;
+}
+
+int aul_launch_app(const char *appid, bundle *kb)
+{
+	stub_counters.ui_launches++;
+
+	return 0;
+}
+
+int appsvc_set_operation(bundle *b, const char *operation)
+{
+	return 0;
+}
+
+int appsvc_set_uri(bundle *b, const char *uri)
+{
+	return 0;
+}
+
+int appsvc_add_data(bundle *b, const char *key, const char *val)
+{
+	return 0;
+}
+
+int appsvc_run_service(bundle *b, int request_code, appsvc_res_fn cbfunc, void *data)
+{
+	stub_counters.ui_launches++;
+
+	return 0;
+}
+
+/* sat_ui_support */
+
+gboolean sat_ui_support_terminate_sat_ui(void)
+{
+	return TRUE;
+}
+
+gboolean sat_ui_support_launch_call_application(enum tel_sat_proactive_cmd_type cmd_type, GVariant *data)
+{
+	stub_counters.ui_launches++;
+
+	return TRUE;
+}
+
+gboolean sat_ui_support_launch_browser_application(enum tel_sat_proactive_cmd_type cmd_type, GVariant *data)
+{
+	stub_counters.ui_launches++;
+
+	return TRUE;
+}
+
+gboolean sat_ui_support_launch_setting_application(enum tel_sat_proactive_cmd_type cmd_type, GVariant *data)
+{
+	stub_counters.ui_launches++;
+
+	return TRUE;
+}
+
+gboolean sat_ui_support_launch_sat_ui(enum tel_sat_proactive_cmd_type cmd_type, GVariant *data)
+{
+	stub_counters.ui_launches++;
+
+	return TRUE;
+}
+
+gboolean sat_ui_support_create_desktop_file(const gchar *title)
+{
+	return TRUE;
+}
+
+gboolean sat_ui_support_remove_desktop_file(void)
+{
+	return TRUE;
+}
+
+/* allocator */
+
+#ifdef __GLIBC__
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+/* per thread, so the GDBus worker does not show up in main loop numbers */
+static __thread unsigned long stub_allocs;
+static __thread unsigned long stub_frees;
+
+void *malloc(size_t size)
+{
+	stub_allocs++;
+	return __libc_malloc(size);
+}
+
+void *calloc(size_t nmemb, size_t size)
+{
+	stub_allocs++;
+	return __libc_calloc(nmemb, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+	if (!ptr)
+		stub_allocs++;
+	return __libc_realloc(ptr, size);
+}
+
+void free(void *ptr)
+{
+	if (ptr)
+		stub_frees++;
+	__libc_free(ptr);
+}
+
+gboolean stub_alloc_counting(void)
+{
+	return TRUE;
+}
+
+void stub_alloc_snapshot(struct stub_alloc_count *count)
+{
+	count->allocs = stub_allocs;
+	count->frees = stub_frees;
+}
+#else
+gboolean stub_alloc_counting(void)
+{
+	return FALSE;
+}
+
+void stub_alloc_snapshot(struct stub_alloc_count *count)
+{
+	memset(count, 0, sizeof(struct stub_alloc_count));
+}
+#endif
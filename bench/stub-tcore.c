@@ -0,0 +1,756 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * The libtcore subset the plugin links against. Prototypes come from the
+ * real headers; the objects behind the opaque handles are private to this
+ * file. Ownership follows tcore: a dispatched request belongs to the
+ * stub until it is answered or dropped, and the free hook runs when the
+ * last reference goes away.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <glib.h>
+
+#include <tcore.h>
+#include <server.h>
+#include <plugin.h>
+#include <hal.h>
+#include <communicator.h>
+#include <storage.h>
+#include <core_object.h>
+#include <user_request.h>
+#include <co_call.h>
+#include <co_network.h>
+#include <co_sim.h>
+#include <co_sms.h>
+#include <co_phonebook.h>
+#include <util.h>
+
+#include "stub.h"
+
+#define STUB_CALL_NUMBER_LEN 83
+
+struct stub_hook {
+	enum tcore_notification_command command;
+	TcoreServerNotificationHook func;
+	void *user_data;
+};
+
+struct stub_server {
+	GSList *plugins;
+	GSList *communicators;
+	GSList *hooks;
+	stub_request_cb request_cb;
+	void *request_data;
+};
+
+struct stub_plugin {
+	struct stub_server *server;
+	struct tcore_plugin_define_desc desc;
+	char *name;
+	GSList *objects;
+};
+
+struct stub_object {
+	unsigned int type;
+	struct stub_plugin *plugin;
+	gboolean hal;
+	GSList *calls;
+};
+
+struct stub_call {
+	int id;
+	enum tcore_call_type type;
+	enum tcore_call_direction direction;
+	enum tcore_call_status status;
+	gboolean multiparty;
+	char number[STUB_CALL_NUMBER_LEN];
+};
+
+struct stub_communicator {
+	struct stub_plugin *plugin;
+	char *name;
+	struct tcore_communitor_operations *ops;
+	void *user_data;
+};
+
+struct stub_user_request {
+	int ref;
+	struct stub_communicator *comm;
+	char *modem_name;
+	struct tcore_user_info ui;
+	UserRequestFreeHook free_hook;
+	enum tcore_request_command command;
+	void *data;
+	unsigned int data_len;
+};
+
+struct stub_response {
+	UserRequest *ur;
+	enum tcore_response_command command;
+	unsigned int data_len;
+	void *data;
+};
+
+static const unsigned int stub_object_types[] = {
+	CORE_OBJECT_TYPE_MODEM,
+	CORE_OBJECT_TYPE_CALL,
+	CORE_OBJECT_TYPE_NETWORK,
+	CORE_OBJECT_TYPE_SS,
+	CORE_OBJECT_TYPE_SMS,
+	CORE_OBJECT_TYPE_SAT,
+	CORE_OBJECT_TYPE_PHONEBOOK,
+	CORE_OBJECT_TYPE_SAP,
+	CORE_OBJECT_TYPE_SIM,
+	CORE_OBJECT_TYPE_PS,
+};
+
+struct stub_counters stub_counters;
+
+static struct tel_sim_imsi stub_imsi;
+static struct tel_phonebook_support_list stub_pb_support;
+static int stub_storage;
+
+/* Server */
+
+Server *stub_server_new(void)
+{
+	return (Server *)g_new0(struct stub_server, 1);
+}
+
+static void _stub_object_free(gpointer data)
+{
+	struct stub_object *o = data;
+
+	g_slist_free_full(o->calls, g_free);
+	g_free(o);
+}
+
+static void _stub_plugin_free(gpointer data)
+{
+	struct stub_plugin *p = data;
+
+	g_slist_free_full(p->objects, _stub_object_free);
+	g_free(p->name);
+	g_free(p);
+}
+
+static void _stub_communicator_free(gpointer data)
+{
+	struct stub_communicator *comm = data;
+
+	g_free(comm->name);
+	g_free(comm);
+}
+
+void stub_server_free(Server *s)
+{
+	struct stub_server *server = (struct stub_server *)s;
+
+	if (!server)
+		return;
+
+	g_slist_free_full(server->communicators, _stub_communicator_free);
+	g_slist_free_full(server->plugins, _stub_plugin_free);
+	g_slist_free_full(server->hooks, g_free);
+	g_free(server);
+}
+
+void stub_server_set_request_handler(Server *s, stub_request_cb cb, void *user_data)
+{
+	struct stub_server *server = (struct stub_server *)s;
+
+	server->request_cb = cb;
+	server->request_data = user_data;
+}
+
+void stub_server_notify(Server *s, CoreObject *source, enum tcore_notification_command command,
+		unsigned int data_len, const void *data)
+{
+	struct stub_server *server = (struct stub_server *)s;
+	struct stub_communicator *comm;
+	struct stub_hook *hook;
+	GSList *l;
+
+	stub_counters.notified++;
+
+	for (l = server->hooks; l; l = l->next) {
+		hook = l->data;
+		if (hook->command != command)
+			continue;
+
+		if (hook->func(s, source, command, data_len, (void *)data, hook->user_data) != TCORE_HOOK_RETURN_CONTINUE)
+			return;
+	}
+
+	for (l = server->communicators; l; l = l->next) {
+		comm = l->data;
+		if (comm->ops && comm->ops->send_notification)
+			comm->ops->send_notification((Communicator *)comm, source, command, data_len, data);
+	}
+}
+
+GSList *tcore_server_ref_plugins(Server *s)
+{
+	return ((struct stub_server *)s)->plugins;
+}
+
+TcorePlugin *tcore_server_find_plugin(Server *s, const char *name)
+{
+	struct stub_server *server = (struct stub_server *)s;
+	struct stub_plugin *p;
+	struct stub_plugin *modem = NULL;
+	GSList *l;
+
+	for (l = server->plugins; l; l = l->next) {
+		p = l->data;
+		if (name && !g_strcmp0(p->name, name))
+			return (TcorePlugin *)p;
+
+		if (!modem && p->objects)
+			modem = p;
+	}
+
+	/* TCORE_PLUGIN_DEFAULT and other unknown names: the first modem */
+	return (TcorePlugin *)modem;
+}
+
+Communicator *tcore_server_find_communicator(Server *s, const char *name)
+{
+	struct stub_server *server = (struct stub_server *)s;
+	struct stub_communicator *comm;
+	GSList *l;
+
+	for (l = server->communicators; l; l = l->next) {
+		comm = l->data;
+		if (!g_strcmp0(comm->name, name))
+			return (Communicator *)comm;
+	}
+
+	return NULL;
+}
+
+Storage *tcore_server_find_storage(Server *s, const char *name)
+{
+	return (Storage *)&stub_storage;
+}
+
+TReturn tcore_server_add_notification_hook(Server *s, enum tcore_notification_command command,
+		TcoreServerNotificationHook hook, void *user_data)
+{
+	struct stub_server *server = (struct stub_server *)s;
+	struct stub_hook *h;
+
+	h = g_new0(struct stub_hook, 1);
+	h->command = command;
+	h->func = hook;
+	h->user_data = user_data;
+	server->hooks = g_slist_append(server->hooks, h);
+
+	return TCORE_RETURN_SUCCESS;
+}
+
+void *tcore_storage_create_handle(Storage *strg, const char *path)
+{
+	return NULL;
+}
+
+gboolean tcore_storage_set_bool(Storage *strg, enum tcore_storage_key key, gboolean value)
+{
+	return TRUE;
+}
+
+/* Plugin / CoreObject */
+
+TcorePlugin *stub_plugin_new(Server *s, const char *name, gboolean modem)
+{
+	struct stub_server *server = (struct stub_server *)s;
+	struct stub_plugin *p;
+	struct stub_object *o;
+	unsigned int i;
+
+	p = g_new0(struct stub_plugin, 1);
+	p->server = server;
+	p->name = g_strdup(name);
+	p->desc.name = p->name;
+
+	for (i = 0; modem && i < G_N_ELEMENTS(stub_object_types); i++) {
+		o = g_new0(struct stub_object, 1);
+		o->type = stub_object_types[i];
+		o->plugin = p;
+		o->hal = TRUE;
+		p->objects = g_slist_append(p->objects, o);
+	}
+
+	server->plugins = g_slist_append(server->plugins, p);
+
+	return (TcorePlugin *)p;
+}
+
+CoreObject *stub_plugin_ref_object(TcorePlugin *plugin, unsigned int type)
+{
+	struct stub_plugin *p = (struct stub_plugin *)plugin;
+	struct stub_object *o;
+	GSList *l;
+
+	for (l = p ? p->objects : NULL; l; l = l->next) {
+		o = l->data;
+		if (o->type == type)
+			return (CoreObject *)o;
+	}
+
+	return NULL;
+}
+
+const struct tcore_plugin_define_desc *tcore_plugin_get_description(TcorePlugin *plugin)
+{
+	return &((struct stub_plugin *)plugin)->desc;
+}
+
+char *tcore_plugin_ref_plugin_name(TcorePlugin *plugin)
+{
+	return plugin ? ((struct stub_plugin *)plugin)->name : NULL;
+}
+
+Server *tcore_plugin_ref_server(TcorePlugin *plugin)
+{
+	return plugin ? (Server *)((struct stub_plugin *)plugin)->server : NULL;
+}
+
+GSList *tcore_plugin_get_core_objects_bytype(TcorePlugin *plugin, unsigned int type)
+{
+	CoreObject *o = stub_plugin_ref_object(plugin, type);
+
+	return o ? g_slist_append(NULL, o) : NULL;
+}
+
+TcorePlugin *tcore_object_ref_plugin(CoreObject *co)
+{
+	return co ? (TcorePlugin *)((struct stub_object *)co)->plugin : NULL;
+}
+
+TcoreHal *tcore_object_get_hal(CoreObject *co)
+{
+	/* any non-NULL handle marks a real modem, nothing dereferences it */
+	return (co && ((struct stub_object *)co)->hal) ? (TcoreHal *)co : NULL;
+}
+
+/* Communicator */
+
+Communicator *tcore_communicator_new(TcorePlugin *plugin, const char *name, struct tcore_communitor_operations *ops)
+{
+	struct stub_plugin *p = (struct stub_plugin *)plugin;
+	struct stub_communicator *comm;
+
+	comm = g_new0(struct stub_communicator, 1);
+	comm->plugin = p;
+	comm->name = g_strdup(name);
+	comm->ops = ops;
+	p->server->communicators = g_slist_append(p->server->communicators, comm);
+
+	return (Communicator *)comm;
+}
+
+void *tcore_communicator_ref_user_data(Communicator *comm)
+{
+	return comm ? ((struct stub_communicator *)comm)->user_data : NULL;
+}
+
+TReturn tcore_communicator_link_user_data(Communicator *comm, void *data)
+{
+	((struct stub_communicator *)comm)->user_data = data;
+
+	return TCORE_RETURN_SUCCESS;
+}
+
+TReturn tcore_communicator_dispatch_request(Communicator *comm, UserRequest *ur)
+{
+	struct stub_communicator *c = (struct stub_communicator *)comm;
+	struct stub_user_request *r = (struct stub_user_request *)ur;
+	struct stub_server *server;
+
+	if (!c || !r)
+		return TCORE_RETURN_EINVAL;
+
+	stub_counters.dispatched++;
+	server = c->plugin->server;
+
+	if (!server->request_cb) {
+		/* nobody home: the request goes away unanswered */
+		stub_counters.dropped++;
+		tcore_user_request_unref(ur);
+		return TCORE_RETURN_SUCCESS;
+	}
+
+	return server->request_cb(ur, r->command, r->data, r->data_len, server->request_data);
+}
+
+/* UserRequest */
+
+UserRequest *tcore_user_request_new(Communicator *comm, const char *modem_name)
+{
+	struct stub_user_request *r;
+
+	r = g_new0(struct stub_user_request, 1);
+	r->ref = 1;
+	r->comm = (struct stub_communicator *)comm;
+	r->modem_name = g_strdup(modem_name);
+	stub_counters.ur_new++;
+
+	return (UserRequest *)r;
+}
+
+void tcore_user_request_unref(UserRequest *ur)
+{
+	struct stub_user_request *r = (struct stub_user_request *)ur;
+
+	if (!r)
+		return;
+
+	if (--r->ref > 0)
+		return;
+
+	if (r->free_hook)
+		r->free_hook(ur);
+
+	stub_counters.ur_free++;
+	g_free(r->modem_name);
+	g_free(r->data);
+	g_free(r);
+}
+
+TReturn tcore_user_request_set_free_hook(UserRequest *ur, UserRequestFreeHook free_hook)
+{
+	((struct stub_user_request *)ur)->free_hook = free_hook;
+
+	return TCORE_RETURN_SUCCESS;
+}
+
+Communicator *tcore_user_request_ref_communicator(UserRequest *ur)
+{
+	return ur ? (Communicator *)((struct stub_user_request *)ur)->comm : NULL;
+}
+
+char *tcore_user_request_get_modem_name(UserRequest *ur)
+{
+	struct stub_user_request *r = (struct stub_user_request *)ur;
+
+	/* caller frees, as with tcore */
+	return (r && r->modem_name) ? strdup(r->modem_name) : NULL;
+}
+
+TReturn tcore_user_request_set_user_info(UserRequest *ur, const struct tcore_user_info *ui)
+{
+	((struct stub_user_request *)ur)->ui = *ui;
+
+	return TCORE_RETURN_SUCCESS;
+}
+
+const struct tcore_user_info *tcore_user_request_ref_user_info(UserRequest *ur)
+{
+	return ur ? &((struct stub_user_request *)ur)->ui : NULL;
+}
+
+TReturn tcore_user_request_set_data(UserRequest *ur, unsigned int data_len, const void *data)
+{
+	struct stub_user_request *r = (struct stub_user_request *)ur;
+
+	g_free(r->data);
+	r->data = (data && data_len) ? g_memdup(data, data_len) : NULL;
+	r->data_len = r->data ? data_len : 0;
+
+	return TCORE_RETURN_SUCCESS;
+}
+
+const void *tcore_user_request_ref_data(UserRequest *ur, unsigned int *data_len)
+{
+	struct stub_user_request *r = (struct stub_user_request *)ur;
+
+	if (data_len)
+		*data_len = r->data_len;
+
+	return r->data;
+}
+
+TReturn tcore_user_request_set_command(UserRequest *ur, enum tcore_request_command command)
+{
+	((struct stub_user_request *)ur)->command = command;
+
+	return TCORE_RETURN_SUCCESS;
+}
+
+enum tcore_request_command tcore_user_request_get_command(UserRequest *ur)
+{
+	return ((struct stub_user_request *)ur)->command;
+}
+
+void stub_user_request_respond(UserRequest *ur, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	struct stub_user_request *r = (struct stub_user_request *)ur;
+
+	stub_counters.responded++;
+
+	if (r->comm && r->comm->ops && r->comm->ops->send_response)
+		r->comm->ops->send_response((Communicator *)r->comm, ur, command, data_len, data);
+
+	tcore_user_request_unref(ur);
+}
+
+static gboolean _stub_response_cb(gpointer user_data)
+{
+	struct stub_response *resp = user_data;
+
+	stub_user_request_respond(resp->ur, resp->command, resp->data_len, resp->data);
+
+	g_free(resp->data);
+	g_free(resp);
+
+	return FALSE;
+}
+
+void stub_user_request_respond_later(UserRequest *ur, guint delay_ms,
+		enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct stub_response *resp;
+
+	resp = g_new0(struct stub_response, 1);
+	resp->ur = ur;
+	resp->command = command;
+	resp->data_len = data_len;
+	resp->data = data_len ? g_memdup(data, data_len) : NULL;
+
+	if (delay_ms)
+		g_timeout_add(delay_ms, _stub_response_cb, resp);
+	else
+		g_idle_add(_stub_response_cb, resp);
+}
+
+/* CallObject */
+
+CallObject *stub_call_new(CoreObject *o, int id, enum tcore_call_type type,
+		enum tcore_call_direction direction, enum tcore_call_status status, const char *number)
+{
+	struct stub_object *obj = (struct stub_object *)o;
+	struct stub_call *call;
+
+	call = g_new0(struct stub_call, 1);
+	call->id = id;
+	call->type = type;
+	call->direction = direction;
+	call->status = status;
+	g_strlcpy(call->number, number ? number : "", STUB_CALL_NUMBER_LEN);
+	obj->calls = g_slist_append(obj->calls, call);
+
+	return (CallObject *)call;
+}
+
+void stub_call_set_status(CallObject *co, enum tcore_call_status status)
+{
+	((struct stub_call *)co)->status = status;
+}
+
+void stub_call_set_multiparty(CallObject *co, gboolean multiparty)
+{
+	((struct stub_call *)co)->multiparty = multiparty;
+}
+
+void stub_call_free(CoreObject *o, CallObject *co)
+{
+	struct stub_object *obj = (struct stub_object *)o;
+
+	obj->calls = g_slist_remove(obj->calls, co);
+	g_free(co);
+}
+
+GSList *stub_call_list(CoreObject *o)
+{
+	return ((struct stub_object *)o)->calls;
+}
+
+CallObject *tcore_call_object_find_by_id(CoreObject *o, int id)
+{
+	struct stub_call *call;
+	GSList *l;
+
+	for (l = o ? ((struct stub_object *)o)->calls : NULL; l; l = l->next) {
+		call = l->data;
+		if (call->id == id)
+			return (CallObject *)call;
+	}
+
+	return NULL;
+}
+
+GSList *tcore_call_object_find_by_status(CoreObject *o, enum tcore_call_status cs)
+{
+	struct stub_call *call;
+	GSList *list = NULL;
+	GSList *l;
+
+	for (l = o ? ((struct stub_object *)o)->calls : NULL; l; l = l->next) {
+		call = l->data;
+		if (call->status == cs)
+			list = g_slist_append(list, call);
+	}
+
+	return list;
+}
+
+int tcore_call_object_get_id(CallObject *co)
+{
+	return ((struct stub_call *)co)->id;
+}
+
+enum tcore_call_type tcore_call_object_get_type(CallObject *co)
+{
+	return ((struct stub_call *)co)->type;
+}
+
+enum tcore_call_direction tcore_call_object_get_direction(CallObject *co)
+{
+	return ((struct stub_call *)co)->direction;
+}
+
+enum tcore_call_status tcore_call_object_get_status(CallObject *co)
+{
+	return ((struct stub_call *)co)->status;
+}
+
+int tcore_call_object_get_number(CallObject *co, char *num)
+{
+	struct stub_call *call = (struct stub_call *)co;
+	int len;
+
+	len = strlen(call->number);
+	memcpy(num, call->number, len);
+
+	return len;
+}
+
+gboolean tcore_call_object_get_multiparty_state(CallObject *co)
+{
+	return ((struct stub_call *)co)->multiparty;
+}
+
+/* Network / SIM / SMS / Phonebook getters, only answered with defaults */
+
+char *tcore_network_get_network_name(CoreObject *co, enum tcore_network_name_type type)
+{
+	return NULL;
+}
+
+TReturn tcore_network_get_network_name_priority(CoreObject *co, enum tcore_network_name_priority *priority)
+{
+	memset(priority, 0, sizeof(*priority));
+
+	return TCORE_RETURN_SUCCESS;
+}
+
+TReturn tcore_network_get_service_type(CoreObject *co, enum telephony_network_service_type *service_type)
+{
+	*service_type = NETWORK_SERVICE_TYPE_UNKNOWN;
+
+	return TCORE_RETURN_SUCCESS;
+}
+
+struct tcore_network_operator_info *tcore_network_operator_info_find(CoreObject *co, const char *mcc, const char *mnc)
+{
+	return NULL;
+}
+
+enum tel_sim_type tcore_sim_get_type(CoreObject *o)
+{
+	return SIM_TYPE_UNKNOWN;
+}
+
+struct tel_sim_imsi *tcore_sim_get_imsi(CoreObject *o)
+{
+	return &stub_imsi;
+}
+
+enum tel_sim_status tcore_sim_get_status(CoreObject *o)
+{
+	return SIM_STATUS_INITIALIZING;
+}
+
+gboolean tcore_sim_get_identification(CoreObject *o)
+{
+	return FALSE;
+}
+
+gboolean tcore_sms_get_ready_status(CoreObject *o)
+{
+	return TRUE;
+}
+
+gboolean tcore_phonebook_get_status(CoreObject *o)
+{
+	return TRUE;
+}
+
+struct tel_phonebook_support_list *tcore_phonebook_get_support_list(CoreObject *o)
+{
+	return &stub_pb_support;
+}
+
+/* GSM 03.38 septet packing, the caller frees the result */
+
+unsigned char *tcore_util_pack_gsm7bit(const unsigned char *src, unsigned int src_len)
+{
+	unsigned char *dest;
+	unsigned int i;
+	unsigned int bit;
+
+	dest = calloc((src_len * 7 + 7) / 8 + 1, 1);
+	if (!dest)
+		return NULL;
+
+	for (i = 0, bit = 0; i < src_len; i++, bit += 7) {
+		dest[bit / 8] |= (unsigned char)((src[i] & 0x7F) << (bit % 8));
+		if (bit % 8 > 1)
+			dest[bit / 8 + 1] |= (unsigned char)((src[i] & 0x7F) >> (8 - bit % 8));
+	}
+
+	return dest;
+}
+
+unsigned char *tcore_util_unpack_gsm7bit(const unsigned char *src, unsigned int src_len)
+{
+	unsigned char *dest;
+	unsigned int count = src_len * 8 / 7;
+	unsigned int i;
+	unsigned int bit;
+	unsigned int v;
+
+	dest = calloc(count + 1, 1);
+	if (!dest)
+		return NULL;
+
+	for (i = 0, bit = 0; i < count; i++, bit += 7) {
+		v = src[bit / 8] >> (bit % 8);
+		if (bit % 8 > 1 && bit / 8 + 1 < src_len)
+			v |= src[bit / 8 + 1] << (8 - bit % 8);
+		dest[i] = v & 0x7F;
+	}
+
+	return dest;
+}
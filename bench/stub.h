@@ -0,0 +1,111 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __BENCH_STUB_H__
+#define __BENCH_STUB_H__
+
+#include <glib.h>
+#include <gio/gio.h>
+
+#include <tcore.h>
+#include <server.h>
+#include <plugin.h>
+#include <communicator.h>
+#include <user_request.h>
+#include <co_call.h>
+
+/*
+ * In-process stand-in for the part of libtcore the plugin uses, plus
+ * dlog / aul / appsvc / bundle and sat_ui_support, so the plugin sources
+ * link and run without a modem, see CMakeLists.txt (BUILD_TESTS). The
+ * dlog / aul / appsvc / bundle headers are in bench/include, libtcore's
+ * are still taken from pkgconfig(tcore).
+ */
+
+/* decides what happens to a dispatched request, see stub_user_request_respond() */
+typedef TReturn (*stub_request_cb)(UserRequest *ur, enum tcore_request_command command,
+		const void *data, unsigned int data_len, void *user_data);
+
+struct stub_counters {
+	unsigned long ur_new;
+	unsigned long ur_free;
+	unsigned long dispatched;
+	unsigned long responded;
+	unsigned long dropped;
+	unsigned long notified;
+	unsigned long ui_launches;
+};
+
+extern struct stub_counters stub_counters;
+extern gboolean stub_verbose;
+
+Server *stub_server_new(void);
+void stub_server_free(Server *s);
+void stub_server_set_request_handler(Server *s, stub_request_cb cb, void *user_data);
+
+/* a modem plugin gets one core object of every type the plugin looks up */
+TcorePlugin *stub_plugin_new(Server *s, const char *name, gboolean modem);
+CoreObject *stub_plugin_ref_object(TcorePlugin *p, unsigned int type);
+
+/* runs the server hooks, then every communicator, like tcore_server_send_notification() */
+void stub_server_notify(Server *s, CoreObject *source, enum tcore_notification_command command,
+		unsigned int data_len, const void *data);
+
+/* hands a response to the communicator and drops the dispatch reference */
+void stub_user_request_respond(UserRequest *ur, enum tcore_response_command command,
+		unsigned int data_len, const void *data);
+void stub_user_request_respond_later(UserRequest *ur, guint delay_ms,
+		enum tcore_response_command command, unsigned int data_len, const void *data);
+
+/* call objects of a CORE_OBJECT_TYPE_CALL object */
+CallObject *stub_call_new(CoreObject *o, int id, enum tcore_call_type type,
+		enum tcore_call_direction direction, enum tcore_call_status status, const char *number);
+void stub_call_set_status(CallObject *co, enum tcore_call_status status);
+void stub_call_set_multiparty(CallObject *co, gboolean multiparty);
+void stub_call_free(CoreObject *o, CallObject *co);
+GSList *stub_call_list(CoreObject *o);
+
+/* heap calls made by the current thread, counted when the allocator is interposed */
+struct stub_alloc_count {
+	unsigned long allocs;
+	unsigned long frees;
+};
+
+gboolean stub_alloc_counting(void);
+void stub_alloc_snapshot(struct stub_alloc_count *count);
+
+/* private bus and plugin bring-up, see stub-bus.c */
+extern struct tcore_plugin_define_desc plugin_define_desc;
+
+struct stub_bus {
+	GTestDBus *bus;
+	GDBusConnection *client;
+	Server *server;
+	TcorePlugin *dbus_plugin;
+	struct custom_data *ctx;
+};
+
+gboolean stub_bus_up(struct stub_bus *sb, const char **modems, guint modem_count);
+gboolean stub_bus_up_at(struct stub_bus *sb, const char *address, const char **modems, guint modem_count);
+void stub_bus_down(struct stub_bus *sb);
+TcorePlugin *stub_bus_add_modem(struct stub_bus *sb, const char *name);
+gchar *stub_bus_modem_path(const char *name);
+GVariant *stub_bus_call(struct stub_bus *sb, const char *path, const char *interface,
+		const char *method, GVariant *parameters, GError **error);
+
+#endif
@@ -0,0 +1,322 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Hosts the plugin on an existing bus with a stub modem that answers the
+ * requests tapi-loadgen sends after a configurable delay, so the plugin
+ * and the dbus-daemon can be measured as separate processes.
+ *
+ *   tapi-stub-host --address unix:path=/tmp/bus --delay-ms 2 --delay sms=40
+ *
+ * Runs until SIGINT / SIGTERM, then prints the stub counters. Requests
+ * it has no answer for are dropped, which the plugin sees as a modem
+ * that never replied.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <glib.h>
+#include <glib-unix.h>
+#include <gio/gio.h>
+
+#include <tcore.h>
+#include <server.h>
+#include <plugin.h>
+#include <communicator.h>
+#include <user_request.h>
+#include <co_call.h>
+#include <co_sms.h>
+#include <co_sim.h>
+#include <co_phonebook.h>
+#include <co_network.h>
+
+#include "stub.h"
+#include "common.h"
+
+#define HOST_MODEM "loadgen0"
+#define HOST_NETWORK_ACT 4 /* UMTS */
+#define HOST_NETWORK_PLMN "00101"
+#define HOST_NETWORK_LAC 1
+
+enum host_class {
+	HOST_CLASS_CALL,
+	HOST_CLASS_SMS,
+	HOST_CLASS_SIM,
+	HOST_CLASS_PHONEBOOK,
+	HOST_CLASS_NETWORK,
+	HOST_CLASS_MAX
+};
+
+static const char *host_class_names[HOST_CLASS_MAX] = {
+	"call", "sms", "sim", "phonebook", "network",
+};
+
+struct host {
+	struct stub_bus sb;
+	GMainLoop *loop;
+	GRand *rand;
+	guint delay_ms[HOST_CLASS_MAX];
+	guint jitter_ms;
+	unsigned long answered[HOST_CLASS_MAX];
+};
+
+union host_response {
+	struct tresp_call_dial dial;
+	struct tresp_call_end end;
+	struct tresp_sms_send_umts_msg sms;
+	struct tresp_sim_transmit_apdu apdu;
+	struct tresp_phonebook_read_record pb;
+	struct tresp_network_get_serving_network network;
+};
+
+static void _fill_response(enum tcore_request_command command, const void *data, union host_response *resp)
+{
+	const struct treq_call_end *end = data;
+	const struct treq_phonebook_read_record *pb = data;
+
+	memset(resp, 0, sizeof(union host_response));
+
+	switch (command) {
+		case TREQ_CALL_END:
+			resp->end.id = end->id;
+			resp->end.type = end->type;
+			break;
+
+		case TREQ_SIM_TRANSMIT_APDU:
+			/* 90 00, normal ending of the command */
+			resp->apdu.apdu_resp_length = 2;
+			resp->apdu.apdu_resp[0] = 0x90;
+			resp->apdu.apdu_resp[1] = 0x00;
+			break;
+
+		case TREQ_PHONEBOOK_READRECORD:
+			resp->pb.phonebook_type = pb->phonebook_type;
+			resp->pb.index = pb->index;
+			resp->pb.next_index = pb->index + 1;
+			g_snprintf((char *)resp->pb.name, sizeof(resp->pb.name), "Contact %u", pb->index);
+			g_snprintf((char *)resp->pb.number, sizeof(resp->pb.number), "0100%06u", pb->index);
+			break;
+
+		case TREQ_NETWORK_GET_SERVING_NETWORK:
+			resp->network.act = HOST_NETWORK_ACT;
+			g_strlcpy(resp->network.plmn, HOST_NETWORK_PLMN, sizeof(resp->network.plmn));
+			resp->network.gsm.lac = HOST_NETWORK_LAC;
+			break;
+
+		default:
+			break;
+	}
+}
+
+static TReturn _on_request(UserRequest *ur, enum tcore_request_command command,
+		const void *data, unsigned int data_len, void *user_data)
+{
+	struct host *h = user_data;
+	union host_response resp;
+	enum tcore_response_command resp_command;
+	enum host_class class;
+	unsigned int resp_len;
+	guint delay;
+
+	switch (command) {
+		case TREQ_CALL_DIAL:
+			class = HOST_CLASS_CALL;
+			resp_command = TRESP_CALL_DIAL;
+			resp_len = sizeof(struct tresp_call_dial);
+			break;
+
+		case TREQ_CALL_END:
+			class = HOST_CLASS_CALL;
+			resp_command = TRESP_CALL_END;
+			resp_len = sizeof(struct tresp_call_end);
+			break;
+
+		case TREQ_SMS_SEND_UMTS_MSG:
+			class = HOST_CLASS_SMS;
+			resp_command = TRESP_SMS_SEND_UMTS_MSG;
+			resp_len = sizeof(struct tresp_sms_send_umts_msg);
+			break;
+
+		case TREQ_SIM_TRANSMIT_APDU:
+			class = HOST_CLASS_SIM;
+			resp_command = TRESP_SIM_TRANSMIT_APDU;
+			resp_len = sizeof(struct tresp_sim_transmit_apdu);
+			break;
+
+		case TREQ_PHONEBOOK_READRECORD:
+			class = HOST_CLASS_PHONEBOOK;
+			resp_command = TRESP_PHONEBOOK_READRECORD;
+			resp_len = sizeof(struct tresp_phonebook_read_record);
+			break;
+
+		case TREQ_NETWORK_GET_SERVING_NETWORK:
+			class = HOST_CLASS_NETWORK;
+			resp_command = TRESP_NETWORK_GET_SERVING_NETWORK;
+			resp_len = sizeof(struct tresp_network_get_serving_network);
+			break;
+
+		default:
+			stub_counters.dropped++;
+			tcore_user_request_unref(ur);
+			return TCORE_RETURN_SUCCESS;
+	}
+
+	_fill_response(command, data, &resp);
+
+	delay = h->delay_ms[class];
+	if (h->jitter_ms)
+		delay += g_rand_int_range(h->rand, 0, h->jitter_ms + 1);
+
+	h->answered[class]++;
+	stub_user_request_respond_later(ur, delay, resp_command, resp_len, &resp);
+
+	return TCORE_RETURN_SUCCESS;
+}
+
+/* "sms=40" */
+static gboolean _parse_delay(struct host *h, const char *spec)
+{
+	gchar **kv;
+	gchar *end;
+	gboolean ok = FALSE;
+	guint64 ms;
+	int i;
+
+	kv = g_strsplit(spec, "=", 2);
+	if (!kv[0] || !kv[1])
+		goto out;
+
+	ms = g_ascii_strtoull(kv[1], &end, 10);
+	if (*end || end == kv[1] || ms > G_MAXUINT)
+		goto out;
+
+	for (i = 0; i < HOST_CLASS_MAX; i++) {
+		if (g_strcmp0(kv[0], host_class_names[i]) == 0) {
+			h->delay_ms[i] = (guint)ms;
+			ok = TRUE;
+			break;
+		}
+	}
+
+out:
+	g_strfreev(kv);
+	return ok;
+}
+
+static gboolean _on_signal(gpointer user_data)
+{
+	g_main_loop_quit(user_data);
+
+	return FALSE;
+}
+
+int main(int argc, char **argv)
+{
+	struct host h;
+	GOptionContext *options;
+	GError *error = NULL;
+	gchar *address = NULL;
+	gchar *modem = NULL;
+	gchar **delays = NULL;
+	const char *modems[1];
+	gint delay_ms = 0;
+	gint jitter_ms = 0;
+	gboolean verbose = FALSE;
+	int i;
+
+	GOptionEntry entries[] = {
+		{ "address", 'a', 0, G_OPTION_ARG_STRING, &address, "Bus to join (DBUS_SYSTEM_BUS_ADDRESS)", "ADDRESS" },
+		{ "modem", 'm', 0, G_OPTION_ARG_STRING, &modem, "Modem name (" HOST_MODEM ")", "NAME" },
+		{ "delay-ms", 'd', 0, G_OPTION_ARG_INT, &delay_ms, "Modem delay for every request (0)", "MS" },
+		{ "delay", 0, 0, G_OPTION_ARG_STRING_ARRAY, &delays, "Delay of one class: call, sms, sim, phonebook, network", "CLASS=MS" },
+		{ "jitter-ms", 'j', 0, G_OPTION_ARG_INT, &jitter_ms, "Random extra delay, up to (0)", "MS" },
+		{ "verbose", 'v', 0, G_OPTION_ARG_NONE, &verbose, "Print the plugin log", NULL },
+		{ NULL }
+	};
+
+	options = g_option_context_new("- host the plugin for tapi-loadgen");
+	g_option_context_add_main_entries(options, entries, NULL);
+	if (!g_option_context_parse(options, &argc, &argv, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		return 2;
+	}
+	g_option_context_free(options);
+
+	memset(&h, 0, sizeof(struct host));
+
+	if (delay_ms < 0 || jitter_ms < 0) {
+		fprintf(stderr, "delays must not be negative\n");
+		return 2;
+	}
+
+	for (i = 0; i < HOST_CLASS_MAX; i++)
+		h.delay_ms[i] = (guint)delay_ms;
+	h.jitter_ms = (guint)jitter_ms;
+
+	for (i = 0; delays && delays[i]; i++) {
+		if (!_parse_delay(&h, delays[i])) {
+			fprintf(stderr, "bad --delay %s\n", delays[i]);
+			return 2;
+		}
+	}
+
+	if (!address)
+		address = g_strdup(g_getenv("DBUS_SYSTEM_BUS_ADDRESS"));
+	if (!address) {
+		fprintf(stderr, "no bus, use --address\n");
+		return 2;
+	}
+
+	stub_verbose = verbose;
+	modems[0] = modem ? modem : HOST_MODEM;
+
+	if (!stub_bus_up_at(&h.sb, address, modems, G_N_ELEMENTS(modems))) {
+		stub_bus_down(&h.sb);
+		return 1;
+	}
+
+	stub_server_set_request_handler(h.sb.server, _on_request, &h);
+	h.rand = g_rand_new();
+	h.loop = g_main_loop_new(NULL, FALSE);
+	g_unix_signal_add(SIGINT, _on_signal, h.loop);
+	g_unix_signal_add(SIGTERM, _on_signal, h.loop);
+
+	printf("%s on %s, pid %d\n", modems[0], address, (int)getpid());
+	fflush(stdout);
+
+	g_main_loop_run(h.loop);
+
+	printf("answered:");
+	for (i = 0; i < HOST_CLASS_MAX; i++)
+		printf(" %s %lu", host_class_names[i], h.answered[i]);
+	printf("\nrequests %lu, dispatched %lu, responded %lu, dropped %lu\n",
+			stub_counters.ur_new, stub_counters.dispatched, stub_counters.responded, stub_counters.dropped);
+
+	g_main_loop_unref(h.loop);
+	g_rand_free(h.rand);
+	stub_bus_down(&h.sb);
+	g_strfreev(delays);
+	g_free(modem);
+	g_free(address);
+
+	return 0;
+}
@@ -0,0 +1,614 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Randomized check of the call table (call.c) against the stub tcore.
+ *
+ *   ./test-call-table --seed 7 --steps 5000
+ *
+ * Each step changes the calls tcore knows about the way a modem would,
+ * then either sends the matching status notification or, for SWAP, JOIN
+ * and SPLIT, answers the D-Bus request without any notification. After
+ * every step the "calls" property must match tcore exactly; every few
+ * steps GetStatusAll is checked as well.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include <gio/gio.h>
+
+#include <tcore.h>
+#include <server.h>
+#include <plugin.h>
+#include <communicator.h>
+#include <user_request.h>
+#include <co_call.h>
+
+#include "stub.h"
+#include "common.h"
+
+#define TEST_MODEM "call0"
+#define TEST_MAX_CALLS 7
+#define TEST_STATUS_ALL_EVERY 16
+
+enum test_op {
+	TEST_OP_DIAL,
+	TEST_OP_ALERT,
+	TEST_OP_INCOMING,
+	TEST_OP_CONNECT,
+	TEST_OP_HOLD,
+	TEST_OP_END,
+	TEST_OP_SWAP,
+	TEST_OP_JOIN,
+	TEST_OP_SPLIT,
+	TEST_OP_MAX
+};
+
+static const char *test_op_names[TEST_OP_MAX] = {
+	"dial", "alert", "incoming", "connect", "hold", "end", "swap", "join", "split",
+};
+
+struct test {
+	struct stub_bus sb;
+	TcorePlugin *modem;
+	CoreObject *o;
+	TelephonyCall *call;
+	gchar *path;
+	GRand *rand;
+	guint step;
+};
+
+/* tcore side */
+
+static GSList *_calls_by_status(struct test *t, enum tcore_call_status status)
+{
+	return tcore_call_object_find_by_status(t->o, status);
+}
+
+static CallObject *_pick(struct test *t, GSList *list)
+{
+	if (!list)
+		return NULL;
+
+	return g_slist_nth_data(list, g_rand_int_range(t->rand, 0, g_slist_length(list)));
+}
+
+static int _free_id(struct test *t)
+{
+	int id;
+
+	for (id = 1; id <= TEST_MAX_CALLS; id++) {
+		if (!tcore_call_object_find_by_id(t->o, id))
+			return id;
+	}
+
+	return 0;
+}
+
+static void _set_status_all(struct test *t, enum tcore_call_status from, enum tcore_call_status to)
+{
+	GSList *list;
+	GSList *l;
+
+	list = _calls_by_status(t, from);
+	for (l = list; l; l = l->next)
+		stub_call_set_status(l->data, to);
+	g_slist_free(list);
+}
+
+/* a conference of one is a plain call again */
+static void _fix_multiparty(struct test *t)
+{
+	CallObject *last = NULL;
+	GSList *l;
+	int count = 0;
+
+	for (l = stub_call_list(t->o); l; l = l->next) {
+		if (tcore_call_object_get_multiparty_state(l->data)) {
+			last = l->data;
+			count++;
+		}
+	}
+
+	if (count == 1)
+		stub_call_set_multiparty(last, FALSE);
+}
+
+static void _notify(struct test *t, enum tcore_notification_command command, int id)
+{
+	struct tnoti_call_status_idle idle;
+	struct tnoti_call_status_dialing dialing;
+	struct tnoti_call_status_alert alert;
+	struct tnoti_call_status_active active;
+	struct tnoti_call_status_held held;
+	struct tnoti_call_status_incoming incoming;
+
+	switch (command) {
+		case TNOTI_CALL_STATUS_IDLE:
+			memset(&idle, 0, sizeof(idle));
+			idle.type = CALL_TYPE_VOICE;
+			idle.id = id;
+			stub_server_notify(t->sb.server, t->o, command, sizeof(idle), &idle);
+			break;
+
+		case TNOTI_CALL_STATUS_DIALING:
+			memset(&dialing, 0, sizeof(dialing));
+			dialing.type = CALL_TYPE_VOICE;
+			dialing.id = id;
+			stub_server_notify(t->sb.server, t->o, command, sizeof(dialing), &dialing);
+			break;
+
+		case TNOTI_CALL_STATUS_ALERT:
+			memset(&alert, 0, sizeof(alert));
+			alert.type = CALL_TYPE_VOICE;
+			alert.id = id;
+			stub_server_notify(t->sb.server, t->o, command, sizeof(alert), &alert);
+			break;
+
+		case TNOTI_CALL_STATUS_ACTIVE:
+			memset(&active, 0, sizeof(active));
+			active.type = CALL_TYPE_VOICE;
+			active.id = id;
+			stub_server_notify(t->sb.server, t->o, command, sizeof(active), &active);
+			break;
+
+		case TNOTI_CALL_STATUS_HELD:
+			memset(&held, 0, sizeof(held));
+			held.type = CALL_TYPE_VOICE;
+			held.id = id;
+			stub_server_notify(t->sb.server, t->o, command, sizeof(held), &held);
+			break;
+
+		case TNOTI_CALL_STATUS_INCOMING:
+			memset(&incoming, 0, sizeof(incoming));
+			incoming.type = CALL_TYPE_VOICE;
+			incoming.id = id;
+			stub_server_notify(t->sb.server, t->o, command, sizeof(incoming), &incoming);
+			break;
+
+		default:
+			break;
+	}
+}
+
+/* every active call goes on hold, one notification each */
+static void _hold_active(struct test *t)
+{
+	GSList *list;
+	GSList *l;
+
+	list = _calls_by_status(t, TCORE_CALL_STATUS_ACTIVE);
+	for (l = list; l; l = l->next) {
+		stub_call_set_status(l->data, TCORE_CALL_STATUS_HELD);
+		_notify(t, TNOTI_CALL_STATUS_HELD, tcore_call_object_get_id(l->data));
+	}
+	g_slist_free(list);
+}
+
+/* SWAP / JOIN / SPLIT: tcore changes several calls and only answers the request */
+static TReturn _on_request(UserRequest *ur, enum tcore_request_command command,
+		const void *data, unsigned int data_len, void *user_data)
+{
+	struct test *t = user_data;
+	const struct treq_call_swap *req = data;
+	struct tresp_call_swap resp;
+	enum tcore_response_command response;
+	CallObject *co;
+	GSList *active;
+	GSList *held;
+	GSList *l;
+
+	memset(&resp, 0, sizeof(resp));
+	resp.id = req ? req->id : 0;
+
+	switch (command) {
+		case TREQ_CALL_SWAP:
+			response = TRESP_CALL_SWAP;
+			_set_status_all(t, TCORE_CALL_STATUS_ACTIVE, TCORE_CALL_STATUS_WAITING);
+			_set_status_all(t, TCORE_CALL_STATUS_HELD, TCORE_CALL_STATUS_ACTIVE);
+			_set_status_all(t, TCORE_CALL_STATUS_WAITING, TCORE_CALL_STATUS_HELD);
+			break;
+
+		case TREQ_CALL_JOIN:
+			response = TRESP_CALL_JOIN;
+			active = _calls_by_status(t, TCORE_CALL_STATUS_ACTIVE);
+			held = _calls_by_status(t, TCORE_CALL_STATUS_HELD);
+			if (active && held) {
+				for (l = active; l; l = l->next)
+					stub_call_set_multiparty(l->data, TRUE);
+				for (l = held; l; l = l->next) {
+					stub_call_set_status(l->data, TCORE_CALL_STATUS_ACTIVE);
+					stub_call_set_multiparty(l->data, TRUE);
+				}
+			}
+			else {
+				resp.err = 1;
+			}
+			g_slist_free(active);
+			g_slist_free(held);
+			break;
+
+		case TREQ_CALL_SPLIT:
+			response = TRESP_CALL_SPLIT;
+			co = req ? tcore_call_object_find_by_id(t->o, req->id) : NULL;
+			if (co && tcore_call_object_get_multiparty_state(co)
+					&& tcore_call_object_get_status(co) == TCORE_CALL_STATUS_ACTIVE) {
+				for (l = stub_call_list(t->o); l; l = l->next) {
+					if (tcore_call_object_get_multiparty_state(l->data))
+						stub_call_set_status(l->data, TCORE_CALL_STATUS_HELD);
+				}
+				stub_call_set_status(co, TCORE_CALL_STATUS_ACTIVE);
+				stub_call_set_multiparty(co, FALSE);
+				_fix_multiparty(t);
+			}
+			else {
+				resp.err = 1;
+			}
+			break;
+
+		default:
+			tcore_user_request_unref(ur);
+			return TCORE_RETURN_SUCCESS;
+	}
+
+	stub_user_request_respond_later(ur, 0, response, sizeof(resp), &resp);
+
+	return TCORE_RETURN_SUCCESS;
+}
+
+static void _settle(struct test *t)
+{
+	while (g_main_context_iteration(NULL, FALSE))
+		;
+}
+
+static gboolean _request(struct test *t, const char *method, int id)
+{
+	GVariant *result;
+	GError *error = NULL;
+
+	result = stub_bus_call(&t->sb, t->path, "org.tizen.telephony.Call", method,
+			g_variant_new("(i)", id), &error);
+	if (!result) {
+		fprintf(stderr, "step %u: %s(%d): %s\n", t->step, method, id, error->message);
+		g_error_free(error);
+		return FALSE;
+	}
+
+	g_variant_unref(result);
+
+	return TRUE;
+}
+
+/* one random step; FALSE when the chosen operation does not apply right now */
+static gboolean _step(struct test *t, enum test_op op, gboolean *ok)
+{
+	CallObject *co = NULL;
+	GSList *list = NULL;
+	char number[32];
+	int id;
+
+	*ok = TRUE;
+
+	switch (op) {
+		case TEST_OP_DIAL:
+			list = _calls_by_status(t, TCORE_CALL_STATUS_DIALING);
+			list = g_slist_concat(list, _calls_by_status(t, TCORE_CALL_STATUS_ALERT));
+			id = _free_id(t);
+			if (list || !id)
+				break;
+
+			_hold_active(t);
+			snprintf(number, sizeof(number), "0105550%04u", g_rand_int_range(t->rand, 0, 10000));
+			stub_call_new(t->o, id, TCORE_CALL_TYPE_VOICE, TCORE_CALL_DIRECTION_OUTGOING,
+					TCORE_CALL_STATUS_DIALING, number);
+			_notify(t, TNOTI_CALL_STATUS_DIALING, id);
+			return TRUE;
+
+		case TEST_OP_ALERT:
+			list = _calls_by_status(t, TCORE_CALL_STATUS_DIALING);
+			co = _pick(t, list);
+			if (!co)
+				break;
+
+			stub_call_set_status(co, TCORE_CALL_STATUS_ALERT);
+			_notify(t, TNOTI_CALL_STATUS_ALERT, tcore_call_object_get_id(co));
+			g_slist_free(list);
+			return TRUE;
+
+		case TEST_OP_INCOMING:
+			list = _calls_by_status(t, TCORE_CALL_STATUS_INCOMING);
+			id = _free_id(t);
+			if (list || !id)
+				break;
+
+			snprintf(number, sizeof(number), "0315550%04u", g_rand_int_range(t->rand, 0, 10000));
+			stub_call_new(t->o, id, TCORE_CALL_TYPE_VOICE, TCORE_CALL_DIRECTION_INCOMING,
+					TCORE_CALL_STATUS_INCOMING, number);
+			_notify(t, TNOTI_CALL_STATUS_INCOMING, id);
+			return TRUE;
+
+		case TEST_OP_CONNECT:
+			list = _calls_by_status(t, TCORE_CALL_STATUS_DIALING);
+			list = g_slist_concat(list, _calls_by_status(t, TCORE_CALL_STATUS_ALERT));
+			list = g_slist_concat(list, _calls_by_status(t, TCORE_CALL_STATUS_INCOMING));
+			co = _pick(t, list);
+			if (!co)
+				break;
+
+			if (tcore_call_object_get_status(co) == TCORE_CALL_STATUS_INCOMING)
+				_hold_active(t);
+			stub_call_set_status(co, TCORE_CALL_STATUS_ACTIVE);
+			_notify(t, TNOTI_CALL_STATUS_ACTIVE, tcore_call_object_get_id(co));
+			g_slist_free(list);
+			return TRUE;
+
+		case TEST_OP_HOLD:
+			list = _calls_by_status(t, TCORE_CALL_STATUS_ACTIVE);
+			if (!list)
+				break;
+
+			_hold_active(t);
+			g_slist_free(list);
+			return TRUE;
+
+		case TEST_OP_END:
+			co = _pick(t, stub_call_list(t->o));
+			if (!co)
+				break;
+
+			id = tcore_call_object_get_id(co);
+			stub_call_free(t->o, co);
+			_fix_multiparty(t);
+			_notify(t, TNOTI_CALL_STATUS_IDLE, id);
+			return TRUE;
+
+		case TEST_OP_SWAP:
+			list = _calls_by_status(t, TCORE_CALL_STATUS_HELD);
+			if (!list)
+				break;
+
+			g_slist_free(list);
+			*ok = _request(t, "Swap", 0);
+			return TRUE;
+
+		case TEST_OP_JOIN:
+			list = _calls_by_status(t, TCORE_CALL_STATUS_HELD);
+			if (!list)
+				break;
+
+			g_slist_free(list);
+			*ok = _request(t, "Join", 0);
+			return TRUE;
+
+		case TEST_OP_SPLIT:
+			for (list = stub_call_list(t->o); list; list = list->next) {
+				if (tcore_call_object_get_multiparty_state(list->data)
+						&& g_rand_boolean(t->rand)) {
+					co = list->data;
+					break;
+				}
+			}
+			if (!co)
+				return FALSE;
+
+			*ok = _request(t, "Split", tcore_call_object_get_id(co));
+			return TRUE;
+
+		default:
+			break;
+	}
+
+	g_slist_free(list);
+
+	return FALSE;
+}
+
+/* check */
+
+static void _dump(const char *what, GVariant *calls)
+{
+	gchar *text;
+
+	text = calls ? g_variant_print(calls, FALSE) : g_strdup("(none)");
+	fprintf(stderr, "  %s: %s\n", what, text);
+	g_free(text);
+}
+
+static void _dump_tcore(struct test *t)
+{
+	char number[MAX_CALL_NUMBER_LEN];
+	GSList *l;
+
+	fprintf(stderr, "  tcore:");
+	for (l = stub_call_list(t->o); l; l = l->next) {
+		memset(number, 0, sizeof(number));
+		tcore_call_object_get_number(l->data, number);
+		fprintf(stderr, " [id %d status %d mpty %d %s]", tcore_call_object_get_id(l->data),
+				tcore_call_object_get_status(l->data),
+				tcore_call_object_get_multiparty_state(l->data), number);
+	}
+	fprintf(stderr, "\n");
+}
+
+static gint _compare_id(gconstpointer a, gconstpointer b)
+{
+	return tcore_call_object_get_id((CallObject *)a) - tcore_call_object_get_id((CallObject *)b);
+}
+
+static gboolean _check(struct test *t, const char *what, GVariant *calls)
+{
+	char number[MAX_CALL_NUMBER_LEN];
+	GSList *expected;
+	GSList *l;
+	GVariant *entry;
+	const gchar *entry_number;
+	gint id, type, state;
+	gboolean direction, multiparty;
+	gboolean ok = TRUE;
+	gsize i = 0;
+
+	expected = g_slist_sort(g_slist_copy(stub_call_list(t->o)), _compare_id);
+
+	if (!calls || g_slist_length(expected) != g_variant_n_children(calls))
+		ok = FALSE;
+
+	for (l = expected; ok && l; l = l->next, i++) {
+		entry = g_variant_get_child_value(calls, i);
+
+		memset(number, 0, sizeof(number));
+		tcore_call_object_get_number(l->data, number);
+
+		if (!g_variant_lookup(entry, "call_id", "i", &id)
+				|| !g_variant_lookup(entry, "call_number", "&s", &entry_number)
+				|| !g_variant_lookup(entry, "call_type", "i", &type)
+				|| !g_variant_lookup(entry, "call_direction", "b", &direction)
+				|| !g_variant_lookup(entry, "call_state", "i", &state)
+				|| !g_variant_lookup(entry, "call_multiparty_state", "b", &multiparty))
+			ok = FALSE;
+		else if (id != tcore_call_object_get_id(l->data)
+				|| g_strcmp0(entry_number, number)
+				|| type != (gint)tcore_call_object_get_type(l->data)
+				|| !direction != !(tcore_call_object_get_direction(l->data) == TCORE_CALL_DIRECTION_OUTGOING)
+				|| state != (gint)tcore_call_object_get_status(l->data)
+				|| !multiparty != !tcore_call_object_get_multiparty_state(l->data))
+			ok = FALSE;
+
+		g_variant_unref(entry);
+	}
+
+	g_slist_free(expected);
+
+	if (!ok) {
+		fprintf(stderr, "step %u: %s does not match tcore\n", t->step, what);
+		_dump(what, calls);
+		_dump_tcore(t);
+	}
+
+	return ok;
+}
+
+static gboolean _check_status_all(struct test *t)
+{
+	GVariant *result;
+	GVariant *calls;
+	GError *error = NULL;
+	gboolean ok;
+
+	result = stub_bus_call(&t->sb, t->path, "org.tizen.telephony.Call", "GetStatusAll", NULL, &error);
+	if (!result) {
+		fprintf(stderr, "step %u: GetStatusAll: %s\n", t->step, error->message);
+		g_error_free(error);
+		return FALSE;
+	}
+
+	calls = g_variant_get_child_value(result, 0);
+	ok = _check(t, "GetStatusAll", calls);
+	g_variant_unref(calls);
+	g_variant_unref(result);
+
+	return ok;
+}
+
+int main(int argc, char *argv[])
+{
+	struct test t;
+	const char *modems[] = { TEST_MODEM };
+	TelephonyObjectSkeleton *object;
+	GOptionContext *options;
+	GError *error = NULL;
+	gint64 seed = 1;
+	gint steps = 2000;
+	gboolean verbose = FALSE;
+	guint applied[TEST_OP_MAX];
+	gboolean ok = TRUE;
+	gboolean request_ok;
+	enum test_op op;
+	int i;
+
+	GOptionEntry entries[] = {
+		{ "seed", 's', 0, G_OPTION_ARG_INT64, &seed, "Random seed (1)", "N" },
+		{ "steps", 'n', 0, G_OPTION_ARG_INT, &steps, "Number of steps (2000)", "N" },
+		{ "verbose", 'v', 0, G_OPTION_ARG_NONE, &verbose, "Print the plugin log", NULL },
+		{ NULL }
+	};
+
+#if !GLIB_CHECK_VERSION(2,35,0)
+	g_type_init();
+#endif
+
+	options = g_option_context_new("- check the call table against a stub tcore");
+	g_option_context_add_main_entries(options, entries, NULL);
+	if (!g_option_context_parse(options, &argc, &argv, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		return 2;
+	}
+	g_option_context_free(options);
+
+	stub_verbose = verbose;
+
+	memset(&t, 0, sizeof(struct test));
+	memset(applied, 0, sizeof(applied));
+
+	if (!stub_bus_up(&t.sb, modems, G_N_ELEMENTS(modems))) {
+		stub_bus_down(&t.sb);
+		return 1;
+	}
+
+	stub_server_set_request_handler(t.sb.server, _on_request, &t);
+	t.modem = tcore_server_find_plugin(t.sb.server, TEST_MODEM);
+	t.o = stub_plugin_ref_object(t.modem, CORE_OBJECT_TYPE_CALL);
+	t.path = stub_bus_modem_path(TEST_MODEM);
+	object = g_hash_table_lookup(t.sb.ctx->objects, t.path);
+	t.call = object ? telephony_object_peek_call(TELEPHONY_OBJECT(object)) : NULL;
+	t.rand = g_rand_new_with_seed((guint32)seed);
+
+	if (!t.call) {
+		fprintf(stderr, "no Call interface on %s\n", t.path);
+		ok = FALSE;
+	}
+
+	for (i = 0; ok && i < steps; i++) {
+		t.step = i;
+
+		op = g_rand_int_range(t.rand, 0, TEST_OP_MAX);
+		if (!_step(&t, op, &request_ok))
+			continue;
+
+		applied[op]++;
+		_settle(&t);
+
+		ok = request_ok && _check(&t, test_op_names[op], telephony_call_get_calls(t.call));
+		if (ok && i % TEST_STATUS_ALL_EVERY == 0)
+			ok = _check_status_all(&t);
+	}
+
+	printf("seed %" G_GINT64_FORMAT ", %u steps:", seed, t.step + 1);
+	for (i = 0; i < TEST_OP_MAX; i++)
+		printf(" %s %u", test_op_names[i], applied[i]);
+	printf("\n%s\n", ok ? "PASS" : "FAIL");
+
+	g_rand_free(t.rand);
+	g_free(t.path);
+	stub_bus_down(&t.sb);
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,203 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Checks the GSM 03.38 lookup tables of sat_util.c against the table
+ * scans they replaced (sat-gsm-old.c).
+ *
+ *   ./test-sat-gsm --seed 1 --strings 20000
+ *
+ * Every one of the 65536 UCS2 values goes through
+ * sat_mgr_get_gsm_code_size() and sat_mgr_convert_ucs2_to_gsm(), every
+ * GSM code and every escaped GSM code through sat_mgr_convert_gsm_to_ucs2().
+ * Then seeded random strings of GSM characters are converted both ways.
+ * Results and return values must be identical.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+
+#include "stub.h"
+#include "common.h"
+#include "sat_gsm.h"
+#include "sat-gsm-old.h"
+
+#define TEST_GSM_ESCAPE 0x1B
+#define TEST_MAX_CHARS 200
+
+struct test {
+	GRand *rand;
+	unsigned short mappable[256];
+	int mappable_count;
+	unsigned long checked;
+	unsigned long failed;
+};
+
+static void _fail(struct test *t, const char *what, unsigned int value, int old_ret, int new_ret)
+{
+	t->failed++;
+	if (t->failed <= 10)
+		fprintf(stderr, "%s 0x%04X: old %d, new %d\n", what, value, old_ret, new_ret);
+}
+
+static void _check_ucs2(struct test *t)
+{
+	unsigned short ucs2;
+	unsigned char old_gsm[4];
+	unsigned char new_gsm[4];
+	unsigned int value;
+	int old_ret;
+	int new_ret;
+
+	for (value = 0; value <= 0xFFFF; value++) {
+		ucs2 = value;
+
+		old_ret = sat_gsm_old_get_gsm_code_size(&ucs2, 1);
+		new_ret = sat_mgr_get_gsm_code_size(&ucs2, 1);
+		t->checked++;
+		if (old_ret != new_ret)
+			_fail(t, "code size", value, old_ret, new_ret);
+
+		memset(old_gsm, 0, sizeof(old_gsm));
+		memset(new_gsm, 0, sizeof(new_gsm));
+		old_ret = sat_gsm_old_ucs2_to_gsm(old_gsm, &ucs2, 1);
+		new_ret = sat_mgr_convert_ucs2_to_gsm(new_gsm, &ucs2, 1);
+		t->checked++;
+		if (old_ret != new_ret || (old_ret > 0 && memcmp(old_gsm, new_gsm, old_ret) != 0))
+			_fail(t, "ucs2 to gsm", value, old_ret, new_ret);
+
+		/* kept for the random strings below */
+		if (old_ret > 0 && t->mappable_count < (int)G_N_ELEMENTS(t->mappable))
+			t->mappable[t->mappable_count++] = ucs2;
+	}
+}
+
+static void _check_gsm(struct test *t)
+{
+	unsigned char gsm[2] = { 0, 0 };
+	unsigned short old_ucs2[2];
+	unsigned short new_ucs2[2];
+	unsigned int code;
+	int old_ret;
+	int new_ret;
+
+	for (code = 0; code <= 0xFF; code++) {
+		gsm[0] = code;
+		old_ret = sat_gsm_old_gsm_to_ucs2(old_ucs2, gsm, 1);
+		new_ret = sat_mgr_convert_gsm_to_ucs2(new_ucs2, gsm, 1);
+		t->checked++;
+		/* a lone escape used to read past the input, only the count can match */
+		if (old_ret != new_ret || (code != TEST_GSM_ESCAPE && old_ucs2[0] != new_ucs2[0]))
+			_fail(t, "gsm to ucs2", code, old_ret, new_ret);
+
+		gsm[0] = TEST_GSM_ESCAPE;
+		gsm[1] = code;
+		old_ret = sat_gsm_old_gsm_to_ucs2(old_ucs2, gsm, 2);
+		new_ret = sat_mgr_convert_gsm_to_ucs2(new_ucs2, gsm, 2);
+		t->checked++;
+		if (old_ret != new_ret || memcmp(old_ucs2, new_ucs2, old_ret * sizeof(unsigned short)) != 0)
+			_fail(t, "escaped gsm to ucs2", code, old_ret, new_ret);
+	}
+}
+
+static void _check_random_strings(struct test *t, guint strings)
+{
+	unsigned short ucs2[TEST_MAX_CHARS];
+	unsigned char old_gsm[TEST_MAX_CHARS * 2];
+	unsigned char new_gsm[TEST_MAX_CHARS * 2];
+	unsigned short old_back[TEST_MAX_CHARS * 2];
+	unsigned short new_back[TEST_MAX_CHARS * 2];
+	int count;
+	int size;
+	int old_ret;
+	int new_ret;
+	int i;
+	guint n;
+
+	if (!t->mappable_count)
+		return;
+
+	for (n = 0; n < strings; n++) {
+		count = g_rand_int_range(t->rand, 1, TEST_MAX_CHARS + 1);
+		for (i = 0; i < count; i++)
+			ucs2[i] = t->mappable[g_rand_int_range(t->rand, 0, t->mappable_count)];
+
+		old_ret = sat_gsm_old_ucs2_to_gsm(old_gsm, ucs2, count);
+		new_ret = sat_mgr_convert_ucs2_to_gsm(new_gsm, ucs2, count);
+		t->checked++;
+		if (old_ret != new_ret || (old_ret > 0 && memcmp(old_gsm, new_gsm, old_ret) != 0)) {
+			_fail(t, "string to gsm", ucs2[0], old_ret, new_ret);
+			continue;
+		}
+
+		size = sat_mgr_get_gsm_code_size(ucs2, count);
+		t->checked++;
+		if (sat_gsm_old_get_gsm_code_size(ucs2, count) != size || size != new_ret)
+			_fail(t, "string code size", ucs2[0], new_ret, size);
+
+		old_ret = sat_gsm_old_gsm_to_ucs2(old_back, old_gsm, old_ret);
+		new_ret = sat_mgr_convert_gsm_to_ucs2(new_back, new_gsm, new_ret);
+		t->checked++;
+		if (old_ret != new_ret || memcmp(old_back, new_back, old_ret * sizeof(unsigned short)) != 0)
+			_fail(t, "string to ucs2", ucs2[0], old_ret, new_ret);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	struct test t;
+	GOptionContext *options;
+	GError *error = NULL;
+	gint64 seed = 1;
+	gint strings = 20000;
+	gboolean verbose = FALSE;
+
+	GOptionEntry entries[] = {
+		{ "seed", 's', 0, G_OPTION_ARG_INT64, &seed, "Random seed (1)", "N" },
+		{ "strings", 'n', 0, G_OPTION_ARG_INT, &strings, "Random strings (20000)", "N" },
+		{ "verbose", 'v', 0, G_OPTION_ARG_NONE, &verbose, "Print the plugin log", NULL },
+		{ NULL }
+	};
+
+	options = g_option_context_new("- check the SAT GSM 03.38 tables against the old table scans");
+	g_option_context_add_main_entries(options, entries, NULL);
+	if (!g_option_context_parse(options, &argc, &argv, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		return 2;
+	}
+	g_option_context_free(options);
+
+	stub_verbose = verbose;
+
+	memset(&t, 0, sizeof(struct test));
+	t.rand = g_rand_new_with_seed((guint32)seed);
+
+	_check_ucs2(&t);
+	_check_gsm(&t);
+	_check_random_strings(&t, strings > 0 ? (guint)strings : 0);
+
+	printf("seed %" G_GINT64_FORMAT ": %d GSM characters, %lu checks, %lu failed\n%s\n",
+			seed, t.mappable_count, t.checked, t.failed, t.failed ? "FAIL" : "PASS");
+
+	g_rand_free(t.rand);
+
+	return t.failed ? 1 : 0;
+}
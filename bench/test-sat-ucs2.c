@@ -0,0 +1,346 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Checks the UCS2 to UTF-8 encoder of sat_util.c against iconv.
+ *
+ *   ./test-sat-ucs2 --seed 1 --strings 20000
+ *
+ * Every single code unit and every surrogate pair is compared, then
+ * random strings in both byte orders, with every output size up to the
+ * full length. Unpaired surrogates, which iconv rejects, are expected as
+ * U+FFFD. Finally sat_mgr_convert_string() must stay inside the
+ * dest_size it is given for every alphabet.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <iconv.h>
+#include <glib.h>
+
+#include "stub.h"
+
+/* the encoder is static */
+#include "sat_util.c"
+
+#define TEST_MAX_UNITS 160
+#define TEST_OUT_MAX (TEST_MAX_UNITS * 3 + 1)
+#define TEST_CANARY 0xA5
+#define TEST_DEST_SIZE 16
+#define TEST_SRC_MAX 255
+
+struct test {
+	iconv_t be;
+	iconv_t le;
+	GRand *rand;
+	unsigned long checked;
+	unsigned long failed;
+};
+
+static void _put_unit(unsigned char *p, unsigned int unit, gboolean be)
+{
+	p[be ? 0 : 1] = (unit >> 8) & 0xFF;
+	p[be ? 1 : 0] = unit & 0xFF;
+}
+
+/* iconv of units, with unpaired surrogates replaced the way the encoder does */
+static int _reference(struct test *t, const unsigned int *units, int count, gboolean be, char *out, size_t out_size)
+{
+	unsigned char in[TEST_MAX_UNITS * 2];
+	char *inp = (char *)in;
+	char *outp = out;
+	size_t in_left;
+	size_t out_left = out_size - 1;
+	unsigned int unit;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		unit = units[i];
+		if (unit >= 0xD800 && unit <= 0xDBFF && i + 1 < count
+				&& units[i + 1] >= 0xDC00 && units[i + 1] <= 0xDFFF) {
+			_put_unit(in + i * 2, unit, be);
+			_put_unit(in + (i + 1) * 2, units[i + 1], be);
+			i++;
+			continue;
+		}
+
+		if (unit >= 0xD800 && unit <= 0xDFFF)
+			unit = 0xFFFD;
+		_put_unit(in + i * 2, unit, be);
+	}
+
+	in_left = count * 2;
+	iconv(be ? t->be : t->le, NULL, NULL, NULL, NULL);
+	if (iconv(be ? t->be : t->le, &inp, &in_left, &outp, &out_left) == (size_t)-1)
+		return -1;
+
+	*outp = '\0';
+
+	return outp - out;
+}
+
+static gboolean _compare(struct test *t, const char *what, const unsigned int *units, int count, gboolean be)
+{
+	unsigned char in[TEST_MAX_UNITS * 2];
+	char expected[TEST_OUT_MAX];
+	char out[TEST_OUT_MAX + 1];
+	int expected_len;
+	int len;
+	int i;
+
+	for (i = 0; i < count; i++)
+		_put_unit(in + i * 2, units[i], be);
+
+	expected_len = _reference(t, units, count, be, expected, sizeof(expected));
+	len = _convert_ucs2_to_utf8(out, sizeof(out), in, count, be ? G_BIG_ENDIAN : G_LITTLE_ENDIAN);
+
+	t->checked++;
+	if (expected_len == len && memcmp(out, expected, len + 1) == 0)
+		return TRUE;
+
+	t->failed++;
+	if (t->failed <= 10) {
+		fprintf(stderr, "%s (%s, %d units, first 0x%04X): iconv %d bytes, encoder %d bytes\n",
+				what, be ? "BE" : "LE", count, count ? units[0] : 0, expected_len, len);
+	}
+
+	return FALSE;
+}
+
+/* every output size: a NUL terminated prefix, cut at a character, nothing written past it */
+static gboolean _compare_truncated(struct test *t, const unsigned int *units, int count, gboolean be)
+{
+	unsigned char in[TEST_MAX_UNITS * 2];
+	char full[TEST_OUT_MAX];
+	unsigned char out[TEST_OUT_MAX + 1];
+	int full_len;
+	int next_len;
+	int size;
+	int len;
+	int i;
+
+	for (i = 0; i < count; i++)
+		_put_unit(in + i * 2, units[i], be);
+
+	full_len = _convert_ucs2_to_utf8(full, sizeof(full), in, count, be ? G_BIG_ENDIAN : G_LITTLE_ENDIAN);
+
+	for (size = 1; size <= full_len + 1; size++) {
+		memset(out, TEST_CANARY, sizeof(out));
+		len = _convert_ucs2_to_utf8((char *)out, size, in, count, be ? G_BIG_ENDIAN : G_LITTLE_ENDIAN);
+
+		for (next_len = 1; len + next_len < full_len && (full[len + next_len] & 0xC0) == 0x80; next_len++)
+			;
+
+		t->checked++;
+		if (len < size && out[len] == '\0' && memcmp(out, full, len) == 0
+				&& out[size] == TEST_CANARY
+				&& (len == full_len || len + next_len > size - 1))
+			continue;
+
+		t->failed++;
+		if (t->failed <= 10)
+			fprintf(stderr, "truncated to %d of %d bytes: wrote %d\n", size, full_len, len);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+static void _check_single_units(struct test *t)
+{
+	unsigned int unit;
+
+	for (unit = 0; unit <= 0xFFFF; unit++) {
+		_compare(t, "unit", &unit, 1, TRUE);
+		_compare(t, "unit", &unit, 1, FALSE);
+	}
+}
+
+static void _check_surrogate_pairs(struct test *t)
+{
+	unsigned int pair[2];
+
+	for (pair[0] = 0xD800; pair[0] <= 0xDBFF; pair[0]++) {
+		for (pair[1] = 0xDC00; pair[1] <= 0xDFFF; pair[1]++)
+			_compare(t, "pair", pair, 2, TRUE);
+	}
+}
+
+static int _random_units(struct test *t, unsigned int *units)
+{
+	int count;
+	int run;
+	int kind;
+	int i = 0;
+
+	count = g_rand_int_range(t->rand, 0, TEST_MAX_UNITS + 1);
+
+	while (i < count) {
+		kind = g_rand_int_range(t->rand, 0, 10);
+
+		if (kind < 4) {
+			/* ASCII runs, long enough for the fast path */
+			for (run = g_rand_int_range(t->rand, 1, 20); run > 0 && i < count; run--)
+				units[i++] = g_rand_int_range(t->rand, 0x01, 0x80);
+		} else if (kind < 6) {
+			units[i++] = g_rand_int_range(t->rand, 0x80, 0x800);
+		} else if (kind < 8) {
+			units[i] = g_rand_int_range(t->rand, 0x800, 0xF800);
+			if (units[i] >= 0xD800)
+				units[i] += 0x800;
+			i++;
+		} else if (kind < 9 && i + 1 < count) {
+			units[i++] = g_rand_int_range(t->rand, 0xD800, 0xDC00);
+			units[i++] = g_rand_int_range(t->rand, 0xDC00, 0xE000);
+		} else {
+			units[i++] = g_rand_int_range(t->rand, 0xD800, 0xE000);
+		}
+	}
+
+	return count;
+}
+
+static void _check_random_strings(struct test *t, guint strings)
+{
+	unsigned int units[TEST_MAX_UNITS];
+	int count;
+	guint i;
+
+	for (i = 0; i < strings; i++) {
+		count = _random_units(t, units);
+		_compare(t, "string", units, count, TRUE);
+		_compare(t, "string", units, count, FALSE);
+		if (i % 16 == 0)
+			_compare_truncated(t, units, count, i % 32 == 0);
+	}
+}
+
+static void _check_convert_string(struct test *t, const char *what, enum alphabet_format dcs,
+		unsigned char *src, unsigned short src_len)
+{
+	unsigned char dest[TEST_DEST_SIZE * 2];
+	unsigned short dest_len = 0;
+	int i;
+
+	memset(dest, TEST_CANARY, sizeof(dest));
+	sat_mgr_convert_string(dest, TEST_DEST_SIZE, &dest_len, dcs, src, src_len);
+
+	t->checked++;
+	for (i = TEST_DEST_SIZE; i < (int)sizeof(dest); i++) {
+		if (dest[i] != TEST_CANARY) {
+			t->failed++;
+			fprintf(stderr, "sat_mgr_convert_string %s: wrote past dest_size %d\n", what, TEST_DEST_SIZE);
+			return;
+		}
+	}
+
+	if (!memchr(dest, '\0', TEST_DEST_SIZE)) {
+		t->failed++;
+		fprintf(stderr, "sat_mgr_convert_string %s: not terminated\n", what);
+	}
+}
+
+static void _check_dest_size(struct test *t)
+{
+	unsigned char src[TEST_SRC_MAX + 1];
+	unsigned char text[TEST_SRC_MAX];
+	unsigned char *packed;
+	int i;
+
+	/* 0x80: big endian UCS2, three UTF-8 bytes per unit */
+	src[0] = 0x80;
+	for (i = 1; i + 1 < TEST_SRC_MAX; i += 2)
+		_put_unit(src + i, 0xAC00, TRUE);
+	_check_convert_string(t, "UCS2 0x80", ALPHABET_FROMAT_UCS2, src, TEST_SRC_MAX);
+
+	/* no prefix */
+	for (i = 0; i + 1 < TEST_SRC_MAX; i += 2)
+		_put_unit(src + i, 0xAC00, TRUE);
+	_check_convert_string(t, "UCS2", ALPHABET_FROMAT_UCS2, src, TEST_SRC_MAX - 1);
+
+	/* 0x81: length, base pointer, then GSM characters */
+	src[0] = 0x81;
+	src[1] = 100;
+	src[2] = 0x01;
+	memset(src + 3, 'A', 100);
+	_check_convert_string(t, "UCS2 0x81", ALPHABET_FROMAT_UCS2, src, 103);
+
+	memset(src, 'A', 200);
+	_check_convert_string(t, "8 bit", ALPHABET_FROMAT_8BIT_DATA, src, 200);
+
+	memset(text, 'A', 160);
+	packed = tcore_util_pack_gsm7bit(text, 160);
+	if (packed) {
+		memcpy(src, packed, 140);
+		free(packed);
+		_check_convert_string(t, "SMS default", ALPHABET_FROMAT_SMS_DEFAULT, src, 140);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	struct test t;
+	GOptionContext *options;
+	GError *error = NULL;
+	gint64 seed = 1;
+	gint strings = 20000;
+	gboolean verbose = FALSE;
+
+	GOptionEntry entries[] = {
+		{ "seed", 's', 0, G_OPTION_ARG_INT64, &seed, "Random seed (1)", "N" },
+		{ "strings", 'n', 0, G_OPTION_ARG_INT, &strings, "Random strings (20000)", "N" },
+		{ "verbose", 'v', 0, G_OPTION_ARG_NONE, &verbose, "Print the plugin log", NULL },
+		{ NULL }
+	};
+
+	options = g_option_context_new("- check the SAT UCS2 encoder against iconv");
+	g_option_context_add_main_entries(options, entries, NULL);
+	if (!g_option_context_parse(options, &argc, &argv, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		return 2;
+	}
+	g_option_context_free(options);
+
+	stub_verbose = verbose;
+
+	memset(&t, 0, sizeof(struct test));
+	t.be = iconv_open("UTF-8", "UTF-16BE");
+	t.le = iconv_open("UTF-8", "UTF-16LE");
+	if (t.be == (iconv_t)-1 || t.le == (iconv_t)-1) {
+		fprintf(stderr, "iconv_open: %s\n", strerror(errno));
+		return 1;
+	}
+	t.rand = g_rand_new_with_seed((guint32)seed);
+
+	_check_single_units(&t);
+	_check_surrogate_pairs(&t);
+	_check_random_strings(&t, strings > 0 ? (guint)strings : 0);
+	_check_dest_size(&t);
+
+	printf("seed %" G_GINT64_FORMAT ": %lu checks, %lu failed\n%s\n",
+			seed, t.checked, t.failed, t.failed ? "FAIL" : "PASS");
+
+	g_rand_free(t.rand);
+	iconv_close(t.be);
+	iconv_close(t.le);
+
+	return t.failed ? 1 : 0;
+}
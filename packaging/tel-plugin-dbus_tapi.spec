@@ -13,6 +13,7 @@ Requires(postun): /sbin/ldconfig
 BuildRequires:  cmake
 BuildRequires:  pkgconfig(glib-2.0)
 BuildRequires:  pkgconfig(gobject-2.0)
+BuildRequires:  pkgconfig(gthread-2.0)
 BuildRequires:  pkgconfig(gio-2.0)
 BuildRequires:  pkgconfig(gio-unix-2.0)
 BuildRequires:  pkgconfig(tcore)
@@ -48,3 +49,4 @@ rm -rf %{buildroot}
 #%doc COPYING
 %{_libdir}/telephony/plugins/*
 %{_prefix}/etc/dbus-1/system.d/*
+%{_bindir}/tapi-trace-decode
@@ -24,6 +24,191 @@
 #include "common.h"
 
 
+#define MAX_CALL_STATUS_NUM 7
+
+struct call_entry {
+	gint id;
+	gchar number[MAX_CALL_NUMBER_LEN];
+	gint type;
+	gboolean direction;
+	gint status;
+	gboolean multiparty;
+};
+
+static gint _call_entry_compare(gconstpointer a, gconstpointer b)
+{
+	const struct call_entry *ea = a;
+	const struct call_entry *eb = b;
+
+	return ea->id - eb->id;
+}
+
+static struct call_entry *_call_table_find(struct dbus_modem_context *modem, gint call_id)
+{
+	GSList *l;
+
+	for (l = modem->calls; l; l = l->next) {
+		struct call_entry *entry = l->data;
+
+		if (entry->id == call_id)
+			return entry;
+	}
+
+	return NULL;
+}
+
+static void _call_entry_fill(struct call_entry *entry, CallObject *co)
+{
+	int len;
+
+	entry->id = tcore_call_object_get_id( co );
+
+	memset(entry->number, 0, MAX_CALL_NUMBER_LEN);
+	len = tcore_call_object_get_number( co, entry->number );
+	if ( !len ) {
+		dbg("[ check ] no number : (0x%d)", entry->id);
+	}
+
+	entry->type = tcore_call_object_get_type( co );
+	entry->direction = ( tcore_call_object_get_direction( co ) == TCORE_CALL_DIRECTION_OUTGOING );
+	entry->status = tcore_call_object_get_status( co );
+	entry->multiparty = tcore_call_object_get_multiparty_state( co );
+}
+
+/*
+ * rebuild the table from tcore: once per modem, and after JOIN/SPLIT/SWAP,
+ * which change several calls while the status notifications name only one
+ */
+static void _call_table_sync(struct dbus_modem_context *modem)
+{
+	CoreObject *o;
+	GSList *list;
+	GSList *tmp;
+	struct call_entry *entry;
+	int i;
+
+	g_slist_free_full(modem->calls, g_free);
+	modem->calls = NULL;
+	modem->calls_synced = TRUE;
+
+	o = MODEM_CO(modem, CORE_OBJECT_TYPE_CALL);
+	if ( !o ) {
+		dbg("[ error ] call core object : 0");
+		return;
+	}
+
+	for ( i=0; i<MAX_CALL_STATUS_NUM; i++ ) {
+		list = tcore_call_object_find_by_status( o, i );
+
+		for ( tmp = list; tmp; tmp = g_slist_next( tmp ) ) {
+			if ( !tmp->data ) {
+				dbg("[ error ] call object : 0");
+				continue;
+			}
+
+			entry = g_new0(struct call_entry, 1);
+			_call_entry_fill(entry, tmp->data);
+			modem->calls = g_slist_insert_sorted(modem->calls, entry, _call_entry_compare);
+		}
+
+		g_slist_free(list);
+	}
+}
+
+static GVariant *_call_table_to_variant(struct dbus_modem_context *modem)
+{
+	GVariantBuilder b;
+	GSList *l;
+
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+
+	for (l = modem ? modem->calls : NULL; l; l = l->next) {
+		const struct call_entry *entry = l->data;
+
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "call_id", g_variant_new_int32( entry->id ));
+		g_variant_builder_add(&b, "{sv}", "call_number", g_variant_new_string( entry->number ));
+		g_variant_builder_add(&b, "{sv}", "call_type", g_variant_new_int32( entry->type ));
+		g_variant_builder_add(&b, "{sv}", "call_direction", g_variant_new_boolean( entry->direction ));
+		g_variant_builder_add(&b, "{sv}", "call_state", g_variant_new_int32( entry->status ));
+		g_variant_builder_add(&b, "{sv}", "call_multiparty_state", g_variant_new_boolean( entry->multiparty ));
+		g_variant_builder_close(&b);
+	}
+
+	return g_variant_builder_end(&b);
+}
+
+/*
+ * Refresh the table from tcore after a status notification and publish
+ * it as the "calls" property. The notified call is added or dropped (an
+ * idle call, or one tcore no longer knows about); the others are
+ * refreshed too, since a multiparty change only names one of them.
+ */
+static void _call_table_update(struct dbus_modem_context *modem, TelephonyCall *call, gint call_id, gboolean idle)
+{
+	struct call_entry *entry;
+	struct call_entry *other;
+	CoreObject *o;
+	CallObject *co = 0;
+	GSList *l;
+	GSList *next;
+
+	if ( !modem )
+		return;
+
+	if ( !modem->calls_synced )
+		_call_table_sync(modem);
+
+	o = MODEM_CO(modem, CORE_OBJECT_TYPE_CALL);
+	entry = _call_table_find(modem, call_id);
+
+	if ( !idle && o )
+		co = tcore_call_object_find_by_id( o, call_id );
+
+	if ( !co ) {
+		if ( entry ) {
+			modem->calls = g_slist_remove(modem->calls, entry);
+			g_free(entry);
+			entry = NULL;
+		}
+	} else {
+		if ( !entry ) {
+			entry = g_new0(struct call_entry, 1);
+			_call_entry_fill(entry, co);
+			modem->calls = g_slist_insert_sorted(modem->calls, entry, _call_entry_compare);
+		} else {
+			_call_entry_fill(entry, co);
+		}
+	}
+
+	for (l = modem->calls; l; l = next) {
+		next = l->next;
+		other = l->data;
+
+		if ( other == entry )
+			continue;
+
+		co = o ? tcore_call_object_find_by_id( o, other->id ) : 0;
+		if ( !co ) {
+			modem->calls = g_slist_delete_link(modem->calls, l);
+			g_free(other);
+		} else {
+			_call_entry_fill(other, co);
+		}
+	}
+
+	telephony_call_set_calls(call, _call_table_to_variant(modem));
+}
+
+static void _call_table_resync(struct dbus_modem_context *modem, TelephonyCall *call)
+{
+	if ( !modem )
+		return;
+
+	_call_table_sync(modem);
+	telephony_call_set_calls(call, _call_table_to_variant(modem));
+}
+
 static void _launch_voice_call( struct tnoti_call_status_incoming* incoming )
 {
 	char id[2] = {0, };
@@ -125,6 +310,42 @@ static void _launch_video_call( struct tnoti_call_status_incoming* incoming )
 	dbg("VT AUL return %d",ret);
 }
 
+/* incoming call UI launch, run by the launcher thread (launcher.c) */
+struct call_launch {
+	struct tnoti_call_status_incoming incoming;
+	gint64 noti_time;
+};
+
+static void _call_launch_run(gpointer data)
+{
+	struct call_launch *job = data;
+	gint64 start;
+
+	start = g_get_monotonic_time();
+	dbg("[ timing ] call id(%d) : launch request %lld us after incoming noti",
+			job->incoming.id, (long long)(start - job->noti_time));
+
+	if ( job->incoming.type != CALL_TYPE_VIDEO )
+		_launch_voice_call( &job->incoming );
+	else
+		_launch_video_call( &job->incoming );
+
+	dbg("[ timing ] call id(%d) : launch took %lld us",
+			job->incoming.id, (long long)(g_get_monotonic_time() - start));
+}
+
+static void _call_launch_queue(struct custom_data *ctx, const struct tnoti_call_status_incoming *incoming, gint64 noti_time)
+{
+	struct call_launch *job;
+
+	job = g_new0(struct call_launch, 1);
+	memcpy(&job->incoming, incoming, sizeof(struct tnoti_call_status_incoming));
+	job->noti_time = noti_time;
+
+	if ( !dbus_plugin_launch(ctx, _call_launch_run, job, g_free) )
+		err("call id(%d) : incoming call UI not launched", incoming->id);
+}
+
 static gboolean on_call_dial(TelephonyCall *call, GDBusMethodInvocation *invocation, gint call_type, gchar* call_number, gpointer user_data)
 {
 	struct treq_call_dial req;
@@ -138,15 +359,16 @@ static gboolean on_call_dial(TelephonyCall *call, GDBusMethodInvocation *invocat
 		return FALSE;
 	}
 
+	memset( &req, 0, sizeof( struct treq_call_dial ) );
 	req.type = call_type;
 
 	if ( call_number )
-		memcpy( req.number, call_number, MAX_CALL_DIAL_NUM_LEN );
+		memcpy( req.number, call_number, MIN( strlen( call_number ), MAX_CALL_DIAL_NUM_LEN ) );
 
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_dial ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_DIAL );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -174,7 +396,7 @@ static gboolean on_call_answer(TelephonyCall *call, GDBusMethodInvocation *invoc
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_answer ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_ANSWER );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -202,7 +424,7 @@ static gboolean on_call_end(TelephonyCall *call, GDBusMethodInvocation *invocati
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_end ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_END );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -230,7 +452,7 @@ static gboolean on_call_dtmf(TelephonyCall *call, GDBusMethodInvocation *invocat
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_dtmf ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_SEND_DTMF );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -257,7 +479,7 @@ static gboolean on_call_active(TelephonyCall *call, GDBusMethodInvocation *invoc
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_active ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_ACTIVE );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -284,7 +506,7 @@ static gboolean on_call_hold(TelephonyCall *call, GDBusMethodInvocation *invocat
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_hold ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_HOLD );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -311,7 +533,7 @@ static gboolean on_call_swap(TelephonyCall *call, GDBusMethodInvocation *invocat
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_swap ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_SWAP );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -338,7 +560,7 @@ static gboolean on_call_join(TelephonyCall *call, GDBusMethodInvocation *invocat
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_join ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_JOIN );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -365,7 +587,7 @@ static gboolean on_call_split(TelephonyCall *call, GDBusMethodInvocation *invoca
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_split ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_SPLIT );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -392,7 +614,7 @@ static gboolean on_call_transfer(TelephonyCall *call, GDBusMethodInvocation *inv
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_transfer ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_TRANSFER );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -420,7 +642,7 @@ static gboolean on_call_deflect(TelephonyCall *call, GDBusMethodInvocation *invo
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_deflect ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_DEFLECT );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -487,104 +709,17 @@ static gboolean on_call_get_status(TelephonyCall *call, GDBusMethodInvocation *i
 
 static gboolean on_call_get_status_all(TelephonyCall *call, GDBusMethodInvocation *invocation, gpointer user_data )
 {
-	struct custom_data *ctx = user_data;
-	TcorePlugin *plugin = 0;
-	GSList *list = 0;
-	CoreObject *o = 0;
-	CallObject *co = 0;
-
+	struct dbus_modem_context *modem;
 	GVariant *gv = 0;
-	GVariantBuilder b;
-
-	gint call_id;
-	gchar call_number[MAX_CALL_NUMBER_LEN];
-	gint call_type;
-	gboolean call_direction;
-	gint call_status;
-	gboolean call_multiparty_state;
-
-	int len, i;
-
-	plugin = tcore_server_find_plugin(ctx->server, TCORE_PLUGIN_DEFAULT);
-	if ( !plugin ) {
-		dbg("[ error ] plugin : 0");
-		return FALSE;
-	}
-
-	list = tcore_plugin_get_core_objects_bytype(plugin, CORE_OBJECT_TYPE_CALL);
-	if ( !list ) {
-		dbg("[ error ] co_list : 0");
-		return FALSE;
-	}
-
-	o = (CoreObject *)list->data;
-	g_slist_free(list);
-
-	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
-
-#define MAX_CALL_STATUS_NUM 7
-	for ( i=0; i<MAX_CALL_STATUS_NUM; i++ ) {
-		list = tcore_call_object_find_by_status( o, i );
-
-		if ( list ) {
-
-			GSList *tmp = 0;
-			tmp = list;
-
-			dbg("[ check ] there is a call on state (0x%x)", i);
-
-			while ( tmp ) {
-
-				co = (CallObject*)list->data;
-				if ( !co ) {
-					dbg("[ error ] call object : 0");
-					tmp = tmp->next;
-					continue;
-				}
-
-				call_id = tcore_call_object_get_id( co );
-				len = tcore_call_object_get_number( co, call_number );
-				if ( !len ) {
-					dbg("[ check ] no number : (0x%d)", call_id);
-				}
-
-				call_type = tcore_call_object_get_type( co );
-				call_direction = tcore_call_object_get_direction( co );
-
-				if ( call_direction == TCORE_CALL_DIRECTION_OUTGOING ) {
-					call_direction = TRUE;
-				} else {
-					call_direction = FALSE;
-				}
-
-				call_status = tcore_call_object_get_status( co );
-				call_multiparty_state = tcore_call_object_get_multiparty_state( co );
-
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "call_id", g_variant_new_int32( call_id ));
-				g_variant_builder_add(&b, "{sv}", "call_number", g_variant_new_string( call_number ));
-				g_variant_builder_add(&b, "{sv}", "call_type", g_variant_new_int32( call_type ));
-				g_variant_builder_add(&b, "{sv}", "call_direction", g_variant_new_boolean( call_direction ));
-				g_variant_builder_add(&b, "{sv}", "call_state", g_variant_new_int32( call_status ));
-				g_variant_builder_add(&b, "{sv}", "call_multiparty_state", g_variant_new_boolean( call_multiparty_state ));
-				g_variant_builder_close(&b);
-
-				tmp = g_slist_next( tmp );
-			}
-
-		} else {
-			dbg("[ check ] there is no call on state (0x%x)", i);
-
-		}
 
-	}
+	modem = dbus_plugin_ref_modem_by_interface(call);
+	if ( modem && !modem->calls_synced )
+		_call_table_sync(modem);
 
-	gv = g_variant_builder_end(&b);
+	gv = _call_table_to_variant(modem);
 
 	telephony_call_complete_get_status_all(call, invocation, gv);
 
-	g_variant_unref(gv);
-
 	return TRUE;
 }
 
@@ -607,7 +742,7 @@ static gboolean on_call_set_sound_path(TelephonyCall *call, GDBusMethodInvocatio
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_sound_set_path ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_SET_SOUND_PATH );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -635,7 +770,7 @@ static gboolean on_call_get_volume(TelephonyCall *call, GDBusMethodInvocation *i
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_sound_get_volume_level ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_GET_SOUND_VOLUME_LEVEL );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -664,7 +799,7 @@ static gboolean on_call_set_volume(TelephonyCall *call, GDBusMethodInvocation *i
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_sound_set_volume_level ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_SET_SOUND_VOLUME_LEVEL );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -687,7 +822,7 @@ static gboolean on_call_get_mute_status(TelephonyCall *call, GDBusMethodInvocati
 
 	tcore_user_request_set_command( ur, TREQ_CALL_GET_MUTE_STATUS );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -710,7 +845,7 @@ static gboolean on_call_mute(TelephonyCall *call, GDBusMethodInvocation *invocat
 
 	tcore_user_request_set_command( ur, TREQ_CALL_MUTE );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -733,7 +868,7 @@ static gboolean on_call_unmute(TelephonyCall *call, GDBusMethodInvocation *invoc
 
 	tcore_user_request_set_command( ur, TREQ_CALL_UNMUTE );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -761,7 +896,7 @@ static gboolean on_call_set_sound_recording(TelephonyCall *call, GDBusMethodInvo
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_sound_set_recording ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_SET_SOUND_RECORDING );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -791,7 +926,7 @@ static gboolean on_call_set_sound_equalization(TelephonyCall *call, GDBusMethodI
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_sound_set_equalization ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_SET_SOUND_EQUALIZATION );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -819,7 +954,7 @@ static gboolean on_call_set_sound_noise_reduction(TelephonyCall *call, GDBusMeth
 	tcore_user_request_set_data( ur, sizeof( struct treq_call_sound_set_noise_reduction ), &req );
 	tcore_user_request_set_command( ur, TREQ_CALL_SET_SOUND_NOISE_REDUCTION );
 
-	ret = tcore_communicator_dispatch_request( ctx->comm, ur );
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if ( ret != TCORE_RETURN_SUCCESS ) {
 		dbg("[ error ] tcore_communicator_dispatch_request() : (0x%x)", ret);
 		return FALSE;
@@ -952,406 +1087,501 @@ gboolean dbus_plugin_setup_call_interface(TelephonyObjectSkeleton *object, struc
 	return TRUE;
 }
 
-gboolean dbus_plugin_call_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+static gboolean _call_dial_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
 {
-	int i = 0;
-	GSList *co_list;
-	CoreObject *co_call;
-	char *modem_name = NULL;
-	TcorePlugin *p = NULL;
+	struct tresp_call_dial *resp = (struct tresp_call_dial*)data;
 
-	modem_name = tcore_user_request_get_modem_name(ur);
-	if (!modem_name)
-		return FALSE;
+	dbg("receive TRESP_CALL_DIAL");
+	dbg("resp->err : [%d]", resp->err);
 
-	p = tcore_server_find_plugin(ctx->server, modem_name);
-	free(modem_name);
-	if (!p)
-		return FALSE;
+	telephony_call_complete_dial(dbus_info->interface_object, dbus_info->invocation, resp->err);
 
-	co_list = tcore_plugin_get_core_objects_bytype(p, CORE_OBJECT_TYPE_NETWORK);
-	if (!co_list) {
-		return FALSE;
-	}
+	return TRUE;
+}
 
-	co_call = (CoreObject *)co_list->data;
-	g_slist_free(co_list);
+static gboolean _call_answer_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_answer *resp = (struct tresp_call_answer*)data;
 
-	if (!co_call) {
-		return FALSE;
-	}
+	dbg("receive TRESP_CALL_ANSWER");
+	dbg("resp->err : [%d]", resp->err);
+	dbg("resp->id : [%d]", resp->id);
+
+	telephony_call_complete_answer(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id );
+
+	return TRUE;
+}
 
-	switch (command) {
-		case TRESP_CALL_DIAL: {
-			struct tresp_call_dial *resp = (struct tresp_call_dial*)data;
+static gboolean _call_end_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_end *resp = (struct tresp_call_end*)data;
+
+	dbg("receive TRESP_CALL_END");
+	dbg("resp->err : [%d]", resp->err);
+	dbg("resp->id : [%d]", resp->err);
+	dbg("resp->type : [%d]", resp->type);
+
+	telephony_call_complete_end(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id, resp->type );
+
+	return TRUE;
+}
+
+static gboolean _call_hold_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_hold *resp = (struct tresp_call_hold*)data;
 
-			dbg("receive TRESP_CALL_DIAL");
-			dbg("resp->err : [%d]", resp->err);
+	dbg("receive TRESP_CALL_HOLD");
+	dbg("resp->err : [%d]", resp->err);
+	dbg("resp->id : [%d]", resp->id);
 
-			telephony_call_complete_dial(dbus_info->interface_object, dbus_info->invocation, resp->err);
-		} break;
+	telephony_call_complete_hold(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id );
 
-		case TRESP_CALL_ANSWER: {
-			struct tresp_call_answer *resp = (struct tresp_call_answer*)data;
+	return TRUE;
+}
 
-			dbg("receive TRESP_CALL_ANSWER");
-			dbg("resp->err : [%d]", resp->err);
-			dbg("resp->id : [%d]", resp->id);
+static gboolean _call_active_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_active *resp = (struct tresp_call_active*)data;
 
-			telephony_call_complete_answer(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id );
+	dbg("receive TRESP_CALL_ACTIVE");
+	dbg("resp->err : [%d]", resp->err);
+	dbg("resp->id : [%d]", resp->id);
 
-		} break;
+	telephony_call_complete_active(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id );
 
-		case TRESP_CALL_END: {
-			struct tresp_call_end *resp = (struct tresp_call_end*)data;
+	return TRUE;
+}
 
-			dbg("receive TRESP_CALL_END");
-			dbg("resp->err : [%d]", resp->err);
-			dbg("resp->id : [%d]", resp->err);
-			dbg("resp->type : [%d]", resp->type);
+static gboolean _call_swap_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_swap *resp = (struct tresp_call_swap*)data;
 
-			telephony_call_complete_end(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id, resp->type );
+	dbg("receive TRESP_CALL_SWAP");
+	dbg("resp->err : [%d]", resp->err);
+	dbg("resp->id : [%d]", resp->id);
 
-		} break;
+	_call_table_resync( dbus_plugin_ref_modem_by_request(ctx, ur, dbus_info), dbus_info->interface_object );
 
-		case TRESP_CALL_HOLD: {
-			struct tresp_call_hold *resp = (struct tresp_call_hold*)data;
+	telephony_call_complete_swap(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id );
 
-			dbg("receive TRESP_CALL_HOLD");
-			dbg("resp->err : [%d]", resp->err);
-			dbg("resp->id : [%d]", resp->id);
+	return TRUE;
+}
 
-			telephony_call_complete_hold(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id );
+static gboolean _call_join_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_join *resp = (struct tresp_call_join*)data;
 
-		} break;
+	dbg("receive TRESP_CALL_JOIN");
+	dbg("resp->err : [%d]", resp->err);
+	dbg("resp->id : [%d]", resp->id);
 
-		case TRESP_CALL_ACTIVE: {
-			struct tresp_call_active *resp = (struct tresp_call_active*)data;
+	_call_table_resync( dbus_plugin_ref_modem_by_request(ctx, ur, dbus_info), dbus_info->interface_object );
 
-			dbg("receive TRESP_CALL_ACTIVE");
-			dbg("resp->err : [%d]", resp->err);
-			dbg("resp->id : [%d]", resp->id);
+	telephony_call_complete_join(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id );
 
-			telephony_call_complete_active(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id );
+	return TRUE;
+}
 
-		} break;
+static gboolean _call_split_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_split *resp = (struct tresp_call_split*)data;
 
-		case TRESP_CALL_SWAP: {
-			struct tresp_call_swap *resp = (struct tresp_call_swap*)data;
+	dbg("receive TRESP_CALL_SPLIT");
+	dbg("resp->err : [%d]", resp->err);
+	dbg("resp->id : [%d]", resp->id);
 
-			dbg("receive TRESP_CALL_SWAP");
-			dbg("resp->err : [%d]", resp->err);
-			dbg("resp->id : [%d]", resp->id);
+	_call_table_resync( dbus_plugin_ref_modem_by_request(ctx, ur, dbus_info), dbus_info->interface_object );
 
-			telephony_call_complete_swap(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id );
+	telephony_call_complete_split(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id );
 
-		} break;
+	return TRUE;
+}
 
-		case TRESP_CALL_JOIN: {
-			struct tresp_call_join *resp = (struct tresp_call_join*)data;
+static gboolean _call_deflect_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_deflect *resp = (struct tresp_call_deflect*)data;
 
-			dbg("receive TRESP_CALL_JOIN");
-			dbg("resp->err : [%d]", resp->err);
-			dbg("resp->id : [%d]", resp->id);
+	dbg("receive TRESP_CALL_DEFLECT");
+	dbg("resp->err : [%d]", resp->err);
+	dbg("resp->id : [%d]", resp->id);
 
-			telephony_call_complete_join(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id );
+	telephony_call_complete_deflect(dbus_info->interface_object, dbus_info->invocation, resp->err );
 
-		} break;
+	return TRUE;
+}
 
+static gboolean _call_transfer_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_transfer *resp = (struct tresp_call_transfer*)data;
 
-		case TRESP_CALL_SPLIT: {
-			struct tresp_call_split *resp = (struct tresp_call_split*)data;
+	dbg("receive TRESP_CALL_TRANSFER");
+	dbg("resp->err : [%d]", resp->err);
+	dbg("resp->id : [%d]", resp->id);
 
-			dbg("receive TRESP_CALL_SPLIT");
-			dbg("resp->err : [%d]", resp->err);
-			dbg("resp->id : [%d]", resp->id);
+	telephony_call_complete_transfer(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id );
 
-			telephony_call_complete_split(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id );
+	return TRUE;
+}
 
-		} break;
+static gboolean _call_send_dtmf_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_dtmf *resp = (struct tresp_call_dtmf*)data;
 
-		case TRESP_CALL_DEFLECT: {
-			struct tresp_call_deflect *resp = (struct tresp_call_deflect*)data;
+	dbg("receive TRESP_CALL_SEND_DTMF");
+	dbg("resp->err : [%d]", resp->err);
 
-			dbg("receive TRESP_CALL_DEFLECT");
-			dbg("resp->err : [%d]", resp->err);
-			dbg("resp->id : [%d]", resp->id);
+	telephony_call_complete_dtmf(dbus_info->interface_object, dbus_info->invocation, resp->err);
 
-			telephony_call_complete_deflect(dbus_info->interface_object, dbus_info->invocation, resp->err );
+	return TRUE;
+}
 
-		} break;
+static gboolean _call_set_sound_path_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_sound_set_path *resp = (struct tresp_call_sound_set_path*)data;
 
-		case TRESP_CALL_TRANSFER: {
-			struct tresp_call_transfer *resp = (struct tresp_call_transfer*)data;
+	dbg("receive TRESP_CALL_SET_SOUND_PATH");
+	dbg("resp->err : [%d]", resp->err);
 
-			dbg("receive TRESP_CALL_TRANSFER");
-			dbg("resp->err : [%d]", resp->err);
-			dbg("resp->id : [%d]", resp->id);
+	telephony_call_complete_set_sound_path(dbus_info->interface_object, dbus_info->invocation, resp->err);
 
-			telephony_call_complete_transfer(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->id );
+	return TRUE;
+}
 
-		} break;
+static gboolean _call_set_sound_volume_level_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_sound_set_volume_level *resp = (struct tresp_call_sound_set_volume_level*)data;
 
-		case TRESP_CALL_SEND_DTMF: {
-			struct tresp_call_dtmf *resp = (struct tresp_call_dtmf*)data;
+	dbg("receive TRESP_CALL_SET_SOUND_VOLUME_LEVEL");
+	dbg("resp->err : [%d]", resp->err);
 
-			dbg("receive TRESP_CALL_SEND_DTMF");
-			dbg("resp->err : [%d]", resp->err);
+	telephony_call_complete_set_volume(dbus_info->interface_object, dbus_info->invocation, resp->err);
 
-			telephony_call_complete_dtmf(dbus_info->interface_object, dbus_info->invocation, resp->err);
-		} break;
+	return TRUE;
+}
 
-		case TRESP_CALL_SET_SOUND_PATH: {
-			struct tresp_call_sound_set_path *resp = (struct tresp_call_sound_set_path*)data;
+static gboolean _call_get_sound_volume_level_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	int i = 0;
+	struct tresp_call_sound_get_volume_level *resp = (struct tresp_call_sound_get_volume_level*)data;
+	GVariant *result = 0;
+	GVariantBuilder b;
 
-			dbg("receive TRESP_CALL_SET_SOUND_PATH");
-			dbg("resp->err : [%d]", resp->err);
+	dbg("receive TRESP_CALL_GET_SOUND_VOLUME_LEVEL");
 
-			telephony_call_complete_set_sound_path(dbus_info->interface_object, dbus_info->invocation, resp->err);
-		} break;
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
 
-		case TRESP_CALL_SET_SOUND_VOLUME_LEVEL: {
-			struct tresp_call_sound_set_volume_level *resp = (struct tresp_call_sound_set_volume_level*)data;
+	g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
 
-			dbg("receive TRESP_CALL_SET_SOUND_VOLUME_LEVEL");
-			dbg("resp->err : [%d]", resp->err);
+	dbg("resp->err : [%d]", resp->err);
 
-			telephony_call_complete_set_volume(dbus_info->interface_object, dbus_info->invocation, resp->err);
-		} break;
+	g_variant_builder_add(&b, "{sv}", "err", g_variant_new_int32(resp->err));
 
-		case TRESP_CALL_GET_SOUND_VOLUME_LEVEL: {
-			struct tresp_call_sound_get_volume_level *resp = (struct tresp_call_sound_get_volume_level*)data;
-			GVariant *result = 0;
-			GVariantBuilder b;
+	if ( !resp->err ) {
 
-			dbg("receive TRESP_CALL_GET_SOUND_VOLUME_LEVEL");
+		dbg("resp->record_num : [%d]", resp->record_num);
 
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+		for ( i=0; i<resp->record_num; i++ ) {
+			dbg("resp->type : [%d]", resp->record[i].sound);
+			dbg("resp->level : [%d]", resp->record[i].volume);
 
-			g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+			g_variant_builder_add(&b, "{sv}", "type", g_variant_new_int32(resp->record[i].sound));
+			g_variant_builder_add(&b, "{sv}", "level", g_variant_new_int32(resp->record[i].volume));
+		} 
 
-			dbg("resp->err : [%d]", resp->err);
+	}
 
-			g_variant_builder_add(&b, "{sv}", "err", g_variant_new_int32(resp->err));
+	g_variant_builder_close(&b);
 
-			if ( !resp->err ) {
+	result = g_variant_builder_end(&b);
 
-				dbg("resp->record_num : [%d]", resp->record_num);
+	telephony_call_complete_get_volume(dbus_info->interface_object, dbus_info->invocation, resp->err, result );
 
-				for ( i=0; i<resp->record_num; i++ ) {
-					dbg("resp->type : [%d]", resp->record[i].sound);
-					dbg("resp->level : [%d]", resp->record[i].volume);
+	return TRUE;
+}
 
-					g_variant_builder_add(&b, "{sv}", "type", g_variant_new_int32(resp->record[i].sound));
-					g_variant_builder_add(&b, "{sv}", "level", g_variant_new_int32(resp->record[i].volume));
-				} 
+static gboolean _call_mute_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_mute *resp = (struct tresp_call_mute*)data;
 
-			}
+	dbg("receive TRESP_CALL_MUTE");
+	dbg("resp->err : [%d]", resp->err);
 
-			g_variant_builder_close(&b);
+	telephony_call_complete_mute(dbus_info->interface_object, dbus_info->invocation, resp->err);
 
-			result = g_variant_builder_end(&b);
+	return TRUE;
+}
 
-			telephony_call_complete_get_volume(dbus_info->interface_object, dbus_info->invocation, resp->err, result );
+static gboolean _call_unmute_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_unmute *resp = (struct tresp_call_unmute*)data;
 
-			g_variant_unref(result);
+	dbg("receive TRESP_CALL_UNMUTE");
+	dbg("resp->err : [%d]", resp->err);
 
-		} break;
+	telephony_call_complete_unmute(dbus_info->interface_object, dbus_info->invocation, resp->err);
 
-		case TRESP_CALL_MUTE: {
-			struct tresp_call_mute *resp = (struct tresp_call_mute*)data;
+	return TRUE;
+}
 
-			dbg("receive TRESP_CALL_MUTE");
-			dbg("resp->err : [%d]", resp->err);
+static gboolean _call_get_mute_status_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_get_mute_status *resp = (struct tresp_call_get_mute_status*)data;
 
-			telephony_call_complete_mute(dbus_info->interface_object, dbus_info->invocation, resp->err);
-		} break;
+	dbg("receive TRESP_CALL_GET_MUTE_STATUS");
+	dbg("resp->err : [%d]", resp->err);
+	dbg("resp->status : [%d]", resp->status);
 
-		case TRESP_CALL_UNMUTE: {
-			struct tresp_call_unmute *resp = (struct tresp_call_unmute*)data;
+	telephony_call_complete_get_mute_status(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->status );
 
-			dbg("receive TRESP_CALL_UNMUTE");
-			dbg("resp->err : [%d]", resp->err);
+	return TRUE;
+}
 
-			telephony_call_complete_unmute(dbus_info->interface_object, dbus_info->invocation, resp->err);
-		} break;
+static gboolean _call_set_sound_recording_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_sound_set_recording *resp = (struct tresp_call_sound_set_recording*)data;
 
-		case TRESP_CALL_GET_MUTE_STATUS: {
-			struct tresp_call_get_mute_status *resp = (struct tresp_call_get_mute_status*)data;
+	telephony_call_complete_set_sound_recording(dbus_info->interface_object, dbus_info->invocation, resp->err );
 
-			dbg("receive TRESP_CALL_GET_MUTE_STATUS");
-			dbg("resp->err : [%d]", resp->err);
-			dbg("resp->status : [%d]", resp->status);
+	return TRUE;
+}
 
-			telephony_call_complete_get_mute_status(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->status );
+static gboolean _call_set_sound_equalization_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_sound_set_equalization *resp = (struct tresp_call_sound_set_equalization*)data;
 
-		} break;
+	telephony_call_complete_set_sound_equalization(dbus_info->interface_object, dbus_info->invocation, resp->err );
 
-		case TRESP_CALL_SET_SOUND_RECORDING: {
-			struct tresp_call_sound_set_recording *resp = (struct tresp_call_sound_set_recording*)data;
-			telephony_call_complete_set_sound_recording(dbus_info->interface_object, dbus_info->invocation, resp->err );
+	return TRUE;
+}
 
-		} break;
+static gboolean _call_set_sound_noise_reduction_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct tresp_call_sound_set_noise_reduction *resp = (struct tresp_call_sound_set_noise_reduction*)data;
 
-		case TRESP_CALL_SET_SOUND_EQUALIZATION: {
-			struct tresp_call_sound_set_equalization *resp = (struct tresp_call_sound_set_equalization*)data;
-			telephony_call_complete_set_sound_equalization(dbus_info->interface_object, dbus_info->invocation, resp->err );
+	telephony_call_complete_set_sound_noise_reduction(dbus_info->interface_object, dbus_info->invocation, resp->err );
 
-		} break;
+	return TRUE;
+}
 
-		case TRESP_CALL_SET_SOUND_NOISE_REDUCTION: {
-			struct tresp_call_sound_set_noise_reduction *resp = (struct tresp_call_sound_set_noise_reduction*)data;
-			telephony_call_complete_set_sound_noise_reduction(dbus_info->interface_object, dbus_info->invocation, resp->err );
+static const struct dbus_plugin_response_handler call_response_handlers[] = {
+	{ TRESP_CALL_DIAL, _call_dial_response },
+	{ TRESP_CALL_ANSWER, _call_answer_response },
+	{ TRESP_CALL_END, _call_end_response },
+	{ TRESP_CALL_HOLD, _call_hold_response },
+	{ TRESP_CALL_ACTIVE, _call_active_response },
+	{ TRESP_CALL_SWAP, _call_swap_response },
+	{ TRESP_CALL_JOIN, _call_join_response },
+	{ TRESP_CALL_SPLIT, _call_split_response },
+	{ TRESP_CALL_DEFLECT, _call_deflect_response },
+	{ TRESP_CALL_TRANSFER, _call_transfer_response },
+	{ TRESP_CALL_SEND_DTMF, _call_send_dtmf_response },
+	{ TRESP_CALL_SET_SOUND_PATH, _call_set_sound_path_response },
+	{ TRESP_CALL_SET_SOUND_VOLUME_LEVEL, _call_set_sound_volume_level_response },
+	{ TRESP_CALL_GET_SOUND_VOLUME_LEVEL, _call_get_sound_volume_level_response },
+	{ TRESP_CALL_MUTE, _call_mute_response },
+	{ TRESP_CALL_UNMUTE, _call_unmute_response },
+	{ TRESP_CALL_GET_MUTE_STATUS, _call_get_mute_status_response },
+	{ TRESP_CALL_SET_SOUND_RECORDING, _call_set_sound_recording_response },
+	{ TRESP_CALL_SET_SOUND_EQUALIZATION, _call_set_sound_equalization_response },
+	{ TRESP_CALL_SET_SOUND_NOISE_REDUCTION, _call_set_sound_noise_reduction_response },
+};
+
+static gboolean _call_status_idle_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyCall *call = telephony_object_peek_call(TELEPHONY_OBJECT(object));
+	struct dbus_modem_context *modem = dbus_plugin_ref_modem_by_object(object);
+	struct tnoti_call_status_idle *idle = (struct tnoti_call_status_idle*)data;
 
-		} break;
+	dbg("[ check ] call status : idle");
 
-		default:
-			dbg("not handled command[%d]", command);
-		break;
+	_call_table_update( modem, call, idle->id, TRUE );
 
+	if ( idle->type != CALL_TYPE_VIDEO ) {
+		dbg("[ check ] this is voice call");
+		telephony_call_emit_voice_call_status_idle( call, idle->id, idle->cause, 0, 0 );
+	} else {
+		dbg("[ check ] this is video call");
+		telephony_call_emit_video_call_status_idle( call, idle->id, idle->cause, 0, 0 );
 	}
 
 	return TRUE;
 }
 
-gboolean dbus_plugin_call_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+static gboolean _call_status_dialing_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
 {
-	TelephonyCall *call;
+	TelephonyCall *call = telephony_object_peek_call(TELEPHONY_OBJECT(object));
+	struct dbus_modem_context *modem = dbus_plugin_ref_modem_by_object(object);
+	struct tnoti_call_status_dialing *dialing = (struct tnoti_call_status_dialing*)data;
 
-	if (!object) {
-		dbg("object is 0");
-		return FALSE;
-	}
+	dbg("[ check ] call status : dialing");
 
-	call = telephony_object_peek_call(TELEPHONY_OBJECT(object));
-	dbg("call = %p", call);
+	_call_table_update( modem, call, dialing->id, FALSE );
+	dbg("[ check ] call type : (%d)", dialing->type);
+	dbg("[ check ] call id : (%d)", dialing->id);
 
-	switch (command) {
-		case TNOTI_CALL_STATUS_IDLE: {
-			struct tnoti_call_status_idle *idle = (struct tnoti_call_status_idle*)data;
+	if ( dialing->type != CALL_TYPE_VIDEO ) {
+		dbg("[ check ] this is voice call");
+		telephony_call_emit_voice_call_status_dialing( call, dialing->id );
+	} else {
+		dbg("[ check ] this is video call");
+		telephony_call_emit_video_call_status_dialing( call, dialing->id );
+	}
+
+	return TRUE;
+}
 
-			dbg("[ check ] call status : idle");
+static gboolean _call_status_alert_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyCall *call = telephony_object_peek_call(TELEPHONY_OBJECT(object));
+	struct dbus_modem_context *modem = dbus_plugin_ref_modem_by_object(object);
+	struct tnoti_call_status_alert *alert = (struct tnoti_call_status_alert*)data;
 
-			if ( idle->type != CALL_TYPE_VIDEO ) {
-				dbg("[ check ] this is voice call");
-				telephony_call_emit_voice_call_status_idle( call, idle->id, idle->cause, 0, 0 );
-			} else {
-				dbg("[ check ] this is video call");
-				telephony_call_emit_video_call_status_idle( call, idle->id, idle->cause, 0, 0 );
-			}
+	dbg("[ check ] call status : alert");
 
+	_call_table_update( modem, call, alert->id, FALSE );
 
-		} break;
-		case TNOTI_CALL_STATUS_DIALING: {
-			struct tnoti_call_status_dialing *dialing = (struct tnoti_call_status_dialing*)data;
+	if ( alert->type != CALL_TYPE_VIDEO ) {
+		dbg("[ check ] this is voice call");
+		telephony_call_emit_voice_call_status_alert( call, alert->id );
+	} else {
+		dbg("[ check ] this is video call");
+		telephony_call_emit_video_call_status_alert( call, alert->id );
+	}
 
-			dbg("[ check ] call status : dialing");
-			dbg("[ check ] call type : (%d)", dialing->type);
-			dbg("[ check ] call id : (%d)", dialing->id);
+	return TRUE;
+}
 
-			if ( dialing->type != CALL_TYPE_VIDEO ) {
-				dbg("[ check ] this is voice call");
-				telephony_call_emit_voice_call_status_dialing( call, dialing->id );
-			} else {
-				dbg("[ check ] this is video call");
-				telephony_call_emit_video_call_status_dialing( call, dialing->id );
-			}
+static gboolean _call_status_active_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyCall *call = telephony_object_peek_call(TELEPHONY_OBJECT(object));
+	struct dbus_modem_context *modem = dbus_plugin_ref_modem_by_object(object);
+	struct tnoti_call_status_active *active = (struct tnoti_call_status_active*)data;
 
-		} break;
-		case TNOTI_CALL_STATUS_ALERT: {
-			struct tnoti_call_status_alert *alert = (struct tnoti_call_status_alert*)data;
+	dbg("[ check ] call status : active");
 
-			dbg("[ check ] call status : alert");
+	_call_table_update( modem, call, active->id, FALSE );
 
-			if ( alert->type != CALL_TYPE_VIDEO ) {
-				dbg("[ check ] this is voice call");
-				telephony_call_emit_voice_call_status_alert( call, alert->id );
-			} else {
-				dbg("[ check ] this is video call");
-				telephony_call_emit_video_call_status_alert( call, alert->id );
-			}
+	if ( active->type != CALL_TYPE_VIDEO ) {
+		dbg("[ check ] this is voice call");
+		telephony_call_emit_voice_call_status_active( call, active->id );
+	} else {
+		dbg("[ check ] this is video call");
+		telephony_call_emit_video_call_status_active( call, active->id );
+	}
 
-		} break;
-		case TNOTI_CALL_STATUS_ACTIVE: {
-			struct tnoti_call_status_active *active = (struct tnoti_call_status_active*)data;
+	return TRUE;
+}
 
-			dbg("[ check ] call status : active");
+static gboolean _call_status_held_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyCall *call = telephony_object_peek_call(TELEPHONY_OBJECT(object));
+	struct dbus_modem_context *modem = dbus_plugin_ref_modem_by_object(object);
+	struct tnoti_call_status_held *held = (struct tnoti_call_status_held*)data;
 
-			if ( active->type != CALL_TYPE_VIDEO ) {
-				dbg("[ check ] this is voice call");
-				telephony_call_emit_voice_call_status_active( call, active->id );
-			} else {
-				dbg("[ check ] this is video call");
-				telephony_call_emit_video_call_status_active( call, active->id );
-			}
+	dbg("[ check ] call status : held");
 
-		} break;
-		case TNOTI_CALL_STATUS_HELD: {
-			struct tnoti_call_status_held *held = (struct tnoti_call_status_held*)data;
+	_call_table_update( modem, call, held->id, FALSE );
 
-			dbg("[ check ] call status : held");
+	telephony_call_emit_voice_call_status_held( call, held->id );
 
-			telephony_call_emit_voice_call_status_held( call, held->id );
+	return TRUE;
+}
 
-		} break;
-		case TNOTI_CALL_STATUS_INCOMING: {
-			struct tnoti_call_status_incoming *incoming = (struct tnoti_call_status_incoming*)data;
+static gboolean _call_status_incoming_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyCall *call = telephony_object_peek_call(TELEPHONY_OBJECT(object));
+	struct dbus_modem_context *modem = dbus_plugin_ref_modem_by_object(object);
+	struct tnoti_call_status_incoming *incoming = (struct tnoti_call_status_incoming*)data;
+	gint64 noti_time = g_get_monotonic_time();
 
-			dbg("[ check ] call status : incoming");
+	dbg("[ check ] call status : incoming");
 
-			if ( incoming->type != CALL_TYPE_VIDEO ) {
-				dbg("[ check ] this is voice call");
+	_call_table_update( modem, call, incoming->id, FALSE );
 
-				telephony_call_emit_voice_call_status_incoming( call, incoming->id );
+	if ( incoming->type != CALL_TYPE_VIDEO ) {
+		dbg("[ check ] this is voice call");
+		telephony_call_emit_voice_call_status_incoming( call, incoming->id );
+	} else {
+		dbg("[ check ] this is video call");
+		telephony_call_emit_video_call_status_incoming( call, incoming->id );
+	}
 
-				_launch_voice_call( incoming );
+	dbg("[ timing ] call id(%d) : incoming signal %lld us after noti",
+			incoming->id, (long long)(g_get_monotonic_time() - noti_time));
 
-			} else {
-				dbg("[ check ] this is video call");
-				telephony_call_emit_video_call_status_incoming( call, incoming->id );
+	_call_launch_queue( ctx, incoming, noti_time );
 
-				_launch_video_call( incoming );
-			}
+	return TRUE;
+}
 
-		} break;
+static gboolean _call_sound_path_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyCall *call = telephony_object_peek_call(TELEPHONY_OBJECT(object));
+	struct tnoti_call_sound_path *noti = (struct tnoti_call_sound_path*)data;
 
-		case TNOTI_CALL_SOUND_PATH: {
+	telephony_call_emit_call_sound_path( call, noti->path );
 
-			struct tnoti_call_sound_path *noti = (struct tnoti_call_sound_path*)data;
-			telephony_call_emit_call_sound_path( call, noti->path );
+	return TRUE;
+}
 
+static gboolean _call_sound_ringback_tone_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyCall *call = telephony_object_peek_call(TELEPHONY_OBJECT(object));
+	struct tnoti_call_sound_ringback_tone *noti = (struct tnoti_call_sound_ringback_tone*)data;
 
-		} break;
+	telephony_call_emit_call_sound_ringback_tone( call, (gint)noti->status );
 
-		case TNOTI_CALL_SOUND_RINGBACK_TONE: {
-			struct tnoti_call_sound_ringback_tone *noti = (struct tnoti_call_sound_ringback_tone*)data;
-			telephony_call_emit_call_sound_ringback_tone( call, (gint)noti->status );
+	return TRUE;
+}
 
-		} break;
+static gboolean _call_sound_wbamr_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyCall *call = telephony_object_peek_call(TELEPHONY_OBJECT(object));
+	struct tnoti_call_sound_wbamr *noti = (struct tnoti_call_sound_wbamr*)data;
 
-		case TNOTI_CALL_SOUND_WBAMR: {
-			struct tnoti_call_sound_wbamr *noti = (struct tnoti_call_sound_wbamr*)data;
-			telephony_call_emit_call_sound_wbamr( call, (gint)noti->status );
+	telephony_call_emit_call_sound_wbamr( call, (gint)noti->status );
 
-		} break;
+	return TRUE;
+}
 
-		case TNOTI_CALL_SOUND_EQUALIZATION: {
-			struct tnoti_call_sound_equalization *noti = (struct tnoti_call_sound_equalization*)data;
-			telephony_call_emit_call_sound_equalization( call, (gint)noti->mode, (gint)noti->direction );
+static gboolean _call_sound_equalization_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyCall *call = telephony_object_peek_call(TELEPHONY_OBJECT(object));
+	struct tnoti_call_sound_equalization *noti = (struct tnoti_call_sound_equalization*)data;
 
-		} break;
+	telephony_call_emit_call_sound_equalization( call, (gint)noti->mode, (gint)noti->direction );
 
-		case TNOTI_CALL_SOUND_NOISE_REDUCTION: {
-			struct tnoti_call_sound_noise_reduction *noti = (struct tnoti_call_sound_noise_reduction*)data;
-			telephony_call_emit_call_sound_noise_reduction( call, (gint)noti->status );
+	return TRUE;
+}
 
-		} break;
+static gboolean _call_sound_noise_reduction_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyCall *call = telephony_object_peek_call(TELEPHONY_OBJECT(object));
+	struct tnoti_call_sound_noise_reduction *noti = (struct tnoti_call_sound_noise_reduction*)data;
 
-		default:
-			dbg("not handled command[%d]", command);
-		break;
-	}
+	telephony_call_emit_call_sound_noise_reduction( call, (gint)noti->status );
 
 	return TRUE;
 }
 
+static const struct dbus_plugin_notification_handler call_notification_handlers[] = {
+	{ TNOTI_CALL_STATUS_IDLE, _call_status_idle_notification },
+	{ TNOTI_CALL_STATUS_DIALING, _call_status_dialing_notification },
+	{ TNOTI_CALL_STATUS_ALERT, _call_status_alert_notification },
+	{ TNOTI_CALL_STATUS_ACTIVE, _call_status_active_notification },
+	{ TNOTI_CALL_STATUS_HELD, _call_status_held_notification },
+	{ TNOTI_CALL_STATUS_INCOMING, _call_status_incoming_notification },
+	{ TNOTI_CALL_SOUND_PATH, _call_sound_path_notification },
+	{ TNOTI_CALL_SOUND_RINGBACK_TONE, _call_sound_ringback_tone_notification },
+	{ TNOTI_CALL_SOUND_WBAMR, _call_sound_wbamr_notification },
+	{ TNOTI_CALL_SOUND_EQUALIZATION, _call_sound_equalization_notification },
+	{ TNOTI_CALL_SOUND_NOISE_REDUCTION, _call_sound_noise_reduction_notification },
+};
+
+void dbus_plugin_register_call_handlers(struct custom_data *ctx)
+{
+	dbus_plugin_register_responses(ctx, call_response_handlers,
+			G_N_ELEMENTS(call_response_handlers));
+	dbus_plugin_register_notifications(ctx, call_notification_handlers,
+			G_N_ELEMENTS(call_notification_handlers));
+}
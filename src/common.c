@@ -8,21 +8,174 @@
 #include <communicator.h>
 #include <server.h>
 #include <user_request.h>
+#include <core_object.h>
 
 #include "generated-code.h"
 #include "common.h"
 
+static const unsigned int modem_co_types[] = {
+	CORE_OBJECT_TYPE_MODEM,
+	CORE_OBJECT_TYPE_CALL,
+	CORE_OBJECT_TYPE_NETWORK,
+	CORE_OBJECT_TYPE_SS,
+	CORE_OBJECT_TYPE_SMS,
+	CORE_OBJECT_TYPE_SAT,
+	CORE_OBJECT_TYPE_PHONEBOOK,
+	CORE_OBJECT_TYPE_SAP,
+	CORE_OBJECT_TYPE_SIM,
+	CORE_OBJECT_TYPE_PS,
+};
+
+static GQuark modem_quark;
+
+/* one outstanding tcore request shared by identical method calls */
+struct dbus_request_flight {
+	void *interface_object;
+	enum tcore_request_command command;
+	guint hash;
+	unsigned int data_len;
+	gpointer data;
+
+	GSList *waiters;
+};
+
+static struct dbus_request_info *_request_info_alloc(struct dbus_request_pool *pool)
+{
+	struct dbus_request_info *dbus_info;
+
+	dbus_info = pool->free_list;
+	if (dbus_info) {
+		pool->free_list = dbus_info->next;
+		pool->in_use++;
+		if (pool->in_use > pool->high_water)
+			pool->high_water = pool->in_use;
+	}
+	else {
+		dbus_info = calloc(sizeof(struct dbus_request_info), 1);
+		pool->overflow++;
+	}
+
+	return dbus_info;
+}
+
+static void _request_info_free(struct dbus_request_pool *pool, struct dbus_request_info *dbus_info)
+{
+	if (!dbus_info->pooled) {
+		free(dbus_info);
+		return;
+	}
+
+	memset(dbus_info, 0, sizeof(struct dbus_request_info));
+	dbus_info->pooled = TRUE;
+	dbus_info->next = pool->free_list;
+	pool->free_list = dbus_info;
+	pool->in_use--;
+}
+
+static guint _flight_hash(gconstpointer key)
+{
+	const struct dbus_request_flight *flight = key;
+
+	return flight->hash;
+}
+
+static gboolean _flight_equal(gconstpointer a, gconstpointer b)
+{
+	const struct dbus_request_flight *fa = a;
+	const struct dbus_request_flight *fb = b;
+
+	if (fa->interface_object != fb->interface_object || fa->command != fb->command)
+		return FALSE;
+
+	if (fa->data_len != fb->data_len)
+		return FALSE;
+
+	return fa->data_len == 0 || memcmp(fa->data, fb->data, fa->data_len) == 0;
+}
+
+static guint _flight_compute_hash(void *interface_object, enum tcore_request_command command,
+		const void *data, unsigned int data_len)
+{
+	const guchar *p = data;
+	guint hash;
+	unsigned int i;
+
+	hash = g_direct_hash(interface_object) * 31 + command;
+	for (i = 0; i < data_len; i++)
+		hash = hash * 33 + p[i];
+
+	return hash;
+}
+
+static void _flight_free(struct dbus_request_flight *flight)
+{
+	g_slist_free(flight->waiters);
+	g_free(flight->data);
+	g_free(flight);
+}
+
+/* request went away without a response, fail whoever joined it */
+static void _flight_abort(struct custom_data *ctx, struct dbus_request_flight *flight)
+{
+	GSList *l;
+
+	if (ctx->flights)
+		g_hash_table_remove(ctx->flights, flight);
+
+	for (l = flight->waiters; l; l = l->next)
+		g_dbus_method_invocation_return_error(l->data, G_DBUS_ERROR, G_DBUS_ERROR_FAILED,
+				"request (0x%x) failed", flight->command);
+
+	_flight_free(flight);
+}
 
 static void _free_hook(UserRequest *ur)
 {
 	const struct tcore_user_info *ui;
+	struct custom_data *ctx;
+	struct dbus_request_info *dbus_info;
 
 	ui = tcore_user_request_ref_user_info(ur);
 	if (!ui)
 		return;
 
-	if (ui->user_data)
-		free(ui->user_data);
+	if (!ui->user_data)
+		return;
+
+	ctx = tcore_communicator_ref_user_data(tcore_user_request_ref_communicator(ur));
+	if (!ctx)
+		return;
+
+	dbus_info = ui->user_data;
+	if (!dbus_info->responded) {
+		dbus_plugin_trace_response(ctx, ur, dbus_info, 0, 0);
+		dbus_plugin_stats_request_done(ctx, ur, dbus_info, DBUS_STATS_NO_RESPONSE);
+	}
+
+	if (dbus_info->flight) {
+		_flight_abort(ctx, dbus_info->flight);
+		dbus_info->flight = NULL;
+	}
+
+	if (dbus_info->batch && dbus_info->batch_abort) {
+		dbus_info->batch_abort(dbus_info);
+		dbus_info->batch = NULL;
+	}
+
+	_request_info_free(&ctx->request_pool, dbus_info);
+}
+
+void dbus_plugin_request_pool_init(struct dbus_request_pool *pool)
+{
+	int i;
+
+	memset(pool, 0, sizeof(struct dbus_request_pool));
+
+	for (i = DBUS_REQUEST_POOL_SIZE - 1; i >= 0; i--) {
+		pool->slots[i].pooled = TRUE;
+		pool->slots[i].next = pool->free_list;
+		pool->free_list = &pool->slots[i];
+	}
 }
 
 char *dbus_plugin_get_plugin_name_by_object_path(const char *object_path)
@@ -49,9 +202,11 @@ UserRequest *dbus_plugin_macro_user_request_new(struct custom_data *ctx, void *o
 
 	ur = tcore_user_request_new(ctx->comm, plugin_name);
 
-	dbus_info = calloc(sizeof(struct dbus_request_info), 1);
+	dbus_info = _request_info_alloc(&ctx->request_pool);
 	dbus_info->interface_object = object;
 	dbus_info->invocation = invocation;
+	dbus_info->start_time = g_get_monotonic_time();
+	dbus_plugin_trace_request(ctx, dbus_info);
 
 	ui.user_data = dbus_info;
 
@@ -60,3 +215,228 @@ UserRequest *dbus_plugin_macro_user_request_new(struct custom_data *ctx, void *o
 
 	return ur;
 }
+
+/*
+ * Like MAKE_UR(), with command and payload already set, for idempotent
+ * GETs. When an identical request (same interface object, command and
+ * payload) is already outstanding the invocation is queued on it and
+ * NULL is returned: the caller must not dispatch anything.
+ */
+UserRequest *dbus_plugin_shared_user_request_new(struct custom_data *ctx, void *object, GDBusMethodInvocation *invocation,
+		enum tcore_request_command command, const void *data, unsigned int data_len)
+{
+	struct dbus_request_flight key;
+	struct dbus_request_flight *flight;
+	struct dbus_request_info *dbus_info;
+	UserRequest *ur;
+
+	if (!ctx->flights)
+		ctx->flights = g_hash_table_new(_flight_hash, _flight_equal);
+
+	key.interface_object = object;
+	key.command = command;
+	key.data = (gpointer)data;
+	key.data_len = data ? data_len : 0;
+	key.hash = _flight_compute_hash(object, command, key.data, key.data_len);
+
+	flight = g_hash_table_lookup(ctx->flights, &key);
+	if (flight) {
+		ctx->flight_joined++;
+		dbg("join in-flight request (0x%x), joined[%lu]", command, ctx->flight_joined);
+		flight->waiters = g_slist_append(flight->waiters, invocation);
+		return NULL;
+	}
+
+	ur = dbus_plugin_macro_user_request_new(ctx, object, invocation);
+	tcore_user_request_set_data(ur, key.data_len, data);
+	tcore_user_request_set_command(ur, command);
+
+	flight = g_memdup(&key, sizeof(struct dbus_request_flight));
+	flight->data = key.data_len ? g_memdup(data, key.data_len) : NULL;
+	g_hash_table_insert(ctx->flights, flight, flight);
+
+	dbus_info = dbus_plugin_ref_request_info(ur);
+	dbus_info->flight = flight;
+
+	return ur;
+}
+
+/* answer every invocation that joined the request, after its owner */
+void dbus_plugin_shared_request_complete(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info,
+		dbus_plugin_response_cb cb, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	struct dbus_request_flight *flight = dbus_info->flight;
+	struct dbus_request_info waiter;
+	GSList *l;
+
+	dbus_info->flight = NULL;
+	g_hash_table_remove(ctx->flights, flight);
+
+	for (l = flight->waiters; l; l = l->next) {
+		memset(&waiter, 0, sizeof(struct dbus_request_info));
+		waiter.interface_object = dbus_info->interface_object;
+		waiter.invocation = l->data;
+
+		cb(ctx, ur, &waiter, command, data_len, data);
+	}
+
+	_flight_free(flight);
+}
+
+void dbus_plugin_shared_request_free_all(struct custom_data *ctx)
+{
+	GHashTableIter iter;
+	gpointer key;
+
+	if (!ctx->flights)
+		return;
+
+	g_hash_table_iter_init(&iter, ctx->flights);
+	while (g_hash_table_iter_next(&iter, &key, NULL))
+		_flight_free(key);
+
+	g_hash_table_destroy(ctx->flights);
+	ctx->flights = NULL;
+}
+
+struct dbus_request_info *dbus_plugin_ref_request_info(UserRequest *ur)
+{
+	const struct tcore_user_info *ui;
+
+	ui = tcore_user_request_ref_user_info(ur);
+	if (!ui)
+		return NULL;
+
+	return ui->user_data;
+}
+
+/* tcore_communicator_dispatch_request(), a failure is counted in Stats */
+TReturn dbus_plugin_dispatch_request(struct custom_data *ctx, UserRequest *ur)
+{
+	struct dbus_request_info *dbus_info;
+	TReturn ret;
+
+	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	if (ret == TCORE_RETURN_SUCCESS)
+		return ret;
+
+	dbus_info = dbus_plugin_ref_request_info(ur);
+	if (dbus_info && !dbus_info->responded) {
+		dbus_plugin_trace_response(ctx, ur, dbus_info, 0, 0);
+		dbus_plugin_stats_request_done(ctx, ur, dbus_info, DBUS_STATS_DISPATCH_FAILED);
+	}
+
+	return ret;
+}
+
+struct dbus_modem_context *dbus_plugin_modem_new(struct custom_data *ctx, TcorePlugin *p, TelephonyObjectSkeleton *object)
+{
+	struct dbus_modem_context *modem;
+	GSList *co_list;
+	unsigned int i;
+
+	if (!modem_quark)
+		modem_quark = g_quark_from_static_string("dbus-tapi-modem");
+
+	modem = g_new0(struct dbus_modem_context, 1);
+	modem->index = g_hash_table_size(ctx->modems);
+	modem->plugin = p;
+	modem->object = object;
+	modem->sim_cache.status = -1;
+	modem->net_publish.min_interval_ms = DBUS_NETWORK_INFO_MIN_INTERVAL_MS;
+	modem->net_publish.rssi_deadband = DBUS_NETWORK_RSSI_DEADBAND;
+
+	for (i = 0; i < G_N_ELEMENTS(modem_co_types); i++) {
+		co_list = tcore_plugin_get_core_objects_bytype(p, modem_co_types[i]);
+		if (!co_list)
+			continue;
+
+		modem->co[DBUS_PLUGIN_TYPE_INDEX(modem_co_types[i])] = co_list->data;
+		g_slist_free(co_list);
+	}
+
+	g_object_set_qdata(G_OBJECT(object), modem_quark, modem);
+	g_hash_table_insert(ctx->modems, p, modem);
+
+	return modem;
+}
+
+void dbus_plugin_modem_free(gpointer data)
+{
+	struct dbus_modem_context *modem = data;
+
+	if (!modem)
+		return;
+
+	if (modem->object)
+		g_object_set_qdata(G_OBJECT(modem->object), modem_quark, NULL);
+
+	if (modem->net_publish.info_timer)
+		g_source_remove(modem->net_publish.info_timer);
+
+	if (modem->pb_cache)
+		g_hash_table_destroy(modem->pb_cache);
+
+	if (modem->plmn_names)
+		g_hash_table_destroy(modem->plmn_names);
+
+	g_slist_free_full(modem->calls, g_free);
+	g_free(modem->sat_tr);
+
+	dbus_plugin_sim_cache_free(modem);
+
+	g_free(modem);
+}
+
+struct dbus_modem_context *dbus_plugin_ref_modem(struct custom_data *ctx, TcorePlugin *p)
+{
+	if (!ctx || !p)
+		return NULL;
+
+	return g_hash_table_lookup(ctx->modems, p);
+}
+
+struct dbus_modem_context *dbus_plugin_ref_modem_by_object(TelephonyObjectSkeleton *object)
+{
+	if (!object || !modem_quark)
+		return NULL;
+
+	return g_object_get_qdata(G_OBJECT(object), modem_quark);
+}
+
+struct dbus_modem_context *dbus_plugin_ref_modem_by_interface(gpointer interface_object)
+{
+	GDBusObject *object;
+
+	if (!interface_object)
+		return NULL;
+
+	object = g_dbus_interface_get_object(G_DBUS_INTERFACE(interface_object));
+	if (!object)
+		return NULL;
+
+	return dbus_plugin_ref_modem_by_object(TELEPHONY_OBJECT_SKELETON(object));
+}
+
+struct dbus_modem_context *dbus_plugin_ref_modem_by_request(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info)
+{
+	struct dbus_modem_context *modem;
+	char *modem_name;
+	TcorePlugin *p;
+
+	if (dbus_info) {
+		modem = dbus_plugin_ref_modem_by_interface(dbus_info->interface_object);
+		if (modem)
+			return modem;
+	}
+
+	/* request was not made through MAKE_UR() */
+	modem_name = tcore_user_request_get_modem_name(ur);
+	if (!modem_name)
+		return NULL;
+
+	p = tcore_server_find_plugin(ctx->server, modem_name);
+	free(modem_name);
+
+	return dbus_plugin_ref_modem(ctx, p);
+}
@@ -12,66 +12,343 @@
 #define MY_DBUS_PATH "/org/tizen/telephony"
 #define MY_DBUS_SERVICE "org.tizen.telephony"
 
+/* TRESP_xxx, TNOTI_xxx and CORE_OBJECT_TYPE_xxx share the same type bits */
+#define DBUS_PLUGIN_TYPE_MASK 0x0FF00000
+#define DBUS_PLUGIN_TYPE_INDEX(type) (((type) & DBUS_PLUGIN_TYPE_MASK) >> 20)
+#define DBUS_PLUGIN_TYPE_INDEX_MAX (DBUS_PLUGIN_TYPE_INDEX(DBUS_PLUGIN_TYPE_MASK) + 1)
+#define DBUS_PLUGIN_CMD_INDEX(command) ((command) & 0x000FFFFF)
+#define DBUS_PLUGIN_CMD_INDEX_MAX 0x100
+
+struct custom_data;
+struct dbus_request_info;
+struct dbus_request_flight;
+
+typedef gboolean (*dbus_plugin_response_cb)(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data);
+typedef gboolean (*dbus_plugin_notification_cb)(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data);
+
+struct dbus_plugin_response_handler {
+	enum tcore_response_command command;
+	dbus_plugin_response_cb cb;
+};
+
+struct dbus_plugin_notification_handler {
+	enum tcore_notification_command command;
+	dbus_plugin_notification_cb cb;
+};
+
+/* per group tables of handlers, indexed by DBUS_PLUGIN_CMD_INDEX() */
+struct dbus_plugin_dispatch {
+	gpointer *response[DBUS_PLUGIN_TYPE_INDEX_MAX];
+	gpointer *notification[DBUS_PLUGIN_TYPE_INDEX_MAX];
+
+	unsigned long unhandled_response[DBUS_PLUGIN_TYPE_INDEX_MAX];
+	unsigned long unhandled_notification[DBUS_PLUGIN_TYPE_INDEX_MAX];
+	unsigned long unhandled_response_total;
+	unsigned long unhandled_notification_total;
+};
+
+struct dbus_request_info {
+	void *interface_object;
+	GDBusMethodInvocation *invocation;
+
+	/*
+	 * set when several tcore requests answer one method call, or one
+	 * request answers several (sim.c cache); the response
+	 * handler clears batch once it has accounted for this request, otherwise
+	 * the free hook hands it to batch_abort
+	 */
+	gpointer batch;
+	guint batch_index;
+	void (*batch_abort)(struct dbus_request_info *dbus_info);
+
+	/* set by the *Raw method handlers, answered with byte arrays instead of base64 */
+	gboolean raw;
+
+	/* set on the request that other identical GETs are waiting on */
+	struct dbus_request_flight *flight;
+
+	/* MAKE_UR() time and first response, for the Stats interface */
+	gint64 start_time;
+	gboolean responded;
+
+	/* trace ring position of the request event, see trace.c */
+	guint64 trace_seq;
+
+	struct dbus_request_info *next;
+	gboolean pooled;
+};
+
+#define DBUS_REQUEST_POOL_SIZE 64
+
+/* free list of request records, overflow falls back to calloc() */
+struct dbus_request_pool {
+	struct dbus_request_info slots[DBUS_REQUEST_POOL_SIZE];
+	struct dbus_request_info *free_list;
+
+	unsigned int in_use;
+	unsigned int high_water;
+	unsigned long overflow;
+};
+
+/* 8 linear buckets below 8us, then 4 per power of two up to ~64s */
+#define DBUS_STATS_BUCKETS 104
+
+enum dbus_stats_result {
+	DBUS_STATS_RESPONDED,
+	DBUS_STATS_NO_RESPONSE,
+	DBUS_STATS_DISPATCH_FAILED,
+};
+
+struct dbus_stats_hist {
+	unsigned long count;
+	unsigned long errors;
+	unsigned long no_response;
+	unsigned long dispatch_failed;
+	guint64 sum_us;
+	guint64 max_us;
+	unsigned long buckets[DBUS_STATS_BUCKETS];
+};
+
+/* per request command latency, indexed like struct dbus_plugin_dispatch */
+struct dbus_plugin_stats {
+	struct dbus_stats_hist **hist[DBUS_PLUGIN_TYPE_INDEX_MAX];
+	gint64 reset_time;
+};
+
+#ifndef DBUS_TRACE_RING_SIZE
+#define DBUS_TRACE_RING_SIZE 1024 /* power of two */
+#endif
+
+#ifndef DBUS_TRACE_DUMP_PATH
+#define DBUS_TRACE_DUMP_PATH "/tmp/dbus-tapi-trace.bin"
+#endif
+
+#define DBUS_TRACE_MAGIC "TAPITRC1"
+#define DBUS_TRACE_SENDER_LEN 20
+
+enum dbus_trace_kind {
+	DBUS_TRACE_REQUEST = 1,
+	DBUS_TRACE_RESPONSE,
+	DBUS_TRACE_NOTIFICATION,
+};
+
+/* fixed 40 byte record, layout shared with tools/tapi-trace-decode.c */
+struct dbus_trace_event {
+	gint64 time_us;
+	guint32 command;
+	guint32 data_len;
+	guint8 kind;
+	guint8 modem;
+	guint16 reserved;
+	gchar sender[DBUS_TRACE_SENDER_LEN];
+};
+
+struct dbus_trace_header {
+	gchar magic[8];
+	guint32 event_size;
+	guint32 count;
+	guint64 total;
+};
+
+/* written only from the main loop: head counts every event ever recorded */
+struct dbus_trace {
+	struct dbus_trace_event *events;
+	guint64 head;
+	guint signal_source;
+};
+
+#ifndef DBUS_LAUNCHER_QUEUE_MAX
+#define DBUS_LAUNCHER_QUEUE_MAX 8
+#endif
+
+/* the launcher thread is started by the first launch */
+struct dbus_launcher {
+	GThread *thread;
+	GAsyncQueue *queue;
+	unsigned long dropped;
+};
+
+typedef void (*dbus_plugin_launch_cb)(gpointer data);
+
 struct custom_data {
 	TcorePlugin *plugin;
 	Communicator *comm;
 	Server *server;
 
 	GHashTable *objects;
+	GHashTable *modems;
+	struct dbus_plugin_dispatch dispatch;
+	struct dbus_request_pool request_pool;
+	struct dbus_plugin_stats stats;
+	struct dbus_trace trace;
+	GHashTable *flights;
+	unsigned long flight_joined;
 	GDBusObjectManagerServer *manager;
 
-	GQueue queue_sat;
+	struct sat_manager_queue *queue_sat;
+	unsigned long sat_queue_overflow;
+	struct treq_sat_terminal_rsp_data *sat_tr;
 	gint sat_character_format;
 	gpointer cached_sat_main_menu;
 	struct tel_sim_ecc_list cached_sim_ecc;
 	gboolean sim_recv_first_status;
+
+	/* aul/appsvc launches, see launcher.c */
+	struct dbus_launcher launcher;
 };
 
-struct dbus_request_info {
-	void *interface_object;
-	GDBusMethodInvocation *invocation;
+/* static SIM files kept until the next TNOTI_SIM_STATUS change, see sim.c */
+enum dbus_sim_cache_item {
+	DBUS_SIM_CACHE_ICCID,
+	DBUS_SIM_CACHE_MSISDN,
+	DBUS_SIM_CACHE_SPN,
+	DBUS_SIM_CACHE_CPHS_INFO,
+	DBUS_SIM_CACHE_ATR,
+	DBUS_SIM_CACHE_MAX
+};
+
+struct dbus_sim_cache {
+	gint status;
+	gpointer data[DBUS_SIM_CACHE_MAX];
+	/* request the waiters are queued on, its batch points back at the cache */
+	struct dbus_request_info *in_flight[DBUS_SIM_CACHE_MAX];
+	GSList *waiters[DBUS_SIM_CACHE_MAX];
+	unsigned long hit;
+	unsigned long miss;
+	unsigned long coalesced;
+};
+
+/* Info / CellInfo signal policy, override at build time with -D */
+#ifndef DBUS_NETWORK_INFO_MIN_INTERVAL_MS
+#define DBUS_NETWORK_INFO_MIN_INTERVAL_MS 2000
+#endif
+
+#ifndef DBUS_NETWORK_RSSI_DEADBAND
+#define DBUS_NETWORK_RSSI_DEADBAND 1
+#endif
+
+struct dbus_network_publish {
+	guint min_interval_ms;
+	gint rssi_deadband;
+
+	gboolean info_sent;
+	gint64 info_time;
+	gint info_rssi;
+	gint info_battery;
+
+	/* latest value held back by min_interval_ms, sent when info_timer fires */
+	guint info_timer;
+	gint pending_rssi;
+	gint pending_battery;
+
+	gboolean cell_sent;
+	gint cell_lac;
+	gint cell_id;
+
+	unsigned long info_emitted;
+	unsigned long info_suppressed;
+	unsigned long info_trailing;
+	unsigned long cell_emitted;
+	unsigned long cell_suppressed;
+};
+
+/* resolved once in add_modem(), keyed by TcorePlugin in custom_data->modems */
+struct dbus_modem_context {
+	guint index;
+	TcorePlugin *plugin;
+	TelephonyObjectSkeleton *object;
+	CoreObject *co[DBUS_PLUGIN_TYPE_INDEX_MAX];
+
+	/* phonebook records by type and index, see phonebook.c */
+	GHashTable *pb_cache;
+	unsigned long pb_cache_hit;
+	unsigned long pb_cache_miss;
+
+	struct dbus_sim_cache sim_cache;
+
+	struct dbus_network_publish net_publish;
+
+	/* operator names by packed PLMN, see network.c */
+	GHashTable *plmn_names;
+	unsigned long plmn_name_hit;
+	unsigned long plmn_name_miss;
+
+	/* call snapshot kept in sync by the call status notifications, see call.c */
+	GSList *calls;
+	gboolean calls_synced;
+
+	/* reused for every SAT terminal response, see sat_manager.c */
+	struct treq_sat_terminal_rsp_data *sat_tr;
 };
 
 #define GET_PLUGIN_NAME(invocation) dbus_plugin_get_plugin_name_by_object_path(g_dbus_method_invocation_get_object_path(invocation))
 #define MAKE_UR(ctx,object,invocation) dbus_plugin_macro_user_request_new(ctx, object, invocation)
+#define MAKE_SHARED_UR(ctx,object,invocation,command,data,data_len) dbus_plugin_shared_user_request_new(ctx, object, invocation, command, data, data_len)
+#define MODEM_CO(modem,type) ((modem) ? (modem)->co[DBUS_PLUGIN_TYPE_INDEX(type)] : NULL)
 
 char *dbus_plugin_get_plugin_name_by_object_path(const char *object_path);
 UserRequest *dbus_plugin_macro_user_request_new(struct custom_data *ctx, void *object, GDBusMethodInvocation *invocation);
+UserRequest *dbus_plugin_shared_user_request_new(struct custom_data *ctx, void *object, GDBusMethodInvocation *invocation, enum tcore_request_command command, const void *data, unsigned int data_len);
+void dbus_plugin_shared_request_complete(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, dbus_plugin_response_cb cb, enum tcore_response_command command, unsigned int data_len, const void *data);
+void dbus_plugin_shared_request_free_all(struct custom_data *ctx);
+void dbus_plugin_request_pool_init(struct dbus_request_pool *pool);
+struct dbus_request_info *dbus_plugin_ref_request_info(UserRequest *ur);
+TReturn dbus_plugin_dispatch_request(struct custom_data *ctx, UserRequest *ur);
+
+struct dbus_modem_context *dbus_plugin_modem_new(struct custom_data *ctx, TcorePlugin *p, TelephonyObjectSkeleton *object);
+void dbus_plugin_modem_free(gpointer data);
+struct dbus_modem_context *dbus_plugin_ref_modem(struct custom_data *ctx, TcorePlugin *p);
+struct dbus_modem_context *dbus_plugin_ref_modem_by_object(TelephonyObjectSkeleton *object);
+struct dbus_modem_context *dbus_plugin_ref_modem_by_interface(gpointer interface_object);
+struct dbus_modem_context *dbus_plugin_ref_modem_by_request(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info);
+
+void dbus_plugin_register_responses(struct custom_data *ctx, const struct dbus_plugin_response_handler *handlers, unsigned int count);
+void dbus_plugin_register_notifications(struct custom_data *ctx, const struct dbus_plugin_notification_handler *handlers, unsigned int count);
+void dbus_plugin_dispatch_free(struct custom_data *ctx);
+
+void dbus_plugin_stats_request_done(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum dbus_stats_result result);
+void dbus_plugin_stats_request_error(struct custom_data *ctx, UserRequest *ur);
+void dbus_plugin_stats_reset(struct custom_data *ctx);
+void dbus_plugin_stats_free(struct custom_data *ctx);
+gboolean dbus_plugin_setup_stats_interface(GDBusConnection *conn, struct custom_data *ctx);
+
+gboolean dbus_plugin_launch(struct custom_data *ctx, dbus_plugin_launch_cb cb, gpointer data, GDestroyNotify free_data);
+void dbus_plugin_launcher_free(struct custom_data *ctx);
+
+void dbus_plugin_trace_init(struct custom_data *ctx);
+void dbus_plugin_trace_free(struct custom_data *ctx);
+void dbus_plugin_trace_request(struct custom_data *ctx, struct dbus_request_info *dbus_info);
+void dbus_plugin_trace_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len);
+void dbus_plugin_trace_notification(struct custom_data *ctx, struct dbus_modem_context *modem, enum tcore_notification_command command, unsigned int data_len);
+GVariant *dbus_plugin_trace_snapshot(struct custom_data *ctx);
 
 gboolean dbus_plugin_setup_network_interface(TelephonyObjectSkeleton *object, struct custom_data *ctx);
-gboolean dbus_plugin_network_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data);
-gboolean dbus_plugin_network_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data);
+void dbus_plugin_register_network_handlers(struct custom_data *ctx);
 
 gboolean dbus_plugin_setup_sap_interface(TelephonyObjectSkeleton *object, struct custom_data *ctx);
-gboolean dbus_plugin_sap_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data);
-gboolean dbus_plugin_sap_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data);
+void dbus_plugin_register_sap_handlers(struct custom_data *ctx);
 
 gboolean dbus_plugin_setup_phonebook_interface(TelephonyObjectSkeleton *object, struct custom_data *ctx);
-gboolean dbus_plugin_phonebook_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data);
-gboolean dbus_plugin_phonebook_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data);
+void dbus_plugin_register_phonebook_handlers(struct custom_data *ctx);
 
 gboolean dbus_plugin_setup_sim_interface(TelephonyObjectSkeleton *object, struct custom_data *ctx);
-gboolean dbus_plugin_sim_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data);
-gboolean dbus_plugin_sim_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data);
+void dbus_plugin_register_sim_handlers(struct custom_data *ctx);
+void dbus_plugin_sim_cache_free(struct dbus_modem_context *modem);
 
 gboolean dbus_plugin_setup_sat_interface(TelephonyObjectSkeleton *object, struct custom_data *ctx);
-gboolean dbus_plugin_sat_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data);
-gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data);
+void dbus_plugin_register_sat_handlers(struct custom_data *ctx);
+void dbus_plugin_sat_free(struct custom_data *ctx);
 
 gboolean dbus_plugin_setup_sms_interface(TelephonyObjectSkeleton *object, struct custom_data *ctx);
-gboolean dbus_plugin_sms_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data);
-gboolean dbus_plugin_sms_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data);
+void dbus_plugin_register_sms_handlers(struct custom_data *ctx);
 
 gboolean dbus_plugin_setup_call_interface(TelephonyObjectSkeleton *object, struct custom_data *ctx);
-gboolean dbus_plugin_call_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data);
-gboolean dbus_plugin_call_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data);
+void dbus_plugin_register_call_handlers(struct custom_data *ctx);
 
 gboolean dbus_plugin_setup_ss_interface(TelephonyObjectSkeleton *object, struct custom_data *ctx);
-gboolean dbus_plugin_ss_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data);
-gboolean dbus_plugin_ss_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data);
+void dbus_plugin_register_ss_handlers(struct custom_data *ctx);
 
 gboolean dbus_plugin_setup_modem_interface(TelephonyObjectSkeleton *object, struct custom_data *ctx);
-gboolean dbus_plugin_modem_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data);
-gboolean dbus_plugin_modem_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data);
+void dbus_plugin_register_modem_handlers(struct custom_data *ctx);
 
 #endif
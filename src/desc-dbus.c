@@ -50,9 +50,9 @@
 static void add_modem(struct custom_data *ctx, TcorePlugin *p)
 {
 	TelephonyObjectSkeleton *object;
+	struct dbus_modem_context *modem;
 	char *plugin_name = NULL;
 	char *path = NULL;
-	GSList *co_list = NULL;
 
 	plugin_name = tcore_plugin_ref_plugin_name(p);
 	if (!plugin_name)
@@ -71,56 +71,34 @@ static void add_modem(struct custom_data *ctx, TcorePlugin *p)
 	dbg("new dbus object created. (object = %p)", object);
 	g_hash_table_insert(ctx->objects, g_strdup(path), object);
 
+	modem = dbus_plugin_modem_new(ctx, p, object);
+
 	/* Add interfaces */
 	dbus_plugin_setup_modem_interface(object, ctx);
 
-	co_list = tcore_plugin_get_core_objects_bytype(p, CORE_OBJECT_TYPE_CALL);
-	if (co_list) {
-		g_slist_free(co_list);
+	if (MODEM_CO(modem, CORE_OBJECT_TYPE_CALL))
 		dbus_plugin_setup_call_interface(object, ctx);
-	}
 
-	co_list = tcore_plugin_get_core_objects_bytype(p, CORE_OBJECT_TYPE_NETWORK);
-	if (co_list) {
-		g_slist_free(co_list);
+	if (MODEM_CO(modem, CORE_OBJECT_TYPE_NETWORK))
 		dbus_plugin_setup_network_interface(object, ctx);
-	}
 
-	co_list = tcore_plugin_get_core_objects_bytype(p, CORE_OBJECT_TYPE_SS);
-	if (co_list) {
-		g_slist_free(co_list);
+	if (MODEM_CO(modem, CORE_OBJECT_TYPE_SS))
 		dbus_plugin_setup_ss_interface(object, ctx);
-	}
 
-	co_list = tcore_plugin_get_core_objects_bytype(p, CORE_OBJECT_TYPE_SMS);
-	if (co_list) {
-		g_slist_free(co_list);
+	if (MODEM_CO(modem, CORE_OBJECT_TYPE_SMS))
 		dbus_plugin_setup_sms_interface(object, ctx);
-	}
 
-	co_list = tcore_plugin_get_core_objects_bytype(p, CORE_OBJECT_TYPE_SAT);
-	if (co_list) {
-		g_slist_free(co_list);
+	if (MODEM_CO(modem, CORE_OBJECT_TYPE_SAT))
 		dbus_plugin_setup_sat_interface(object, ctx);
-	}
 
-	co_list = tcore_plugin_get_core_objects_bytype(p, CORE_OBJECT_TYPE_PHONEBOOK);
-	if (co_list) {
-		g_slist_free(co_list);
+	if (MODEM_CO(modem, CORE_OBJECT_TYPE_PHONEBOOK))
 		dbus_plugin_setup_phonebook_interface(object, ctx);
-	}
 
-	co_list = tcore_plugin_get_core_objects_bytype(p, CORE_OBJECT_TYPE_SAP);
-	if (co_list) {
-		g_slist_free(co_list);
+	if (MODEM_CO(modem, CORE_OBJECT_TYPE_SAP))
 		dbus_plugin_setup_sap_interface(object, ctx);
-	}
 
-	co_list = tcore_plugin_get_core_objects_bytype(p, CORE_OBJECT_TYPE_SIM);
-	if (co_list) {
-		g_slist_free(co_list);
+	if (MODEM_CO(modem, CORE_OBJECT_TYPE_SIM))
 		dbus_plugin_setup_sim_interface(object, ctx);
-	}
 
 	g_dbus_object_manager_server_export (ctx->manager, G_DBUS_OBJECT_SKELETON (object));
 
@@ -166,10 +144,40 @@ static void refresh_object(struct custom_data *ctx)
 	}
 }
 
+static gboolean on_server_notification(struct custom_data *ctx, const char *plugin_name,
+		TelephonyObjectSkeleton *object, enum tcore_notification_command command,
+		unsigned int data_len, const void *data)
+{
+	refresh_object(ctx);
+
+	return TRUE;
+}
+
+static const struct dbus_plugin_notification_handler server_notification_handlers[] = {
+	{ TNOTI_SERVER_RUN, on_server_notification },
+};
+
+static void register_handlers(struct custom_data *ctx)
+{
+	dbus_plugin_register_notifications(ctx, server_notification_handlers,
+			G_N_ELEMENTS(server_notification_handlers));
+
+	dbus_plugin_register_call_handlers(ctx);
+	dbus_plugin_register_ss_handlers(ctx);
+	dbus_plugin_register_sim_handlers(ctx);
+	dbus_plugin_register_sap_handlers(ctx);
+	dbus_plugin_register_phonebook_handlers(ctx);
+	dbus_plugin_register_modem_handlers(ctx);
+	dbus_plugin_register_sms_handlers(ctx);
+	dbus_plugin_register_sat_handlers(ctx);
+	dbus_plugin_register_network_handlers(ctx);
+}
+
 static TReturn send_response(Communicator *comm, UserRequest *ur, enum tcore_response_command command, unsigned int data_len, const void *data)
 {
 	struct custom_data *ctx = NULL;
 	const struct tcore_user_info *ui;
+	gboolean first = FALSE;
 
 	dbg("Response Command = [0x%x], data_len = %d", command, data_len);
 
@@ -181,61 +189,26 @@ static TReturn send_response(Communicator *comm, UserRequest *ur, enum tcore_res
 
 	ui = tcore_user_request_ref_user_info(ur);
 
-	switch (command & (TCORE_RESPONSE | 0x0FF00000)) {
-		case TRESP_CALL:
-			dbus_plugin_call_response(ctx, ur, ui->user_data, command, data_len, data);
-			break;
-
-		case TRESP_SS:
-			dbus_plugin_ss_response(ctx, ur, ui->user_data, command, data_len, data);
-			break;
-
-		case TRESP_PS:
-			break;
-
-		case TRESP_SIM:
-			dbus_plugin_sim_response(ctx, ur, ui->user_data, command, data_len, data);
-			break;
-
-		case TRESP_SAP:
-			dbus_plugin_sap_response(ctx, ur, ui->user_data, command, data_len, data);
-			break;
-
-		case TRESP_PHONEBOOK:
-			dbus_plugin_phonebook_response(ctx, ur, ui->user_data, command, data_len, data);
-			break;
-
-		case TRESP_MODEM:
-			dbus_plugin_modem_response(ctx, ur, ui->user_data, command, data_len, data);
-			break;
-
-		case TRESP_SMS:
-			dbus_plugin_sms_response(ctx, ur, ui->user_data, command, data_len, data);
-			break;
-
-		case TRESP_SAT:
-			dbus_plugin_sat_response(ctx, ur, ui->user_data, command, data_len, data);
-			break;
-		case TRESP_CUSTOM:
-			break;
-
-		case TRESP_NETWORK:
-			dbus_plugin_network_response(ctx, ur, ui->user_data, command, data_len, data);
-			break;
-
-		default:
-			warn("unknown command (0x%x)", command);
-			break;
+	if (ui->user_data) {
+		dbus_plugin_trace_response(ctx, ur, ui->user_data, command, data_len);
+		if (!((struct dbus_request_info *)ui->user_data)->responded) {
+			dbus_plugin_stats_request_done(ctx, ur, ui->user_data, DBUS_STATS_RESPONDED);
+			first = TRUE;
+		}
 	}
 
+	if (!dbus_plugin_dispatch_response(ctx, ur, ui->user_data, command, data_len, data) && first)
+		dbus_plugin_stats_request_error(ctx, ur);
+
 	return FALSE;
 }
 
 static TReturn send_notification(Communicator *comm, CoreObject *source, enum tcore_notification_command command, unsigned int data_len, const void *data)
 {
 	struct custom_data *ctx = NULL;
+	struct dbus_modem_context *modem;
+	TcorePlugin *p;
 	char *plugin_name;
-	char *path;
 	TelephonyObjectSkeleton *object;
 
 	dbg("notification !!! (command = 0x%x, data_len = %d)", command, data_len);
@@ -246,70 +219,21 @@ static TReturn send_notification(Communicator *comm, CoreObject *source, enum tc
 		return FALSE;
 	}
 
-	plugin_name = tcore_plugin_ref_plugin_name(tcore_object_ref_plugin(source));
-	if (plugin_name) {
-		path = g_strdup_printf("%s/%s", MY_DBUS_PATH, plugin_name);
-	}
-	else {
-		path = g_strdup_printf("%s", MY_DBUS_PATH);
-	}
-	dbg("path = [%s]", path);
+	p = tcore_object_ref_plugin(source);
+	plugin_name = tcore_plugin_ref_plugin_name(p);
 
-	object = g_hash_table_lookup(ctx->objects, path);
+	modem = dbus_plugin_ref_modem(ctx, p);
+	if (modem)
+		object = modem->object;
+	else if (!plugin_name)
+		object = g_hash_table_lookup(ctx->objects, MY_DBUS_PATH);
+	else
+		object = NULL;
 	dbg("dbus inteface object = %p", object);
 
-	switch (command & (TCORE_NOTIFICATION | 0x0FF00000)) {
-		case TNOTI_CALL:
-			dbus_plugin_call_notification(ctx, plugin_name, object, command, data_len, data);
-			break;
-
-		case TNOTI_SS:
-			dbus_plugin_ss_notification(ctx, plugin_name, object, command, data_len, data);
-			break;
-
-		case TNOTI_PS:
-			break;
-
-		case TNOTI_SIM:
-			dbus_plugin_sim_notification(ctx, plugin_name, object, command, data_len, data);
-			break;
-
-		case TNOTI_SAP:
-			dbus_plugin_sap_notification(ctx, plugin_name, object, command, data_len, data);
-			break;
-
-		case TNOTI_PHONEBOOK:
-			dbus_plugin_phonebook_notification(ctx, plugin_name, object, command, data_len, data);
-			break;
-
-		case TNOTI_MODEM:
-			dbus_plugin_modem_notification(ctx, plugin_name, object, command, data_len, data);
-			break;
-
-		case TNOTI_SMS:
-			dbus_plugin_sms_notification(ctx, plugin_name, object, command, data_len, data);
-			break;
-
-		case TNOTI_SAT:
-			dbus_plugin_sat_notification(ctx, plugin_name, object, command, data_len, data);
-			break;
-		case TNOTI_CUSTOM:
-			break;
-
-		case TNOTI_NETWORK:
-			dbus_plugin_network_notification(ctx, plugin_name, object, command, data_len, data);
-			break;
-
-		case TNOTI_SERVER:
-			if (command == TNOTI_SERVER_RUN) {
-				refresh_object(ctx);
-			}
-			break;
-
-		default:
-			warn("unknown command (0x%x)", command);
-			break;
-	}
+	dbus_plugin_trace_notification(ctx, modem, command, data_len);
+
+	dbus_plugin_dispatch_notification(ctx, plugin_name, object, command, data_len, data);
 
 	return FALSE;
 }
@@ -394,6 +318,8 @@ static void on_bus_acquired(GDBusConnection *conn, const gchar *name, gpointer u
 
 	g_dbus_interface_skeleton_export(G_DBUS_INTERFACE_SKELETON(mgr), conn, MY_DBUS_PATH, NULL);
 
+	dbus_plugin_setup_stats_interface(conn, ctx);
+
 	g_dbus_object_manager_server_set_connection (ctx->manager, conn);
 
 	//set telephony ready registry
@@ -445,8 +371,14 @@ static gboolean on_init(TcorePlugin *p)
 	data->server = tcore_plugin_ref_server(p);
 
 	data->objects = g_hash_table_new(g_str_hash, g_str_equal);
+	data->modems = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, dbus_plugin_modem_free);
 	data->cached_sat_main_menu = NULL;
 
+	dbus_plugin_request_pool_init(&data->request_pool);
+	dbus_plugin_stats_reset(data);
+	dbus_plugin_trace_init(data);
+	register_handlers(data);
+
 	dbg("data = %p", data);
 
 	id = g_bus_own_name (G_BUS_TYPE_SYSTEM,
@@ -478,6 +410,13 @@ static void on_unload(TcorePlugin *p)
 	if (!data)
 		return;
 
+	dbus_plugin_dispatch_free(data);
+	dbus_plugin_shared_request_free_all(data);
+	dbus_plugin_launcher_free(data);
+	dbus_plugin_sat_free(data);
+	dbus_plugin_stats_free(data);
+	dbus_plugin_trace_free(data);
+	g_hash_table_destroy(data->modems);
 	g_hash_table_destroy(data->objects);
 
 	free(data);
@@ -0,0 +1,166 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Contact: Ja-young Gu <jygu@samsung.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <glib.h>
+
+#include <tcore.h>
+#include <plugin.h>
+#include <communicator.h>
+#include <server.h>
+#include <user_request.h>
+
+#include "generated-code.h"
+#include "common.h"
+
+/*
+ * Two level command table: the first level is indexed by the command
+ * group (TCORE_TYPE_xxx bits), the second level by the command's sub
+ * index inside that group. Second level arrays are only allocated for
+ * groups that have at least one registered handler.
+ */
+
+static gboolean _register(gpointer **group_table, unsigned int command, gpointer cb)
+{
+	unsigned int group = DBUS_PLUGIN_TYPE_INDEX(command);
+	unsigned int sub = DBUS_PLUGIN_CMD_INDEX(command);
+	gpointer *sub_table;
+
+	if (sub >= DBUS_PLUGIN_CMD_INDEX_MAX) {
+		err("command (0x%x) exceeds dispatch table", command);
+		return FALSE;
+	}
+
+	sub_table = group_table[group];
+	if (!sub_table) {
+		sub_table = g_new0(gpointer, DBUS_PLUGIN_CMD_INDEX_MAX);
+		group_table[group] = sub_table;
+	}
+
+	if (sub_table[sub] && sub_table[sub] != cb)
+		warn("command (0x%x) handler replaced", command);
+
+	sub_table[sub] = cb;
+
+	return TRUE;
+}
+
+static gpointer _lookup(gpointer **group_table, unsigned int command)
+{
+	gpointer *sub_table;
+	unsigned int sub = DBUS_PLUGIN_CMD_INDEX(command);
+
+	if (sub >= DBUS_PLUGIN_CMD_INDEX_MAX)
+		return NULL;
+
+	sub_table = group_table[DBUS_PLUGIN_TYPE_INDEX(command)];
+	if (!sub_table)
+		return NULL;
+
+	return sub_table[sub];
+}
+
+static void _count_unhandled(unsigned long *counter, unsigned long *total, unsigned int command)
+{
+	if (counter[DBUS_PLUGIN_TYPE_INDEX(command)]++ == 0)
+		warn("unknown command (0x%x)", command);
+
+	(*total)++;
+}
+
+void dbus_plugin_register_responses(struct custom_data *ctx,
+		const struct dbus_plugin_response_handler *handlers, unsigned int count)
+{
+	unsigned int i;
+
+	for (i = 0; i < count; i++)
+		_register(ctx->dispatch.response, handlers[i].command, (gpointer)handlers[i].cb);
+}
+
+void dbus_plugin_register_notifications(struct custom_data *ctx,
+		const struct dbus_plugin_notification_handler *handlers, unsigned int count)
+{
+	unsigned int i;
+
+	for (i = 0; i < count; i++)
+		_register(ctx->dispatch.notification, handlers[i].command, (gpointer)handlers[i].cb);
+}
+
+gboolean dbus_plugin_dispatch_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	dbus_plugin_response_cb cb;
+	gboolean ret;
+
+	cb = (dbus_plugin_response_cb)_lookup(ctx->dispatch.response, command);
+	if (!cb) {
+		_count_unhandled(ctx->dispatch.unhandled_response,
+				&ctx->dispatch.unhandled_response_total, command);
+		return FALSE;
+	}
+
+	dbg("response command = [0x%x], data_len = %d", command, data_len);
+
+	ret = cb(ctx, ur, dbus_info, command, data_len, data);
+
+	if (dbus_info && dbus_info->flight)
+		dbus_plugin_shared_request_complete(ctx, ur, dbus_info, cb, command, data_len, data);
+
+	return ret;
+}
+
+gboolean dbus_plugin_dispatch_notification(struct custom_data *ctx, const char *plugin_name,
+		TelephonyObjectSkeleton *object, enum tcore_notification_command command,
+		unsigned int data_len, const void *data)
+{
+	dbus_plugin_notification_cb cb;
+
+	cb = (dbus_plugin_notification_cb)_lookup(ctx->dispatch.notification, command);
+	if (!cb) {
+		_count_unhandled(ctx->dispatch.unhandled_notification,
+				&ctx->dispatch.unhandled_notification_total, command);
+		return FALSE;
+	}
+
+	/* every handler but the server's emits on the modem's object */
+	if (!object && DBUS_PLUGIN_TYPE_INDEX(command) != DBUS_PLUGIN_TYPE_INDEX(TNOTI_SERVER_RUN)) {
+		dbg("object is NULL (command = 0x%x)", command);
+		return FALSE;
+	}
+
+	dbg("notification command = [0x%x], data_len = %d", command, data_len);
+
+	return cb(ctx, plugin_name, object, command, data_len, data);
+}
+
+void dbus_plugin_dispatch_free(struct custom_data *ctx)
+{
+	unsigned int i;
+
+	for (i = 0; i < DBUS_PLUGIN_TYPE_INDEX_MAX; i++) {
+		g_free(ctx->dispatch.response[i]);
+		g_free(ctx->dispatch.notification[i]);
+	}
+
+	memset(&ctx->dispatch, 0, sizeof(ctx->dispatch));
+}
@@ -0,0 +1,140 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Contact: Ja-young Gu <jygu@samsung.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <glib.h>
+
+#include <tcore.h>
+#include <plugin.h>
+#include <communicator.h>
+#include <server.h>
+#include <user_request.h>
+
+#include "generated-code.h"
+#include "common.h"
+
+/*
+ * Application launches. aul/appsvc block for as long as the launch takes
+ * and make no thread safety promise, so every call to them is made by a
+ * single launcher thread, in the order the launches were queued. The
+ * main loop only queues; a launch that does not fit in the queue is
+ * dropped and counted.
+ */
+
+struct dbus_launch {
+	dbus_plugin_launch_cb cb;
+	gpointer data;
+	GDestroyNotify free_data;
+};
+
+/* queued by dbus_plugin_launcher_free(), ends the thread */
+static struct dbus_launch launcher_stop;
+
+static void _launch_free(struct dbus_launch *launch)
+{
+	if (launch->free_data)
+		launch->free_data(launch->data);
+
+	g_free(launch);
+}
+
+static gpointer _launcher_thread(gpointer user_data)
+{
+	GAsyncQueue *queue = user_data;
+	struct dbus_launch *launch;
+
+	while ((launch = g_async_queue_pop(queue)) != &launcher_stop) {
+		launch->cb(launch->data);
+		_launch_free(launch);
+	}
+
+	return NULL;
+}
+
+static gboolean _launcher_start(struct dbus_launcher *launcher)
+{
+	GError *error = NULL;
+
+	launcher->queue = g_async_queue_new();
+	launcher->thread = g_thread_try_new("dbus-launcher", _launcher_thread, launcher->queue, &error);
+	if (!launcher->thread) {
+		err("launcher thread failed (%s)", error ? error->message : "");
+		g_clear_error(&error);
+		g_async_queue_unref(launcher->queue);
+		launcher->queue = NULL;
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+/* takes data: it is freed with free_data once run, or right away if dropped */
+gboolean dbus_plugin_launch(struct custom_data *ctx, dbus_plugin_launch_cb cb, gpointer data, GDestroyNotify free_data)
+{
+	struct dbus_launcher *launcher = &ctx->launcher;
+	struct dbus_launch *launch;
+
+	if ((!launcher->thread && !_launcher_start(launcher))
+			|| g_async_queue_length(launcher->queue) >= DBUS_LAUNCHER_QUEUE_MAX) {
+		launcher->dropped++;
+		err("launch dropped (dropped: %lu)", launcher->dropped);
+		if (free_data)
+			free_data(data);
+		return FALSE;
+	}
+
+	launch = g_new0(struct dbus_launch, 1);
+	launch->cb = cb;
+	launch->data = data;
+	launch->free_data = free_data;
+
+	g_async_queue_push(launcher->queue, launch);
+
+	return TRUE;
+}
+
+/* pending launches are discarded, only the one already running is waited for */
+void dbus_plugin_launcher_free(struct custom_data *ctx)
+{
+	struct dbus_launcher *launcher = &ctx->launcher;
+	struct dbus_launch *launch;
+	unsigned int discarded = 0;
+
+	if (!launcher->thread)
+		return;
+
+	g_async_queue_lock(launcher->queue);
+	while ((launch = g_async_queue_try_pop_unlocked(launcher->queue))) {
+		_launch_free(launch);
+		discarded++;
+	}
+	g_async_queue_push_unlocked(launcher->queue, &launcher_stop);
+	g_async_queue_unlock(launcher->queue);
+
+	dbg("launcher stopped (discarded: %u)", discarded);
+
+	g_thread_join(launcher->thread);
+	launcher->thread = NULL;
+
+	g_async_queue_unref(launcher->queue);
+	launcher->queue = NULL;
+}
@@ -50,7 +50,7 @@ on_modem_set_power (TelephonyModem *modem,
 			break;
 	}
 
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS)
 		goto ERR;
 
@@ -78,7 +78,7 @@ on_modem_set_flight_mode (TelephonyModem *modem,
 	ur = MAKE_UR(ctx, modem, invocation);
 	tcore_user_request_set_data(ur, sizeof(struct treq_modem_set_flightmode), &data);
 	tcore_user_request_set_command(ur, TREQ_MODEM_SET_FLIGHTMODE);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_modem_complete_set_flight_mode(modem, invocation, ret);
 		tcore_user_request_unref(ur);
@@ -96,9 +96,11 @@ on_modem_get_version (TelephonyModem *modem,
 	UserRequest *ur = NULL;
 	TReturn ret;
 
-	ur = MAKE_UR(ctx, modem, invocation);
-	tcore_user_request_set_command(ur, TREQ_MODEM_GET_VERSION);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ur = MAKE_SHARED_UR(ctx, modem, invocation, TREQ_MODEM_GET_VERSION, NULL, 0);
+	if (!ur)
+		return TRUE;
+
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_modem_complete_get_version(modem, invocation,
 				ret,
@@ -120,7 +122,7 @@ on_modem_get_serial_number (TelephonyModem *modem,
 
 	ur = MAKE_UR(ctx, modem, invocation);
 	tcore_user_request_set_command(ur, TREQ_MODEM_GET_SN);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_modem_complete_get_serial_number(modem, invocation, ret, NULL);
 		tcore_user_request_unref(ur);
@@ -138,9 +140,11 @@ on_modem_get_imei (TelephonyModem *modem,
 	UserRequest *ur = NULL;
 	TReturn ret;
 
-	ur = MAKE_UR(ctx, modem, invocation);
-	tcore_user_request_set_command(ur, TREQ_MODEM_GET_IMEI);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ur = MAKE_SHARED_UR(ctx, modem, invocation, TREQ_MODEM_GET_IMEI, NULL, 0);
+	if (!ur)
+		return TRUE;
+
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_modem_complete_get_imei(modem, invocation, ret, NULL);
 		tcore_user_request_unref(ur);
@@ -163,7 +167,7 @@ static gboolean on_modem_set_dun_pin_ctrl (TelephonyModem *modem, GDBusMethodInv
 	ur = MAKE_UR(ctx, modem, invocation);
 	tcore_user_request_set_data(ur, sizeof(struct treq_modem_set_dun_pin_control), &data);
 	tcore_user_request_set_command(ur, TREQ_MODEM_SET_DUN_PIN_CONTROL);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_modem_complete_set_dun_pin_ctrl(modem, invocation, ret);
 		tcore_user_request_unref(ur);
@@ -214,106 +218,125 @@ gboolean dbus_plugin_setup_modem_interface(TelephonyObjectSkeleton *object, stru
 	return TRUE;
 }
 
-gboolean dbus_plugin_modem_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+static gboolean _modem_set_flightmode_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
 {
 	const struct tresp_modem_set_flightmode *resp_set_flight_mode = data;
-	const struct tresp_modem_set_dun_pin_control *resp_dun_pin_ctrl = data;
+
+	dbg("receive TRESP_MODEM_SET_FLIGHTMODE");
+	dbg("resp->result = %d", resp_set_flight_mode->result);
+	telephony_modem_complete_set_flight_mode(dbus_info->interface_object, dbus_info->invocation, resp_set_flight_mode->result);
+
+	return TRUE;
+}
+
+static gboolean _modem_power_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	dbg("receive power response (command = 0x%x)", command);
+	telephony_modem_complete_set_power(dbus_info->interface_object, dbus_info->invocation, 0);
+
+	return TRUE;
+}
+
+static gboolean _modem_get_imei_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
 	const struct tresp_modem_get_imei *resp_get_imei = data;
-	const struct tresp_modem_get_sn *resp_get_sn = data;
-	const struct tresp_modem_get_version *resp_get_version = data;
 
-	switch (command) {
-		case TRESP_MODEM_SET_FLIGHTMODE:
-			dbg("receive TRESP_MODEM_SET_FLIGHTMODE");
-			dbg("resp->result = %d", resp_set_flight_mode->result);
-			telephony_modem_complete_set_flight_mode(dbus_info->interface_object, dbus_info->invocation, resp_set_flight_mode->result);
-			break;
+	dbg("receive TRESP_MODEM_GET_IMEI");
+	telephony_modem_complete_get_imei(dbus_info->interface_object, dbus_info->invocation, resp_get_imei->result, resp_get_imei->imei);
 
-		case TRESP_MODEM_POWER_ON:
-			dbg("receive TRESP_MODEM_POWER_ON");
-			telephony_modem_complete_set_power(dbus_info->interface_object, dbus_info->invocation, 0);
-			break;
+	return TRUE;
+}
 
-		case TRESP_MODEM_POWER_OFF:
-			dbg("receive TRESP_MODEM_POWER_OFF");
-			telephony_modem_complete_set_power(dbus_info->interface_object, dbus_info->invocation, 0);
-			break;
+static gboolean _modem_get_sn_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_modem_get_sn *resp_get_sn = data;
 
-		case TRESP_MODEM_POWER_RESET:
-			dbg("receive TRESP_MODEM_POWER_RESET");
-			telephony_modem_complete_set_power(dbus_info->interface_object, dbus_info->invocation, 0);
-			break;
+	dbg("receive TRESP_MODEM_GET_SN");
+	telephony_modem_complete_get_serial_number(dbus_info->interface_object, dbus_info->invocation, resp_get_sn->result, resp_get_sn->sn);
 
-		case TRESP_MODEM_GET_IMEI:
-			dbg("receive TRESP_MODEM_GET_IMEI");
-			telephony_modem_complete_get_imei(dbus_info->interface_object, dbus_info->invocation, resp_get_imei->result, resp_get_imei->imei);
-			break;
+	return TRUE;
+}
 
-		case TRESP_MODEM_GET_SN:
-			dbg("receive TRESP_MODEM_GET_SN");
-			telephony_modem_complete_get_serial_number(dbus_info->interface_object, dbus_info->invocation, resp_get_sn->result, resp_get_sn->sn);
-			break;
+static gboolean _modem_get_version_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_modem_get_version *resp_get_version = data;
 
-		case TRESP_MODEM_GET_VERSION:
-			dbg("receive TRESP_MODEM_GET_VERSION");
-			telephony_modem_complete_get_version(dbus_info->interface_object, dbus_info->invocation,
-					resp_get_version->result,
-					resp_get_version->software,
-					resp_get_version->hardware,
-					resp_get_version->calibration,
-					resp_get_version->product_code);
-			break;
+	dbg("receive TRESP_MODEM_GET_VERSION");
+	telephony_modem_complete_get_version(dbus_info->interface_object, dbus_info->invocation,
+			resp_get_version->result,
+			resp_get_version->software,
+			resp_get_version->hardware,
+			resp_get_version->calibration,
+			resp_get_version->product_code);
 
-		case TRESP_MODEM_SET_DUN_PIN_CONTROL:
-			dbg("receive TRESP_MODEM_SET_DUN_PIN_CONTROL");
-			dbg("resp->result = %d", resp_dun_pin_ctrl->result);
-			telephony_modem_complete_set_dun_pin_ctrl(dbus_info->interface_object, dbus_info->invocation, resp_dun_pin_ctrl->result);
-			break;
+	return TRUE;
+}
 
-		default:
-			dbg("not handled command[%d]", command);
-		break;
-	}
+static gboolean _modem_set_dun_pin_control_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_modem_set_dun_pin_control *resp_dun_pin_ctrl = data;
+
+	dbg("receive TRESP_MODEM_SET_DUN_PIN_CONTROL");
+	dbg("resp->result = %d", resp_dun_pin_ctrl->result);
+	telephony_modem_complete_set_dun_pin_ctrl(dbus_info->interface_object, dbus_info->invocation, resp_dun_pin_ctrl->result);
 
 	return TRUE;
 }
 
-gboolean dbus_plugin_modem_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+static const struct dbus_plugin_response_handler modem_response_handlers[] = {
+	{ TRESP_MODEM_SET_FLIGHTMODE, _modem_set_flightmode_response },
+	{ TRESP_MODEM_POWER_ON, _modem_power_response },
+	{ TRESP_MODEM_POWER_OFF, _modem_power_response },
+	{ TRESP_MODEM_POWER_RESET, _modem_power_response },
+	{ TRESP_MODEM_GET_IMEI, _modem_get_imei_response },
+	{ TRESP_MODEM_GET_SN, _modem_get_sn_response },
+	{ TRESP_MODEM_GET_VERSION, _modem_get_version_response },
+	{ TRESP_MODEM_SET_DUN_PIN_CONTROL, _modem_set_dun_pin_control_response },
+};
+
+static gboolean _modem_power_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
 {
-	TelephonyModem *modem;
+	TelephonyModem *modem = telephony_object_peek_modem(TELEPHONY_OBJECT(object));
 	const struct tnoti_modem_power *info = data;
-	const struct tnoti_modem_dun_pin_control *pin = data;
 
-	if (!object) {
-		dbg("object is NULL");
-		return FALSE;
-	}
+	dbg("modem->state = %d", info->state);
+	telephony_modem_emit_power(modem, info->state);
+	telephony_modem_set_power(modem, info->state);
+
+	return TRUE;
+}
 
-	modem = telephony_object_peek_modem(TELEPHONY_OBJECT(object));
-	dbg("modem = %p", modem);
+static gboolean _modem_dun_pin_control_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyModem *modem = telephony_object_peek_modem(TELEPHONY_OBJECT(object));
+	const struct tnoti_modem_dun_pin_control *pin = data;
 
-	switch (command) {
-		case TNOTI_MODEM_POWER:
-			dbg("modem->state = %d", info->state);
-			telephony_modem_emit_power(modem, info->state);
-			telephony_modem_set_power(modem, info->state);
-			break;
+	dbg("modem dun pin ctrl noti signal(%d), status(%d)", pin->signal, pin->status);
+	telephony_modem_emit_dun_pin_ctrl(modem, pin->signal, pin->status);
 
-		case TNOTI_MODEM_DUN_PIN_CONTROL:
-			dbg("modem dun pin ctrl noti signal(%d), status(%d)", pin->signal, pin->status);
-			telephony_modem_emit_dun_pin_ctrl(modem, pin->signal, pin->status);
-			break;
+	return TRUE;
+}
 
-		case TNOTI_MODEM_DUN_EXTERNAL_CALL:
-			dbg("modem dun external call noti");
-			telephony_modem_emit_dun_external_call(modem, TRUE);
-			break;
+static gboolean _modem_dun_external_call_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyModem *modem = telephony_object_peek_modem(TELEPHONY_OBJECT(object));
 
-		default:
-			dbg("not handled command[0x%x]", command);
-		break;
-	}
+	dbg("modem dun external call noti");
+	telephony_modem_emit_dun_external_call(modem, TRUE);
 
 	return TRUE;
 }
 
+static const struct dbus_plugin_notification_handler modem_notification_handlers[] = {
+	{ TNOTI_MODEM_POWER, _modem_power_notification },
+	{ TNOTI_MODEM_DUN_PIN_CONTROL, _modem_dun_pin_control_notification },
+	{ TNOTI_MODEM_DUN_EXTERNAL_CALL, _modem_dun_external_call_notification },
+};
+
+void dbus_plugin_register_modem_handlers(struct custom_data *ctx)
+{
+	dbus_plugin_register_responses(ctx, modem_response_handlers,
+			G_N_ELEMENTS(modem_response_handlers));
+	dbus_plugin_register_notifications(ctx, modem_notification_handlers,
+			G_N_ELEMENTS(modem_notification_handlers));
+}
@@ -13,6 +13,7 @@
 #include <plugin.h>
 #include <hal.h>
 #include <communicator.h>
+#include <core_object.h>
 #include <storage.h>
 #include <queue.h>
 #include <user_request.h>
@@ -23,16 +24,75 @@
 #include "generated-code.h"
 #include "common.h"
 
+/*
+ * RegistrationStatus and Change repeat what the hooks below already put
+ * in the properties of the same notification (Change also carries the
+ * access technology, which has no property). They are still emitted by
+ * default; build with -DNETWORK_LEGACY_SIGNALS=OFF once no client
+ * listens to them any more.
+ */
+#ifndef DBUS_NETWORK_LEGACY_SIGNALS
+#define DBUS_NETWORK_LEGACY_SIGNALS 1
+#endif
+
+/*
+ * "45001" / "450001" / "45001#" -> (mcc << 16) | (mnc digits << 12) | mnc,
+ * never 0 for a valid PLMN.
+ */
+static guint _network_plmn_key(const char *plmn)
+{
+	guint mcc = 0;
+	guint mnc = 0;
+	guint digits = 0;
+	int i;
+
+	for (i = 0; i < 3; i++) {
+		if (plmn[i] < '0' || plmn[i] > '9')
+			return 0;
+		mcc = mcc * 10 + (plmn[i] - '0');
+	}
+
+	for (i = 3; i < 6 && plmn[i] >= '0' && plmn[i] <= '9'; i++) {
+		mnc = mnc * 10 + (plmn[i] - '0');
+		digits++;
+	}
 
-static char *_get_network_name_by_plmn(CoreObject *o, const char *plmn)
+	if (digits < 2)
+		return 0;
+
+	return (mcc << 16) | (digits << 12) | mnc;
+}
+
+/*
+ * Operator name from the pre-defined table, memoized per modem. Misses
+ * are remembered too (as ""), so each PLMN asks tcore only once.
+ */
+static const char *_get_network_name_by_plmn(struct dbus_modem_context *modem, CoreObject *o, const char *plmn)
 {
 	struct tcore_network_operator_info *noi = NULL;
+	const char *name;
 	char mcc[4] = { 0, };
 	char mnc[4] = { 0, };
+	guint key;
 
 	if (!plmn)
 		return NULL;
 
+	key = _network_plmn_key(plmn);
+
+	if (modem && key) {
+		if (!modem->plmn_names)
+			modem->plmn_names = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+
+		name = g_hash_table_lookup(modem->plmn_names, GUINT_TO_POINTER(key));
+		if (name) {
+			modem->plmn_name_hit++;
+			return name[0] ? name : NULL;
+		}
+
+		modem->plmn_name_miss++;
+	}
+
 	snprintf(mcc, 4, "%s", plmn);
 	snprintf(mnc, 4, "%s", plmn+3);
 
@@ -40,22 +100,153 @@ static char *_get_network_name_by_plmn(CoreObject *o, const char *plmn)
 		mnc[2] = '\0';
 
 	noi = tcore_network_operator_info_find(o, mcc, mnc);
-	if (noi) {
+	if (noi)
 		dbg("%s-%s: country=[%s], oper=[%s]", mcc, mnc, noi->country, noi->name);
-		return noi->name;
-	}
-	else {
+	else
 		dbg("%s-%s: no network operator name", mcc, mnc);
+
+	if (!modem || !key)
+		return noi ? noi->name : NULL;
+
+	name = g_strdup(noi ? noi->name : "");
+	g_hash_table_insert(modem->plmn_names, GUINT_TO_POINTER(key), (gpointer)name);
+	dbg("plmn name cache hit[%lu] miss[%lu]", modem->plmn_name_hit, modem->plmn_name_miss);
+
+	return name[0] ? name : NULL;
+}
+
+
+/*
+ * Hooks are registered once for all modems, user_data is the
+ * custom_data. The source's plugin picks the modem in ctx->modems.
+ */
+static TelephonyNetwork *_network_by_source(struct custom_data *ctx, CoreObject *source)
+{
+	struct dbus_modem_context *modem;
+
+	modem = dbus_plugin_ref_modem(ctx, tcore_object_ref_plugin(source));
+	if (!modem || !modem->object)
+		return NULL;
+
+	return telephony_object_peek_network(TELEPHONY_OBJECT(modem->object));
+}
+
+static void _network_info_sent(struct dbus_network_publish *pub, gint64 now, gint rssi, gint battery)
+{
+	if (pub->info_timer) {
+		g_source_remove(pub->info_timer);
+		pub->info_timer = 0;
 	}
 
-	return NULL;
+	pub->info_sent = TRUE;
+	pub->info_time = now;
+	pub->info_rssi = rssi;
+	pub->info_battery = battery;
 }
 
+/* trailing edge: the interval is over, send what was held back */
+static gboolean _network_info_flush(gpointer user_data)
+{
+	struct dbus_modem_context *modem = user_data;
+	struct dbus_network_publish *pub = &modem->net_publish;
+	TelephonyNetwork *network;
+
+	pub->info_timer = 0;
+
+	network = telephony_object_peek_network(TELEPHONY_OBJECT(modem->object));
+	if (!network)
+		return FALSE;
+
+	_network_info_sent(pub, g_get_monotonic_time(), pub->pending_rssi, pub->pending_battery);
+	pub->info_trailing++;
+
+	telephony_network_emit_info(network, pub->pending_rssi, pub->pending_battery);
+
+	return FALSE;
+}
+
+/*
+ * Info is re-sent when the battery level changes, or when RSSI moved by
+ * at least rssi_deadband and min_interval_ms passed since the last one.
+ * A move held back only by the interval goes out when the interval ends,
+ * unless RSSI came back within the dead-band of the last Info meanwhile.
+ * The last Info is therefore only guaranteed to be within rssi_deadband
+ * of the rssi property, which on_hook_icon_info() always updates; clients
+ * that need the exact value read the property.
+ */
+static gboolean _network_publish_info(struct dbus_modem_context *modem, gint rssi, gint battery)
+{
+	struct dbus_network_publish *pub;
+	gint64 now;
+	gint64 wait_us;
+	gboolean in_band;
+
+	if (!modem)
+		return TRUE;
+
+	pub = &modem->net_publish;
+	now = g_get_monotonic_time();
+
+	if (pub->info_sent && battery == pub->info_battery) {
+		in_band = ABS(rssi - pub->info_rssi) < pub->rssi_deadband;
+		wait_us = pub->info_time + (gint64)pub->min_interval_ms * 1000 - now;
+
+		if (in_band || wait_us > 0) {
+			if (in_band) {
+				/* back within the dead-band, nothing left to catch up on */
+				if (pub->info_timer) {
+					g_source_remove(pub->info_timer);
+					pub->info_timer = 0;
+				}
+			} else {
+				pub->pending_rssi = rssi;
+				pub->pending_battery = battery;
+				if (!pub->info_timer)
+					pub->info_timer = g_timeout_add((wait_us + 999) / 1000, _network_info_flush, modem);
+			}
+
+			pub->info_suppressed++;
+			dbg("info suppressed: rssi[%d] last[%d] (emitted[%lu] suppressed[%lu])",
+					rssi, pub->info_rssi, pub->info_emitted, pub->info_suppressed);
+			return FALSE;
+		}
+	}
+
+	_network_info_sent(pub, now, rssi, battery);
+	pub->info_emitted++;
+
+	return TRUE;
+}
+
+/* CellInfo only goes out when the serving LAC or cell id changed */
+static gboolean _network_publish_cell_info(struct dbus_modem_context *modem, gint lac, gint cell_id)
+{
+	struct dbus_network_publish *pub;
+
+	if (!modem)
+		return TRUE;
+
+	pub = &modem->net_publish;
+
+	if (pub->cell_sent && lac == pub->cell_lac && cell_id == pub->cell_id) {
+		pub->cell_suppressed++;
+		dbg("cell info suppressed (emitted[%lu] suppressed[%lu])",
+				pub->cell_emitted, pub->cell_suppressed);
+		return FALSE;
+	}
+
+	pub->cell_sent = TRUE;
+	pub->cell_lac = lac;
+	pub->cell_id = cell_id;
+	pub->cell_emitted++;
+
+	return TRUE;
+}
 
 static enum tcore_hook_return on_hook_location_cellinfo(Server *s, CoreObject *source, enum tcore_notification_command command, unsigned int data_len, void *data, void *user_data)
 {
 	const struct tnoti_network_location_cellinfo *info = data;
-	TelephonyNetwork *network = user_data;
+	TelephonyNetwork *network = _network_by_source(user_data, source);
 
 	if (!network)
 		return TCORE_HOOK_RETURN_CONTINUE;
@@ -69,7 +260,7 @@ static enum tcore_hook_return on_hook_location_cellinfo(Server *s, CoreObject *s
 static enum tcore_hook_return on_hook_icon_info(Server *s, CoreObject *source, enum tcore_notification_command command, unsigned int data_len, void *data, void *user_data)
 {
 	const struct tnoti_network_icon_info *info = data;
-	TelephonyNetwork *network = user_data;
+	TelephonyNetwork *network = _network_by_source(user_data, source);
 
 	if (!network)
 		return TCORE_HOOK_RETURN_CONTINUE;
@@ -82,7 +273,7 @@ static enum tcore_hook_return on_hook_icon_info(Server *s, CoreObject *source, e
 static enum tcore_hook_return on_hook_registration_status(Server *s, CoreObject *source, enum tcore_notification_command command, unsigned int data_len, void *data, void *user_data)
 {
 	const struct tnoti_network_registration_status *info = data;
-	TelephonyNetwork *network = user_data;
+	TelephonyNetwork *network = _network_by_source(user_data, source);
 
 	if (!network)
 		return TCORE_HOOK_RETURN_CONTINUE;
@@ -116,10 +307,8 @@ static enum tcore_hook_return on_hook_registration_status(Server *s, CoreObject
 static enum tcore_hook_return on_hook_change(Server *s, CoreObject *source, enum tcore_notification_command command, unsigned int data_len, void *data, void *user_data)
 {
 	const struct tnoti_network_change *info = data;
-	TelephonyNetwork *network = user_data;
-	struct tcore_network_operator_info *noi = NULL;
-	char mcc[4] = { 0, };
-	char mnc[4] = { 0, };
+	TelephonyNetwork *network = _network_by_source(user_data, source);
+	const char *name;
 	enum telephony_network_service_type svc_type;
 	enum tcore_network_name_priority network_name_priority;
 	char *tmp;
@@ -130,12 +319,6 @@ static enum tcore_hook_return on_hook_change(Server *s, CoreObject *source, enum
 	telephony_network_set_plmn(network, info->plmn);
 	telephony_network_set_lac(network, info->gsm.lac);
 
-	snprintf(mcc, 4, "%s", info->plmn);
-	snprintf(mnc, 4, "%s", info->plmn+3);
-
-	if (mnc[2] == '#')
-		mnc[2] = '\0';
-
 	tcore_network_get_network_name_priority(source, &network_name_priority);
 	telephony_network_set_name_priority(network, network_name_priority);
 
@@ -168,14 +351,13 @@ static enum tcore_hook_return on_hook_change(Server *s, CoreObject *source, enum
 			}
 			else {
 				/* pre-defined table */
-				noi = tcore_network_operator_info_find(source, mcc, mnc);
-				if (noi) {
-					dbg("%s-%s: country=[%s], oper=[%s]", mcc, mnc, noi->country, noi->name);
-					dbg("NWNAME = pre-define table[%s]", noi->name);
-					telephony_network_set_network_name(network, noi->name);
+				name = _get_network_name_by_plmn(dbus_plugin_ref_modem(user_data, tcore_object_ref_plugin(source)),
+						source, info->plmn);
+				if (name) {
+					dbg("NWNAME = pre-define table[%s]", name);
+					telephony_network_set_network_name(network, name);
 				}
 				else {
-					dbg("%s-%s: no network operator name", mcc, mnc);
 					telephony_network_set_network_name(network, info->plmn);
 				}
 			}
@@ -188,7 +370,7 @@ static enum tcore_hook_return on_hook_change(Server *s, CoreObject *source, enum
 static enum tcore_hook_return on_hook_ps_protocol_status(Server *s, CoreObject *source, enum tcore_notification_command command, unsigned int data_len, void *data, void *user_data)
 {
 	const struct tnoti_ps_protocol_status *info = data;
-	TelephonyNetwork *network = user_data;
+	TelephonyNetwork *network = _network_by_source(user_data, source);
 
 	if (!network)
 		return TCORE_HOOK_RETURN_CONTINUE;
@@ -211,7 +393,7 @@ on_network_search (TelephonyNetwork *network,
 	ur = MAKE_UR(ctx, network, invocation);
 	tcore_user_request_set_data(ur, 0, NULL);
 	tcore_user_request_set_command(ur, TREQ_NETWORK_SEARCH);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_network_complete_search(network, invocation, NULL, ret);
 		tcore_user_request_unref(ur);
@@ -257,7 +439,7 @@ on_network_search_cancel (TelephonyNetwork *network,
 	ur = MAKE_UR(ctx, network, invocation);
 	tcore_user_request_set_data(ur, 0, NULL);
 	tcore_user_request_set_command(ur, TREQ_NETWORK_SET_CANCEL_MANUAL_SEARCH);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_network_complete_search_cancel(network, invocation, ret);
 		tcore_user_request_unref(ur);
@@ -278,7 +460,7 @@ on_network_get_selection_mode (TelephonyNetwork *network,
 	ur = MAKE_UR(ctx, network, invocation);
 	tcore_user_request_set_data(ur, 0, NULL);
 	tcore_user_request_set_command(ur, TREQ_NETWORK_GET_PLMN_SELECTION_MODE);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_network_complete_get_selection_mode(network, invocation, -1, ret);
 		tcore_user_request_unref(ur);
@@ -326,7 +508,7 @@ on_network_set_selection_mode (TelephonyNetwork *network,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_network_set_plmn_selection_mode), &req);
 	tcore_user_request_set_command(ur, TREQ_NETWORK_SET_PLMN_SELECTION_MODE);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_network_complete_set_selection_mode(network, invocation, ret);
 		tcore_user_request_unref(ur);
@@ -353,7 +535,7 @@ on_network_set_service_domain (TelephonyNetwork *network,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_network_set_service_domain), &req);
 	tcore_user_request_set_command(ur, TREQ_NETWORK_SET_SERVICE_DOMAIN);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_network_complete_set_service_domain(network, invocation, ret);
 		tcore_user_request_unref(ur);
@@ -374,7 +556,7 @@ on_network_get_service_domain (TelephonyNetwork *network,
 	ur = MAKE_UR(ctx, network, invocation);
 	tcore_user_request_set_data(ur, 0, NULL);
 	tcore_user_request_set_command(ur, TREQ_NETWORK_GET_SERVICE_DOMAIN);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_network_complete_get_service_domain(network, invocation, -1, ret);
 		tcore_user_request_unref(ur);
@@ -402,7 +584,7 @@ on_network_set_band (TelephonyNetwork *network,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_network_set_band), &req);
 	tcore_user_request_set_command(ur, TREQ_NETWORK_SET_BAND);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_network_complete_set_band(network, invocation, ret);
 		tcore_user_request_unref(ur);
@@ -420,10 +602,11 @@ on_network_get_band (TelephonyNetwork *network,
 	UserRequest *ur = NULL;
 	TReturn ret;
 
-	ur = MAKE_UR(ctx, network, invocation);
-	tcore_user_request_set_data(ur, 0, NULL);
-	tcore_user_request_set_command(ur, TREQ_NETWORK_GET_BAND);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ur = MAKE_SHARED_UR(ctx, network, invocation, TREQ_NETWORK_GET_BAND, NULL, 0);
+	if (!ur)
+		return TRUE;
+
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_network_complete_get_band(network, invocation, -1, -1, ret);
 		tcore_user_request_unref(ur);
@@ -449,7 +632,7 @@ on_network_set_mode (TelephonyNetwork *network,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_network_set_mode), &req);
 	tcore_user_request_set_command(ur, TREQ_NETWORK_SET_MODE);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_network_complete_set_mode(network, invocation, ret);
 		tcore_user_request_unref(ur);
@@ -467,10 +650,11 @@ on_network_get_mode (TelephonyNetwork *network,
 	UserRequest *ur = NULL;
 	TReturn ret;
 
-	ur = MAKE_UR(ctx, network, invocation);
-	tcore_user_request_set_data(ur, 0, NULL);
-	tcore_user_request_set_command(ur, TREQ_NETWORK_GET_MODE);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ur = MAKE_SHARED_UR(ctx, network, invocation, TREQ_NETWORK_GET_MODE, NULL, 0);
+	if (!ur)
+		return TRUE;
+
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_network_complete_get_mode(network, invocation, -1, ret);
 		tcore_user_request_unref(ur);
@@ -507,7 +691,7 @@ on_network_set_preferred_plmn (TelephonyNetwork *network,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_network_set_preferred_plmn), &req);
 	tcore_user_request_set_command(ur, TREQ_NETWORK_SET_PREFERRED_PLMN);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_network_complete_set_preferred_plmn(network, invocation, ret);
 		tcore_user_request_unref(ur);
@@ -528,7 +712,7 @@ on_network_get_preferred_plmn (TelephonyNetwork *network,
 	ur = MAKE_UR(ctx, network, invocation);
 	tcore_user_request_set_data(ur, 0, NULL);
 	tcore_user_request_set_command(ur, TREQ_NETWORK_GET_PREFERRED_PLMN);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_network_complete_get_preferred_plmn(network, invocation, NULL, ret);
 		tcore_user_request_unref(ur);
@@ -546,10 +730,11 @@ on_network_get_serving_network (TelephonyNetwork *network,
 	UserRequest *ur = NULL;
 	TReturn ret;
 
-	ur = MAKE_UR(ctx, network, invocation);
-	tcore_user_request_set_data(ur, 0, NULL);
-	tcore_user_request_set_command(ur, TREQ_NETWORK_GET_SERVING_NETWORK);
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ur = MAKE_SHARED_UR(ctx, network, invocation, TREQ_NETWORK_GET_SERVING_NETWORK, NULL, 0);
+	if (!ur)
+		return TRUE;
+
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		telephony_network_complete_get_serving_network(network, invocation, 0, NULL, 0, ret);
 		tcore_user_request_unref(ur);
@@ -631,300 +816,377 @@ gboolean dbus_plugin_setup_network_interface(TelephonyObjectSkeleton *object, st
 			G_CALLBACK (on_network_get_serving_network),
 			ctx);
 
-	tcore_server_add_notification_hook(ctx->server, TNOTI_NETWORK_LOCATION_CELLINFO, on_hook_location_cellinfo, network);
-	tcore_server_add_notification_hook(ctx->server, TNOTI_NETWORK_ICON_INFO, on_hook_icon_info, network);
-	tcore_server_add_notification_hook(ctx->server, TNOTI_NETWORK_REGISTRATION_STATUS, on_hook_registration_status, network);
-	tcore_server_add_notification_hook(ctx->server, TNOTI_NETWORK_CHANGE, on_hook_change, network);
-	tcore_server_add_notification_hook(ctx->server, TNOTI_PS_PROTOCOL_STATUS, on_hook_ps_protocol_status, network);
-
 	return TRUE;
 }
 
-gboolean dbus_plugin_network_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+static gboolean _network_search_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
 {
 	const struct tresp_network_search *resp_network_search = data;
-	const struct tresp_network_set_cancel_manual_search *resp_set_cancel_manual_search = data;
-	const struct tresp_network_get_plmn_selection_mode *resp_get_plmn_selection_mode = data;
-	const struct tresp_network_set_plmn_selection_mode *resp_set_plmn_selection_mode = data;
-	const struct tresp_network_set_service_domain *resp_set_service_domain = data;
-	const struct tresp_network_get_service_domain *resp_get_service_domain = data;
-	const struct tresp_network_set_band *resp_set_band = data;
-	const struct tresp_network_get_band *resp_get_band = data;
-	const struct tresp_network_set_preferred_plmn *resp_set_preferred_plmn = data;
-	const struct tresp_network_get_preferred_plmn *resp_get_preferred_plmn = data;
-	const struct tresp_network_get_serving_network *resp_get_serving_network = data;
-	const struct tresp_network_set_mode *resp_set_mode = data;
-	const struct tresp_network_get_mode *resp_get_mode = data;
-
 	int i = 0;
-	char *buf;
-
-	GSList *co_list;
+	const char *buf;
+	struct dbus_modem_context *modem;
 	CoreObject *co_network;
-	char *modem_name = NULL;
-	TcorePlugin *p = NULL;
+	GVariant *result = NULL;
+	GVariantBuilder b;
 
-	modem_name = tcore_user_request_get_modem_name(ur);
-	if (!modem_name)
+	modem = dbus_plugin_ref_modem_by_request(ctx, ur, dbus_info);
+	co_network = MODEM_CO(modem, CORE_OBJECT_TYPE_NETWORK);
+	if (!co_network) {
 		return FALSE;
+	}
 
-	p = tcore_server_find_plugin(ctx->server, modem_name);
-	free(modem_name);
-	if (!p)
-		return FALSE;
+	dbg("receive TRESP_NETWORK_SEARCH");
+	dbg("resp->result = %d", resp_network_search->result);
 
-	co_list = tcore_plugin_get_core_objects_bytype(p, CORE_OBJECT_TYPE_NETWORK);
-	if (!co_list) {
-		return FALSE;
-	}
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
 
-	co_network = (CoreObject *)co_list->data;
-	g_slist_free(co_list);
+	for (i = 0; i < resp_network_search->list_count; i++) {
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
 
-	if (!co_network) {
-		return FALSE;
-	}
+		g_variant_builder_add(&b, "{sv}", "plmn", g_variant_new_string(resp_network_search->list[i].plmn));
+		g_variant_builder_add(&b, "{sv}", "act", g_variant_new_int32(resp_network_search->list[i].act));
+		g_variant_builder_add(&b, "{sv}", "type", g_variant_new_int32(resp_network_search->list[i].status));
 
-	switch (command) {
-		case TRESP_NETWORK_SEARCH: {
-			GVariant *result = NULL;
-			GVariantBuilder b;
+		if (strlen(resp_network_search->list[i].name) > 0) {
+			g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(resp_network_search->list[i].name));
+		}
+		else {
+			buf = _get_network_name_by_plmn(modem, co_network, resp_network_search->list[i].plmn);
+			if (buf)
+				g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(buf));
+			else
+				g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(resp_network_search->list[i].plmn));
+		}
 
-			dbg("receive TRESP_NETWORK_SEARCH");
-			dbg("resp->result = %d", resp_network_search->result);
+		g_variant_builder_close(&b);
+	}
 
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+	result = g_variant_builder_end(&b);
 
-			for (i = 0; i < resp_network_search->list_count; i++) {
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+	telephony_network_complete_search(dbus_info->interface_object, dbus_info->invocation, result, resp_network_search->result);
 
-				g_variant_builder_add(&b, "{sv}", "plmn", g_variant_new_string(resp_network_search->list[i].plmn));
-				g_variant_builder_add(&b, "{sv}", "act", g_variant_new_int32(resp_network_search->list[i].act));
-				g_variant_builder_add(&b, "{sv}", "type", g_variant_new_int32(resp_network_search->list[i].status));
+	return TRUE;
+}
 
-				if (strlen(resp_network_search->list[i].name) > 0) {
-					g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(resp_network_search->list[i].name));
-				}
-				else {
-					buf = _get_network_name_by_plmn(co_network, resp_network_search->list[i].plmn);
-					if (buf)
-						g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(buf));
-					else
-						g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(resp_network_search->list[i].plmn));
-				}
+static gboolean _network_set_plmn_selection_mode_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_network_set_plmn_selection_mode *resp_set_plmn_selection_mode = data;
 
-				g_variant_builder_close(&b);
-			}
+	dbg("receive TRESP_SET_PLMN_SELECTION_MODE");
+	dbg("resp->result = %d", resp_set_plmn_selection_mode->result);
+	telephony_network_complete_set_selection_mode(dbus_info->interface_object, dbus_info->invocation, resp_set_plmn_selection_mode->result);
 
-			result = g_variant_builder_end(&b);
+	return TRUE;
+}
 
-			telephony_network_complete_search(dbus_info->interface_object, dbus_info->invocation, result, resp_network_search->result);
-		}
+static gboolean _network_get_plmn_selection_mode_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_network_get_plmn_selection_mode *resp_get_plmn_selection_mode = data;
 
+	dbg("receive TRESP_GET_PLMN_SELECTION_MODE");
+	dbg("resp->mode = %d", resp_get_plmn_selection_mode->mode);
+	switch (resp_get_plmn_selection_mode->mode) {
+		case NETWORK_SELECT_MODE_GLOBAL_AUTOMATIC:
+		case NETWORK_SELECT_MODE_GSM_AUTOMATIC:
+			telephony_network_complete_get_selection_mode(dbus_info->interface_object, dbus_info->invocation, 0, resp_get_plmn_selection_mode->result);
 			break;
 
-		case TRESP_NETWORK_SET_PLMN_SELECTION_MODE:
-			dbg("receive TRESP_SET_PLMN_SELECTION_MODE");
-			dbg("resp->result = %d", resp_set_plmn_selection_mode->result);
-			telephony_network_complete_set_selection_mode(dbus_info->interface_object, dbus_info->invocation, resp_set_plmn_selection_mode->result);
+		case NETWORK_SELECT_MODE_GSM_MANUAL:
+			telephony_network_complete_get_selection_mode(dbus_info->interface_object, dbus_info->invocation, 1, resp_get_plmn_selection_mode->result);
 			break;
 
-		case TRESP_NETWORK_GET_PLMN_SELECTION_MODE:
-			dbg("receive TRESP_GET_PLMN_SELECTION_MODE");
-			dbg("resp->mode = %d", resp_get_plmn_selection_mode->mode);
-			switch (resp_get_plmn_selection_mode->mode) {
-				case NETWORK_SELECT_MODE_GLOBAL_AUTOMATIC:
-				case NETWORK_SELECT_MODE_GSM_AUTOMATIC:
-					telephony_network_complete_get_selection_mode(dbus_info->interface_object, dbus_info->invocation, 0, resp_get_plmn_selection_mode->result);
-					break;
-
-				case NETWORK_SELECT_MODE_GSM_MANUAL:
-					telephony_network_complete_get_selection_mode(dbus_info->interface_object, dbus_info->invocation, 1, resp_get_plmn_selection_mode->result);
-					break;
-
-				default:
-					telephony_network_complete_get_selection_mode(dbus_info->interface_object, dbus_info->invocation, -1, resp_get_plmn_selection_mode->result);
-					break;
-			}
+		default:
+			telephony_network_complete_get_selection_mode(dbus_info->interface_object, dbus_info->invocation, -1, resp_get_plmn_selection_mode->result);
 			break;
+	}
 
-		case TRESP_NETWORK_SET_SERVICE_DOMAIN:
-			dbg("receive TRESP_NETWORK_SET_SERVICE_DOMAIN");
-			dbg("resp->result = %d", resp_set_service_domain->result);
-			telephony_network_complete_set_service_domain(dbus_info->interface_object, dbus_info->invocation, resp_set_service_domain->result);
-			break;
+	return TRUE;
+}
 
-		case TRESP_NETWORK_GET_SERVICE_DOMAIN:
-			dbg("receive TRESP_NETWORK_GET_SERVICE_DOMAIN");
-			dbg("resp->domain = %d", resp_get_service_domain->domain);
-			telephony_network_complete_get_service_domain(dbus_info->interface_object, dbus_info->invocation, resp_get_service_domain->domain, resp_get_service_domain->result);
-			break;
+static gboolean _network_set_service_domain_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_network_set_service_domain *resp_set_service_domain = data;
 
-		case TRESP_NETWORK_SET_BAND:
-			dbg("receive TRESP_NETWORK_SET_BAND");
-			dbg("resp->result = %d", resp_set_band->result);
-			telephony_network_complete_set_band(dbus_info->interface_object, dbus_info->invocation, resp_set_band->result);
-			break;
+	dbg("receive TRESP_NETWORK_SET_SERVICE_DOMAIN");
+	dbg("resp->result = %d", resp_set_service_domain->result);
+	telephony_network_complete_set_service_domain(dbus_info->interface_object, dbus_info->invocation, resp_set_service_domain->result);
 
-		case TRESP_NETWORK_GET_BAND:
-			dbg("receive TRESP_NETWORK_GET_BAND");
-			dbg("resp->mode = %d", resp_get_band->mode);
-			dbg("resp->band = %d", resp_get_band->band);
-			telephony_network_complete_get_band(dbus_info->interface_object, dbus_info->invocation, resp_get_band->band, resp_get_band->mode, resp_get_band->result);
-			break;
+	return TRUE;
+}
 
-		case TRESP_NETWORK_SET_MODE:
-			dbg("receive TRESP_NETWORK_SET_MODE");
-			dbg("resp->result = %d", resp_set_mode->result);
-			telephony_network_complete_set_mode(dbus_info->interface_object, dbus_info->invocation, resp_set_mode->result);
-			break;
+static gboolean _network_get_service_domain_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_network_get_service_domain *resp_get_service_domain = data;
 
-		case TRESP_NETWORK_GET_MODE:
-			dbg("receive TRESP_NETWORK_GET_MODE");
-			dbg("resp->mode = %d", resp_get_mode->mode);
-			telephony_network_complete_get_mode(dbus_info->interface_object, dbus_info->invocation, resp_get_mode->mode, resp_get_mode->result);
-			break;
+	dbg("receive TRESP_NETWORK_GET_SERVICE_DOMAIN");
+	dbg("resp->domain = %d", resp_get_service_domain->domain);
+	telephony_network_complete_get_service_domain(dbus_info->interface_object, dbus_info->invocation, resp_get_service_domain->domain, resp_get_service_domain->result);
 
-		case TRESP_NETWORK_SET_PREFERRED_PLMN:
-			dbg("receive TRESP_NETWORK_SET_PREFERRED_PLMN");
-			dbg("resp->result = %d", resp_set_preferred_plmn->result);
-			telephony_network_complete_set_preferred_plmn(dbus_info->interface_object, dbus_info->invocation, resp_set_preferred_plmn->result);
-			break;
+	return TRUE;
+}
 
-		case TRESP_NETWORK_GET_PREFERRED_PLMN:
-			dbg("receive TRESP_NETWORK_GET_PREFERRED_PLMN");
-			dbg("resp->result = %d", resp_get_preferred_plmn->result);
-			{
-				GVariant *result = NULL;
-				GVariantBuilder b;
+static gboolean _network_set_band_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_network_set_band *resp_set_band = data;
 
-				g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+	dbg("receive TRESP_NETWORK_SET_BAND");
+	dbg("resp->result = %d", resp_set_band->result);
+	telephony_network_complete_set_band(dbus_info->interface_object, dbus_info->invocation, resp_set_band->result);
 
-				for (i = 0; i < resp_get_preferred_plmn->list_count; i++) {
-					g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+	return TRUE;
+}
 
-					g_variant_builder_add(&b, "{sv}", "plmn",
-							g_variant_new_string(resp_get_preferred_plmn->list[i].plmn));
-					g_variant_builder_add(&b, "{sv}", "act", g_variant_new_int32(resp_get_preferred_plmn->list[i].act));
-					g_variant_builder_add(&b, "{sv}", "index",
-							g_variant_new_int32(resp_get_preferred_plmn->list[i].ef_index));
+static gboolean _network_get_band_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_network_get_band *resp_get_band = data;
 
-					buf = _get_network_name_by_plmn(co_network, resp_get_preferred_plmn->list[i].plmn);
-					if (buf)
-						g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(buf));
-					else
-						g_variant_builder_add(&b, "{sv}", "name",
-								g_variant_new_string(resp_get_preferred_plmn->list[i].plmn));
+	dbg("receive TRESP_NETWORK_GET_BAND");
+	dbg("resp->mode = %d", resp_get_band->mode);
+	dbg("resp->band = %d", resp_get_band->band);
+	telephony_network_complete_get_band(dbus_info->interface_object, dbus_info->invocation, resp_get_band->band, resp_get_band->mode, resp_get_band->result);
 
-					g_variant_builder_close(&b);
-				}
+	return TRUE;
+}
 
-				result = g_variant_builder_end(&b);
+static gboolean _network_set_mode_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_network_set_mode *resp_set_mode = data;
 
-				telephony_network_complete_get_preferred_plmn(dbus_info->interface_object, dbus_info->invocation,
-						result, resp_get_preferred_plmn->result);
-			}
-			break;
+	dbg("receive TRESP_NETWORK_SET_MODE");
+	dbg("resp->result = %d", resp_set_mode->result);
+	telephony_network_complete_set_mode(dbus_info->interface_object, dbus_info->invocation, resp_set_mode->result);
 
-		case TRESP_NETWORK_SET_CANCEL_MANUAL_SEARCH:
-			dbg("receive TRESP_NETWORK_SET_CANCEL_MANUAL_SEARCH");
-			dbg("resp->result = %d", resp_set_cancel_manual_search->result);
-			telephony_network_complete_search_cancel(dbus_info->interface_object, dbus_info->invocation, resp_set_cancel_manual_search->result);
-			break;
+	return TRUE;
+}
 
-		case TRESP_NETWORK_GET_SERVING_NETWORK:
-			dbg("receive TRESP_NETWORK_GET_SERVING_NETWORK");
-			dbg("resp->act = %d", resp_get_serving_network->act);
-			dbg("resp->plmn = %s", resp_get_serving_network->plmn);
-			dbg("resp->lac = %d", resp_get_serving_network->gsm.lac);
-			telephony_network_complete_get_serving_network(dbus_info->interface_object, dbus_info->invocation,
-					resp_get_serving_network->act,
-					resp_get_serving_network->plmn,
-					resp_get_serving_network->gsm.lac,
-					resp_get_serving_network->result);
-			break;
+static gboolean _network_get_mode_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_network_get_mode *resp_get_mode = data;
 
-		default:
-			dbg("not handled cmd[0x%x]", command);
-			break;
+	dbg("receive TRESP_NETWORK_GET_MODE");
+	dbg("resp->mode = %d", resp_get_mode->mode);
+	telephony_network_complete_get_mode(dbus_info->interface_object, dbus_info->invocation, resp_get_mode->mode, resp_get_mode->result);
+
+	return TRUE;
+}
+
+static gboolean _network_set_preferred_plmn_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_network_set_preferred_plmn *resp_set_preferred_plmn = data;
+
+	dbg("receive TRESP_NETWORK_SET_PREFERRED_PLMN");
+	dbg("resp->result = %d", resp_set_preferred_plmn->result);
+	telephony_network_complete_set_preferred_plmn(dbus_info->interface_object, dbus_info->invocation, resp_set_preferred_plmn->result);
+
+	return TRUE;
+}
+
+static gboolean _network_get_preferred_plmn_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_network_get_preferred_plmn *resp_get_preferred_plmn = data;
+	int i = 0;
+	const char *buf;
+	struct dbus_modem_context *modem;
+	CoreObject *co_network;
+	GVariant *result = NULL;
+	GVariantBuilder b;
+
+	modem = dbus_plugin_ref_modem_by_request(ctx, ur, dbus_info);
+	co_network = MODEM_CO(modem, CORE_OBJECT_TYPE_NETWORK);
+	if (!co_network) {
+		return FALSE;
+	}
+
+	dbg("receive TRESP_NETWORK_GET_PREFERRED_PLMN");
+	dbg("resp->result = %d", resp_get_preferred_plmn->result);
+
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+
+	for (i = 0; i < resp_get_preferred_plmn->list_count; i++) {
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+
+		g_variant_builder_add(&b, "{sv}", "plmn",
+				g_variant_new_string(resp_get_preferred_plmn->list[i].plmn));
+		g_variant_builder_add(&b, "{sv}", "act", g_variant_new_int32(resp_get_preferred_plmn->list[i].act));
+		g_variant_builder_add(&b, "{sv}", "index",
+				g_variant_new_int32(resp_get_preferred_plmn->list[i].ef_index));
+
+		buf = _get_network_name_by_plmn(modem, co_network, resp_get_preferred_plmn->list[i].plmn);
+		if (buf)
+			g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(buf));
+		else
+			g_variant_builder_add(&b, "{sv}", "name",
+					g_variant_new_string(resp_get_preferred_plmn->list[i].plmn));
+
+		g_variant_builder_close(&b);
 	}
 
+	result = g_variant_builder_end(&b);
+
+	telephony_network_complete_get_preferred_plmn(dbus_info->interface_object, dbus_info->invocation,
+			result, resp_get_preferred_plmn->result);
+
 	return TRUE;
 }
 
-gboolean dbus_plugin_network_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+static gboolean _network_set_cancel_manual_search_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
 {
-	TelephonyNetwork *network;
+	const struct tresp_network_set_cancel_manual_search *resp_set_cancel_manual_search = data;
+
+	dbg("receive TRESP_NETWORK_SET_CANCEL_MANUAL_SEARCH");
+	dbg("resp->result = %d", resp_set_cancel_manual_search->result);
+	telephony_network_complete_search_cancel(dbus_info->interface_object, dbus_info->invocation, resp_set_cancel_manual_search->result);
+
+	return TRUE;
+}
+
+static gboolean _network_get_serving_network_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_network_get_serving_network *resp_get_serving_network = data;
+
+	dbg("receive TRESP_NETWORK_GET_SERVING_NETWORK");
+	dbg("resp->act = %d", resp_get_serving_network->act);
+	dbg("resp->plmn = %s", resp_get_serving_network->plmn);
+	dbg("resp->lac = %d", resp_get_serving_network->gsm.lac);
+	telephony_network_complete_get_serving_network(dbus_info->interface_object, dbus_info->invocation,
+			resp_get_serving_network->act,
+			resp_get_serving_network->plmn,
+			resp_get_serving_network->gsm.lac,
+			resp_get_serving_network->result);
+
+	return TRUE;
+}
+
+static const struct dbus_plugin_response_handler network_response_handlers[] = {
+	{ TRESP_NETWORK_SEARCH, _network_search_response },
+	{ TRESP_NETWORK_SET_PLMN_SELECTION_MODE, _network_set_plmn_selection_mode_response },
+	{ TRESP_NETWORK_GET_PLMN_SELECTION_MODE, _network_get_plmn_selection_mode_response },
+	{ TRESP_NETWORK_SET_SERVICE_DOMAIN, _network_set_service_domain_response },
+	{ TRESP_NETWORK_GET_SERVICE_DOMAIN, _network_get_service_domain_response },
+	{ TRESP_NETWORK_SET_BAND, _network_set_band_response },
+	{ TRESP_NETWORK_GET_BAND, _network_get_band_response },
+	{ TRESP_NETWORK_SET_MODE, _network_set_mode_response },
+	{ TRESP_NETWORK_GET_MODE, _network_get_mode_response },
+	{ TRESP_NETWORK_SET_PREFERRED_PLMN, _network_set_preferred_plmn_response },
+	{ TRESP_NETWORK_GET_PREFERRED_PLMN, _network_get_preferred_plmn_response },
+	{ TRESP_NETWORK_SET_CANCEL_MANUAL_SEARCH, _network_set_cancel_manual_search_response },
+	{ TRESP_NETWORK_GET_SERVING_NETWORK, _network_get_serving_network_response },
+};
+
+static gboolean _network_registration_status_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+#if DBUS_NETWORK_LEGACY_SIGNALS
+	TelephonyNetwork *network = telephony_object_peek_network(TELEPHONY_OBJECT(object));
 	const struct tnoti_network_registration_status *registration = data;
+
+	telephony_network_emit_registration_status(network,
+			registration->cs_domain_status,
+			registration->ps_domain_status,
+			registration->service_type,
+			registration->roaming_status);
+#endif
+
+	return TRUE;
+}
+
+static gboolean _network_change_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+#if DBUS_NETWORK_LEGACY_SIGNALS
+	TelephonyNetwork *network = telephony_object_peek_network(TELEPHONY_OBJECT(object));
 	const struct tnoti_network_change *change = data;
+
+	telephony_network_emit_change(network,
+			change->act,
+			change->plmn,
+			change->gsm.lac);
+#endif
+
+	return TRUE;
+}
+
+static gboolean _network_icon_info_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyNetwork *network = telephony_object_peek_network(TELEPHONY_OBJECT(object));
 	const struct tnoti_network_icon_info *icon_info = data;
-	const struct tnoti_network_timeinfo *time_info = data;
-	const struct tnoti_network_identity *identity = data;
-	const struct tnoti_network_location_cellinfo *location = data;
 
-	if (!object) {
-		dbg("object is NULL");
-		return FALSE;
-	}
+	if (!_network_publish_info(dbus_plugin_ref_modem_by_object(object), icon_info->rssi, icon_info->battery))
+		return TRUE;
 
-	network = telephony_object_peek_network(TELEPHONY_OBJECT(object));
-	dbg("network = %p", network);
+	telephony_network_emit_info(network,
+			icon_info->rssi,
+			icon_info->battery);
 
-	switch (command) {
-		case TNOTI_NETWORK_REGISTRATION_STATUS:
-			telephony_network_emit_registration_status(network,
-					registration->cs_domain_status,
-					registration->ps_domain_status,
-					registration->service_type,
-					registration->roaming_status);
-			break;
+	return TRUE;
+}
 
-		case TNOTI_NETWORK_CHANGE:
-			telephony_network_emit_change(network,
-					change->act,
-					change->plmn,
-					change->gsm.lac);
-			break;
+static gboolean _network_timeinfo_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyNetwork *network = telephony_object_peek_network(TELEPHONY_OBJECT(object));
+	const struct tnoti_network_timeinfo *time_info = data;
 
-		case TNOTI_NETWORK_ICON_INFO:
-			telephony_network_emit_info(network,
-					icon_info->rssi,
-					icon_info->battery);
-			break;
+	telephony_network_emit_time_info(network,
+			time_info->year,
+			time_info->month,
+			time_info->day,
+			time_info->hour,
+			time_info->minute,
+			time_info->second,
+			time_info->wday,
+			time_info->gmtoff,
+			time_info->dstoff,
+			time_info->isdst,
+			time_info->plmn);
 
-		case TNOTI_NETWORK_TIMEINFO:
-			telephony_network_emit_time_info(network,
-					time_info->year,
-					time_info->month,
-					time_info->day,
-					time_info->hour,
-					time_info->minute,
-					time_info->second,
-					time_info->wday,
-					time_info->gmtoff,
-					time_info->dstoff,
-					time_info->isdst,
-					time_info->plmn);
-			break;
+	return TRUE;
+}
 
-		case TNOTI_NETWORK_IDENTITY:
-			telephony_network_emit_identity(network,
-					identity->plmn,
-					identity->short_name,
-					identity->full_name);
-			break;
+static gboolean _network_identity_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyNetwork *network = telephony_object_peek_network(TELEPHONY_OBJECT(object));
+	const struct tnoti_network_identity *identity = data;
 
-		case TNOTI_NETWORK_LOCATION_CELLINFO:
-			telephony_network_emit_cell_info(network,
-					location->lac,
-					location->cell_id);
-			break;
+	telephony_network_emit_identity(network,
+			identity->plmn,
+			identity->short_name,
+			identity->full_name);
 
-		default:
-			dbg("not handled cmd[0x%x]", command);
-			break;
-	}
+	return TRUE;
+}
+
+static gboolean _network_location_cellinfo_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonyNetwork *network = telephony_object_peek_network(TELEPHONY_OBJECT(object));
+	const struct tnoti_network_location_cellinfo *location = data;
+
+	if (!_network_publish_cell_info(dbus_plugin_ref_modem_by_object(object), location->lac, location->cell_id))
+		return TRUE;
+
+	telephony_network_emit_cell_info(network,
+			location->lac,
+			location->cell_id);
 
 	return TRUE;
 }
 
+static const struct dbus_plugin_notification_handler network_notification_handlers[] = {
+	{ TNOTI_NETWORK_REGISTRATION_STATUS, _network_registration_status_notification },
+	{ TNOTI_NETWORK_CHANGE, _network_change_notification },
+	{ TNOTI_NETWORK_ICON_INFO, _network_icon_info_notification },
+	{ TNOTI_NETWORK_TIMEINFO, _network_timeinfo_notification },
+	{ TNOTI_NETWORK_IDENTITY, _network_identity_notification },
+	{ TNOTI_NETWORK_LOCATION_CELLINFO, _network_location_cellinfo_notification },
+};
+
+void dbus_plugin_register_network_handlers(struct custom_data *ctx)
+{
+	dbus_plugin_register_responses(ctx, network_response_handlers,
+			G_N_ELEMENTS(network_response_handlers));
+	dbus_plugin_register_notifications(ctx, network_notification_handlers,
+			G_N_ELEMENTS(network_notification_handlers));
+
+	tcore_server_add_notification_hook(ctx->server, TNOTI_NETWORK_LOCATION_CELLINFO, on_hook_location_cellinfo, ctx);
+	tcore_server_add_notification_hook(ctx->server, TNOTI_NETWORK_ICON_INFO, on_hook_icon_info, ctx);
+	tcore_server_add_notification_hook(ctx->server, TNOTI_NETWORK_REGISTRATION_STATUS, on_hook_registration_status, ctx);
+	tcore_server_add_notification_hook(ctx->server, TNOTI_NETWORK_CHANGE, on_hook_change, ctx);
+	tcore_server_add_notification_hook(ctx->server, TNOTI_PS_PROTOCOL_STATUS, on_hook_ps_protocol_status, ctx);
+}
@@ -39,6 +39,79 @@
 #include "generated-code.h"
 #include "common.h"
 
+/*
+ * Cache of successful TRESP_PHONEBOOK_READRECORD results per modem,
+ * keyed by phonebook type and index. Adding or removing a record
+ * changes next_index of its neighbours, so those drop the whole type.
+ */
+#define PB_CACHE_KEY(type, index) GUINT_TO_POINTER(0x80000000 | (((guint)(type) & 0x7FFF) << 16) | ((guint)(index) & 0xFFFF))
+
+static const struct tresp_phonebook_read_record *_pb_cache_lookup(struct dbus_modem_context *modem, gint type, gint index)
+{
+	const struct tresp_phonebook_read_record *record;
+
+	if (!modem || !modem->pb_cache)
+		return NULL;
+
+	record = g_hash_table_lookup(modem->pb_cache, PB_CACHE_KEY(type, index));
+	if (record)
+		modem->pb_cache_hit++;
+	else
+		modem->pb_cache_miss++;
+
+	dbg("pb cache hit[%lu] miss[%lu]", modem->pb_cache_hit, modem->pb_cache_miss);
+
+	return record;
+}
+
+static void _pb_cache_store(struct dbus_modem_context *modem, const struct tresp_phonebook_read_record *record)
+{
+	if (!modem)
+		return;
+
+	if (!modem->pb_cache)
+		modem->pb_cache = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+
+	g_hash_table_replace(modem->pb_cache, PB_CACHE_KEY(record->phonebook_type, record->index),
+			g_memdup(record, sizeof(struct tresp_phonebook_read_record)));
+}
+
+static gboolean _pb_cache_match_type(gpointer key, gpointer value, gpointer user_data)
+{
+	const struct tresp_phonebook_read_record *record = value;
+
+	return record->phonebook_type == GPOINTER_TO_INT(user_data);
+}
+
+static void _pb_cache_invalidate(struct dbus_modem_context *modem, gint type, gint index)
+{
+	if (!modem || !modem->pb_cache)
+		return;
+
+	if (index >= 0 && g_hash_table_remove(modem->pb_cache, PB_CACHE_KEY(type, index)))
+		return;
+
+	g_hash_table_foreach_remove(modem->pb_cache, _pb_cache_match_type, GINT_TO_POINTER(type));
+}
+
+static void _pb_cache_clear(struct dbus_modem_context *modem)
+{
+	if (!modem || !modem->pb_cache)
+		return;
+
+	g_hash_table_remove_all(modem->pb_cache);
+}
+
+static void _pb_complete_read_record(TelephonyPhonebook *phonebook, GDBusMethodInvocation *invocation,
+		const struct tresp_phonebook_read_record *resp_pbread)
+{
+	telephony_phonebook_complete_read_record(phonebook, invocation,
+			resp_pbread->result, resp_pbread->phonebook_type, resp_pbread->index, resp_pbread->next_index, (const gchar *)resp_pbread->name,
+			resp_pbread->dcs, (const gchar *)resp_pbread->number, resp_pbread->ton, (const gchar *)resp_pbread->anr1, resp_pbread->anr1_ton,
+			(const gchar *)resp_pbread->anr2, resp_pbread->anr2_ton, (const gchar *)resp_pbread->anr3, resp_pbread->anr3_ton,
+			(const gchar *)resp_pbread->email1, (const gchar *)resp_pbread->email2, (const gchar *)resp_pbread->email3, (const gchar *)resp_pbread->email4, resp_pbread->group_index);
+}
+
 static gboolean on_phonebook_get_init_status(TelephonyPhonebook *phonebook, GDBusMethodInvocation *invocation, gpointer user_data)
 {
 	struct custom_data *ctx = user_data;
@@ -91,7 +164,7 @@ static gboolean on_phonebook_get_count(TelephonyPhonebook *phonebook, GDBusMetho
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_phonebook_get_count), &pb_count);
 	tcore_user_request_set_command(ur, TREQ_PHONEBOOK_GETCOUNT);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -110,7 +183,7 @@ static gboolean on_phonebook_get_info(TelephonyPhonebook *phonebook, GDBusMethod
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_phonebook_get_info), &pb_info);
 	tcore_user_request_set_command(ur, TREQ_PHONEBOOK_GETMETAINFO);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -122,7 +195,7 @@ static gboolean on_phonebook_get_usim_info(TelephonyPhonebook *phonebook, GDBusM
 	ur = MAKE_UR(ctx, phonebook, invocation);
 	tcore_user_request_set_data(ur, 0, NULL);
 	tcore_user_request_set_command(ur, TREQ_PHONEBOOK_GETUSIMINFO);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 	return TRUE;
 }
 
@@ -131,9 +204,16 @@ static gboolean on_phonebook_read_record(TelephonyPhonebook *phonebook, GDBusMet
 {
 	struct custom_data *ctx = user_data;
 	UserRequest *ur = NULL;
+	const struct tresp_phonebook_read_record *cached;
 
 	struct treq_phonebook_read_record pb_read;
 
+	cached = _pb_cache_lookup(dbus_plugin_ref_modem_by_interface(phonebook), arg_req_type, arg_index);
+	if (cached) {
+		_pb_complete_read_record(phonebook, invocation, cached);
+		return TRUE;
+	}
+
 	ur = MAKE_UR(ctx, phonebook, invocation);
 	memset(&pb_read, 0, sizeof(struct treq_phonebook_read_record));
 
@@ -142,7 +222,113 @@ static gboolean on_phonebook_read_record(TelephonyPhonebook *phonebook, GDBusMet
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_phonebook_read_record), &pb_read);
 	tcore_user_request_set_command(ur, TREQ_PHONEBOOK_READRECORD);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
+
+	return TRUE;
+}
+
+struct pb_export {
+	struct custom_data *ctx;
+	TelephonyPhonebook *phonebook;
+	GDBusMethodInvocation *invocation;
+	gint type;
+	gint remaining;
+	guint exported;
+	GVariantBuilder records;
+};
+
+static void _pb_export_complete(struct pb_export *export, gint result)
+{
+	telephony_phonebook_complete_export_range(export->phonebook, export->invocation,
+			export->exported ? 0 : result, g_variant_builder_end(&export->records));
+	g_free(export);
+}
+
+/* free hook: the read went away without a response, return what we have */
+static void _pb_export_abort(struct dbus_request_info *dbus_info)
+{
+	struct pb_export *export = dbus_info->batch;
+
+	dbus_info->batch = NULL;
+	_pb_export_complete(export, -1);
+}
+
+static void _pb_export_request(struct pb_export *export, unsigned short index)
+{
+	struct treq_phonebook_read_record pb_read;
+	struct dbus_request_info *dbus_info;
+	UserRequest *ur = NULL;
+	TReturn ret;
+
+	ur = MAKE_UR(export->ctx, export->phonebook, export->invocation);
+	dbus_info = dbus_plugin_ref_request_info(ur);
+	dbus_info->batch = export;
+	dbus_info->batch_abort = _pb_export_abort;
+
+	memset(&pb_read, 0, sizeof(struct treq_phonebook_read_record));
+	pb_read.index = index;
+	pb_read.phonebook_type = export->type;
+
+	tcore_user_request_set_data(ur, sizeof(struct treq_phonebook_read_record), &pb_read);
+	tcore_user_request_set_command(ur, TREQ_PHONEBOOK_READRECORD);
+
+	ret = dbus_plugin_dispatch_request(export->ctx, ur);
+	if (ret != TCORE_RETURN_SUCCESS) {
+		dbg("dispatch fail [0x%x]", ret);
+		dbus_info->batch = NULL;
+		tcore_user_request_unref(ur);
+		_pb_export_complete(export, -1);
+	}
+}
+
+static void _pb_export_response(struct dbus_request_info *dbus_info, const struct tresp_phonebook_read_record *resp)
+{
+	struct pb_export *export = dbus_info->batch;
+
+	dbus_info->batch = NULL;
+
+	if (resp->result != 0) {
+		_pb_export_complete(export, resp->result);
+		return;
+	}
+
+	g_variant_builder_add(&export->records, "(isisisisisissssi)",
+			resp->index, (const gchar *)resp->name, resp->dcs,
+			(const gchar *)resp->number, resp->ton,
+			(const gchar *)resp->anr1, resp->anr1_ton,
+			(const gchar *)resp->anr2, resp->anr2_ton,
+			(const gchar *)resp->anr3, resp->anr3_ton,
+			(const gchar *)resp->email1, (const gchar *)resp->email2,
+			(const gchar *)resp->email3, (const gchar *)resp->email4,
+			resp->group_index);
+	export->exported++;
+
+	if (export->remaining > 0)
+		export->remaining--;
+
+	if (export->remaining == 0 || resp->next_index == 0 || resp->next_index <= resp->index) {
+		_pb_export_complete(export, 0);
+		return;
+	}
+
+	_pb_export_request(export, resp->next_index);
+}
+
+static gboolean on_phonebook_export_range(TelephonyPhonebook *phonebook, GDBusMethodInvocation *invocation,
+		gint arg_type, gint arg_start_index, gint arg_count, gpointer user_data)
+{
+	struct custom_data *ctx = user_data;
+	struct pb_export *export;
+
+	export = g_new0(struct pb_export, 1);
+	export->ctx = ctx;
+	export->phonebook = phonebook;
+	export->invocation = invocation;
+	export->type = arg_type;
+	export->remaining = (arg_count > 0) ? arg_count : -1;
+	g_variant_builder_init(&export->records, G_VARIANT_TYPE("a(isisisisisissssi)"));
+
+	_pb_export_request(export, (unsigned short)arg_start_index);
 
 	return TRUE;
 }
@@ -201,7 +387,7 @@ static gboolean on_phonebook_update_record(TelephonyPhonebook *phonebook, GDBusM
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_phonebook_update_record), &pb_update);
 	tcore_user_request_set_command(ur, TREQ_PHONEBOOK_UPDATERECORD);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -222,7 +408,7 @@ static gboolean on_phonebook_delete_record(TelephonyPhonebook *phonebook, GDBusM
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_phonebook_delete_record), &pb_delete);
 	tcore_user_request_set_command(ur, TREQ_PHONEBOOK_DELETERECORD);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -262,6 +448,11 @@ gboolean dbus_plugin_setup_phonebook_interface(TelephonyObjectSkeleton *object,
 			G_CALLBACK (on_phonebook_read_record),
 			ctx);
 
+	g_signal_connect (phonebook,
+			"handle-export-range",
+			G_CALLBACK (on_phonebook_export_range),
+			ctx);
+
 	g_signal_connect (phonebook,
 			"handle-update-record",
 			G_CALLBACK (on_phonebook_update_record),
@@ -275,117 +466,161 @@ gboolean dbus_plugin_setup_phonebook_interface(TelephonyObjectSkeleton *object,
 	return TRUE;
 }
 
-gboolean dbus_plugin_phonebook_response(struct custom_data *ctx, UserRequest *ur,
+static gboolean _phonebook_getcount_response(struct custom_data *ctx, UserRequest *ur,
 		struct dbus_request_info *dbus_info, enum tcore_response_command command,
 		unsigned int data_len, const void *data)
 {
 	const struct tresp_phonebook_get_count *resp_pbcnt = data;
+
+	dbg("dbus comm - TRESP_PHONEBOOK_GETCOUNT");
+	dbg("used[%d]total[%d]", resp_pbcnt->used_count, resp_pbcnt->total_count);
+	telephony_phonebook_complete_get_count(dbus_info->interface_object, dbus_info->invocation,
+			resp_pbcnt->result, resp_pbcnt->type, resp_pbcnt->used_count, resp_pbcnt->total_count);
+
+	return TRUE;
+}
+
+static gboolean _phonebook_getmetainfo_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
 	const struct tresp_phonebook_get_info *resp_entry = data;
+
+	dbg("dbus comm - TRESP_PHONEBOOK_GETMETAINFO");
+	dbg("index min[%d]max[%d], num len max[%d] text len max[%d]", resp_entry->index_min, resp_entry->index_max, resp_entry->number_length_max, resp_entry->text_length_max);
+	telephony_phonebook_complete_get_info(dbus_info->interface_object, dbus_info->invocation,
+			resp_entry->result, resp_entry->type, resp_entry->index_min, resp_entry->index_max,
+			resp_entry->number_length_max, resp_entry->text_length_max);
+
+	return TRUE;
+}
+
+static gboolean _phonebook_getusiminfo_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
 	const struct tresp_phonebook_get_usim_info *resp_capa = data;
+	GVariant *gv = NULL;
+	GVariantBuilder b;
+	int i;
+
+	dbg("resp comm - TRESP_PHONEBOOK_GETUSIMINFO");
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+
+	for(i=0;i < resp_capa->field_count; i++){
+		g_variant_builder_open(&b,G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "filed_type", g_variant_new_int32(resp_capa->field_list[i].field));
+		g_variant_builder_add(&b, "{sv}", "index_max", g_variant_new_int32(resp_capa->field_list[i].index_max));
+		g_variant_builder_add(&b, "{sv}", "text_max", g_variant_new_int32(resp_capa->field_list[i].text_max));
+		g_variant_builder_add(&b, "{sv}", "used_count", g_variant_new_int32(resp_capa->field_list[i].used_count));
+		g_variant_builder_close(&b);
+	}
+	gv = g_variant_builder_end(&b);
+
+	telephony_phonebook_complete_get_usim_meta_info (dbus_info->interface_object, dbus_info->invocation,
+			resp_capa->result,
+			gv);
+	g_variant_unref(gv);
+
+	return TRUE;
+}
+
+static gboolean _phonebook_readrecord_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
 	const struct tresp_phonebook_read_record *resp_pbread = data;
-	const struct tresp_phonebook_update_record *resp_pbupdate = data;
-	const struct tresp_phonebook_delete_record *resp_pbdelete = data;
 
-	dbg("application command = [0x%x], data_len = %d", command, data_len);
-
-	switch (command) {
-		case TRESP_PHONEBOOK_GETCOUNT:
-			dbg("dbus comm - TRESP_PHONEBOOK_GETCOUNT");
-			dbg("used[%d]total[%d]", resp_pbcnt->used_count, resp_pbcnt->total_count);
-			telephony_phonebook_complete_get_count(dbus_info->interface_object, dbus_info->invocation,
-					resp_pbcnt->result, resp_pbcnt->type, resp_pbcnt->used_count, resp_pbcnt->total_count);
-			break;
-
-		case TRESP_PHONEBOOK_GETMETAINFO:
-			dbg("dbus comm - TRESP_PHONEBOOK_GETMETAINFO");
-			dbg("index min[%d]max[%d], num len max[%d] text len max[%d]", resp_entry->index_min, resp_entry->index_max, resp_entry->number_length_max, resp_entry->text_length_max);
-			telephony_phonebook_complete_get_info(dbus_info->interface_object, dbus_info->invocation,
-					resp_entry->result, resp_entry->type, resp_entry->index_min, resp_entry->index_max,
-					resp_entry->number_length_max, resp_entry->text_length_max);
-			break;
-
-		case TRESP_PHONEBOOK_GETUSIMINFO:{
-			GVariant *gv = NULL;
-			GVariantBuilder b;
-			int i;
-			dbg("resp comm - TRESP_PHONEBOOK_GETUSIMINFO");
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
-
-			for(i=0;i < resp_capa->field_count; i++){
-				g_variant_builder_open(&b,G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "filed_type", g_variant_new_int32(resp_capa->field_list[i].field));
-				g_variant_builder_add(&b, "{sv}", "index_max", g_variant_new_int32(resp_capa->field_list[i].index_max));
-				g_variant_builder_add(&b, "{sv}", "text_max", g_variant_new_int32(resp_capa->field_list[i].text_max));
-				g_variant_builder_add(&b, "{sv}", "used_count", g_variant_new_int32(resp_capa->field_list[i].used_count));
-				g_variant_builder_close(&b);
-			}
-			gv = g_variant_builder_end(&b);
-
-			telephony_phonebook_complete_get_usim_meta_info (dbus_info->interface_object, dbus_info->invocation,
-					resp_capa->result,
-					gv);
-			g_variant_unref(gv);
-		}
-			break;
-
-		case TRESP_PHONEBOOK_READRECORD:
-			dbg("dbus comm - TRESP_PHONEBOOK_READRECORD");
-			dbg("resp_pbread->index[%d]",resp_pbread->index );
-			dbg("resp_pbread->next_index[%d]",resp_pbread->next_index );
-			dbg("resp_pbread->name[%s]",resp_pbread->name );
-			dbg("resp_pbread->dcs[%d]",resp_pbread->dcs );
-			dbg("resp_pbread->number[%s]",resp_pbread->number );
-			dbg("resp_pbread->ton[%d]",resp_pbread->ton );
-
-			telephony_phonebook_complete_read_record(dbus_info->interface_object, dbus_info->invocation,
-					resp_pbread->result, resp_pbread->phonebook_type, resp_pbread->index, resp_pbread->next_index, (const gchar *)resp_pbread->name,
-					resp_pbread->dcs, (const gchar *)resp_pbread->number, resp_pbread->ton, (const gchar *)resp_pbread->anr1, resp_pbread->anr1_ton,
-					(const gchar *)resp_pbread->anr2, resp_pbread->anr2_ton, (const gchar *)resp_pbread->anr3, resp_pbread->anr3_ton,
-					(const gchar *)resp_pbread->email1, (const gchar *)resp_pbread->email2, (const gchar *)resp_pbread->email3, (const gchar *)resp_pbread->email4, resp_pbread->group_index);
-			break;
-
-		case TRESP_PHONEBOOK_UPDATERECORD:
-			dbg("dbus comm - TRESP_PHONEBOOK_UPDATERECORD");
-			telephony_phonebook_complete_update_record(dbus_info->interface_object, dbus_info->invocation,resp_pbupdate->result);
-			break;
-
-		case TRESP_PHONEBOOK_DELETERECORD:
-			dbg("dbus comm - TRESP_PHONEBOOK_DELETERECORD");
-			telephony_phonebook_complete_delete_record(dbus_info->interface_object, dbus_info->invocation, resp_pbdelete->result);
-			break;
-
-		default:
-			dbg("not handled cmd[0x%x]", command);
-			break;
+	dbg("dbus comm - TRESP_PHONEBOOK_READRECORD");
+	if (resp_pbread->result == 0)
+		_pb_cache_store(dbus_plugin_ref_modem_by_interface(dbus_info->interface_object), resp_pbread);
+
+	if (dbus_info->batch) {
+		_pb_export_response(dbus_info, resp_pbread);
+		return TRUE;
 	}
 
+	dbg("resp_pbread->index[%d]",resp_pbread->index );
+	dbg("resp_pbread->next_index[%d]",resp_pbread->next_index );
+	dbg("resp_pbread->name[%s]",resp_pbread->name );
+	dbg("resp_pbread->dcs[%d]",resp_pbread->dcs );
+	dbg("resp_pbread->number[%s]",resp_pbread->number );
+	dbg("resp_pbread->ton[%d]",resp_pbread->ton );
+
+	_pb_complete_read_record(dbus_info->interface_object, dbus_info->invocation, resp_pbread);
+
 	return TRUE;
 }
 
-gboolean dbus_plugin_phonebook_notification(struct custom_data *ctx, const char *plugin_name,
-		TelephonyObjectSkeleton *object, enum tcore_notification_command command,
+static gboolean _phonebook_updaterecord_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
 		unsigned int data_len, const void *data)
 {
-	TelephonyPhonebook *phonebook;
-	const struct tnoti_phonebook_status *n_pb_status = data;
+	const struct tresp_phonebook_update_record *resp_pbupdate = data;
+
+	dbg("dbus comm - TRESP_PHONEBOOK_UPDATERECORD");
+	if (resp_pbupdate->result == 0) {
+		const struct treq_phonebook_update_record *req_update = tcore_user_request_ref_data(ur, NULL);
 
-	if (!object) {
-		dbg("object is NULL");
-		return FALSE;
+		/* overwriting a cached record keeps next_index of the others intact */
+		if (req_update)
+			_pb_cache_invalidate(dbus_plugin_ref_modem_by_interface(dbus_info->interface_object),
+					req_update->phonebook_type, req_update->index);
 	}
+	telephony_phonebook_complete_update_record(dbus_info->interface_object, dbus_info->invocation,resp_pbupdate->result);
 
-	phonebook = telephony_object_peek_phonebook(TELEPHONY_OBJECT(object));
-	dbg("phonebook = %p", phonebook);
+	return TRUE;
+}
 
-	switch (command) {
-		case TNOTI_PHONEBOOK_STATUS :
-			telephony_phonebook_emit_status(phonebook, n_pb_status->b_init);
-			break;
+static gboolean _phonebook_deleterecord_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_phonebook_delete_record *resp_pbdelete = data;
+
+	dbg("dbus comm - TRESP_PHONEBOOK_DELETERECORD");
+	if (resp_pbdelete->result == 0) {
+		const struct treq_phonebook_delete_record *req_delete = tcore_user_request_ref_data(ur, NULL);
 
-		default:
-			dbg("not handled cmd[0x%x]", command);
-			break;
+		if (req_delete)
+			_pb_cache_invalidate(dbus_plugin_ref_modem_by_interface(dbus_info->interface_object),
+					req_delete->phonebook_type, -1);
 	}
+	telephony_phonebook_complete_delete_record(dbus_info->interface_object, dbus_info->invocation, resp_pbdelete->result);
+
+	return TRUE;
+}
+
+static const struct dbus_plugin_response_handler phonebook_response_handlers[] = {
+	{ TRESP_PHONEBOOK_GETCOUNT, _phonebook_getcount_response },
+	{ TRESP_PHONEBOOK_GETMETAINFO, _phonebook_getmetainfo_response },
+	{ TRESP_PHONEBOOK_GETUSIMINFO, _phonebook_getusiminfo_response },
+	{ TRESP_PHONEBOOK_READRECORD, _phonebook_readrecord_response },
+	{ TRESP_PHONEBOOK_UPDATERECORD, _phonebook_updaterecord_response },
+	{ TRESP_PHONEBOOK_DELETERECORD, _phonebook_deleterecord_response },
+};
+
+static gboolean _phonebook_status_notification(struct custom_data *ctx, const char *plugin_name,
+		TelephonyObjectSkeleton *object, enum tcore_notification_command command,
+		unsigned int data_len, const void *data)
+{
+	TelephonyPhonebook *phonebook = telephony_object_peek_phonebook(TELEPHONY_OBJECT(object));
+	const struct tnoti_phonebook_status *n_pb_status = data;
+
+	_pb_cache_clear(dbus_plugin_ref_modem_by_object(object));
+	telephony_phonebook_emit_status(phonebook, n_pb_status->b_init);
 
 	return TRUE;
 }
+
+static const struct dbus_plugin_notification_handler phonebook_notification_handlers[] = {
+	{ TNOTI_PHONEBOOK_STATUS, _phonebook_status_notification },
+};
+
+void dbus_plugin_register_phonebook_handlers(struct custom_data *ctx)
+{
+	dbus_plugin_register_responses(ctx, phonebook_response_handlers,
+			G_N_ELEMENTS(phonebook_response_handlers));
+	dbus_plugin_register_notifications(ctx, phonebook_notification_handlers,
+			G_N_ELEMENTS(phonebook_notification_handlers));
+}
@@ -54,7 +54,7 @@ static gboolean on_sap_connect(TelephonySap *sap, GDBusMethodInvocation *invocat
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_sap_req_connect), &req_conn);
 	tcore_user_request_set_command(ur, TREQ_SAP_REQ_CONNECT);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -71,7 +71,7 @@ static gboolean on_sap_disconnect(TelephonySap *sap, GDBusMethodInvocation *invo
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_sap_req_disconnect), &req_disconn);
 	tcore_user_request_set_command(ur, TREQ_SAP_REQ_DISCONNECT);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -88,7 +88,7 @@ static gboolean on_sap_get_status(TelephonySap *sap, GDBusMethodInvocation *invo
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_sap_req_status), &req_status);
 	tcore_user_request_set_command(ur, TREQ_SAP_REQ_STATUS);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -105,7 +105,7 @@ static gboolean on_sap_get_atr(TelephonySap *sap, GDBusMethodInvocation *invocat
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_sap_req_atr), &req_atr);
 	tcore_user_request_set_command(ur, TREQ_SAP_REQ_ATR);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -127,15 +127,23 @@ static gboolean on_sap_transfer_apdu(TelephonySap *sap, GDBusMethodInvocation *i
 
 	inner_gv = g_variant_get_variant(arg_req_apdu);
 
+	/* a truncated APDU would be a different command to the card */
+	if (!g_variant_is_of_type(inner_gv, G_VARIANT_TYPE_BYTESTRING)
+			|| g_variant_n_children(inner_gv) > sizeof(t_apdu.apdu_data)) {
+		g_variant_unref(inner_gv);
+		g_dbus_method_invocation_return_error(invocation, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS,
+				"apdu must be an ay of at most %u bytes", (unsigned int)sizeof(t_apdu.apdu_data));
+		return TRUE;
+	}
+
 	g_variant_get(inner_gv, "ay", &iter);
-	while ( g_variant_iter_loop (iter, "y", &rt_i)) {
+	while (g_variant_iter_loop (iter, "y", &rt_i)) {
 		t_apdu.apdu_data[i] = rt_i;
 		i++;
 	}
 	t_apdu.apdu_length = (unsigned int)i;
 	g_variant_iter_free(iter);
 	g_variant_unref(inner_gv);
-	g_variant_unref(arg_req_apdu);
 
 	for(i=0; i < (int)t_apdu.apdu_length; i++)
 		dbg("apdu[%d][0x%02x]",i, t_apdu.apdu_data[i]);
@@ -143,7 +151,7 @@ static gboolean on_sap_transfer_apdu(TelephonySap *sap, GDBusMethodInvocation *i
 	ur = MAKE_UR(ctx, sap, invocation);
 	tcore_user_request_set_data(ur, sizeof(struct treq_sap_transfer_apdu), &t_apdu);
 	tcore_user_request_set_command(ur, TREQ_SAP_TRANSFER_APDU);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -163,7 +171,7 @@ static gboolean on_sap_set_protocol(TelephonySap *sap, GDBusMethodInvocation *in
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_sap_set_protocol), &set_protocol);
 	tcore_user_request_set_command(ur, TREQ_SAP_SET_PROTOCOL);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -183,7 +191,7 @@ static gboolean on_sap_set_power(TelephonySap *sap, GDBusMethodInvocation *invoc
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_sap_set_power), &set_power);
 	tcore_user_request_set_command(ur, TREQ_SAP_SET_POWER);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -200,7 +208,7 @@ static gboolean on_sap_get_card_reader_status(TelephonySap *sap, GDBusMethodInvo
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_sap_req_cardreaderstatus), &req_reader);
 	tcore_user_request_set_command(ur, TREQ_SAP_REQ_CARDREADERSTATUS);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -258,139 +266,182 @@ gboolean dbus_plugin_setup_sap_interface(TelephonyObjectSkeleton *object, struct
 	return TRUE;
 }
 
-gboolean dbus_plugin_sap_response(struct custom_data *ctx, UserRequest *ur,
+static gboolean _sap_req_connect_response(struct custom_data *ctx, UserRequest *ur,
 		struct dbus_request_info *dbus_info, enum tcore_response_command command,
 		unsigned int data_len, const void *data)
 {
 	const struct tresp_sap_req_connect *sap_conn = data;
+
+	dbg("dbus comm - TRESP_SAP_REQ_CONNECT");
+	telephony_sap_complete_connect(dbus_info->interface_object, dbus_info->invocation,
+			sap_conn->status, sap_conn->max_msg_size);
+
+	return TRUE;
+}
+
+static gboolean _sap_req_disconnect_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
 	const struct tresp_sap_req_disconnect *sap_disconn = data;
+
+	dbg("dbus comm - TRESP_SAP_REQ_DISCONNECT");
+	telephony_sap_complete_disconnect(dbus_info->interface_object, dbus_info->invocation,
+			sap_disconn->result);
+
+	return TRUE;
+}
+
+static gboolean _sap_req_status_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
 	const struct tresp_sap_req_status *sap_status = data;
+
+	dbg("dbus comm - TRESP_SAP_REQ_STATUS");
+	telephony_sap_complete_get_status(dbus_info->interface_object, dbus_info->invocation,
+			sap_status->status);
+
+	return TRUE;
+}
+
+static gboolean _sap_req_atr_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
 	const struct tresp_sap_req_atr *sap_atr = data;
+	GVariantBuilder *builder = NULL;
+	GVariant * atr_gv = NULL;
+	GVariant *inner_gv = NULL;
+	int i =0;
+
+	dbg("dbus comm - TRESP_SAP_REQ_ATR");
+	builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
+	for(i = 0; i < (int)sap_atr->atr_length; i++) {
+		dbg("sap_atr->atr[%d][0x%02x]", i,sap_atr->atr[i]);
+		g_variant_builder_add (builder, "y", sap_atr->atr[i]);
+	}
+	inner_gv = g_variant_builder_end(builder);
+	g_variant_builder_unref (builder);
+	atr_gv = g_variant_new("v", inner_gv);
+
+	telephony_sap_complete_get_atr(dbus_info->interface_object, dbus_info->invocation,
+			sap_atr->result, atr_gv);
+
+	return TRUE;
+}
+
+static gboolean _sap_transfer_apdu_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
 	const struct tresp_sap_transfer_apdu *sap_apdu = data;
+	GVariantBuilder *builder = NULL;
+	GVariant * apdu_gv = NULL;
+	GVariant *inner_gv = NULL;
+	int i =0;
+
+	dbg("dbus comm - TRESP_SAP_TRANSFER_APDU");
+	builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
+	for(i = 0; i < (int)sap_apdu->resp_apdu_length; i++) {
+		dbg("sap_apdu->resp_adpdu[%d][0x%02x]", i,sap_apdu->resp_adpdu[i]);
+		g_variant_builder_add (builder, "y", sap_apdu->resp_adpdu[i]);
+	}
+	inner_gv = g_variant_builder_end(builder);
+	g_variant_builder_unref (builder);
+	apdu_gv = g_variant_new("v", inner_gv);
+
+	telephony_sap_complete_transfer_apdu(dbus_info->interface_object, dbus_info->invocation,
+			sap_apdu->result, apdu_gv);
+
+	return TRUE;
+}
+
+static gboolean _sap_set_protocol_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
 	const struct tresp_sap_set_protocol *sap_protocol = data;
+
+	dbg("dbus comm - TRESP_SAP_SET_PROTOCOL");
+	telephony_sap_complete_set_protocol(dbus_info->interface_object, dbus_info->invocation,
+			sap_protocol->result);
+
+	return TRUE;
+}
+
+static gboolean _sap_set_power_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
 	const struct tresp_sap_set_power *sap_power = data;
+
+	dbg("dbus comm - TRESP_SAP_SET_POWER");
+	telephony_sap_complete_set_power(dbus_info->interface_object, dbus_info->invocation,
+			sap_power->result);
+
+	return TRUE;
+}
+
+static gboolean _sap_req_cardreaderstatus_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
 	const struct tresp_sap_req_cardreaderstatus *sap_reader = data;
 
-	dbg("application Command = [0x%x], data_len = %d",command, data_len);
-
-	switch (command) {
-		case TRESP_SAP_REQ_CONNECT:
-			dbg("dbus comm - TRESP_SAP_REQ_CONNECT");
-			telephony_sap_complete_connect(dbus_info->interface_object, dbus_info->invocation,
-					sap_conn->status, sap_conn->max_msg_size);
-			break;
-
-		case TRESP_SAP_REQ_DISCONNECT:
-			dbg("dbus comm - TRESP_SAP_REQ_DISCONNECT");
-			telephony_sap_complete_disconnect(dbus_info->interface_object, dbus_info->invocation,
-					sap_disconn->result);
-			break;
-
-		case TRESP_SAP_REQ_STATUS:
-			dbg("dbus comm - TRESP_SAP_REQ_STATUS");
-			telephony_sap_complete_get_status(dbus_info->interface_object, dbus_info->invocation,
-					sap_status->status);
-			break;
-
-		case TRESP_SAP_REQ_ATR: {
-			GVariantBuilder *builder = NULL;
-			GVariant * atr_gv = NULL;
-			GVariant *inner_gv = NULL;
-			int i =0;
-
-			dbg("dbus comm - TRESP_SAP_REQ_ATR");
-			builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
-			for(i = 0; i < (int)sap_atr->atr_length; i++) {
-				dbg("sap_atr->atr[%d][0x%02x]", i,sap_atr->atr[i]);
-				g_variant_builder_add (builder, "y", sap_atr->atr[i]);
-			}
-			inner_gv = g_variant_builder_end(builder);
-/*			g_variant_builder_unref (builder);*/
-			atr_gv = g_variant_new("v", inner_gv);
-
-			telephony_sap_complete_get_atr(dbus_info->interface_object, dbus_info->invocation,
-					sap_atr->result, atr_gv);
-		}
-			break;
-
-		case TRESP_SAP_TRANSFER_APDU: {
-			GVariantBuilder *builder = NULL;
-			GVariant * apdu_gv = NULL;
-			GVariant *inner_gv = NULL;
-			int i =0;
-
-			dbg("dbus comm - TRESP_SAP_TRANSFER_APDU");
-			builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
-			for(i = 0; i < (int)sap_apdu->resp_apdu_length; i++) {
-				dbg("sap_apdu->resp_adpdu[%d][0x%02x]", i,sap_apdu->resp_adpdu[i]);
-				g_variant_builder_add (builder, "y", sap_apdu->resp_adpdu[i]);
-			}
-			inner_gv = g_variant_builder_end(builder);
-/*			g_variant_builder_unref (builder);*/
-			apdu_gv = g_variant_new("v", inner_gv);
-
-			telephony_sap_complete_transfer_apdu(dbus_info->interface_object, dbus_info->invocation,
-					sap_apdu->result, apdu_gv);
-		}
-			break;
-
-		case TRESP_SAP_SET_PROTOCOL:
-			dbg("dbus comm - TRESP_SAP_SET_PROTOCOL");
-			telephony_sap_complete_set_protocol(dbus_info->interface_object, dbus_info->invocation,
-					sap_protocol->result);
-			break;
-
-		case TRESP_SAP_SET_POWER:
-			dbg("dbus comm - TRESP_SAP_SET_POWER");
-			telephony_sap_complete_set_power(dbus_info->interface_object, dbus_info->invocation,
-					sap_power->result);
-			break;
-
-		case TRESP_SAP_REQ_CARDREADERSTATUS:
-			dbg("dbus comm - TRESP_SAP_REQ_CARDREADERSTATUS");
-			telephony_sap_complete_get_card_reader_status(dbus_info->interface_object, dbus_info->invocation,
-					sap_reader->result, sap_reader->reader_status);
-			break;
-
-		default:
-			dbg("not handled command[%d]", command);
-		break;
-	}
+	dbg("dbus comm - TRESP_SAP_REQ_CARDREADERSTATUS");
+	telephony_sap_complete_get_card_reader_status(dbus_info->interface_object, dbus_info->invocation,
+			sap_reader->result, sap_reader->reader_status);
 
 	return TRUE;
 }
 
-gboolean dbus_plugin_sap_notification(struct custom_data *ctx, const char *plugin_name,
+static const struct dbus_plugin_response_handler sap_response_handlers[] = {
+	{ TRESP_SAP_REQ_CONNECT, _sap_req_connect_response },
+	{ TRESP_SAP_REQ_DISCONNECT, _sap_req_disconnect_response },
+	{ TRESP_SAP_REQ_STATUS, _sap_req_status_response },
+	{ TRESP_SAP_REQ_ATR, _sap_req_atr_response },
+	{ TRESP_SAP_TRANSFER_APDU, _sap_transfer_apdu_response },
+	{ TRESP_SAP_SET_PROTOCOL, _sap_set_protocol_response },
+	{ TRESP_SAP_SET_POWER, _sap_set_power_response },
+	{ TRESP_SAP_REQ_CARDREADERSTATUS, _sap_req_cardreaderstatus_response },
+};
+
+static gboolean _sap_status_notification(struct custom_data *ctx, const char *plugin_name,
 		TelephonyObjectSkeleton *object, enum tcore_notification_command command,
 		unsigned int data_len, const void *data)
 {
-	TelephonySap *sap;
+	TelephonySap *sap = telephony_object_peek_sap(TELEPHONY_OBJECT(object));
 	const struct tnoti_sap_status_changed *n_sap_status = data;
-	const struct tnoti_sap_disconnect *n_sap_disconn = data;
 
-	if (!object) {
-		dbg("object is NULL");
-		return FALSE;
-	}
+	dbg("notified sap_status[%d]", n_sap_status->status);
+	telephony_sap_emit_status(sap, n_sap_status->status);
 
-	sap = telephony_object_peek_sap(TELEPHONY_OBJECT(object));
-	dbg("sap = %p", sap);
+	return TRUE;
+}
 
-	dbg("notification !!! (command = 0x%x, data_len = %d)", command, data_len);
-
-	switch (command) {
-		case TNOTI_SAP_STATUS:
-			dbg("notified sap_status[%d]", n_sap_status->status);
-			telephony_sap_emit_status(sap, n_sap_status->status);
-			break;
-		case TNOTI_SAP_DISCONNECT:
-			dbg("notified sap_disconnect type[%d]", n_sap_disconn->type);
-			telephony_sap_emit_disconnect(sap, n_sap_disconn->type);
-			break;
-		default:
-			dbg("not handled command[%d]", command);
-		break;
-	}
+static gboolean _sap_disconnect_notification(struct custom_data *ctx, const char *plugin_name,
+		TelephonyObjectSkeleton *object, enum tcore_notification_command command,
+		unsigned int data_len, const void *data)
+{
+	TelephonySap *sap = telephony_object_peek_sap(TELEPHONY_OBJECT(object));
+	const struct tnoti_sap_disconnect *n_sap_disconn = data;
+
+	dbg("notified sap_disconnect type[%d]", n_sap_disconn->type);
+	telephony_sap_emit_disconnect(sap, n_sap_disconn->type);
 
 	return TRUE;
 }
+
+static const struct dbus_plugin_notification_handler sap_notification_handlers[] = {
+	{ TNOTI_SAP_STATUS, _sap_status_notification },
+	{ TNOTI_SAP_DISCONNECT, _sap_disconnect_notification },
+};
+
+void dbus_plugin_register_sap_handlers(struct custom_data *ctx)
+{
+	dbus_plugin_register_responses(ctx, sap_response_handlers,
+			G_N_ELEMENTS(sap_response_handlers));
+	dbus_plugin_register_notifications(ctx, sap_notification_handlers,
+			G_N_ELEMENTS(sap_notification_handlers));
+}
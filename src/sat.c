@@ -181,7 +181,7 @@ static gboolean on_sat_select_menu(TelephonySAT *sat, GDBusMethodInvocation *inv
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_sat_envelop_cmd_data), &envelop_data);
 	tcore_user_request_set_command(ur, TREQ_SAT_REQ_ENVELOPE);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -204,7 +204,7 @@ static gboolean on_sat_download_event(TelephonySAT *sat, GDBusMethodInvocation *
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_sat_envelop_cmd_data), &envelop_data);
 	tcore_user_request_set_command(ur, TREQ_SAT_REQ_ENVELOPE);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -252,55 +252,66 @@ gboolean dbus_plugin_setup_sat_interface(TelephonyObjectSkeleton *object, struct
 	return TRUE;
 }
 
-gboolean dbus_plugin_sat_response(struct custom_data *ctx, UserRequest *ur,
+static gboolean _sat_req_envelope_response(struct custom_data *ctx, UserRequest *ur,
 		struct dbus_request_info *dbus_info, enum tcore_response_command command,
 		unsigned int data_len, const void *data)
 {
-	const struct tresp_sat_envelop_data *envelop_rsp = NULL;
+	const struct tresp_sat_envelop_data *envelop_rsp = data;
 
-	dbg("sat response command = [0x%x], data_len = %d", command, data_len);
+	dbg("envelop sub_cmd(%d) result(%d) rsp(%d)", envelop_rsp->sub_cmd, envelop_rsp->result, envelop_rsp->envelop_resp);
 
-	switch (command) {
-		case TRESP_SAT_REQ_ENVELOPE: {
-			envelop_rsp = (struct tresp_sat_envelop_data *)data;
+	if(envelop_rsp->sub_cmd == ENVELOP_MENU_SELECTION){
+		telephony_sat_complete_select_menu(dbus_info->interface_object, dbus_info->invocation,
+				envelop_rsp->result, envelop_rsp->envelop_resp);
+	}
+	else if(envelop_rsp->sub_cmd == ENVELOP_EVENT_DOWNLOAD){
+		telephony_sat_complete_download_event(dbus_info->interface_object, dbus_info->invocation,
+				envelop_rsp->result, envelop_rsp->envelop_resp);
+	}
 
-			dbg("envelop sub_cmd(%d) result(%d) rsp(%d)", envelop_rsp->sub_cmd, envelop_rsp->result, envelop_rsp->envelop_resp);
+	return TRUE;
+}
 
-			if(envelop_rsp->sub_cmd == ENVELOP_MENU_SELECTION){
-				telephony_sat_complete_select_menu(dbus_info->interface_object, dbus_info->invocation,
-						envelop_rsp->result, envelop_rsp->envelop_resp);
-			}
-			else if(envelop_rsp->sub_cmd == ENVELOP_EVENT_DOWNLOAD){
-				telephony_sat_complete_download_event(dbus_info->interface_object, dbus_info->invocation,
-						envelop_rsp->result, envelop_rsp->envelop_resp);
-			}
-		} break;
+static gboolean _sat_req_terminalresponse_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	dbg("receive TRESP_SAT_REQ_TERMINALRESPONSE");
 
-		case TRESP_SAT_REQ_TERMINALRESPONSE:
-			dbg("receive TRESP_SAT_REQ_TERMINALRESPONSE");
-		break;
+	return TRUE;
+}
+
+static const struct dbus_plugin_response_handler sat_response_handlers[] = {
+	{ TRESP_SAT_REQ_ENVELOPE, _sat_req_envelope_response },
+	{ TRESP_SAT_REQ_TERMINALRESPONSE, _sat_req_terminalresponse_response },
+};
+
+static gboolean _sat_session_end_notification(struct custom_data *ctx, const char *plugin_name,
+		TelephonyObjectSkeleton *object, enum tcore_notification_command command,
+		unsigned int data_len, const void *data)
+{
+	TelephonySAT *sat = telephony_object_peek_sat(TELEPHONY_OBJECT(object));
+
+	dbg("notified sat session end evt");
+	sat_manager_init_queue(ctx);
+
+	sat_manager_queue_ui_terminate(ctx);
+	telephony_sat_emit_end_proactive_session(sat, SAT_PROATV_CMD_TYPE_END_PROACTIVE_SESSION);
 
-		default:
-			dbg("not handled command[%d]", command);
-		break;
-	}
 	return TRUE;
 }
 
-gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugin_name,
+static gboolean _sat_proactive_ind_notification(struct custom_data *ctx, const char *plugin_name,
 		TelephonyObjectSkeleton *object, enum tcore_notification_command command,
 		unsigned int data_len, const void *data)
 {
 	TcorePlugin *plg = NULL;
+	struct dbus_modem_context *modem;
 	TelephonySAT *sat;
 	struct tnoti_sat_proactive_ind *p_ind = (struct tnoti_sat_proactive_ind *)data;
 
-	if (!object) {
-		dbg("object is NULL");
-		return FALSE;
-	}
-
-	plg = tcore_server_find_plugin(ctx->server, plugin_name);
+	modem = dbus_plugin_ref_modem_by_object(object);
+	plg = modem ? modem->plugin : tcore_server_find_plugin(ctx->server, plugin_name);
 	if (!plg){
 		dbg("there is no valid plugin at this point");
 		return FALSE;
@@ -309,19 +320,6 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 	sat = telephony_object_peek_sat(TELEPHONY_OBJECT(object));
 	dbg("sat = %p", sat);
 
-	dbg("notification !!! (command = 0x%x, data_len = %d)", command, data_len);
-
-	if (command == TNOTI_SAT_SESSION_END) {
-
-		dbg("notified sat session end evt");
-		sat_manager_init_queue(ctx);
-
-		sat_ui_support_terminate_sat_ui();
-		telephony_sat_emit_end_proactive_session(sat, SAT_PROATV_CMD_TYPE_END_PROACTIVE_SESSION);
-		return TRUE;
-	}
-
-	//Proactive Command Notification
 	dbg("notified sat proactive command(%d)", p_ind->cmd_type);
 
 	switch (p_ind->cmd_type) {
@@ -385,7 +383,7 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 			g_variant_get(display_text, "(isiibbb@v)", &command_id, &text, &text_len, &duration,
 						&high_priority, &user_rsp_required, &immediately_rsp, &icon_id);
 
-			sat_ui_support_launch_sat_ui(SAT_PROATV_CMD_DISPLAY_TEXT, display_text);
+			sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_sat_ui, SAT_PROATV_CMD_DISPLAY_TEXT, display_text);
 
 			telephony_sat_emit_display_text(sat, command_id, text, text_len, duration,
 					high_priority, user_rsp_required, immediately_rsp);
@@ -411,7 +409,7 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 			g_variant_get(select_menu, "(ibsiii@v@v@v)", &command_id, &help_info, &selected_text,
 					&text_len, &default_item_id, &menu_cnt, &menu_items, &icon_id, &icon_list);
 
-			sat_ui_support_launch_sat_ui(SAT_PROATV_CMD_SELECT_ITEM, select_menu);
+			sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_sat_ui, SAT_PROATV_CMD_SELECT_ITEM, select_menu);
 
 			telephony_sat_emit_select_item (sat, command_id, help_info, selected_text, text_len,
 					default_item_id, menu_cnt, menu_items);
@@ -437,7 +435,7 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 			g_variant_get(get_inkey, "(iiibbsii@v)", &command_id, &key_type, &input_character_mode,
 					&b_numeric,&b_help_info, &text, &text_len, &duration, &icon_id);
 
-			sat_ui_support_launch_sat_ui(SAT_PROATV_CMD_GET_INKEY, get_inkey);
+			sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_sat_ui, SAT_PROATV_CMD_GET_INKEY, get_inkey);
 
 			telephony_sat_emit_get_inkey(sat, command_id, key_type, input_character_mode,
 					b_numeric, b_help_info, text, text_len, duration);
@@ -463,7 +461,7 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 			g_variant_get(get_input, "(iibbbsiiisi@v)", &command_id, &input_character_mode, &b_numeric, &b_help_info, &b_echo_input,
 					&text, &text_len, &rsp_len_max, &rsp_len_min, &def_text, &def_text_len, &icon_id);
 
-			sat_ui_support_launch_sat_ui(SAT_PROATV_CMD_GET_INPUT, get_input);
+			sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_sat_ui, SAT_PROATV_CMD_GET_INPUT, get_input);
 
 			telephony_sat_emit_get_input(sat, command_id, input_character_mode, b_numeric, b_help_info,
 					b_echo_input, text, text_len, rsp_len_max, rsp_len_min, def_text, def_text_len);
@@ -495,7 +493,7 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 				dbg("play tone is pending!!!")
 
 				ui_info = g_variant_new("(isib)", command_id, text, text_len, user_confirm);
-				sat_ui_support_launch_sat_ui(SAT_PROATV_CMD_NONE, ui_info);
+				sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_sat_ui, SAT_PROATV_CMD_NONE, ui_info);
 				return TRUE;
 			}
 
@@ -530,7 +528,7 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 				dbg("send sms is pending!!!")
 
 				ui_info = g_variant_new("(isib)", command_id, text, text_len, user_confirm);
-				sat_ui_support_launch_sat_ui(SAT_PROATV_CMD_NONE, ui_info);
+				sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_sat_ui, SAT_PROATV_CMD_NONE, ui_info);
 				return TRUE;
 			}
 
@@ -566,7 +564,7 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 				dbg("send ss is pending!!!")
 
 				ui_info = g_variant_new("(isib)", command_id, text, text_len, user_confirm);
-				sat_ui_support_launch_sat_ui(SAT_PROATV_CMD_NONE, ui_info);
+				sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_sat_ui, SAT_PROATV_CMD_NONE, ui_info);
 				return TRUE;
 			}
 
@@ -600,7 +598,7 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 				dbg("send ussd is pending!!!")
 
 				ui_info = g_variant_new("(isib)", command_id, text, text_len, user_confirm);
-				sat_ui_support_launch_sat_ui(SAT_PROATV_CMD_NONE, ui_info);
+				sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_sat_ui, SAT_PROATV_CMD_NONE, ui_info);
 				return TRUE;
 			}
 
@@ -632,7 +630,7 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 				dbg("setup call is pending!!!")
 
 				ui_info = g_variant_new("(isib)", command_id, text, text_len, user_confirm);
-				sat_ui_support_launch_sat_ui(SAT_PROATV_CMD_NONE, ui_info);
+				sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_sat_ui, SAT_PROATV_CMD_NONE, ui_info);
 				return TRUE;
 			}
 
@@ -683,7 +681,7 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 				dbg("setup idle mode text is displayed!!!")
 
 				ui_info = g_variant_new("(isib)", command_id, text, text_len, user_confirm);
-				sat_ui_support_launch_sat_ui(SAT_PROATV_CMD_NONE, ui_info);
+				sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_sat_ui, SAT_PROATV_CMD_NONE, ui_info);
 				return TRUE;
 			}
 
@@ -720,7 +718,7 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 				dbg("open channel text is displayed!!!")
 
 				ui_info = g_variant_new("(isib)", command_id, text, text_len, user_confirm);
-				sat_ui_support_launch_sat_ui(SAT_PROATV_CMD_NONE, ui_info);
+				sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_sat_ui, SAT_PROATV_CMD_NONE, ui_info);
 				return TRUE;
 			}
 
@@ -840,7 +838,7 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 			dbg("text should be displayed by ui");
 
 			ui_info = g_variant_new("(isib)", command_id, info, strlen(info), user_confirm);
-			sat_ui_support_launch_sat_ui(SAT_PROATV_CMD_NONE, ui_info);
+			sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_sat_ui, SAT_PROATV_CMD_NONE, ui_info);
 
 			telephony_sat_emit_refresh(sat, command_id, refresh_type, file_list);
 		}break;
@@ -874,7 +872,7 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 				dbg("send dtmf is displayed!!!")
 
 				ui_info = g_variant_new("(isib)", command_id, text, text_len, user_confirm);
-				sat_ui_support_launch_sat_ui(SAT_PROATV_CMD_NONE, ui_info);
+				sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_sat_ui, SAT_PROATV_CMD_NONE, ui_info);
 				return TRUE;
 			}
 
@@ -907,7 +905,7 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 				dbg("launch browser is displayed!!!")
 
 				ui_info = g_variant_new("(isib)", command_id, text, text_len, user_confirm);
-				sat_ui_support_launch_sat_ui(SAT_PROATV_CMD_NONE, ui_info);
+				sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_sat_ui, SAT_PROATV_CMD_NONE, ui_info);
 				return TRUE;
 			}
 
@@ -956,3 +954,24 @@ gboolean dbus_plugin_sat_notification(struct custom_data *ctx, const char *plugi
 
 	return TRUE;
 }
+
+static const struct dbus_plugin_notification_handler sat_notification_handlers[] = {
+	{ TNOTI_SAT_PROACTIVE_IND, _sat_proactive_ind_notification },
+	{ TNOTI_SAT_SESSION_END, _sat_session_end_notification },
+};
+
+void dbus_plugin_register_sat_handlers(struct custom_data *ctx)
+{
+	dbus_plugin_register_responses(ctx, sat_response_handlers,
+			G_N_ELEMENTS(sat_response_handlers));
+	dbus_plugin_register_notifications(ctx, sat_notification_handlers,
+			G_N_ELEMENTS(sat_notification_handlers));
+}
+
+void dbus_plugin_sat_free(struct custom_data *ctx)
+{
+	sat_manager_free_queue(ctx);
+
+	g_free(ctx->sat_tr);
+	ctx->sat_tr = NULL;
+}
@@ -0,0 +1,14 @@
+#ifndef SAT_GSM_H_
+#define SAT_GSM_H_
+
+/*
+ * GSM 03.38 default alphabet <-> UCS2, table driven, see sat_util.c.
+ * No tcore or plugin types, so the conversions can be used and tested
+ * on their own.
+ */
+
+int sat_mgr_convert_gsm_to_ucs2(unsigned short *dest, const unsigned char *src, unsigned int src_len);
+int sat_mgr_convert_ucs2_to_gsm(unsigned char *dest, const unsigned short *src, unsigned int src_len);
+int sat_mgr_get_gsm_code_size(const unsigned short *src, int src_len);
+
+#endif /* SAT_GSM_H_ */
@@ -41,7 +41,6 @@
 #include "sat_manager.h"
 #include "sat_ui_support/sat_ui_support.h"
 
-#define SAT_DEF_CMD_Q_MAX 10
 #define SAT_TIME_OUT 60000
 
 static unsigned int _get_time_in_ms(struct tel_sat_duration *dr)
@@ -68,86 +67,191 @@ static unsigned int _get_time_in_ms(struct tel_sat_duration *dr)
 	return 0;
 }
 
-static int _get_queue_size(struct custom_data *ctx)
+/* a sat_ui_support launch, run by the launcher thread (launcher.c) */
+struct sat_ui_launch {
+	sat_manager_ui_launch_func launch;
+	enum tel_sat_proactive_cmd_type cmd_type;
+	GVariant *data;
+};
+
+static void _sat_ui_launch_run(gpointer data)
 {
-	int temp;
-	temp = (int)g_queue_get_length(&ctx->queue_sat);
-	dbg("[SAT]SAT Command Queue current Size [%d], MAX SIZE [%d]\n", temp,	SAT_DEF_CMD_Q_MAX);
-	return temp;
+	struct sat_ui_launch *job = data;
+
+	if (job->launch)
+		job->launch(job->cmd_type, job->data);
+	else
+		sat_ui_support_terminate_sat_ui();
 }
 
-static gboolean _push_data(struct custom_data *ctx, struct sat_manager_queue_data *cmd_obj)
+static void _sat_ui_launch_free(gpointer data)
 {
-	struct sat_manager_queue_data* item = NULL;
-	if (_get_queue_size(ctx) == (SAT_DEF_CMD_Q_MAX - 1)) {
-		dbg("[SAT] FAILED TO ENQUEUE - QUEUE FULL!\n");
-		return FALSE;
-	}
+	struct sat_ui_launch *job = data;
 
-	item = g_new(struct sat_manager_queue_data, 1);
+	if (job->data)
+		g_variant_unref(job->data);
+	g_free(job);
+}
 
-	if (item == NULL) {
-		dbg("[SAT] FAILED TO ALLOC QUEUE ITEM!\n");
-		return FALSE;
-	}
+void sat_manager_queue_ui_launch(struct custom_data *ctx, sat_manager_ui_launch_func launch,
+		enum tel_sat_proactive_cmd_type cmd_type, GVariant *data)
+{
+	struct sat_ui_launch *job;
 
-	memcpy((void*)item, cmd_obj, sizeof(struct sat_manager_queue_data));
-	g_queue_push_tail(&ctx->queue_sat, item);
-	return TRUE;
+	job = g_new0(struct sat_ui_launch, 1);
+	job->launch = launch;
+	job->cmd_type = cmd_type;
+	job->data = data ? g_variant_ref_sink(data) : NULL;
+
+	if (!dbus_plugin_launch(ctx, _sat_ui_launch_run, job, _sat_ui_launch_free))
+		dbg("[SAT] sat ui launch (%d) dropped", cmd_type);
 }
 
-static gboolean _pop_nth_data(struct custom_data *ctx, struct sat_manager_queue_data *cmd_obj, int command_id)
+void sat_manager_queue_ui_terminate(struct custom_data *ctx)
 {
-	struct sat_manager_queue_data *item = NULL;
+	sat_manager_queue_ui_launch(ctx, NULL, SAT_PROATV_CMD_TYPE_END_PROACTIVE_SESSION, NULL);
+}
+
+static struct sat_manager_queue_data *_queue_lookup(struct custom_data *ctx, int command_id)
+{
+	struct sat_manager_queue *q = ctx->queue_sat;
+	struct sat_manager_queue_data *item;
+	int slot;
 
-	if (g_queue_is_empty(&ctx->queue_sat))
-		return FALSE;
+	if (!q || q->count == 0) {
+		dbg("[SAT] queue_sat is empty.");
+		return NULL;
+	}
 
-	item = g_queue_pop_nth(&ctx->queue_sat, command_id);
-	memcpy((void*)cmd_obj, item, sizeof(struct sat_manager_queue_data));
-	g_free(item);
+	if (command_id < 0) {
+		dbg("[SAT] invalid command_id [%d].", command_id);
+		return NULL;
+	}
 
-	return TRUE;
+	slot = command_id % SAT_DEF_CMD_Q_MAX;
+	item = &q->slots[slot];
+	if (!q->used[slot] || item->cmd_id != command_id) {
+		dbg("[SAT] queue_sat has no element with command_id [%d].", command_id);
+		return NULL;
+	}
+
+	return item;
 }
 
-static gboolean _peek_nth_data(struct custom_data *ctx, struct sat_manager_queue_data *cmd_obj, int command_id)
+static int _push_data(struct custom_data *ctx, enum tel_sat_proactive_cmd_type cmd_type,
+		const void *tlv, size_t tlv_len)
 {
-	gpointer element = NULL;
+	struct sat_manager_queue *q = ctx->queue_sat;
+	struct sat_manager_queue_data *item;
+	int i, id = -1, slot = -1;
+
+	dbg("[SAT]SAT Command Queue current Size [%u], MAX SIZE [%d]", q->count, SAT_DEF_CMD_Q_MAX);
 
-	if (g_queue_is_empty(&ctx->queue_sat)) {
-		dbg("[SAT] queue_sat is empty.")
-		return FALSE;
+	if (q->count >= SAT_DEF_CMD_Q_MAX) {
+		ctx->sat_queue_overflow++;
+		dbg("[SAT] FAILED TO ENQUEUE - QUEUE FULL!");
+		return -1;
 	}
 
-	element = g_queue_peek_nth(&ctx->queue_sat, command_id);
-	if (element==NULL) {
-		dbg("[SAT] queue_sat has no element with command_id [%d].\n", command_id);
-		return FALSE;
+	/* skip ids whose slot is still held by an older, unanswered command */
+	for (i = 0; i < SAT_DEF_CMD_Q_MAX; i++) {
+		id = q->next_id;
+		q->next_id = (id + 1) % SAT_MANAGER_QUEUE_ID_WRAP;
+		if (!q->used[id % SAT_DEF_CMD_Q_MAX]) {
+			slot = id % SAT_DEF_CMD_Q_MAX;
+			break;
+		}
 	}
 
-	memcpy((void*)cmd_obj, element, sizeof(struct sat_manager_queue_data));
-	return TRUE;
+	if (slot < 0)
+		return -1;
+
+	item = &q->slots[slot];
+	item->cmd_type = cmd_type;
+	item->cmd_id = id;
+
+	/* a re-issued command passes its TLV straight from a just released slot */
+	memmove(&item->cmd_data, tlv, tlv_len);
+
+	q->used[slot] = TRUE;
+	q->count++;
+
+	return id;
+}
+
+static struct sat_manager_queue_data *_pop_data(struct custom_data *ctx, int command_id)
+{
+	struct sat_manager_queue_data *item;
+
+	item = _queue_lookup(ctx, command_id);
+	if (!item)
+		return NULL;
+
+	ctx->queue_sat->used[command_id % SAT_DEF_CMD_Q_MAX] = FALSE;
+	ctx->queue_sat->count--;
+
+	return item;
 }
 
 void sat_manager_init_queue(struct custom_data *ctx)
 {
-	g_queue_init(&ctx->queue_sat);
+	struct sat_manager_queue *q = ctx->queue_sat;
+
+	if (!q) {
+		ctx->queue_sat = g_new0(struct sat_manager_queue, 1);
+		return;
+	}
+
+	/* next_id is kept so ids handed out before the reset stay invalid */
+	memset(q->used, 0, sizeof(q->used));
+	q->count = 0;
+}
+
+void sat_manager_free_queue(struct custom_data *ctx)
+{
+	g_free(ctx->queue_sat);
+	ctx->queue_sat = NULL;
 }
 
-static gboolean sat_manager_enqueue_cmd(struct custom_data *ctx, struct sat_manager_queue_data *cmd_obj)
+/*
+ * Copies the proactive command TLV into a free slot and returns its
+ * command id, or -1 when the queue is full.
+ */
+static int sat_manager_enqueue_cmd(struct custom_data *ctx, enum tel_sat_proactive_cmd_type cmd_type,
+		const void *tlv, size_t tlv_len)
 {
-	cmd_obj->cmd_id = g_queue_get_length(&ctx->queue_sat);
-	return _push_data(ctx, cmd_obj);
+	if (!ctx->queue_sat)
+		sat_manager_init_queue(ctx);
+
+	return _push_data(ctx, cmd_type, tlv, tlv_len);
 }
 
-static gboolean sat_manager_dequeue_cmd_by_id(struct custom_data *ctx, struct sat_manager_queue_data *cmd_obj, int cmd_id)
+/*
+ * Releases the command and returns it in place. The data stays valid
+ * until the next enqueue, which is all the result and confirm handlers
+ * need to build their terminal response or re-issue the command.
+ *
+ * Re-issuing (sat_manager_*_noti(ctx, plg_name, &q_data->cmd_data.x)
+ * from the confirm handlers) hands _push_data() a TLV that lives in the
+ * slot just released here, and _push_data() may pick that very slot
+ * again. That is safe because:
+ *  - _push_data() copies with memmove(), so source and destination may
+ *    be the same or overlap;
+ *  - the slot is only written by _push_data(), and nothing enqueues
+ *    between this dequeue and the re-issue: both run in the same D-Bus
+ *    handler on the main loop, with no dispatch in between.
+ * After the re-issue the released slot either holds the same bytes
+ * (same slot) or is untouched (another slot), so callers may keep
+ * reading q_data until they return.
+ */
+static struct sat_manager_queue_data *sat_manager_dequeue_cmd_by_id(struct custom_data *ctx, int cmd_id)
 {
-	return _pop_nth_data(ctx, cmd_obj, cmd_id);
+	return _pop_data(ctx, cmd_id);
 }
 
-static gboolean sat_manager_queue_peek_data_by_id(struct custom_data *ctx, struct sat_manager_queue_data *cmd_obj, int command_id)
+static struct sat_manager_queue_data *sat_manager_queue_peek_data_by_id(struct custom_data *ctx, int command_id)
 {
-	return _peek_nth_data(ctx, cmd_obj, command_id);
+	return _queue_lookup(ctx, command_id);
 }
 
 static gboolean sat_manager_check_availiable_event_list(struct tel_sat_setup_event_list_tlv *event_list_tlv)
@@ -183,6 +287,26 @@ static gboolean sat_manager_check_availiable_event_list(struct tel_sat_setup_eve
 	return rv;
 }
 
+/*
+ * Terminal responses are built one at a time and copied by
+ * tcore_user_request_set_data(), so each modem reuses one zeroed buffer.
+ */
+static struct treq_sat_terminal_rsp_data *_sat_terminal_rsp_data(struct custom_data *ctx, TcorePlugin *plg)
+{
+	struct dbus_modem_context *modem;
+	struct treq_sat_terminal_rsp_data **tr;
+
+	modem = dbus_plugin_ref_modem(ctx, plg);
+	tr = modem ? &modem->sat_tr : &ctx->sat_tr;
+
+	if (!*tr)
+		*tr = g_new0(struct treq_sat_terminal_rsp_data, 1);
+	else
+		memset(*tr, 0, sizeof(struct treq_sat_terminal_rsp_data));
+
+	return *tr;
+}
+
 static TReturn sat_manager_send_terminal_response(Communicator *comm, TcorePlugin *target_plg, struct treq_sat_terminal_rsp_data *tr)
 {
 	TReturn rv = TCORE_RETURN_SUCCESS;
@@ -209,7 +333,6 @@ GVariant* sat_manager_caching_setup_menu_info(struct custom_data *ctx, const cha
 {
 	TcorePlugin *plg = NULL;
 	GVariant *setup_menu_info = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0, menu_cnt = 0, title_len =0;
 	gboolean menu_present = FALSE, help_info = FALSE, updated = FALSE;
@@ -233,7 +356,7 @@ GVariant* sat_manager_caching_setup_menu_info(struct custom_data *ctx, const cha
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("exceptional case to fix gcf case 2.4 command not understood");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 		tr->cmd_number = setup_menu_tlv->command_detail.cmd_num;
 		tr->cmd_type = setup_menu_tlv->command_detail.cmd_type;
 
@@ -261,7 +384,7 @@ GVariant* sat_manager_caching_setup_menu_info(struct custom_data *ctx, const cha
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("no item");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 		tr->cmd_number = setup_menu_tlv->command_detail.cmd_num;
 		tr->cmd_type = setup_menu_tlv->command_detail.cmd_type;
 
@@ -279,7 +402,7 @@ GVariant* sat_manager_caching_setup_menu_info(struct custom_data *ctx, const cha
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("item removed");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 		tr->cmd_number = setup_menu_tlv->command_detail.cmd_num;
 		tr->cmd_type = setup_menu_tlv->command_detail.cmd_type;
 
@@ -294,7 +417,7 @@ GVariant* sat_manager_caching_setup_menu_info(struct custom_data *ctx, const cha
 
 	//get title
 	if(setup_menu_tlv->alpha_id.alpha_data_len)
-		sat_mgr_convert_string((unsigned char*)&main_title,(unsigned short *)&title_len,
+		sat_mgr_convert_string((unsigned char*)&main_title,sizeof(main_title),(unsigned short *)&title_len,
 			setup_menu_tlv->alpha_id.dcs.a_format,
 			(unsigned char*)&setup_menu_tlv->alpha_id.alpha_data,
 			(unsigned short)setup_menu_tlv->alpha_id.alpha_data_len);
@@ -316,7 +439,7 @@ GVariant* sat_manager_caching_setup_menu_info(struct custom_data *ctx, const cha
 				setup_menu_tlv->alpha_id.dcs.a_format = ALPHABET_FROMAT_8BIT_DATA;
 
 			memset(&item_str, 0 , SAT_ITEM_TEXT_LEN_MAX + 1);
-			sat_mgr_convert_string((unsigned char*)&item_str, (unsigned short *)&item_len,
+			sat_mgr_convert_string((unsigned char*)&item_str, sizeof(item_str), (unsigned short *)&item_len,
 				setup_menu_tlv->alpha_id.dcs.a_format,
 				(unsigned char*)&setup_menu_tlv->menu_item[index].text,
 				(unsigned short)setup_menu_tlv->menu_item[index].text_len);
@@ -340,7 +463,7 @@ GVariant* sat_manager_caching_setup_menu_info(struct custom_data *ctx, const cha
 				setup_menu_tlv->alpha_id.dcs.a_format = ALPHABET_FROMAT_8BIT_DATA;
 
 			memset(&item_str, '\0' , SAT_ITEM_TEXT_LEN_MAX + 1);
-			sat_mgr_convert_string((unsigned char*)&item_str, (unsigned short *)&item_len,
+			sat_mgr_convert_string((unsigned char*)&item_str, sizeof(item_str), (unsigned short *)&item_len,
 				setup_menu_tlv->alpha_id.dcs.a_format,
 				(unsigned char*)&setup_menu_tlv->menu_item[index].text,
 				(unsigned short)setup_menu_tlv->menu_item[index].text_len);
@@ -368,11 +491,7 @@ GVariant* sat_manager_caching_setup_menu_info(struct custom_data *ctx, const cha
 	menu_items = g_variant_builder_end(v_builder);
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_SETUP_MENU;
-	memcpy((void*)&(q_data.cmd_data.setupMenuInd), setup_menu_tlv, sizeof(struct tel_sat_setup_menu_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_SETUP_MENU, setup_menu_tlv, sizeof(struct tel_sat_setup_menu_tlv));
 
 	setup_menu_info = g_variant_new("(ibsvibb)", command_id, menu_present, main_title, menu_items,
 			menu_cnt, help_info, updated);
@@ -384,7 +503,6 @@ GVariant* sat_manager_display_text_noti(struct custom_data *ctx, const char *plu
 {
 	TcorePlugin *plg = NULL;
 	GVariant *display_text = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0, text_len =0, duration= 0, tmp_duration = 0;
 	gboolean immediately_rsp = FALSE, high_priority = FALSE, user_rsp_required = FALSE;
@@ -406,7 +524,7 @@ GVariant* sat_manager_display_text_noti(struct custom_data *ctx, const char *plu
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT]  exceptional case to fix gcf case 2.4 command not understood");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 		tr->cmd_number = display_text_tlv->command_detail.cmd_num;
 		tr->cmd_type = display_text_tlv->command_detail.cmd_type;
 
@@ -438,7 +556,7 @@ GVariant* sat_manager_display_text_noti(struct custom_data *ctx, const char *plu
 	dbg("user rsp required(%d), immediately rsp(%d) priority(%d)",user_rsp_required, immediately_rsp, high_priority);
 
 	//get text
-	sat_mgr_convert_string((unsigned char*) &text, (unsigned short *) &text_len,
+	sat_mgr_convert_string((unsigned char*) &text, sizeof(text), (unsigned short *) &text_len,
 			display_text_tlv->text.dcs.a_format,
 			(unsigned char*) &display_text_tlv->text.string,
 			(unsigned short) display_text_tlv->text.string_length);
@@ -463,11 +581,7 @@ GVariant* sat_manager_display_text_noti(struct custom_data *ctx, const char *plu
 	}*/
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_DISPLAY_TEXT;
-	memcpy((void*)&(q_data.cmd_data.displayTextInd), display_text_tlv, sizeof(struct tel_sat_display_text_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_DISPLAY_TEXT, display_text_tlv, sizeof(struct tel_sat_display_text_tlv));
 
 	icon_id = g_variant_new("()");
 
@@ -481,7 +595,6 @@ GVariant* sat_manager_select_item_noti(struct custom_data *ctx, const char *plug
 {
 	TcorePlugin *plg = NULL;
 	GVariant *select_item = NULL;
-	struct sat_manager_queue_data q_data;
 
 	int index = 0;
 	gint command_id = 0, default_item_id = 0, menu_cnt = 0, text_len =0;
@@ -508,7 +621,7 @@ GVariant* sat_manager_select_item_noti(struct custom_data *ctx, const char *plug
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT]  exceptional case to fix gcf case 2.4 command not understood");
 
-		tr = (struct treq_sat_terminal_rsp_data *) calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 
 		tr->cmd_number = select_item_tlv->command_detail.cmd_num;
 		tr->cmd_type = select_item_tlv->command_detail.cmd_type;
@@ -532,7 +645,7 @@ GVariant* sat_manager_select_item_noti(struct custom_data *ctx, const char *plug
 
 	// select item text
 	if(select_item_tlv->alpha_id.is_exist && select_item_tlv->alpha_id.alpha_data_len > 0)
-		sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+		sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 				select_item_tlv->alpha_id.dcs.a_format,
 				(unsigned char*)&select_item_tlv->alpha_id.alpha_data,
 				(unsigned short)select_item_tlv->alpha_id.alpha_data_len);
@@ -554,7 +667,7 @@ GVariant* sat_manager_select_item_noti(struct custom_data *ctx, const char *plug
 
 		memset(&item_str, 0 , SAT_ITEM_TEXT_LEN_MAX + 1);
 
-		sat_mgr_convert_string((unsigned char*) &item_str, (unsigned short *) &item_len,
+		sat_mgr_convert_string((unsigned char*) &item_str, sizeof(item_str), (unsigned short *) &item_len,
 				select_item_tlv->alpha_id.dcs.a_format,
 				(unsigned char*) &select_item_tlv->menu_item[index].text,
 				(unsigned short) select_item_tlv->menu_item[index].text_len);
@@ -581,11 +694,7 @@ GVariant* sat_manager_select_item_noti(struct custom_data *ctx, const char *plug
 	menu_items = g_variant_builder_end(v_builder);
 
 	// generate command id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_SELECT_ITEM;
-	memcpy((void*)&(q_data.cmd_data.selectItemInd), select_item_tlv, sizeof(struct tel_sat_select_item_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_SELECT_ITEM, select_item_tlv, sizeof(struct tel_sat_select_item_tlv));
 
 	icon_id = g_variant_new_variant(menu_items);
 	icon_list = g_variant_new_variant(menu_items);
@@ -600,7 +709,6 @@ GVariant* sat_manager_get_inkey_noti(struct custom_data *ctx, const char *plugin
 {
 	TcorePlugin *plg = NULL;
 	GVariant *get_inkey = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0, key_type = 0, input_character_mode = 0;
 	gint text_len = 0, duration = 0, tmp_duration = 0;
@@ -623,7 +731,7 @@ GVariant* sat_manager_get_inkey_noti(struct custom_data *ctx, const char *plugin
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT]  exceptional case to fix gcf case 2.4 command not understood");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 		tr->cmd_number = get_inkey_tlv->command_detail.cmd_num;
 		tr->cmd_type = get_inkey_tlv->command_detail.cmd_type;
 
@@ -655,7 +763,7 @@ GVariant* sat_manager_get_inkey_noti(struct custom_data *ctx, const char *plugin
 	b_help_info = get_inkey_tlv->command_detail.cmd_qualifier.get_inkey.help_info;
 
 	//text & text len
-	sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+	sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 								get_inkey_tlv->text.dcs.a_format ,
 								(unsigned char*)&get_inkey_tlv->text.string,
 								(unsigned short)get_inkey_tlv->text.string_length);
@@ -668,11 +776,7 @@ GVariant* sat_manager_get_inkey_noti(struct custom_data *ctx, const char *plugin
 	}
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_GET_INKEY;
-	memcpy((void*)&(q_data.cmd_data.getInkeyInd), get_inkey_tlv, sizeof(struct tel_sat_get_inkey_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_GET_INKEY, get_inkey_tlv, sizeof(struct tel_sat_get_inkey_tlv));
 
 	icon_id = g_variant_new("()");
 
@@ -686,7 +790,6 @@ GVariant* sat_manager_get_input_noti(struct custom_data *ctx, const char *plugin
 {
 	TcorePlugin *plg = NULL;
 	GVariant *get_input = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0, input_character_mode = 0;
 	gint text_len = 0, def_text_len = 0, rsp_len_min = 0, rsp_len_max = 0;
@@ -708,7 +811,7 @@ GVariant* sat_manager_get_input_noti(struct custom_data *ctx, const char *plugin
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT]  exceptional case to fix gcf case 2.4 command not understood");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 		tr->cmd_number = get_input_tlv->command_detail.cmd_num;
 		tr->cmd_type = get_input_tlv->command_detail.cmd_type;
 
@@ -738,7 +841,7 @@ GVariant* sat_manager_get_input_noti(struct custom_data *ctx, const char *plugin
 
 	//text & text len
 	if(get_input_tlv->text.string_length){
-		sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+		sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 				get_input_tlv->text.dcs.a_format ,
 				(unsigned char*)&get_input_tlv->text.string,
 				(unsigned short)get_input_tlv->text.string_length);
@@ -755,7 +858,7 @@ GVariant* sat_manager_get_input_noti(struct custom_data *ctx, const char *plugin
 
 	//default text & default text len
 	if(get_input_tlv->default_text.string_length){
-		sat_mgr_convert_string((unsigned char*)&def_text,(unsigned short *)&def_text_len,
+		sat_mgr_convert_string((unsigned char*)&def_text,sizeof(def_text),(unsigned short *)&def_text_len,
 				get_input_tlv->text.dcs.a_format ,
 				(unsigned char*)&get_input_tlv->default_text.string,
 				(unsigned short)get_input_tlv->default_text.string_length);
@@ -763,11 +866,7 @@ GVariant* sat_manager_get_input_noti(struct custom_data *ctx, const char *plugin
 	}
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_GET_INPUT;
-	memcpy((void*)&(q_data.cmd_data.getInputInd), get_input_tlv, sizeof(struct tel_sat_get_input_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_GET_INPUT, get_input_tlv, sizeof(struct tel_sat_get_input_tlv));
 
 	icon_id = g_variant_new("()");
 
@@ -781,7 +880,6 @@ GVariant* sat_manager_play_tone_noti(struct custom_data *ctx, const char *plugin
 {
 	TcorePlugin *plg = NULL;
 	GVariant *play_tone = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0, tone_type = 0, duration = 0, tmp_duration = 0;
 	gint text_len = 0;
@@ -803,7 +901,7 @@ GVariant* sat_manager_play_tone_noti(struct custom_data *ctx, const char *plugin
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT]  exceptional case to fix gcf case 2.4 command not understood");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 		tr->cmd_number = play_tone_tlv->command_detail.cmd_num;
 		tr->cmd_type = play_tone_tlv->command_detail.cmd_type;
 
@@ -818,7 +916,7 @@ GVariant* sat_manager_play_tone_noti(struct custom_data *ctx, const char *plugin
 
 	//text and text len
 	if( play_tone_tlv->alpha_id.is_exist && play_tone_tlv->alpha_id.alpha_data_len){
-		sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+		sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 				play_tone_tlv->alpha_id.dcs.a_format,
 				(unsigned char*)&play_tone_tlv->alpha_id.alpha_data,
 				(unsigned short)play_tone_tlv->alpha_id.alpha_data_len);
@@ -835,11 +933,7 @@ GVariant* sat_manager_play_tone_noti(struct custom_data *ctx, const char *plugin
 		duration = tmp_duration;
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_PLAY_TONE;
-	memcpy((void*)&(q_data.cmd_data.play_tone), play_tone_tlv, sizeof(struct tel_sat_play_tone_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_PLAY_TONE, play_tone_tlv, sizeof(struct tel_sat_play_tone_tlv));
 
 	icon_id = g_variant_new("()");
 
@@ -852,7 +946,6 @@ GVariant* sat_manager_send_sms_noti(struct custom_data *ctx, const char *plugin_
 {
 	TcorePlugin *plg = NULL;
 	GVariant *send_sms = NULL;
-	struct sat_manager_queue_data q_data;
 
 	int index = 0;
 	gint command_id = 0, ton = 0, npi = 0, tpdu_type = 0;
@@ -879,7 +972,7 @@ GVariant* sat_manager_send_sms_noti(struct custom_data *ctx, const char *plugin_
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT]  exceptional case to fix gcf case 2.4 command not understood");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 		tr->cmd_number = send_sms_tlv->command_detail.cmd_num;
 		tr->cmd_type = send_sms_tlv->command_detail.cmd_type;
 
@@ -894,7 +987,7 @@ GVariant* sat_manager_send_sms_noti(struct custom_data *ctx, const char *plugin_
 
 	//text and text len
 	if( send_sms_tlv->alpha_id.is_exist && send_sms_tlv->alpha_id.alpha_data_len){
-		sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+		sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 				send_sms_tlv->alpha_id.dcs.a_format,
 				(unsigned char*)&send_sms_tlv->alpha_id.alpha_data,
 				(unsigned short)send_sms_tlv->alpha_id.alpha_data_len);
@@ -924,11 +1017,7 @@ GVariant* sat_manager_send_sms_noti(struct custom_data *ctx, const char *plugin_
 	tpdu_data = g_variant_builder_end(builder);
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_SEND_SMS;
-	memcpy((void*)&(q_data.cmd_data.sendSMSInd), send_sms_tlv, sizeof(struct tel_sat_send_sms_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_SEND_SMS, send_sms_tlv, sizeof(struct tel_sat_send_sms_tlv));
 
 	icon_id = g_variant_new("()");
 
@@ -942,7 +1031,6 @@ GVariant* sat_manager_send_ss_noti(struct custom_data *ctx, const char *plugin_n
 {
 	TcorePlugin *plg = NULL;
 	GVariant *send_ss = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0, ton = 0, npi = 0;
 	gint text_len, ss_str_len;
@@ -965,7 +1053,7 @@ GVariant* sat_manager_send_ss_noti(struct custom_data *ctx, const char *plugin_n
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT]  exceptional case to fix gcf case 2.4 command not understood");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 		tr->cmd_number = send_ss_tlv->command_detail.cmd_num;
 		tr->cmd_type = send_ss_tlv->command_detail.cmd_type;
 
@@ -980,7 +1068,7 @@ GVariant* sat_manager_send_ss_noti(struct custom_data *ctx, const char *plugin_n
 
 	//text and text len
 	if( send_ss_tlv->alpha_id.is_exist && send_ss_tlv->alpha_id.alpha_data_len){
-		sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+		sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 				send_ss_tlv->alpha_id.dcs.a_format,
 				(unsigned char*)&send_ss_tlv->alpha_id.alpha_data,
 				(unsigned short)send_ss_tlv->alpha_id.alpha_data_len);
@@ -994,11 +1082,7 @@ GVariant* sat_manager_send_ss_noti(struct custom_data *ctx, const char *plugin_n
 	memcpy(ss_string, send_ss_tlv->ss_string.ss_string, SAT_SS_STRING_LEN_MAX);
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_SEND_SS;
-	memcpy((void*)&(q_data.cmd_data.send_ss), send_ss_tlv, sizeof(struct tel_sat_send_ss_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_SEND_SS, send_ss_tlv, sizeof(struct tel_sat_send_ss_tlv));
 
 	icon_id = g_variant_new("()");
 
@@ -1012,7 +1096,6 @@ GVariant* sat_manager_send_ussd_noti(struct custom_data *ctx, const char *plugin
 {
 	TcorePlugin *plg = NULL;
 	GVariant *send_ussd = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0;
 	gint text_len, ussd_str_len;
@@ -1035,7 +1118,7 @@ GVariant* sat_manager_send_ussd_noti(struct custom_data *ctx, const char *plugin
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT]  exceptional case to fix gcf case 2.4 command not understood");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 		tr->cmd_number = send_ussd_tlv->command_detail.cmd_num;
 		tr->cmd_type = send_ussd_tlv->command_detail.cmd_type;
 
@@ -1050,7 +1133,7 @@ GVariant* sat_manager_send_ussd_noti(struct custom_data *ctx, const char *plugin
 
 	//text and text len
 	if( send_ussd_tlv->alpha_id.is_exist && send_ussd_tlv->alpha_id.alpha_data_len){
-		sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+		sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 				send_ussd_tlv->alpha_id.dcs.a_format,
 				(unsigned char*)&send_ussd_tlv->alpha_id.alpha_data,
 				(unsigned short)send_ussd_tlv->alpha_id.alpha_data_len);
@@ -1058,17 +1141,13 @@ GVariant* sat_manager_send_ussd_noti(struct custom_data *ctx, const char *plugin
 	}
 
 	//ussd string
-	sat_mgr_convert_string((unsigned char*)&ussd_string,(unsigned short *)&ussd_str_len,
+	sat_mgr_convert_string((unsigned char*)&ussd_string,sizeof(ussd_string),(unsigned short *)&ussd_str_len,
 				send_ussd_tlv->ussd_string.dsc.a_format,
 				(unsigned char*)&send_ussd_tlv->ussd_string.ussd_string,
 				(unsigned short)send_ussd_tlv->ussd_string.string_len);
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_SEND_USSD;
-	memcpy((void*)&(q_data.cmd_data.send_ussd), send_ussd_tlv, sizeof(struct tel_sat_send_ussd_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_SEND_USSD, send_ussd_tlv, sizeof(struct tel_sat_send_ussd_tlv));
 
 	icon_id = g_variant_new("()");
 
@@ -1081,7 +1160,6 @@ GVariant* sat_manager_setup_call_noti(struct custom_data *ctx, const char *plugi
 {
 	TcorePlugin *plg = NULL;
 	GVariant *setup_call = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0, call_type = 0, text_len = 0, duration = 0;
 	gchar text[SAT_TEXT_STRING_LEN_MAX], call_number[SAT_DIALING_NUMBER_LEN_MAX];
@@ -1102,7 +1180,7 @@ GVariant* sat_manager_setup_call_noti(struct custom_data *ctx, const char *plugi
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT] redial is not supported.\n");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 		tr->cmd_number = setup_call_tlv->command_detail.cmd_num;
 		tr->cmd_type = setup_call_tlv->command_detail.cmd_type;
 
@@ -1121,7 +1199,7 @@ GVariant* sat_manager_setup_call_noti(struct custom_data *ctx, const char *plugi
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT] Sub address is not supported > 0)");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 		tr->cmd_number = setup_call_tlv->command_detail.cmd_num;
 		tr->cmd_type = setup_call_tlv->command_detail.cmd_type;
 
@@ -1139,14 +1217,14 @@ GVariant* sat_manager_setup_call_noti(struct custom_data *ctx, const char *plugi
 
 	//call display data
 	if(setup_call_tlv->call_setup_alpha_id.alpha_data_len != 0){
-		sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+		sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 				setup_call_tlv->call_setup_alpha_id.dcs.a_format,
 				(unsigned char*)&setup_call_tlv->call_setup_alpha_id.alpha_data,
 				(unsigned short)setup_call_tlv->call_setup_alpha_id.alpha_data_len);
 	}
 	else{
 		if(setup_call_tlv->user_confirm_alpha_id.alpha_data_len != 0){
-			sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+			sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 					setup_call_tlv->user_confirm_alpha_id.dcs.a_format,
 					(unsigned char*)&setup_call_tlv->user_confirm_alpha_id.alpha_data,
 					(unsigned short)setup_call_tlv->user_confirm_alpha_id.alpha_data_len);
@@ -1173,11 +1251,7 @@ GVariant* sat_manager_setup_call_noti(struct custom_data *ctx, const char *plugi
 		duration = _get_time_in_ms(&setup_call_tlv->duration);
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_SETUP_CALL;
-	memcpy((void*)&(q_data.cmd_data.setup_call), setup_call_tlv, sizeof(struct tel_sat_setup_call_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_SETUP_CALL, setup_call_tlv, sizeof(struct tel_sat_setup_call_tlv));
 
 	icon_id = g_variant_new("()");
 
@@ -1220,7 +1294,7 @@ GVariant* sat_manager_setup_event_list_noti(struct custom_data *ctx, const char
 	event_list = g_variant_new("(iv)", event_cnt, evt_list);
 
 	//send TR - does not need from application's response
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 	tr->cmd_number = event_list_tlv->command_detail.cmd_num;
 	tr->cmd_type = event_list_tlv->command_detail.cmd_type;
 	memcpy((void*)&tr->terminal_rsp_data.setup_event_list.command_detail, &event_list_tlv->command_detail, sizeof(struct tel_sat_cmd_detail_info));
@@ -1243,7 +1317,6 @@ GVariant* sat_manager_setup_idle_mode_text_noti(struct custom_data *ctx, const c
 {
 	TcorePlugin *plg = NULL;
 	GVariant *idle_mode = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0;
 	gint text_len;
@@ -1265,7 +1338,7 @@ GVariant* sat_manager_setup_idle_mode_text_noti(struct custom_data *ctx, const c
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT]  exceptional case to fix gcf case 2.4 command not understood");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 		tr->cmd_number = idle_mode_tlv->command_detail.cmd_num;
 		tr->cmd_type = idle_mode_tlv->command_detail.cmd_type;
 
@@ -1278,7 +1351,7 @@ GVariant* sat_manager_setup_idle_mode_text_noti(struct custom_data *ctx, const c
 		return NULL;
 	}
 
-	sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+	sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 			idle_mode_tlv->text.dcs.a_format,
 			(unsigned char*)&idle_mode_tlv->text.string,
 			(unsigned short)idle_mode_tlv->text.string_length);
@@ -1286,11 +1359,7 @@ GVariant* sat_manager_setup_idle_mode_text_noti(struct custom_data *ctx, const c
 	dbg("setup idle mode text display text (%s)",text);
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_SETUP_IDLE_MODE_TEXT;
-	memcpy((void*)&(q_data.cmd_data.idle_mode), idle_mode_tlv, sizeof(struct tel_sat_setup_idle_mode_text_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_SETUP_IDLE_MODE_TEXT, idle_mode_tlv, sizeof(struct tel_sat_setup_idle_mode_text_tlv));
 
 	icon_id = g_variant_new("()");
 
@@ -1303,7 +1372,6 @@ GVariant* sat_manager_open_channel_noti(struct custom_data *ctx, const char *plu
 {
 	TcorePlugin *plg = NULL;
 	GVariant *open_channel = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0, bearer_type = 0, protocol_type = 0, dest_addr_type = 0;
 	gboolean immediate_link = FALSE, auto_reconnection = FALSE, bg_mode = FALSE;
@@ -1334,7 +1402,7 @@ GVariant* sat_manager_open_channel_noti(struct custom_data *ctx, const char *plu
 
 	//open channel text
 	if(open_channel_tlv->alpha_id.is_exist && open_channel_tlv->alpha_id.alpha_data_len > 0)
-		sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+		sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 				open_channel_tlv->alpha_id.dcs.a_format,
 				(unsigned char*)&open_channel_tlv->alpha_id.alpha_data,
 				(unsigned short)open_channel_tlv->alpha_id.alpha_data_len);
@@ -1398,12 +1466,12 @@ GVariant* sat_manager_open_channel_noti(struct custom_data *ctx, const char *plu
 			other_addr_type = open_channel_tlv->bearer_detail.cs_bearer.other_address.address_type;
 			memcpy(other_address, open_channel_tlv->bearer_detail.cs_bearer.other_address.address, open_channel_tlv->bearer_detail.cs_bearer.other_address.address_len);
 
-			sat_mgr_convert_string((unsigned char*) &login, (unsigned short *) &login_len,
+			sat_mgr_convert_string((unsigned char*) &login, sizeof(login), (unsigned short *) &login_len,
 					open_channel_tlv->bearer_detail.cs_bearer.text_user_login.dcs.a_format,
 					(unsigned char*) &open_channel_tlv->bearer_detail.cs_bearer.text_user_login.string,
 					(unsigned short) open_channel_tlv->bearer_detail.cs_bearer.text_user_login.string_length);
 
-			sat_mgr_convert_string((unsigned char*) &pwd, (unsigned short *) &pwd_len,
+			sat_mgr_convert_string((unsigned char*) &pwd, sizeof(pwd), (unsigned short *) &pwd_len,
 					open_channel_tlv->bearer_detail.cs_bearer.text_user_pwd.dcs.a_format,
 					(unsigned char*) &open_channel_tlv->bearer_detail.cs_bearer.text_user_pwd.string,
 					(unsigned short) open_channel_tlv->bearer_detail.cs_bearer.text_user_pwd.string_length);
@@ -1443,12 +1511,12 @@ GVariant* sat_manager_open_channel_noti(struct custom_data *ctx, const char *plu
 			other_addr_type = open_channel_tlv->bearer_detail.ps_bearer.other_address.address_type;
 			memcpy(other_address, open_channel_tlv->bearer_detail.ps_bearer.other_address.address, open_channel_tlv->bearer_detail.ps_bearer.other_address.address_len);
 
-			sat_mgr_convert_string((unsigned char*) &login, (unsigned short *) &login_len,
+			sat_mgr_convert_string((unsigned char*) &login, sizeof(login), (unsigned short *) &login_len,
 					open_channel_tlv->bearer_detail.ps_bearer.text_user_login.dcs.a_format,
 					(unsigned char*) &open_channel_tlv->bearer_detail.ps_bearer.text_user_login.string,
 					(unsigned short) open_channel_tlv->bearer_detail.ps_bearer.text_user_login.string_length);
 
-			sat_mgr_convert_string((unsigned char*) &pwd, (unsigned short *) &pwd_len,
+			sat_mgr_convert_string((unsigned char*) &pwd, sizeof(pwd), (unsigned short *) &pwd_len,
 					open_channel_tlv->bearer_detail.ps_bearer.text_user_pwd.dcs.a_format,
 					(unsigned char*) &open_channel_tlv->bearer_detail.ps_bearer.text_user_pwd.string,
 					(unsigned short) open_channel_tlv->bearer_detail.ps_bearer.text_user_pwd.string_length);
@@ -1475,12 +1543,12 @@ GVariant* sat_manager_open_channel_noti(struct custom_data *ctx, const char *plu
 			other_addr_type = open_channel_tlv->bearer_detail.default_bearer.other_address.address_type;
 			memcpy(other_address, open_channel_tlv->bearer_detail.default_bearer.other_address.address, open_channel_tlv->bearer_detail.default_bearer.other_address.address_len);
 
-			sat_mgr_convert_string((unsigned char*) &login, (unsigned short *) &login_len,
+			sat_mgr_convert_string((unsigned char*) &login, sizeof(login), (unsigned short *) &login_len,
 					open_channel_tlv->bearer_detail.default_bearer.text_user_login.dcs.a_format,
 					(unsigned char*) &open_channel_tlv->bearer_detail.default_bearer.text_user_login.string,
 					(unsigned short) open_channel_tlv->bearer_detail.default_bearer.text_user_login.string_length);
 
-			sat_mgr_convert_string((unsigned char*) &pwd, (unsigned short *) &pwd_len,
+			sat_mgr_convert_string((unsigned char*) &pwd, sizeof(pwd), (unsigned short *) &pwd_len,
 					open_channel_tlv->bearer_detail.default_bearer.text_user_pwd.dcs.a_format,
 					(unsigned char*) &open_channel_tlv->bearer_detail.default_bearer.text_user_pwd.string,
 					(unsigned short) open_channel_tlv->bearer_detail.default_bearer.text_user_pwd.string_length);
@@ -1506,7 +1574,7 @@ GVariant* sat_manager_open_channel_noti(struct custom_data *ctx, const char *plu
 			time_duration1 = _get_time_in_ms(&open_channel_tlv->bearer_detail.local_bearer.duration1);
 			time_duration2 = _get_time_in_ms(&open_channel_tlv->bearer_detail.local_bearer.duration2);
 
-			sat_mgr_convert_string((unsigned char*) &pwd, (unsigned short *) &pwd_len,
+			sat_mgr_convert_string((unsigned char*) &pwd, sizeof(pwd), (unsigned short *) &pwd_len,
 											open_channel_tlv->bearer_detail.default_bearer.text_user_pwd.dcs.a_format,
 											(unsigned char*) &open_channel_tlv->bearer_detail.default_bearer.text_user_pwd.string,
 											(unsigned short) open_channel_tlv->bearer_detail.default_bearer.text_user_pwd.string_length);
@@ -1523,11 +1591,7 @@ GVariant* sat_manager_open_channel_noti(struct custom_data *ctx, const char *plu
 	}//end of switch
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_OPEN_CHANNEL;
-	memcpy((void*)&(q_data.cmd_data.open_channel), open_channel_tlv, sizeof(struct tel_sat_open_channel_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_OPEN_CHANNEL, open_channel_tlv, sizeof(struct tel_sat_open_channel_tlv));
 
 	icon_id = g_variant_new("()");
 
@@ -1541,7 +1605,6 @@ GVariant* sat_manager_close_channel_noti(struct custom_data *ctx, const char *pl
 {
 	TcorePlugin *plg = NULL;
 	GVariant *close_channel = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0, channel_id = 0;
 	gint text_len = 0;
@@ -1562,18 +1625,14 @@ GVariant* sat_manager_close_channel_noti(struct custom_data *ctx, const char *pl
 
 	//close channel text
 	if(close_channel_tlv->alpha_id.is_exist && close_channel_tlv->alpha_id.alpha_data_len > 0)
-		sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+		sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 				close_channel_tlv->alpha_id.dcs.a_format,
 				(unsigned char*)&close_channel_tlv->alpha_id.alpha_data,
 				(unsigned short)close_channel_tlv->alpha_id.alpha_data_len);
 	dbg("close channel text(%s)",text);
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_CLOSE_CHANNEL;
-	memcpy((void*)&(q_data.cmd_data.close_channel), close_channel_tlv, sizeof(struct tel_sat_close_channel_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_CLOSE_CHANNEL, close_channel_tlv, sizeof(struct tel_sat_close_channel_tlv));
 
 	icon_id = g_variant_new("()");
 
@@ -1586,7 +1645,6 @@ GVariant* sat_manager_receive_data_noti(struct custom_data *ctx, const char *plu
 {
 	TcorePlugin *plg = NULL;
 	GVariant *receive_data = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0, channel_id = 0;
 	gint text_len = 0, channel_data_len = 0;
@@ -1607,7 +1665,7 @@ GVariant* sat_manager_receive_data_noti(struct custom_data *ctx, const char *plu
 
 	//receive data text
 	if(receive_data_tlv->alpha_id.is_exist && receive_data_tlv->alpha_id.alpha_data_len > 0)
-		sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+		sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 				receive_data_tlv->alpha_id.dcs.a_format,
 				(unsigned char*)&receive_data_tlv->alpha_id.alpha_data,
 				(unsigned short)receive_data_tlv->alpha_id.alpha_data_len);
@@ -1616,11 +1674,7 @@ GVariant* sat_manager_receive_data_noti(struct custom_data *ctx, const char *plu
 	channel_data_len = receive_data_tlv->channel_data_len.data_len;
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_RECEIVE_DATA;
-	memcpy((void*)&(q_data.cmd_data.receive_data), receive_data_tlv, sizeof(struct tel_sat_receive_channel_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_RECEIVE_DATA, receive_data_tlv, sizeof(struct tel_sat_receive_channel_tlv));
 
 	icon_id = g_variant_new("()");
 
@@ -1633,7 +1687,6 @@ GVariant* sat_manager_send_data_noti(struct custom_data *ctx, const char *plugin
 {
 	TcorePlugin *plg = NULL;
 	GVariant *send_data = NULL;
-	struct sat_manager_queue_data q_data;
 
 	int index = 0;
 	gint command_id = 0, channel_id = 0, data_len = 0;
@@ -1661,7 +1714,7 @@ GVariant* sat_manager_send_data_noti(struct custom_data *ctx, const char *plugin
 
 	//send data text
 	if(send_data_tlv->alpha_id.is_exist && send_data_tlv->alpha_id.alpha_data_len > 0)
-		sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+		sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 				send_data_tlv->alpha_id.dcs.a_format,
 				(unsigned char*)&send_data_tlv->alpha_id.alpha_data,
 				(unsigned short)send_data_tlv->alpha_id.alpha_data_len);
@@ -1677,11 +1730,7 @@ GVariant* sat_manager_send_data_noti(struct custom_data *ctx, const char *plugin
 	channel_data = g_variant_builder_end(builder);
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_SEND_DATA;
-	memcpy((void*)&(q_data.cmd_data.send_data), send_data_tlv, sizeof(struct tel_sat_send_channel_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_SEND_DATA, send_data_tlv, sizeof(struct tel_sat_send_channel_tlv));
 
 	icon_id = g_variant_new("()");
 
@@ -1694,7 +1743,6 @@ GVariant* sat_manager_get_channel_status_noti(struct custom_data *ctx, const cha
 {
 	TcorePlugin *plg = NULL;
 	GVariant *get_channel_status = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0;
 
@@ -1707,11 +1755,7 @@ GVariant* sat_manager_get_channel_status_noti(struct custom_data *ctx, const cha
 	}
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_GET_CHANNEL_STATUS;
-	memcpy((void*)&(q_data.cmd_data.get_channel_status), get_channel_status_tlv, sizeof(struct tel_sat_get_channel_status_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_GET_CHANNEL_STATUS, get_channel_status_tlv, sizeof(struct tel_sat_get_channel_status_tlv));
 
 	get_channel_status = g_variant_new("(i)", command_id);
 
@@ -1722,7 +1766,6 @@ GVariant* sat_manager_refresh_noti(struct custom_data *ctx, const char *plugin_n
 {
 	TcorePlugin *plg = NULL;
 	GVariant *refresh = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0;
 	gint refresh_type =0;
@@ -1747,11 +1790,7 @@ GVariant* sat_manager_refresh_noti(struct custom_data *ctx, const char *plugin_n
 	file_list = g_variant_builder_end(builder);
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_REFRESH;
-	memcpy((void*)&(q_data.cmd_data.refresh), refresh_tlv, sizeof(struct tel_sat_refresh_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_REFRESH, refresh_tlv, sizeof(struct tel_sat_refresh_tlv));
 
 	refresh = g_variant_new("(iiv)", command_id, refresh_type, file_list);
 
@@ -1771,7 +1810,7 @@ void sat_manager_more_time_noti(struct custom_data *ctx, const char *plugin_name
 		return;
 	}
 	//send TR - does not need from application's response
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 	tr->cmd_number = more_time_tlv->command_detail.cmd_num;
 	tr->cmd_type = more_time_tlv->command_detail.cmd_type;
 	memcpy((void*)&tr->terminal_rsp_data.more_time.command_detail, &more_time_tlv->command_detail, sizeof(struct tel_sat_cmd_detail_info));
@@ -1787,7 +1826,6 @@ GVariant* sat_manager_send_dtmf_noti(struct custom_data *ctx, const char *plugin
 {
 	TcorePlugin *plg = NULL;
 	GVariant *send_dtmf = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0;
 	gint text_len =0, dtmf_str_len =0;
@@ -1810,7 +1848,7 @@ GVariant* sat_manager_send_dtmf_noti(struct custom_data *ctx, const char *plugin
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT]  exceptional case to fix gcf case 2.4 command not understood");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 		tr->cmd_number = send_dtmf_tlv->command_detail.cmd_num;
 		tr->cmd_type = send_dtmf_tlv->command_detail.cmd_type;
 
@@ -1825,7 +1863,7 @@ GVariant* sat_manager_send_dtmf_noti(struct custom_data *ctx, const char *plugin
 
 	//text and text len
 	if( send_dtmf_tlv->alpha_id.is_exist && send_dtmf_tlv->alpha_id.alpha_data_len){
-		sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+		sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 				send_dtmf_tlv->alpha_id.dcs.a_format,
 				(unsigned char*)&send_dtmf_tlv->alpha_id.alpha_data,
 				(unsigned short)send_dtmf_tlv->alpha_id.alpha_data_len);
@@ -1837,11 +1875,7 @@ GVariant* sat_manager_send_dtmf_noti(struct custom_data *ctx, const char *plugin
 	memcpy(dtmf_str, send_dtmf_tlv->dtmf_string.dtmf_string, SAT_DTMF_STRING_LEN_MAX);
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_SEND_DTMF;
-	memcpy((void*)&(q_data.cmd_data.send_dtmf), send_dtmf_tlv, sizeof(struct tel_sat_send_dtmf_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_SEND_DTMF, send_dtmf_tlv, sizeof(struct tel_sat_send_dtmf_tlv));
 
 	icon_id = g_variant_new("()");
 
@@ -1855,7 +1889,6 @@ GVariant* sat_manager_launch_browser_noti(struct custom_data *ctx, const char *p
 {
 	TcorePlugin *plg = NULL;
 	GVariant *launch_browser = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0;
 	gint browser_id = 0;
@@ -1880,7 +1913,7 @@ GVariant* sat_manager_launch_browser_noti(struct custom_data *ctx, const char *p
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT]  exceptional case to fix gcf case 2.4 command not understood");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 		tr->cmd_number = launch_browser_tlv->command_detail.cmd_num;
 		tr->cmd_type = launch_browser_tlv->command_detail.cmd_type;
 
@@ -1909,7 +1942,7 @@ GVariant* sat_manager_launch_browser_noti(struct custom_data *ctx, const char *p
 		dbg("launch browser gateway_proxy digit type string (%s)",gateway_proxy);
 	} else {
 		if( launch_browser_tlv->gateway_proxy_text.string_length){
-			sat_mgr_convert_string((unsigned char*)&gateway_proxy,(unsigned short *)&gateway_proxy_len,
+			sat_mgr_convert_string((unsigned char*)&gateway_proxy,sizeof(gateway_proxy),(unsigned short *)&gateway_proxy_len,
 					launch_browser_tlv->gateway_proxy_text.dcs.a_format,
 					(unsigned char*)&launch_browser_tlv->gateway_proxy_text.string,
 					(unsigned short)launch_browser_tlv->gateway_proxy_text.string_length);
@@ -1919,7 +1952,7 @@ GVariant* sat_manager_launch_browser_noti(struct custom_data *ctx, const char *p
 
 	//user confirm text and user confirm text len
 	if( launch_browser_tlv->user_confirm_alpha_id.is_exist && launch_browser_tlv->user_confirm_alpha_id.alpha_data_len){
-		sat_mgr_convert_string((unsigned char*)&text,(unsigned short *)&text_len,
+		sat_mgr_convert_string((unsigned char*)&text,sizeof(text),(unsigned short *)&text_len,
 				launch_browser_tlv->user_confirm_alpha_id.dcs.a_format,
 				(unsigned char*)&launch_browser_tlv->user_confirm_alpha_id.alpha_data,
 				(unsigned short)launch_browser_tlv->user_confirm_alpha_id.alpha_data_len);
@@ -1927,11 +1960,7 @@ GVariant* sat_manager_launch_browser_noti(struct custom_data *ctx, const char *p
 	}
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_LAUNCH_BROWSER;
-	memcpy((void*)&(q_data.cmd_data.launch_browser), launch_browser_tlv, sizeof(struct tel_sat_launch_browser_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_LAUNCH_BROWSER, launch_browser_tlv, sizeof(struct tel_sat_launch_browser_tlv));
 
 	icon_id = g_variant_new("()");
 
@@ -1945,7 +1974,6 @@ GVariant* sat_manager_provide_local_info_noti(struct custom_data *ctx, const cha
 {
 	TcorePlugin *plg = NULL;
 	GVariant *provide_info = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0;
 	gint info_type =0;
@@ -1961,11 +1989,7 @@ GVariant* sat_manager_provide_local_info_noti(struct custom_data *ctx, const cha
 	info_type = provide_local_info_tlv->command_detail.cmd_qualifier.provide_local_info.provide_local_info;
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_PROVIDE_LOCAL_INFO;
-	memcpy((void*)&(q_data.cmd_data.provide_local_info), provide_local_info_tlv, sizeof(struct tel_sat_provide_local_info_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_PROVIDE_LOCAL_INFO, provide_local_info_tlv, sizeof(struct tel_sat_provide_local_info_tlv));
 
 	provide_info = g_variant_new("(ii)", command_id, info_type);
 
@@ -1976,7 +2000,6 @@ GVariant* sat_manager_language_notification_noti(struct custom_data *ctx, const
 {
 	TcorePlugin *plg = NULL;
 	GVariant *language_noti = NULL;
-	struct sat_manager_queue_data q_data;
 
 	gint command_id = 0;
 	gint language =0;
@@ -1999,11 +2022,7 @@ GVariant* sat_manager_language_notification_noti(struct custom_data *ctx, const
 	}
 
 	//enqueue data and generate cmd_id
-	memset(&q_data, 0x00, sizeof(struct sat_manager_queue_data));
-	q_data.cmd_type = SAT_PROATV_CMD_LANGUAGE_NOTIFICATION;
-	memcpy((void*)&(q_data.cmd_data.language_notification), language_notification_tlv, sizeof(struct tel_sat_language_notification_tlv));
-	sat_manager_enqueue_cmd(ctx, &q_data);
-	command_id = q_data.cmd_id;
+	command_id = sat_manager_enqueue_cmd(ctx, SAT_PROATV_CMD_LANGUAGE_NOTIFICATION, language_notification_tlv, sizeof(struct tel_sat_language_notification_tlv));
 
 	language_noti = g_variant_new("(iib)", command_id, language, b_specified);
 
@@ -2017,12 +2036,12 @@ static gboolean _sat_manager_handle_setup_menu_result(struct custom_data *ctx, T
 
 	gint resp;
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -2040,21 +2059,21 @@ static gboolean _sat_manager_handle_setup_menu_result(struct custom_data *ctx, T
 	dbg("exec_result type_format(%s)", g_variant_get_type_string(exec_result));
 	g_variant_get(exec_result, "(i)", &resp);
 
-	tr->cmd_number = q_data.cmd_data.setupMenuInd.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.setupMenuInd.command_detail.cmd_type;
+	tr->cmd_number = q_data->cmd_data.setupMenuInd.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.setupMenuInd.command_detail.cmd_type;
 
 	memcpy((void*)&tr->terminal_rsp_data.setup_menu.command_detail,
-		&q_data.cmd_data.setupMenuInd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+		&q_data->cmd_data.setupMenuInd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
 
-	tr->terminal_rsp_data.setup_menu.device_id.src = q_data.cmd_data.setupMenuInd.device_id.dest;
-	tr->terminal_rsp_data.setup_menu.device_id.dest = q_data.cmd_data.setupMenuInd.device_id.src;
+	tr->terminal_rsp_data.setup_menu.device_id.src = q_data->cmd_data.setupMenuInd.device_id.dest;
+	tr->terminal_rsp_data.setup_menu.device_id.dest = q_data->cmd_data.setupMenuInd.device_id.src;
 
 	dbg("[SAT] resp(%d)", resp);
 
 	switch(resp){
 		case RESULT_SUCCESS:
 			tr->terminal_rsp_data.setup_menu.result_type = RESULT_SUCCESS;
-			if (q_data.cmd_data.setupMenuInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
+			if (q_data->cmd_data.setupMenuInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
 				tr->terminal_rsp_data.setup_menu.result_type = RESULT_SUCCESS_BUT_REQUESTED_ICON_NOT_DISPLAYED;
 			tr->terminal_rsp_data.setup_menu.me_problem_type = ME_PROBLEM_NO_SPECIFIC_CAUSE;
 			break;
@@ -2089,12 +2108,12 @@ static gboolean _sat_manager_handle_display_text_result(struct custom_data *ctx,
 
 	gint resp, me_problem;
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -2112,11 +2131,11 @@ static gboolean _sat_manager_handle_display_text_result(struct custom_data *ctx,
 	dbg("exec_result type_format(%s)", g_variant_get_type_string(exec_result));
 	g_variant_get(exec_result, "(ii)",&resp, &me_problem);
 
-	tr->cmd_number = q_data.cmd_data.displayTextInd.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.displayTextInd.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.display_text.command_detail, &q_data.cmd_data.displayTextInd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
-	tr->terminal_rsp_data.display_text.device_id.src = q_data.cmd_data.displayTextInd.device_id.dest;
-	tr->terminal_rsp_data.display_text.device_id.dest = q_data.cmd_data.displayTextInd.device_id.src;
+	tr->cmd_number = q_data->cmd_data.displayTextInd.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.displayTextInd.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.display_text.command_detail, &q_data->cmd_data.displayTextInd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->terminal_rsp_data.display_text.device_id.src = q_data->cmd_data.displayTextInd.device_id.dest;
+	tr->terminal_rsp_data.display_text.device_id.dest = q_data->cmd_data.displayTextInd.device_id.src;
 
 	switch (resp) {
 		case RESULT_SUCCESS:
@@ -2136,7 +2155,7 @@ static gboolean _sat_manager_handle_display_text_result(struct custom_data *ctx,
 			break;
 	}
 
-	if (q_data.cmd_data.displayTextInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
+	if (q_data->cmd_data.displayTextInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
 		tr->terminal_rsp_data.display_text.result_type = RESULT_SUCCESS_BUT_REQUESTED_ICON_NOT_DISPLAYED;
 
 	result = TRUE;
@@ -2156,12 +2175,12 @@ static gboolean _sat_manager_handle_play_tone_result(struct custom_data *ctx, Tc
 
 	gint resp, me_problem;
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -2179,16 +2198,16 @@ static gboolean _sat_manager_handle_play_tone_result(struct custom_data *ctx, Tc
 	dbg("exec_result type_format(%s)", g_variant_get_type_string(exec_result));
 	g_variant_get(exec_result, "(ii)",&resp, &me_problem);
 
-	tr->cmd_number = q_data.cmd_data.play_tone.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.play_tone.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.play_tone.command_detail, &q_data.cmd_data.play_tone.command_detail, sizeof(struct tel_sat_cmd_detail_info));
-	tr->terminal_rsp_data.play_tone.device_id.src = q_data.cmd_data.play_tone.device_id.dest;
-	tr->terminal_rsp_data.play_tone.device_id.dest = q_data.cmd_data.play_tone.device_id.src;
+	tr->cmd_number = q_data->cmd_data.play_tone.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.play_tone.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.play_tone.command_detail, &q_data->cmd_data.play_tone.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->terminal_rsp_data.play_tone.device_id.src = q_data->cmd_data.play_tone.device_id.dest;
+	tr->terminal_rsp_data.play_tone.device_id.dest = q_data->cmd_data.play_tone.device_id.src;
 
 	switch (resp) {
 		case RESULT_SUCCESS:
 			tr->terminal_rsp_data.play_tone.result_type = RESULT_SUCCESS;
-			if (q_data.cmd_data.play_tone.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
+			if (q_data->cmd_data.play_tone.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
 				tr->terminal_rsp_data.play_tone.result_type = RESULT_SUCCESS_BUT_REQUESTED_ICON_NOT_DISPLAYED;
 
 			tr->terminal_rsp_data.play_tone.me_problem_type = ME_PROBLEM_NO_SPECIFIC_CAUSE;
@@ -2211,7 +2230,7 @@ static gboolean _sat_manager_handle_play_tone_result(struct custom_data *ctx, Tc
 			break;
 	}
 
-	if (q_data.cmd_data.displayTextInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
+	if (q_data->cmd_data.displayTextInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
 		tr->terminal_rsp_data.display_text.result_type = RESULT_SUCCESS_BUT_REQUESTED_ICON_NOT_DISPLAYED;
 
 	result = TRUE;
@@ -2231,12 +2250,12 @@ static gboolean _sat_manager_handle_send_sms_result(struct custom_data *ctx, Tco
 
 	gint resp;
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -2254,16 +2273,16 @@ static gboolean _sat_manager_handle_send_sms_result(struct custom_data *ctx, Tco
 	dbg("exec_result type_format(%s)", g_variant_get_type_string(exec_result));
 	g_variant_get(exec_result, "(i)",&resp);
 
-	tr->cmd_number = q_data.cmd_data.sendSMSInd.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.sendSMSInd.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.send_sms.command_detail, &q_data.cmd_data.sendSMSInd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
-	tr->terminal_rsp_data.send_sms.device_id.src = q_data.cmd_data.sendSMSInd.device_id.dest;
-	tr->terminal_rsp_data.send_sms.device_id.dest = q_data.cmd_data.sendSMSInd.device_id.src;
+	tr->cmd_number = q_data->cmd_data.sendSMSInd.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.sendSMSInd.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.send_sms.command_detail, &q_data->cmd_data.sendSMSInd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->terminal_rsp_data.send_sms.device_id.src = q_data->cmd_data.sendSMSInd.device_id.dest;
+	tr->terminal_rsp_data.send_sms.device_id.dest = q_data->cmd_data.sendSMSInd.device_id.src;
 
 	switch (resp) {
 		case RESULT_SUCCESS:
 			tr->terminal_rsp_data.send_sms.result_type = RESULT_SUCCESS;
-			if (q_data.cmd_data.sendSMSInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
+			if (q_data->cmd_data.sendSMSInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
 				tr->terminal_rsp_data.send_sms.result_type = RESULT_SUCCESS_BUT_REQUESTED_ICON_NOT_DISPLAYED;
 
 			break;
@@ -2311,7 +2330,7 @@ static gboolean _sat_manager_handle_send_sms_result(struct custom_data *ctx, Tco
 		result = FALSE;
 	}
 
-/*	if( q_data.cmd_data.sendSMSInd.alpha_id.alpha_data_len && q_data.cmd_data.sendSMSInd.alpha_id.is_exist)
+/*	if( q_data->cmd_data.sendSMSInd.alpha_id.alpha_data_len && q_data->cmd_data.sendSMSInd.alpha_id.is_exist)
 		sat_ui_support_terminate_sat_ui();*/
 
 	return result;
@@ -2324,13 +2343,13 @@ static gboolean _sat_manager_handle_send_ss_result(struct custom_data *ctx, Tcor
 
 	gint resp, ss_problem;
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 	//call ctrl action, result data object, text
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -2348,16 +2367,16 @@ static gboolean _sat_manager_handle_send_ss_result(struct custom_data *ctx, Tcor
 	dbg("exec_result type_format(%s)", g_variant_get_type_string(exec_result));
 	g_variant_get(exec_result, "(ii)",&resp, &ss_problem);
 
-	tr->cmd_number = q_data.cmd_data.send_ss.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.send_ss.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.send_ss.command_detail, &q_data.cmd_data.send_ss.command_detail, sizeof(struct tel_sat_cmd_detail_info));
-	tr->terminal_rsp_data.send_ss.device_id.src = q_data.cmd_data.send_ss.device_id.dest;
-	tr->terminal_rsp_data.send_ss.device_id.dest = q_data.cmd_data.send_ss.device_id.src;
+	tr->cmd_number = q_data->cmd_data.send_ss.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.send_ss.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.send_ss.command_detail, &q_data->cmd_data.send_ss.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->terminal_rsp_data.send_ss.device_id.src = q_data->cmd_data.send_ss.device_id.dest;
+	tr->terminal_rsp_data.send_ss.device_id.dest = q_data->cmd_data.send_ss.device_id.src;
 
 	switch (resp) {
 		case RESULT_SUCCESS:
 			tr->terminal_rsp_data.send_ss.result_type = RESULT_SUCCESS;
-			if (q_data.cmd_data.send_ss.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
+			if (q_data->cmd_data.send_ss.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
 				tr->terminal_rsp_data.send_ss.result_type = RESULT_SUCCESS_BUT_REQUESTED_ICON_NOT_DISPLAYED;
 
 			break;
@@ -2385,8 +2404,8 @@ static gboolean _sat_manager_handle_send_ss_result(struct custom_data *ctx, Tcor
 		result = FALSE;
 	}
 
-	if( q_data.cmd_data.send_ss.alpha_id.alpha_data_len && q_data.cmd_data.send_ss.alpha_id.is_exist )
-		sat_ui_support_terminate_sat_ui();
+	if( q_data->cmd_data.send_ss.alpha_id.alpha_data_len && q_data->cmd_data.send_ss.alpha_id.is_exist )
+		sat_manager_queue_ui_terminate(ctx);
 
 	return result;
 }
@@ -2398,13 +2417,13 @@ static gboolean _sat_manager_handle_send_ussd_result(struct custom_data *ctx, Tc
 
 	gint resp, ussd_problem;
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 	//call ctrl action, result data object, text, result2, text2
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -2422,16 +2441,16 @@ static gboolean _sat_manager_handle_send_ussd_result(struct custom_data *ctx, Tc
 	dbg("exec_result type_format(%s)", g_variant_get_type_string(exec_result));
 	g_variant_get(exec_result, "(ii)",&resp, &ussd_problem);
 
-	tr->cmd_number = q_data.cmd_data.send_ussd.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.send_ussd.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.send_ussd.command_detail, &q_data.cmd_data.send_ussd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
-	tr->terminal_rsp_data.send_ussd.device_id.src = q_data.cmd_data.send_ussd.device_id.dest;
-	tr->terminal_rsp_data.send_ussd.device_id.dest = q_data.cmd_data.send_ussd.device_id.src;
+	tr->cmd_number = q_data->cmd_data.send_ussd.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.send_ussd.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.send_ussd.command_detail, &q_data->cmd_data.send_ussd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->terminal_rsp_data.send_ussd.device_id.src = q_data->cmd_data.send_ussd.device_id.dest;
+	tr->terminal_rsp_data.send_ussd.device_id.dest = q_data->cmd_data.send_ussd.device_id.src;
 
 	switch (resp) {
 		case RESULT_SUCCESS:
 			tr->terminal_rsp_data.send_ussd.result_type = RESULT_SUCCESS;
-			if (q_data.cmd_data.send_ussd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
+			if (q_data->cmd_data.send_ussd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
 				tr->terminal_rsp_data.send_ussd.result_type = RESULT_SUCCESS_BUT_REQUESTED_ICON_NOT_DISPLAYED;
 
 			break;
@@ -2465,8 +2484,8 @@ static gboolean _sat_manager_handle_send_ussd_result(struct custom_data *ctx, Tc
 		result = FALSE;
 	}
 
-	if( q_data.cmd_data.send_ussd.alpha_id.alpha_data_len && q_data.cmd_data.send_ussd.alpha_id.is_exist )
-		sat_ui_support_terminate_sat_ui();
+	if( q_data->cmd_data.send_ussd.alpha_id.alpha_data_len && q_data->cmd_data.send_ussd.alpha_id.is_exist )
+		sat_manager_queue_ui_terminate(ctx);
 
 	return result;
 }
@@ -2478,12 +2497,12 @@ static gboolean _sat_manager_handle_setup_call_result(struct custom_data *ctx, T
 
 	gint resp, me_problem, cc_problem, call_cause;
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -2501,17 +2520,17 @@ static gboolean _sat_manager_handle_setup_call_result(struct custom_data *ctx, T
 	dbg("exec_result type_format(%s)", g_variant_get_type_string(exec_result));
 	g_variant_get(exec_result, "(iiii)",&resp, &me_problem, &cc_problem, &call_cause);
 
-	tr->cmd_number = q_data.cmd_data.setup_call.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.setup_call.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.setup_call.command_detail, &q_data.cmd_data.setup_call.command_detail, sizeof(struct tel_sat_cmd_detail_info));
-	tr->terminal_rsp_data.setup_call.device_id.src = q_data.cmd_data.setup_call.device_id.dest;
-	tr->terminal_rsp_data.setup_call.device_id.dest = q_data.cmd_data.setup_call.device_id.src;
+	tr->cmd_number = q_data->cmd_data.setup_call.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.setup_call.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.setup_call.command_detail, &q_data->cmd_data.setup_call.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->terminal_rsp_data.setup_call.device_id.src = q_data->cmd_data.setup_call.device_id.dest;
+	tr->terminal_rsp_data.setup_call.device_id.dest = q_data->cmd_data.setup_call.device_id.src;
 
 	switch (resp) {
 		case RESULT_SUCCESS:
 			tr->terminal_rsp_data.setup_call.result_type = RESULT_SUCCESS;
-			if (q_data.cmd_data.setup_call.call_setup_icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR ||
-					q_data.cmd_data.setup_call.call_setup_icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR )
+			if (q_data->cmd_data.setup_call.call_setup_icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR ||
+					q_data->cmd_data.setup_call.call_setup_icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR )
 				tr->terminal_rsp_data.setup_call.result_type = RESULT_SUCCESS_BUT_REQUESTED_ICON_NOT_DISPLAYED;
 			tr->terminal_rsp_data.setup_call.me_problem_type = ME_PROBLEM_NO_SPECIFIC_CAUSE;
 			tr->terminal_rsp_data.setup_call.cc_problem_type = CC_PROBLEM_NO_SPECIFIC_CAUSE;
@@ -2577,12 +2596,12 @@ static gboolean _sat_manager_handle_setup_idle_mode_text_result(struct custom_da
 
 	gint resp, me_problem;
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -2600,16 +2619,16 @@ static gboolean _sat_manager_handle_setup_idle_mode_text_result(struct custom_da
 	dbg("exec_result type_format(%s)", g_variant_get_type_string(exec_result));
 	g_variant_get(exec_result, "(ii)",&resp, &me_problem);
 
-	tr->cmd_number = q_data.cmd_data.idle_mode.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.idle_mode.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.setup_idle_mode_text.command_detail, &q_data.cmd_data.idle_mode.command_detail, sizeof(struct tel_sat_cmd_detail_info));
-	tr->terminal_rsp_data.setup_idle_mode_text.device_id.src = q_data.cmd_data.idle_mode.device_id.dest;
-	tr->terminal_rsp_data.setup_idle_mode_text.device_id.dest = q_data.cmd_data.idle_mode.device_id.src;
+	tr->cmd_number = q_data->cmd_data.idle_mode.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.idle_mode.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.setup_idle_mode_text.command_detail, &q_data->cmd_data.idle_mode.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->terminal_rsp_data.setup_idle_mode_text.device_id.src = q_data->cmd_data.idle_mode.device_id.dest;
+	tr->terminal_rsp_data.setup_idle_mode_text.device_id.dest = q_data->cmd_data.idle_mode.device_id.src;
 
 	switch (resp) {
 		case RESULT_SUCCESS:
 			tr->terminal_rsp_data.setup_idle_mode_text.result_type = RESULT_SUCCESS;
-			if (q_data.cmd_data.idle_mode.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
+			if (q_data->cmd_data.idle_mode.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
 				tr->terminal_rsp_data.setup_idle_mode_text.result_type = RESULT_SUCCESS_BUT_REQUESTED_ICON_NOT_DISPLAYED;
 
 			break;
@@ -2626,7 +2645,7 @@ static gboolean _sat_manager_handle_setup_idle_mode_text_result(struct custom_da
 		result = FALSE;
 	}
 
-	sat_ui_support_terminate_sat_ui();
+	sat_manager_queue_ui_terminate(ctx);
 
 	return result;
 }
@@ -2642,12 +2661,12 @@ static gboolean sat_manager_handle_open_channel_result(struct custom_data *ctx,
 	GVariant *desc_tmp, *bearer_desc;
 
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -2669,12 +2688,12 @@ static gboolean sat_manager_handle_open_channel_result(struct custom_data *ctx,
 
 	bearer_desc = g_variant_get_variant(desc_tmp);
 
-	tr->cmd_number = q_data.cmd_data.open_channel.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.open_channel.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.open_channel.command_detail, &q_data.cmd_data.open_channel.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->cmd_number = q_data->cmd_data.open_channel.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.open_channel.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.open_channel.command_detail, &q_data->cmd_data.open_channel.command_detail, sizeof(struct tel_sat_cmd_detail_info));
 
-	tr->terminal_rsp_data.open_channel.device_id.src = q_data.cmd_data.open_channel.device_id.dest;
-	tr->terminal_rsp_data.open_channel.device_id.dest = q_data.cmd_data.open_channel.device_id.src;
+	tr->terminal_rsp_data.open_channel.device_id.src = q_data->cmd_data.open_channel.device_id.dest;
+	tr->terminal_rsp_data.open_channel.device_id.dest = q_data->cmd_data.open_channel.device_id.src;
 
 	tr->terminal_rsp_data.open_channel.result_type = resp;
 	switch (resp) {
@@ -2774,12 +2793,12 @@ static gboolean sat_manager_handle_close_channel_result(struct custom_data *ctx,
 	gint resp, me_problem, bip_problem;
 
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -2797,12 +2816,12 @@ static gboolean sat_manager_handle_close_channel_result(struct custom_data *ctx,
 	dbg("exec_result type_format(%s)", g_variant_get_type_string(exec_result));
 	g_variant_get(exec_result, "(iii)",&resp, &me_problem, &bip_problem);
 
-	tr->cmd_number = q_data.cmd_data.close_channel.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.close_channel.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.close_channel.command_detail, &q_data.cmd_data.close_channel.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->cmd_number = q_data->cmd_data.close_channel.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.close_channel.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.close_channel.command_detail, &q_data->cmd_data.close_channel.command_detail, sizeof(struct tel_sat_cmd_detail_info));
 
 	tr->terminal_rsp_data.close_channel.device_id.src = DEVICE_ID_ME;
-	tr->terminal_rsp_data.close_channel.device_id.dest = q_data.cmd_data.close_channel.device_id.src;
+	tr->terminal_rsp_data.close_channel.device_id.dest = q_data->cmd_data.close_channel.device_id.src;
 
 	tr->terminal_rsp_data.close_channel.result_type = resp;
 	switch (resp) {
@@ -2846,12 +2865,12 @@ static gboolean sat_manager_handle_receive_data_result(struct custom_data *ctx,
 	GVariant *received_data;
 
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -2869,12 +2888,12 @@ static gboolean sat_manager_handle_receive_data_result(struct custom_data *ctx,
 	dbg("exec_result type_format(%s)", g_variant_get_type_string(exec_result));
 	g_variant_get(exec_result, "(iiiiibv)",&resp, &me_problem, &bip_problem, &data_str_len, &data_len, &other_info, &received_data);
 
-	tr->cmd_number = q_data.cmd_data.receive_data.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.receive_data.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.receive_data.command_detail, &q_data.cmd_data.receive_data.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->cmd_number = q_data->cmd_data.receive_data.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.receive_data.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.receive_data.command_detail, &q_data->cmd_data.receive_data.command_detail, sizeof(struct tel_sat_cmd_detail_info));
 
 	tr->terminal_rsp_data.receive_data.device_id.src = DEVICE_ID_ME;
-	tr->terminal_rsp_data.receive_data.device_id.dest = q_data.cmd_data.receive_data.device_id.src;
+	tr->terminal_rsp_data.receive_data.device_id.dest = q_data->cmd_data.receive_data.device_id.src;
 
 	tr->terminal_rsp_data.receive_data.result_type = resp;
 	switch (resp) {
@@ -2937,12 +2956,12 @@ static gboolean sat_manager_handle_send_data_result(struct custom_data *ctx, Tco
 	gint data_len;
 
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -2960,12 +2979,12 @@ static gboolean sat_manager_handle_send_data_result(struct custom_data *ctx, Tco
 	dbg("exec_result type_format(%s)", g_variant_get_type_string(exec_result));
 	g_variant_get(exec_result, "(iiii)",&resp, &me_problem, &bip_problem, &data_len);
 
-	tr->cmd_number = q_data.cmd_data.send_data.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.send_data.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.send_data.command_detail, &q_data.cmd_data.send_data.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->cmd_number = q_data->cmd_data.send_data.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.send_data.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.send_data.command_detail, &q_data->cmd_data.send_data.command_detail, sizeof(struct tel_sat_cmd_detail_info));
 
 	tr->terminal_rsp_data.send_data.device_id.src = DEVICE_ID_ME;
-	tr->terminal_rsp_data.send_data.device_id.dest = q_data.cmd_data.send_data.device_id.src;
+	tr->terminal_rsp_data.send_data.device_id.dest = q_data->cmd_data.send_data.device_id.src;
 
 	tr->terminal_rsp_data.send_data.result_type = resp;
 	switch (resp) {
@@ -3009,12 +3028,12 @@ static gboolean sat_manager_handle_get_channel_status_result(struct custom_data
 	gint channel_id, channel_status, channel_status_info;
 
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -3033,12 +3052,12 @@ static gboolean sat_manager_handle_get_channel_status_result(struct custom_data
 	g_variant_get(exec_result, "(iiiiii)",&resp, &me_problem, &bip_problem,
 			&channel_id, &channel_status, &channel_status_info);
 
-	tr->cmd_number = q_data.cmd_data.get_channel_status.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.get_channel_status.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.get_channel_status.command_detail, &q_data.cmd_data.get_channel_status.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->cmd_number = q_data->cmd_data.get_channel_status.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.get_channel_status.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.get_channel_status.command_detail, &q_data->cmd_data.get_channel_status.command_detail, sizeof(struct tel_sat_cmd_detail_info));
 
-	tr->terminal_rsp_data.get_channel_status.device_id.src = q_data.cmd_data.get_channel_status.device_id.dest;
-	tr->terminal_rsp_data.get_channel_status.device_id.dest = q_data.cmd_data.get_channel_status.device_id.src;
+	tr->terminal_rsp_data.get_channel_status.device_id.src = q_data->cmd_data.get_channel_status.device_id.dest;
+	tr->terminal_rsp_data.get_channel_status.device_id.dest = q_data->cmd_data.get_channel_status.device_id.src;
 
 	tr->terminal_rsp_data.get_channel_status.result_type = resp;
 	switch (resp) {
@@ -3081,12 +3100,12 @@ static gboolean sat_manager_handle_send_dtmf_result(struct custom_data *ctx, Tco
 	gboolean result = FALSE;
 
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -3118,12 +3137,12 @@ static gboolean sat_manager_handle_launch_browser_result(struct custom_data *ctx
 	gboolean result = FALSE;
 
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -3155,12 +3174,12 @@ static gboolean sat_manager_handle_provide_local_info_result(struct custom_data
 	gboolean result = FALSE;
 
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -3192,12 +3211,12 @@ static gboolean sat_manager_handle_language_notification_result(struct custom_da
 	gboolean result = FALSE;
 
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -3306,7 +3325,7 @@ gboolean sat_manager_handle_app_exec_result(struct custom_data *ctx, TcorePlugin
 			break;
 	}
 
-	sat_ui_support_terminate_sat_ui();
+	sat_manager_queue_ui_terminate(ctx);
 
 	return result;
 }
@@ -3318,12 +3337,12 @@ static gboolean _sat_manager_handle_menu_select_confirm(struct custom_data *ctx,
 
 	gint item_id;
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -3352,9 +3371,9 @@ static gboolean _sat_manager_handle_menu_select_confirm(struct custom_data *ctx,
 		g_variant_unref(inner_gv);
 	}
 
-	tr->cmd_number = q_data.cmd_data.selectItemInd.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.selectItemInd.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.select_item.command_detail, &q_data.cmd_data.selectItemInd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->cmd_number = q_data->cmd_data.selectItemInd.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.selectItemInd.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.select_item.command_detail, &q_data->cmd_data.selectItemInd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
 	tr->terminal_rsp_data.select_item.device_id.src = DEVICE_ID_ME;
 	tr->terminal_rsp_data.select_item.device_id.dest = DEVICE_ID_SIM;
 
@@ -3365,7 +3384,7 @@ static gboolean _sat_manager_handle_menu_select_confirm(struct custom_data *ctx,
 			tr->terminal_rsp_data.select_item.result_type = RESULT_SUCCESS;
 			tr->terminal_rsp_data.select_item.me_problem_type = ME_PROBLEM_NO_SPECIFIC_CAUSE;
 
-			if (q_data.cmd_data.selectItemInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
+			if (q_data->cmd_data.selectItemInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
 				tr->terminal_rsp_data.select_item.result_type = RESULT_SUCCESS_BUT_REQUESTED_ICON_NOT_DISPLAYED;
 
 			break;
@@ -3411,12 +3430,12 @@ static gboolean _sat_manager_handle_display_text_confirm(struct custom_data *ctx
 	gboolean result = FALSE;
 
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -3426,13 +3445,13 @@ static gboolean _sat_manager_handle_display_text_confirm(struct custom_data *ctx
 		return result;
 	}
 
-	if (q_data.cmd_data.displayTextInd.immediate_response_requested){
+	if (q_data->cmd_data.displayTextInd.immediate_response_requested){
 		return TRUE;
 	}
 
-	tr->cmd_number = q_data.cmd_data.displayTextInd.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.displayTextInd.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.display_text.command_detail, &q_data.cmd_data.displayTextInd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->cmd_number = q_data->cmd_data.displayTextInd.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.displayTextInd.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.display_text.command_detail, &q_data->cmd_data.displayTextInd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
 	tr->terminal_rsp_data.display_text.device_id.src = DEVICE_ID_ME;
 	tr->terminal_rsp_data.display_text.device_id.dest = DEVICE_ID_SIM;
 
@@ -3441,7 +3460,7 @@ static gboolean _sat_manager_handle_display_text_confirm(struct custom_data *ctx
 			tr->terminal_rsp_data.display_text.result_type = RESULT_SUCCESS;
 			tr->terminal_rsp_data.display_text.me_problem_type = ME_PROBLEM_NO_SPECIFIC_CAUSE;
 
-			if (q_data.cmd_data.displayTextInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
+			if (q_data->cmd_data.displayTextInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
 				tr->terminal_rsp_data.display_text.result_type = RESULT_SUCCESS_BUT_REQUESTED_ICON_NOT_DISPLAYED;
 		} break;
 
@@ -3452,7 +3471,7 @@ static gboolean _sat_manager_handle_display_text_confirm(struct custom_data *ctx
 		case USER_CONFIRM_TIMEOUT:
 			tr->terminal_rsp_data.display_text.result_type = RESULT_SUCCESS;
 
-			if (q_data.cmd_data.displayTextInd.command_detail.cmd_qualifier.display_text.text_clear_type == TEXT_WAIT_FOR_USER_TO_CLEAR_MSG )
+			if (q_data->cmd_data.displayTextInd.command_detail.cmd_qualifier.display_text.text_clear_type == TEXT_WAIT_FOR_USER_TO_CLEAR_MSG )
 				tr->terminal_rsp_data.display_text.result_type = RESULT_NO_RESPONSE_FROM_USER;
 
 			break;
@@ -3485,13 +3504,13 @@ static gboolean _sat_manager_handle_get_inkey_confirm(struct custom_data *ctx, T
 	gint inkey_data_len = 0;
 	gchar inkey_data[SAT_TEXT_STRING_LEN_MAX];
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 	memset(inkey_data, 0, SAT_TEXT_STRING_LEN_MAX);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
 		return result;
 	}
@@ -3521,9 +3540,9 @@ static gboolean _sat_manager_handle_get_inkey_confirm(struct custom_data *ctx, T
 		inkey_data_len = index;
 	}
 
-	tr->cmd_number = q_data.cmd_data.getInkeyInd.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.getInkeyInd.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.get_inkey.command_detail, &q_data.cmd_data.getInkeyInd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->cmd_number = q_data->cmd_data.getInkeyInd.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.getInkeyInd.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.get_inkey.command_detail, &q_data->cmd_data.getInkeyInd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
 	tr->terminal_rsp_data.get_inkey.device_id.src = DEVICE_ID_ME;
 	tr->terminal_rsp_data.get_inkey.device_id.dest = DEVICE_ID_SIM;
 
@@ -3531,10 +3550,10 @@ static gboolean _sat_manager_handle_get_inkey_confirm(struct custom_data *ctx, T
 		case USER_CONFIRM_YES:
 			tr->terminal_rsp_data.get_inkey.result_type = RESULT_SUCCESS;
 
-			if (q_data.cmd_data.getInkeyInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
+			if (q_data->cmd_data.getInkeyInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
 				tr->terminal_rsp_data.get_inkey.result_type = RESULT_SUCCESS_BUT_REQUESTED_ICON_NOT_DISPLAYED;
 
-			if (q_data.cmd_data.getInkeyInd.command_detail.cmd_qualifier.get_inkey.inkey_type == INKEY_TYPE_YES_NO_REQUESTED) {
+			if (q_data->cmd_data.getInkeyInd.command_detail.cmd_qualifier.get_inkey.inkey_type == INKEY_TYPE_YES_NO_REQUESTED) {
 				tr->terminal_rsp_data.get_inkey.text.dcs.m_class = MSG_CLASS_RESERVED;
 				tr->terminal_rsp_data.get_inkey.text.dcs.a_format = ALPHABET_FROMAT_8BIT_DATA;
 				tr->terminal_rsp_data.get_inkey.text.string_length = 1;
@@ -3544,7 +3563,7 @@ static gboolean _sat_manager_handle_get_inkey_confirm(struct custom_data *ctx, T
 			{
 				tr->terminal_rsp_data.get_inkey.text.string_length = inkey_data_len;
 
-				if (!q_data.cmd_data.getInkeyInd.command_detail.cmd_qualifier.get_inkey.alphabet_set){
+				if (!q_data->cmd_data.getInkeyInd.command_detail.cmd_qualifier.get_inkey.alphabet_set){
 					tr->terminal_rsp_data.get_inkey.text.is_digit_only = TRUE;
 					tr->terminal_rsp_data.get_inkey.text.dcs.a_format = ALPHABET_FROMAT_8BIT_DATA;
 					tr->terminal_rsp_data.get_inkey.text.dcs.m_class = MSG_CLASS_RESERVED;
@@ -3555,7 +3574,7 @@ static gboolean _sat_manager_handle_get_inkey_confirm(struct custom_data *ctx, T
 				{
 					tr->terminal_rsp_data.get_inkey.text.dcs.m_class = MSG_CLASS_RESERVED;
 
-					if(q_data.cmd_data.getInkeyInd.command_detail.cmd_qualifier.get_inkey.alphabet_type == INPUT_ALPHABET_TYPE_SMS_DEFAULT )
+					if(q_data->cmd_data.getInkeyInd.command_detail.cmd_qualifier.get_inkey.alphabet_type == INPUT_ALPHABET_TYPE_SMS_DEFAULT )
 					{
 						int tmp_len;
 						char tmp_str[SAT_TEXT_STRING_LEN_MAX + 1], *packed_data;
@@ -3570,7 +3589,7 @@ static gboolean _sat_manager_handle_get_inkey_confirm(struct custom_data *ctx, T
 
 						if (packed_data) g_free(packed_data);
 					}
-					else if(q_data.cmd_data.getInkeyInd.command_detail.cmd_qualifier.get_inkey.alphabet_type == INPUT_ALPHABET_TYPE_UCS2 )
+					else if(q_data->cmd_data.getInkeyInd.command_detail.cmd_qualifier.get_inkey.alphabet_type == INPUT_ALPHABET_TYPE_UCS2 )
 					{
 						dbg("UCS2 DATA");
 
@@ -3595,7 +3614,7 @@ static gboolean _sat_manager_handle_get_inkey_confirm(struct custom_data *ctx, T
 		case USER_CONFIRM_NO_OR_CANCEL:
 			tr->terminal_rsp_data.get_inkey.result_type = RESULT_BACKWARD_MOVE_BY_USER;
 
-			if (q_data.cmd_data.getInkeyInd.command_detail.cmd_qualifier.get_inkey.inkey_type == INKEY_TYPE_YES_NO_REQUESTED) {
+			if (q_data->cmd_data.getInkeyInd.command_detail.cmd_qualifier.get_inkey.inkey_type == INKEY_TYPE_YES_NO_REQUESTED) {
 				tr->terminal_rsp_data.get_inkey.result_type = RESULT_SUCCESS;
 				tr->terminal_rsp_data.get_inkey.text.dcs.m_class = MSG_CLASS_RESERVED;
 				tr->terminal_rsp_data.get_inkey.text.dcs.a_format = ALPHABET_FROMAT_8BIT_DATA;
@@ -3606,9 +3625,9 @@ static gboolean _sat_manager_handle_get_inkey_confirm(struct custom_data *ctx, T
 
 		case USER_CONFIRM_TIMEOUT:
 			tr->terminal_rsp_data.get_inkey.result_type = RESULT_NO_RESPONSE_FROM_USER;
-			if (q_data.cmd_data.getInkeyInd.duration.time_interval > 0){
-				tr->terminal_rsp_data.get_inkey.duration.time_interval = q_data.cmd_data.getInkeyInd.duration.time_interval;
-				tr->terminal_rsp_data.get_inkey.duration.time_unit = q_data.cmd_data.getInkeyInd.duration.time_unit;
+			if (q_data->cmd_data.getInkeyInd.duration.time_interval > 0){
+				tr->terminal_rsp_data.get_inkey.duration.time_interval = q_data->cmd_data.getInkeyInd.duration.time_interval;
+				tr->terminal_rsp_data.get_inkey.duration.time_unit = q_data->cmd_data.getInkeyInd.duration.time_unit;
 			}
 			break;
 
@@ -3639,21 +3658,19 @@ static gboolean _sat_manager_handle_get_input_confirm(struct custom_data *ctx, T
 	gint input_data_len = 0;
 	gchar input_data[SAT_TEXT_STRING_LEN_MAX];
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 	memset(input_data, 0, SAT_TEXT_STRING_LEN_MAX);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
-		g_free(tr);
 		return result;
 	}
 
 	if (!plg){
 		dbg("there is no valid plugin at this point");
-		g_free(tr);
 		return result;
 	}
 
@@ -3677,9 +3694,9 @@ static gboolean _sat_manager_handle_get_input_confirm(struct custom_data *ctx, T
 		input_data_len = index;
 	}
 
-	tr->cmd_number = q_data.cmd_data.getInputInd.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.getInputInd.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.get_input.command_detail, &q_data.cmd_data.getInputInd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->cmd_number = q_data->cmd_data.getInputInd.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.getInputInd.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.get_input.command_detail, &q_data->cmd_data.getInputInd.command_detail, sizeof(struct tel_sat_cmd_detail_info));
 	tr->terminal_rsp_data.get_input.device_id.src = DEVICE_ID_ME;
 	tr->terminal_rsp_data.get_input.device_id.dest = DEVICE_ID_SIM;
 
@@ -3688,14 +3705,14 @@ static gboolean _sat_manager_handle_get_input_confirm(struct custom_data *ctx, T
 			tr->terminal_rsp_data.get_input.result_type = RESULT_SUCCESS;
 			tr->terminal_rsp_data.get_input.text.dcs.m_class = MSG_CLASS_RESERVED;
 
-			if(!q_data.cmd_data.getInputInd.command_detail.cmd_qualifier.get_input.alphabet_set){
+			if(!q_data->cmd_data.getInputInd.command_detail.cmd_qualifier.get_input.alphabet_set){
 				tr->terminal_rsp_data.get_input.text.is_digit_only = TRUE;
 			}
 
-			if (q_data.cmd_data.getInputInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
+			if (q_data->cmd_data.getInputInd.icon_id.icon_info.ics == IMAGE_CODING_SCHEME_COLOUR)
 				tr->terminal_rsp_data.get_input.result_type = RESULT_SUCCESS_BUT_REQUESTED_ICON_NOT_DISPLAYED;
 
-			if(!q_data.cmd_data.getInputInd.command_detail.cmd_qualifier.get_input.user_input_unpacked_format){
+			if(!q_data->cmd_data.getInputInd.command_detail.cmd_qualifier.get_input.user_input_unpacked_format){
 				dbg("[SAT] packing to SMS7 default");
 
 				tr->terminal_rsp_data.get_input.text.string_length = 0;
@@ -3720,14 +3737,14 @@ static gboolean _sat_manager_handle_get_input_confirm(struct custom_data *ctx, T
 			{
 				dbg("[SAT] packing not required");
 
-				if(q_data.cmd_data.getInkeyInd.command_detail.cmd_qualifier.get_input.alphabet_type == INPUT_ALPHABET_TYPE_SMS_DEFAULT){
+				if(q_data->cmd_data.getInkeyInd.command_detail.cmd_qualifier.get_input.alphabet_type == INPUT_ALPHABET_TYPE_SMS_DEFAULT){
 
 					tr->terminal_rsp_data.get_input.text.dcs.a_format = ALPHABET_FROMAT_8BIT_DATA;
 					sat_mgr_convert_utf8_to_gsm((unsigned char*)tr->terminal_rsp_data.get_input.text.string,
 							&tr->terminal_rsp_data.get_input.text.string_length, (unsigned char*)input_data, input_data_len);
 
 				}
-				else if(q_data.cmd_data.getInkeyInd.command_detail.cmd_qualifier.get_input.alphabet_type == INPUT_ALPHABET_TYPE_UCS2 ){
+				else if(q_data->cmd_data.getInkeyInd.command_detail.cmd_qualifier.get_input.alphabet_type == INPUT_ALPHABET_TYPE_UCS2 ){
 
 					tr->terminal_rsp_data.get_input.text.dcs.a_format = ALPHABET_FROMAT_UCS2;
 					sat_mgr_convert_utf8_to_ucs2((unsigned char*)tr->terminal_rsp_data.get_input.text.string,
@@ -3778,21 +3795,19 @@ static gboolean _sat_manager_handle_setup_call_confirm(struct custom_data *ctx,
 	gint input_data_len = 0;
 	gchar input_data[SAT_TEXT_STRING_LEN_MAX];
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 	memset(input_data, 0, SAT_TEXT_STRING_LEN_MAX);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
-		g_free(tr);
 		return result;
 	}
 
 	if (!plg){
 		dbg("there is no valid plugin at this point");
-		g_free(tr);
 		return result;
 	}
 
@@ -3816,11 +3831,11 @@ static gboolean _sat_manager_handle_setup_call_confirm(struct custom_data *ctx,
 		input_data_len = index;
 	}
 
-	tr->cmd_number = q_data.cmd_data.setup_call.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.setup_call.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.setup_call.command_detail, &q_data.cmd_data.setup_call.command_detail, sizeof(struct tel_sat_cmd_detail_info));
-	tr->terminal_rsp_data.setup_call.device_id.src = q_data.cmd_data.setup_call.device_id.dest;
-	tr->terminal_rsp_data.setup_call.device_id.dest = q_data.cmd_data.setup_call.device_id.src;
+	tr->cmd_number = q_data->cmd_data.setup_call.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.setup_call.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.setup_call.command_detail, &q_data->cmd_data.setup_call.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->terminal_rsp_data.setup_call.device_id.src = q_data->cmd_data.setup_call.device_id.dest;
+	tr->terminal_rsp_data.setup_call.device_id.dest = q_data->cmd_data.setup_call.device_id.src;
 
 	switch(confirm_type){
 		case USER_CONFIRM_YES:{
@@ -3847,7 +3862,7 @@ static gboolean _sat_manager_handle_setup_call_confirm(struct custom_data *ctx,
 			object = g_hash_table_lookup(ctx->objects, path);
 			sat = telephony_object_peek_sat(TELEPHONY_OBJECT(object));
 
-			setup_call = sat_manager_setup_call_noti(ctx, plg_name, &q_data.cmd_data.setup_call);
+			setup_call = sat_manager_setup_call_noti(ctx, plg_name, &q_data->cmd_data.setup_call);
 
 			dbg("setup call type_format(%s)", g_variant_get_type_string(setup_call));
 			g_variant_get(setup_call, "(isi@visi)", &command_id, &text, &text_len, &icon_id, &call_type, &call_number, &duration);
@@ -3855,7 +3870,7 @@ static gboolean _sat_manager_handle_setup_call_confirm(struct custom_data *ctx,
 			telephony_sat_emit_setup_call(sat, command_id, text, text_len, call_type,
 					call_number, duration);
 
-			sat_ui_support_launch_call_application(q_data.cmd_data.setup_call.command_detail.cmd_type, setup_call);
+			sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_call_application, q_data->cmd_data.setup_call.command_detail.cmd_type, setup_call);
 			return TRUE;
 		}break;
 
@@ -3891,28 +3906,26 @@ static gboolean _sat_manager_handle_send_dtmf_confirm(struct custom_data *ctx, T
 	gboolean result = FALSE;
 
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
-		g_free(tr);
 		return result;
 	}
 
 	if (!plg){
 		dbg("there is no valid plugin at this point");
-		g_free(tr);
 		return result;
 	}
 
-	tr->cmd_number = q_data.cmd_data.send_dtmf.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.send_dtmf.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.send_dtmf.command_detail, &q_data.cmd_data.send_dtmf.command_detail, sizeof(struct tel_sat_cmd_detail_info));
-	tr->terminal_rsp_data.send_dtmf.device_id.src = q_data.cmd_data.send_dtmf.device_id.dest;
-	tr->terminal_rsp_data.send_dtmf.device_id.dest = q_data.cmd_data.send_dtmf.device_id.src;
+	tr->cmd_number = q_data->cmd_data.send_dtmf.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.send_dtmf.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.send_dtmf.command_detail, &q_data->cmd_data.send_dtmf.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->terminal_rsp_data.send_dtmf.device_id.src = q_data->cmd_data.send_dtmf.device_id.dest;
+	tr->terminal_rsp_data.send_dtmf.device_id.dest = q_data->cmd_data.send_dtmf.device_id.src;
 
 	dbg("confirm_type[%d]", confirm_type);
 
@@ -3943,28 +3956,26 @@ static gboolean _sat_manager_handle_launch_browser_confirm(struct custom_data *c
 	gboolean result = FALSE;
 
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
-		g_free(tr);
 		return result;
 	}
 
 	if (!plg){
 		dbg("there is no valid plugin at this point");
-		g_free(tr);
 		return result;
 	}
 
-	tr->cmd_number = q_data.cmd_data.launch_browser.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.launch_browser.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.launch_browser.command_detail, &q_data.cmd_data.launch_browser.command_detail, sizeof(struct tel_sat_cmd_detail_info));
-	tr->terminal_rsp_data.launch_browser.device_id.src = q_data.cmd_data.launch_browser.device_id.dest;
-	tr->terminal_rsp_data.launch_browser.device_id.dest = q_data.cmd_data.launch_browser.device_id.src;
+	tr->cmd_number = q_data->cmd_data.launch_browser.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.launch_browser.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.launch_browser.command_detail, &q_data->cmd_data.launch_browser.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->terminal_rsp_data.launch_browser.device_id.src = q_data->cmd_data.launch_browser.device_id.dest;
+	tr->terminal_rsp_data.launch_browser.device_id.dest = q_data->cmd_data.launch_browser.device_id.src;
 
 	dbg("confirm_type[%d]", confirm_type);
 
@@ -3996,14 +4007,14 @@ static gboolean _sat_manager_handle_launch_browser_confirm(struct custom_data *c
 			object = g_hash_table_lookup(ctx->objects, path);
 			sat = telephony_object_peek_sat(TELEPHONY_OBJECT(object));
 
-			launch_browser = sat_manager_launch_browser_noti(ctx, plg_name, &q_data.cmd_data.launch_browser);
+			launch_browser = sat_manager_launch_browser_noti(ctx, plg_name, &q_data->cmd_data.launch_browser);
 
 			dbg("launch_browser type_format(%s)", g_variant_get_type_string(launch_browser));
 			g_variant_get(launch_browser, "(iisisisi@v)", &command_id, &browser_id, &url, &url_len, &gateway_proxy, &gateway_proxy_len, &text, &text_len, &icon_id);
 
 			telephony_sat_emit_launch_browser(sat, command_id, browser_id, url, url_len, gateway_proxy, gateway_proxy_len, text, text_len);
 
-			sat_ui_support_launch_browser_application(q_data.cmd_data.launch_browser.command_detail.cmd_type, launch_browser);
+			sat_manager_queue_ui_launch(ctx, sat_ui_support_launch_browser_application, q_data->cmd_data.launch_browser.command_detail.cmd_type, launch_browser);
 			return TRUE;
 		}break;
 
@@ -4035,28 +4046,26 @@ static gboolean _sat_manager_handle_open_channel_confirm(struct custom_data *ctx
 	gboolean result = FALSE;
 
 	struct treq_sat_terminal_rsp_data *tr;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command dequeue failed. didn't find in command Q!!");
-		g_free(tr);
 		return result;
 	}
 
 	if (!plg){
 		dbg("there is no valid plugin at this point");
-		g_free(tr);
 		return result;
 	}
 
-	tr->cmd_number = q_data.cmd_data.open_channel.command_detail.cmd_num;
-	tr->cmd_type = q_data.cmd_data.open_channel.command_detail.cmd_type;
-	memcpy((void*)&tr->terminal_rsp_data.open_channel.command_detail, &q_data.cmd_data.open_channel.command_detail, sizeof(struct tel_sat_cmd_detail_info));
-	tr->terminal_rsp_data.open_channel.device_id.src = q_data.cmd_data.send_dtmf.device_id.dest;
-	tr->terminal_rsp_data.open_channel.device_id.dest = q_data.cmd_data.send_dtmf.device_id.src;
+	tr->cmd_number = q_data->cmd_data.open_channel.command_detail.cmd_num;
+	tr->cmd_type = q_data->cmd_data.open_channel.command_detail.cmd_type;
+	memcpy((void*)&tr->terminal_rsp_data.open_channel.command_detail, &q_data->cmd_data.open_channel.command_detail, sizeof(struct tel_sat_cmd_detail_info));
+	tr->terminal_rsp_data.open_channel.device_id.src = q_data->cmd_data.send_dtmf.device_id.dest;
+	tr->terminal_rsp_data.open_channel.device_id.dest = q_data->cmd_data.send_dtmf.device_id.src;
 
 	dbg("confirm_type[%d]", confirm_type);
 
@@ -4090,7 +4099,7 @@ static gboolean _sat_manager_handle_open_channel_confirm(struct custom_data *ctx
 			object = g_hash_table_lookup(ctx->objects, path);
 			sat = telephony_object_peek_sat(TELEPHONY_OBJECT(object));
 
-			open_channel = sat_manager_open_channel_noti(ctx, plg_name, &q_data.cmd_data.open_channel);
+			open_channel = sat_manager_open_channel_noti(ctx, plg_name, &q_data->cmd_data.open_channel);
 
 			dbg("open channel type_format(%s)", g_variant_get_type_string(open_channel));
 			g_variant_get(open_channel,"(isi@vbbbi@viiiis@v)", &command_id, &text, &text_len, &icon_id, &immediate_link, &auto_reconnection, &bg_mode,
@@ -4111,8 +4120,8 @@ static gboolean _sat_manager_handle_open_channel_confirm(struct custom_data *ctx
 			break;
 	}
 
-	memcpy((void*)&tr->terminal_rsp_data.open_channel.bearer_desc, &q_data.cmd_data.open_channel.bearer_desc, sizeof(struct tel_sat_bearer_description));
-	memcpy((void*)&tr->terminal_rsp_data.open_channel.buffer_size, &q_data.cmd_data.open_channel.buffer_size, sizeof(struct tel_sat_buffer_size));
+	memcpy((void*)&tr->terminal_rsp_data.open_channel.bearer_desc, &q_data->cmd_data.open_channel.bearer_desc, sizeof(struct tel_sat_bearer_description));
+	memcpy((void*)&tr->terminal_rsp_data.open_channel.buffer_size, &q_data->cmd_data.open_channel.buffer_size, sizeof(struct tel_sat_buffer_size));
 
 	result = TRUE;
 	rv = sat_manager_send_terminal_response(ctx->comm, plg, tr);
@@ -4126,9 +4135,8 @@ static gboolean _sat_manager_handle_open_channel_confirm(struct custom_data *ctx
 
 gboolean sat_manager_handle_user_confirm(struct custom_data *ctx, TcorePlugin *plg, GVariant *user_confirm_data)
 {
-	gboolean rv = FALSE;
 	gboolean result = FALSE;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
 	gint command_id, command_type, confirm_type;
 	GVariant *additional_data = NULL;
@@ -4138,13 +4146,13 @@ gboolean sat_manager_handle_user_confirm(struct custom_data *ctx, TcorePlugin *p
 
 	dbg("[SAT] user confirm data command id(%d), confirm_type(%d)", command_id, confirm_type);
 
-	rv = sat_manager_queue_peek_data_by_id(ctx, &q_data, command_id);
-	if(!rv){
+	q_data = sat_manager_queue_peek_data_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] no commands in queue");
 		return result;
 	}
 
-	command_type = (gint)q_data.cmd_type;
+	command_type = (gint)q_data->cmd_type;
 	dbg("[SAT] command type(%d)", command_type);
 
 	switch(command_type){
@@ -4199,7 +4207,7 @@ static gboolean _sat_manager_handle_play_tone_ui_display_status(struct custom_da
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT] fail to show ui display for play tone");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 
 		tr->cmd_number = q_data->cmd_data.play_tone.command_detail.cmd_num;
 		tr->cmd_type = q_data->cmd_data.play_tone.command_detail.cmd_type;
@@ -4256,7 +4264,7 @@ static gboolean _sat_manager_handle_send_sms_ui_display_status(struct custom_dat
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT] fail to show ui display for send sms");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 
 		tr->cmd_number = q_data->cmd_data.sendSMSInd.command_detail.cmd_num;
 		tr->cmd_type = q_data->cmd_data.sendSMSInd.command_detail.cmd_type;
@@ -4314,7 +4322,7 @@ static gboolean _sat_manager_handle_send_ss_ui_display_status(struct custom_data
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT] fail to show ui display for send ss");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 
 		tr->cmd_number = q_data->cmd_data.send_ss.command_detail.cmd_num;
 		tr->cmd_type = q_data->cmd_data.send_ss.command_detail.cmd_type;
@@ -4370,7 +4378,7 @@ static gboolean _sat_manager_handle_send_ussd_ui_display_status(struct custom_da
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT] fail to show ui display for send ussd");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 
 		tr->cmd_number = q_data->cmd_data.send_ussd.command_detail.cmd_num;
 		tr->cmd_type = q_data->cmd_data.send_ussd.command_detail.cmd_type;
@@ -4414,7 +4422,7 @@ static gboolean _sat_manager_handle_setup_idle_mode_text_ui_display_status(struc
 
 	struct treq_sat_terminal_rsp_data *tr;
 
-	tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+	tr = _sat_terminal_rsp_data(ctx, plg);
 
 	if (!plg){
 		dbg("there is no valid plugin at this point");
@@ -4444,7 +4452,7 @@ static gboolean _sat_manager_handle_setup_idle_mode_text_ui_display_status(struc
 		result = FALSE;
 	}
 
-	sat_ui_support_terminate_sat_ui();
+	sat_manager_queue_ui_terminate(ctx);
 
 	return result;
 }
@@ -4495,7 +4503,7 @@ static gboolean _sat_manager_handle_send_dtmf_ui_display_status(struct custom_da
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT] fail to show ui display for send_dtmf");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 
 		tr->cmd_number = q_data->cmd_data.send_dtmf.command_detail.cmd_num;
 		tr->cmd_type = q_data->cmd_data.send_dtmf.command_detail.cmd_type;
@@ -4553,7 +4561,7 @@ static gboolean _sat_manager_handle_open_channel_ui_display_status(struct custom
 		struct treq_sat_terminal_rsp_data *tr = NULL;
 		dbg("[SAT] fail to show ui display for open channel");
 
-		tr = (struct treq_sat_terminal_rsp_data *)calloc(1, sizeof(struct treq_sat_terminal_rsp_data));
+		tr = _sat_terminal_rsp_data(ctx, plg);
 
 		tr->cmd_number = q_data->cmd_data.open_channel.command_detail.cmd_num;
 		tr->cmd_type = q_data->cmd_data.open_channel.command_detail.cmd_type;
@@ -4594,12 +4602,12 @@ static gboolean _sat_manager_handle_open_channel_ui_display_status(struct custom
 gboolean sat_manager_handle_ui_display_status(struct custom_data *ctx, TcorePlugin *plg, gint command_id, gboolean display_status)
 {
 	gboolean result = FALSE;
-	struct sat_manager_queue_data q_data;
+	struct sat_manager_queue_data *q_data = NULL;
 
 	dbg("[SAT] ui display status : command id(%d) display status(%d)", command_id, display_status);
-	memset(&q_data, 0, sizeof(struct sat_manager_queue_data));
 
-	if (sat_manager_dequeue_cmd_by_id(ctx, &q_data, command_id) == FALSE) {
+	q_data = sat_manager_dequeue_cmd_by_id(ctx, command_id);
+	if (!q_data) {
 		dbg("[SAT] command peek data from queue is failed. didn't find in command Q!!");
 		return result;
 	}
@@ -4609,33 +4617,33 @@ gboolean sat_manager_handle_ui_display_status(struct custom_data *ctx, TcorePlug
 		return result;
 	}
 
-	switch(q_data.cmd_type){
+	switch(q_data->cmd_type){
 		case SAT_PROATV_CMD_PLAY_TONE:
-			result = _sat_manager_handle_play_tone_ui_display_status(ctx, plg, &q_data, display_status);
+			result = _sat_manager_handle_play_tone_ui_display_status(ctx, plg, q_data, display_status);
 			break;
 		case SAT_PROATV_CMD_SEND_SMS:
-			result = _sat_manager_handle_send_sms_ui_display_status(ctx, plg, &q_data, display_status);
+			result = _sat_manager_handle_send_sms_ui_display_status(ctx, plg, q_data, display_status);
 			break;
 		case SAT_PROATV_CMD_SEND_SS:
-			result = _sat_manager_handle_send_ss_ui_display_status(ctx, plg, &q_data, display_status);
+			result = _sat_manager_handle_send_ss_ui_display_status(ctx, plg, q_data, display_status);
 			break;
 		case SAT_PROATV_CMD_SEND_USSD:
-			result = _sat_manager_handle_send_ussd_ui_display_status(ctx, plg, &q_data, display_status);
+			result = _sat_manager_handle_send_ussd_ui_display_status(ctx, plg, q_data, display_status);
 			break;
 		case SAT_PROATV_CMD_SETUP_IDLE_MODE_TEXT:
-			result = _sat_manager_handle_setup_idle_mode_text_ui_display_status(ctx, plg, &q_data, display_status);
+			result = _sat_manager_handle_setup_idle_mode_text_ui_display_status(ctx, plg, q_data, display_status);
 			break;
 		case SAT_PROATV_CMD_REFRESH:
-			result = _sat_manager_handle_refresh_ui_display_status(ctx, plg, &q_data, display_status);
+			result = _sat_manager_handle_refresh_ui_display_status(ctx, plg, q_data, display_status);
 			break;
 		case SAT_PROATV_CMD_SEND_DTMF:
-			result = _sat_manager_handle_send_dtmf_ui_display_status(ctx, plg, &q_data, display_status);
+			result = _sat_manager_handle_send_dtmf_ui_display_status(ctx, plg, q_data, display_status);
 			break;
 		case SAT_PROATV_CMD_OPEN_CHANNEL:
-			result = _sat_manager_handle_open_channel_ui_display_status(ctx, plg, &q_data, display_status);
+			result = _sat_manager_handle_open_channel_ui_display_status(ctx, plg, q_data, display_status);
 			break;
 		default:
-			dbg("[SAT] cannot handle ui display status command(0x%x)", q_data.cmd_type);
+			dbg("[SAT] cannot handle ui display status command(0x%x)", q_data->cmd_type);
 			break;
 	}
 
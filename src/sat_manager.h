@@ -39,10 +39,33 @@ struct sat_manager_queue_data {
 	sat_manager_proactive_data cmd_data; /**<Proactive Cmd Ind Info*/
 };
 
+#define SAT_DEF_CMD_Q_MAX 10
+
+/* command ids wrap on a multiple of the capacity so id -> slot stays stable */
+#define SAT_MANAGER_QUEUE_ID_WRAP ((G_MAXINT / SAT_DEF_CMD_Q_MAX) * SAT_DEF_CMD_Q_MAX)
+
+/**
+ * Fixed capacity command queue. A command lives in slot
+ * (cmd_id % SAT_DEF_CMD_Q_MAX) until it is dequeued; the stored cmd_id
+ * is checked on lookup so a stale id never matches a newer command.
+ */
+struct sat_manager_queue {
+	struct sat_manager_queue_data slots[SAT_DEF_CMD_Q_MAX];
+	gboolean used[SAT_DEF_CMD_Q_MAX];
+	guint count;
+	int next_id;
+};
+
 
 /*================================================================================================*/
 
 void sat_manager_init_queue(struct custom_data *ctx);
+void sat_manager_free_queue(struct custom_data *ctx);
+
+//sat ui launches, run by the launcher thread
+typedef gboolean (*sat_manager_ui_launch_func)(enum tel_sat_proactive_cmd_type cmd_type, GVariant *data);
+void sat_manager_queue_ui_launch(struct custom_data *ctx, sat_manager_ui_launch_func launch, enum tel_sat_proactive_cmd_type cmd_type, GVariant *data);
+void sat_manager_queue_ui_terminate(struct custom_data *ctx);
 
 //application request handling
 gboolean sat_manager_handle_user_confirm(struct custom_data *ctx, TcorePlugin *plg, GVariant *user_confirm_data);
@@ -77,7 +100,7 @@ GVariant* sat_manager_language_notification_noti(struct custom_data *ctx, const
 
 void sat_mgr_convert_utf8_to_gsm(unsigned char *dest, int *dest_len, unsigned char* src, unsigned int src_len);
 void sat_mgr_convert_utf8_to_ucs2(unsigned char* dest, int* dest_len,	unsigned char* src, int src_len);
-void sat_mgr_convert_string(unsigned char *dest, unsigned short *dest_len,
+void sat_mgr_convert_string(unsigned char *dest, int dest_size, unsigned short *dest_len,
 		enum alphabet_format dcs, unsigned char *src, unsigned short src_len);
 
 #endif /* SAT_MANAGER_H_ */
@@ -4,52 +4,198 @@
 #include <string.h>
 #include <assert.h>
 
-#include <iconv.h>
 #include <glib.h>
 
 #include "sat_manager.h"
+#include "sat_gsm.h"
 #include "util.h"
 
-#define	tabGsmUniMax2 9
-#define	tabGsmUniMax 42
+#define GSM_ESCAPE 0x1B
 
-static void _convert_gsm_to_utf8(unsigned char *dest, unsigned short *dest_len,	unsigned char *src, unsigned int src_len);
+/* reverse table values: 0 is unmapped, the high byte tells which GSM table */
+#define GSM_REVERSE_DEFAULT 0x0100
+#define GSM_REVERSE_EXT (GSM_ESCAPE << 8)
+#define GSM_REVERSE_PAGES 4
+
+static void _convert_gsm_to_utf8(unsigned char *dest, int dest_size, unsigned short *dest_len, unsigned char *src, unsigned int src_len);
 
 static gboolean _convert_gsm_to_unicode(unsigned short *dest, int dest_len, unsigned char *src, unsigned int src_len);
 static gboolean _convert_unicode_to_gsm(unsigned char* dest, int dest_len, unsigned short* src, int src_len);
 
-static char* _convert_ucs_to_utf8(unsigned char *src, int src_len);
+static int _convert_ucs2_to_utf8(char *dest, int dest_size, const unsigned char *src, int src_units, int byte_order);
 static int _convert_utf8_to_unicode(unsigned short* dest, unsigned char* src, unsigned int src_len);
 
 static unsigned short* _convert_process_unicode(unsigned short *dest, int dest_buf_len,	unsigned char *src, unsigned long src_len);
 
-static int _convert_ucs2_to_gsm(unsigned char* dest, unsigned short* src, unsigned int src_len);
-static int _convert_gsm_to_ucs2(unsigned short* dest, unsigned char* src, unsigned int src_len);
-
-static gboolean _find_gsm_code_exception_table(unsigned short src);
-static int _get_gsm_code_size(unsigned short* src, int src_len);
 static unsigned short* _swap_byte_order(unsigned short *dest, unsigned short *src, int len);
 
-typedef struct {
-	char gsm;
-	unsigned short unicode;
-} GsmUniTable;
-
-const GsmUniTable gsm_unicode2_table[] = {
-		{ 0x14, 0x005E }, { 0x28, 0x007B }, { 0x29, 0x007D }, { 0x2F, 0x005C },
-		{ 0x3C, 0x005B }, { 0x3D, 0x007E }, { 0x3E, 0x005D }, { 0x40, 0x007C },
-		{ 0x65, 0x20AC } };
-
-const GsmUniTable gsm_unicode_table[] = {
-		{ 0x00, 0x0040 }, { 0x01, 0x00A3 }, { 0x02, 0x0024 }, { 0x03, 0x00A5 },
-		{ 0x04, 0x00E8 }, { 0x05, 0x00E9 }, { 0x06, 0x00F9 }, { 0x07, 0x00EC }, { 0x08, 0x00F2 },
-		{ 0x09, 0x00E7 }, { 0x0B, 0x00D8 }, { 0x0C, 0x00F8 }, { 0x0E, 0x00C5 }, { 0x0F, 0x00E5 },
-		{ 0x10, 0x0394 }, { 0x11, 0x005F }, { 0x12, 0x03A6 }, { 0x13, 0x0393 }, { 0x14, 0x039B },
-		{ 0x15, 0x03A9 }, { 0x16, 0x03A0 }, { 0x17, 0x03A8 }, { 0x18, 0x03A3 }, { 0x19,	0x0398 },
-		{ 0x1A, 0x039E }, { 0x1C, 0x00C6 }, { 0x1D, 0x00E6 }, { 0x1E, 0x00DF }, { 0x1F, 0x00C9 },
-		{ 0x24, 0x00A4 }, { 0x40, 0x00A1 }, { 0x5B, 0x00C4 }, { 0x5C, 0x00D6 }, { 0x5D, 0x00D1 },
-		{ 0x5E, 0x00DC }, { 0x5F, 0x00A7 }, { 0x60, 0x00BF }, { 0x7B, 0x00E4 }, { 0x7C, 0x00F6 },
-		{ 0x7D, 0x00F1 }, { 0x7E, 0x00FC }, { 0x7F, 0x00E0 }, };
+/* GSM 03.38 default alphabet, indexed by GSM code */
+static const unsigned short gsm_to_ucs2_table[128] = {
+	0x0040, 0x00A3, 0x0024, 0x00A5, 0x00E8, 0x00E9, 0x00F9, 0x00EC,
+	0x00F2, 0x00E7, 0x000A, 0x00D8, 0x00F8, 0x000D, 0x00C5, 0x00E5,
+	0x0394, 0x005F, 0x03A6, 0x0393, 0x039B, 0x03A9, 0x03A0, 0x03A8,
+	0x03A3, 0x0398, 0x039E, 0x001B, 0x00C6, 0x00E6, 0x00DF, 0x00C9,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x00A4, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x00A1, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005A, 0x00C4, 0x00D6, 0x00D1, 0x00DC, 0x00A7,
+	0x00BF, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x007A, 0x00E4, 0x00F6, 0x00F1, 0x00FC, 0x00E0,
+};
+
+/* GSM 03.38 extension table (after GSM_ESCAPE), unassigned codes read as space */
+static const unsigned short gsm_ext_to_ucs2_table[128] = {
+	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+	0x0020, 0x0020, 0x0020, 0x0020, 0x005E, 0x0020, 0x0020, 0x0020,
+	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+	0x007B, 0x007D, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x005C,
+	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+	0x0020, 0x0020, 0x0020, 0x0020, 0x005B, 0x007E, 0x005D, 0x0020,
+	0x007C, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x20AC, 0x0020, 0x0020,
+	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+};
+
+/*
+ * UCS2 -> GSM, two levels: the high byte of the UCS2 code selects one
+ * of the few pages that hold GSM characters, the low byte the entry.
+ * Built once from the tables above.
+ */
+static unsigned char ucs2_to_gsm_index[256];
+static unsigned short ucs2_to_gsm_pages[GSM_REVERSE_PAGES][256];
+
+static void _gsm_reverse_add(unsigned short ucs2, unsigned short value)
+{
+	static unsigned int pages_used = 0;
+	unsigned short *page;
+
+	if (!ucs2_to_gsm_index[ucs2 >> 8]) {
+		g_assert(pages_used < GSM_REVERSE_PAGES);
+		ucs2_to_gsm_index[ucs2 >> 8] = ++pages_used;
+	}
+
+	page = ucs2_to_gsm_pages[ucs2_to_gsm_index[ucs2 >> 8] - 1];
+	if (!page[ucs2 & 0xFF])
+		page[ucs2 & 0xFF] = value;
+}
+
+static void _gsm_reverse_init(void)
+{
+	static gsize initialized = 0;
+	unsigned int i;
+
+	if (!g_once_init_enter(&initialized))
+		return;
+
+	for (i = 0; i < G_N_ELEMENTS(gsm_to_ucs2_table); i++) {
+		if (i != GSM_ESCAPE)
+			_gsm_reverse_add(gsm_to_ucs2_table[i], GSM_REVERSE_DEFAULT | i);
+	}
+
+	for (i = 0; i < G_N_ELEMENTS(gsm_ext_to_ucs2_table); i++) {
+		if (gsm_ext_to_ucs2_table[i] != 0x0020)
+			_gsm_reverse_add(gsm_ext_to_ucs2_table[i], GSM_REVERSE_EXT | i);
+	}
+
+	g_once_init_leave(&initialized, 1);
+}
+
+static unsigned short _gsm_reverse_lookup(unsigned short ucs2)
+{
+	unsigned char page = ucs2_to_gsm_index[ucs2 >> 8];
+
+	if (!page)
+		return 0;
+
+	return ucs2_to_gsm_pages[page - 1][ucs2 & 0xFF];
+}
+
+int sat_mgr_convert_gsm_to_ucs2(unsigned short *dest, const unsigned char *src, unsigned int src_len)
+{
+	const unsigned char *end = src + src_len;
+	unsigned short *org = dest;
+
+	while (src < end) {
+		if (*src != GSM_ESCAPE) {
+			/* codes above 0x7F are not GSM, they are passed through */
+			*dest++ = (*src < 0x80) ? gsm_to_ucs2_table[*src] : *src;
+			src++;
+			continue;
+		}
+
+		src++;
+		if (src < end) {
+			*dest++ = (*src < 0x80) ? gsm_ext_to_ucs2_table[*src] : 0x0020;
+			src++;
+		} else {
+			*dest++ = 0x0020;
+		}
+	}
+
+	return dest - org;
+}
+
+int sat_mgr_get_gsm_code_size(const unsigned short *src, int src_len)
+{
+	unsigned short code;
+	int gsm_len = 0;
+
+	if (NULL == src) {
+		dbg( "INPUT PARAM was NULL");
+		return -1;
+	}
+
+	_gsm_reverse_init();
+
+	for (; src_len > 0; src_len--, src++) {
+		code = _gsm_reverse_lookup(*src);
+		if (!code) {
+			dbg( "GSM Char[%d], gsm_len[%d]", *src, gsm_len);
+			return -1;
+		}
+		gsm_len += ((code >> 8) == GSM_ESCAPE) ? 2 : 1;
+	}
+
+	return gsm_len;
+}
+
+int sat_mgr_convert_ucs2_to_gsm(unsigned char *dest, const unsigned short *src, unsigned int src_len)
+{
+	unsigned char *rear = dest;
+	unsigned short code;
+
+	if ((!dest) || (!src) || (0x00 == src_len)) {
+		dbg( "Warning: Wrong Input");
+		return -1;
+	}
+
+	_gsm_reverse_init();
+
+	for (; src_len > 0; src_len--, src++) {
+		code = _gsm_reverse_lookup(*src);
+		if (!code)
+			return -1;
+
+		if ((code >> 8) == GSM_ESCAPE)
+			*rear++ = GSM_ESCAPE;
+		*rear++ = code & 0xFF;
+	}
+
+	return rear - dest;
+}
 
 static int _convert_utf8_to_unicode(unsigned short* dest, unsigned char* src, unsigned int src_len)
 {
@@ -98,128 +244,6 @@ static int _convert_utf8_to_unicode(unsigned short* dest, unsigned char* src, un
 	return (dest - org);
 }
 
-static gboolean _find_gsm_code_exception_table(unsigned short src)
-{
-	if ((src >= 0x0020 && src <= 0x0023)
-			|| (src >= 0x0025 && src <= 0x003F)
-			|| (src >= 0x0041 && src <= 0x005A)
-			|| (src >= 0x0061 && src <= 0x007A)
-			|| src == 0x000A || src == 0x000D)
-		return TRUE;
-	return FALSE;
-}
-
-static int _get_gsm_code_size(unsigned short* src, int src_len)
-{
-	gboolean in_table = FALSE;
-	gboolean in_sec_table = FALSE;
-	int i, gsm_len = 0;
-
-	if (NULL == src) {
-		dbg( "INPUT PARAM was NULL");
-		return -1;
-	}
-
-	for (; src_len > 0 && src; src_len--) {
-		if (_find_gsm_code_exception_table(*src) == TRUE) {
-			src++;
-			gsm_len++;
-			continue;
-		}
-		in_table = FALSE;
-		for (i = 0; i < tabGsmUniMax; i++) {
-			if (*src == gsm_unicode_table[i].unicode) {
-				src++;
-				in_table = TRUE;
-				gsm_len++;
-				break;
-			}
-		}
-		if (in_table == FALSE) {
-			in_sec_table = FALSE;
-			for (i = 0; i < tabGsmUniMax2; i++) {/* second table */
-				if (*src == gsm_unicode2_table[i].unicode) {
-					src++;
-					in_table = TRUE;
-					in_sec_table = TRUE;
-					gsm_len += 2;
-					break;
-				}
-			}
-			if (in_sec_table == FALSE) {/* second*/
-				if (_find_gsm_code_exception_table(*src) == FALSE) {
-					dbg( "GSM Char[%d], gsm_len[%d]", *src, gsm_len);
-					return -1;
-				}
-				src++;
-				gsm_len++;
-			}
-		}
-	}
-	return gsm_len;
-}
-
-static int _convert_ucs2_to_gsm(unsigned char* dest, unsigned short* src, unsigned int src_len)
-{
-	unsigned char* rear = NULL;
-	unsigned short* p;
-	unsigned char temp;
-	gboolean in_table = FALSE;
-	gboolean in_sec_table = FALSE;
-	int i, gc_len = 0;
-
-	if ((!dest) || (!src) || (0x00 == src_len)) {
-		dbg( "Warning: Wrong Input");
-		return -1;
-	}
-
-	rear = dest;
-	p = src;
-
-	for (; src_len > 0 && p; src_len--) {
-		in_table = FALSE;
-		for (i = 0; i < tabGsmUniMax; i++) { /* is in table  */
-			if (*p == gsm_unicode_table[i].unicode) {
-				temp = (unsigned char) (gsm_unicode_table[i].gsm);
-				*rear = temp;
-				rear++;
-				p++;
-				in_table = TRUE;
-				gc_len++;
-				break;
-			}
-		}
-		if (in_table == FALSE) {
-			in_sec_table = FALSE;
-			for (i = 0; i < tabGsmUniMax2; i++) { /* second table*/
-				if (*p == gsm_unicode2_table[i].unicode) {
-					*rear = 0x1B;
-					rear++;
-					temp = (unsigned char) (gsm_unicode2_table[i].gsm);
-					*rear = temp;
-					rear++;
-					p++;
-					in_table = TRUE;
-					in_sec_table = TRUE;
-					gc_len += 2;
-					break;
-				}
-			}
-			if (in_sec_table == FALSE) { /* second */
-				if (_find_gsm_code_exception_table(*p) == FALSE)
-					return -1;
-				temp = (unsigned char) (*p); /* isn't in table */
-				*rear = temp;
-				rear++;
-				p++;
-				gc_len++;
-			}
-		}
-	}
-	src = p;
-	return gc_len;
-}
-
 static gboolean _convert_unicode_to_gsm(unsigned char* dest, int dest_len, unsigned short* src, int src_len)
 {
 	char* tmp_str;
@@ -233,7 +257,7 @@ static gboolean _convert_unicode_to_gsm(unsigned char* dest, int dest_len, unsig
 	if (src_len == 0)
 		return FALSE;
 
-	gc_len = _get_gsm_code_size(src, src_len);
+	gc_len = sat_mgr_get_gsm_code_size(src, src_len);
 	if (0 >= gc_len) {
 		dbg( "Warning: Error[%d] while finding the GSM Code Size", gc_len);
 		return FALSE;
@@ -254,7 +278,7 @@ static gboolean _convert_unicode_to_gsm(unsigned char* dest, int dest_len, unsig
 		return FALSE;
 	}
 
-	gc_len = _convert_ucs2_to_gsm((unsigned char*) tmp_str, src, src_len);
+	gc_len = sat_mgr_convert_ucs2_to_gsm((unsigned char*) tmp_str, src, src_len);
 	if (gc_len != -1) {
 		memcpy((char*) dest, (char*) tmp_str, gc_len);
 		free(tmp_str);
@@ -293,7 +317,7 @@ void sat_mgr_convert_utf8_to_gsm(unsigned char *dest, int *dest_len, unsigned ch
 	}
 
 	/*Finding the GSMCode Size*/
-	gc_len = _get_gsm_code_size(uc, uc_len);
+	gc_len = sat_mgr_get_gsm_code_size(uc, uc_len);
 	dbg( "gc_len:[%d]", gc_len);
 	if ( gc_len == -1) {
 		dbg( "SM- DATA is not in GSM7BIT Character Set & Error:[%d]",	gc_len);
@@ -361,63 +385,131 @@ void sat_mgr_convert_utf8_to_ucs2(unsigned char* dest, int* dest_len,	unsigned c
 	return;
 }
 
-static int _convert_ucs2_to_utf8(char *out, unsigned short *out_len, char *in, unsigned short in_len)
+/* UTF-8 length of one code point, dest must have room for 4 bytes */
+static int _put_utf8(unsigned char *dest, unsigned int cp)
+{
+	if (cp < 0x80) {
+		dest[0] = cp;
+		return 1;
+	}
+
+	if (cp < 0x800) {
+		dest[0] = 0xC0 | (cp >> 6);
+		dest[1] = 0x80 | (cp & 0x3F);
+		return 2;
+	}
+
+	if (cp < 0x10000) {
+		dest[0] = 0xE0 | (cp >> 12);
+		dest[1] = 0x80 | ((cp >> 6) & 0x3F);
+		dest[2] = 0x80 | (cp & 0x3F);
+		return 3;
+	}
+
+	dest[0] = 0xF0 | (cp >> 18);
+	dest[1] = 0x80 | ((cp >> 12) & 0x3F);
+	dest[2] = 0x80 | ((cp >> 6) & 0x3F);
+	dest[3] = 0x80 | (cp & 0x3F);
+	return 4;
+}
+
+#define UCS2_UNIT(p, be) ((be) ? (((p)[0] << 8) | (p)[1]) : (((p)[1] << 8) | (p)[0]))
+#define UCS2_ASCII_RUN 8
+
+/*
+ * Encodes src_units UCS2 (UTF-16, surrogate pairs are joined) code units
+ * stored in byte_order (G_BIG_ENDIAN or G_LITTLE_ENDIAN) into dest.
+ * Stops before a character that does not fit, always NUL terminates and
+ * returns the number of bytes written. Nothing is allocated.
+ */
+static int _convert_ucs2_to_utf8(char *dest, int dest_size, const unsigned char *src, int src_units, int byte_order)
 {
-	char *p_o = NULL;
-	size_t src_len = in_len;
-	size_t dest_len = in_len*3;
-	short *dest = NULL;
-	short *src = NULL;
-	int i = 0;
-
-	iconv_t cd = iconv_open("UTF-8", "UCS2");
-	if (cd == (iconv_t) (-1)) {
-		perror("iconv_open");
+	unsigned char *d = (unsigned char *)dest;
+	unsigned char *end;
+	unsigned char tmp[4];
+	unsigned char hi, lo;
+	gboolean be = (byte_order == G_BIG_ENDIAN);
+	unsigned int cp, next;
+	int i, k, len;
+
+	if (!dest || dest_size <= 0)
+		return 0;
+
+	end = d + dest_size - 1;
+
+	if (!src) {
+		*d = '\0';
 		return 0;
 	}
-//For byte swap - start
-	src = (short*)malloc(in_len);
-	memcpy(src, in, in_len);
-	dest = (short*)malloc(in_len);
-    memset(dest, 0, in_len);
-    for(i=0; i<in_len/2; i++){
-        dest[i] = ((src[i] << 8) + (src[i] >> 8));
-    }
-    memcpy(in, dest, in_len);
-    free(dest);
-    free(src);
- //For byte swap - end
-
-	p_o = out;
-
-	dbg("expected input bytes:%d dest_len:%d\n", src_len, dest_len);
-
-	if (iconv(cd, &in, &src_len, &p_o, &dest_len) == (size_t)(-1)) {
-		dbg("failed to iconv errno:%d", errno);
-	} else {
-		dbg("remained input bytes:%d processed bytes:%d", src_len, in_len*3-dest_len);
-		out[in_len*3-dest_len] = '\0';
+
+	i = 0;
+	while (i < src_units) {
+		/* ASCII fast path: a whole run of units below 0x80 maps 1:1 */
+		if (src_units - i >= UCS2_ASCII_RUN && end - d >= UCS2_ASCII_RUN) {
+			const unsigned char *p = src + i * 2;
+
+			hi = lo = 0;
+			for (k = 0; k < UCS2_ASCII_RUN; k++) {
+				hi |= p[k * 2 + (be ? 0 : 1)];
+				lo |= p[k * 2 + (be ? 1 : 0)];
+			}
+
+			if (hi == 0 && lo < 0x80) {
+				for (k = 0; k < UCS2_ASCII_RUN; k++)
+					d[k] = p[k * 2 + (be ? 1 : 0)];
+				d += UCS2_ASCII_RUN;
+				i += UCS2_ASCII_RUN;
+				continue;
+			}
+		}
+
+		cp = UCS2_UNIT(src + i * 2, be);
+		i++;
+
+		if (cp >= 0xD800 && cp <= 0xDBFF && i < src_units) {
+			next = UCS2_UNIT(src + i * 2, be);
+			if (next >= 0xDC00 && next <= 0xDFFF) {
+				cp = 0x10000 + ((cp - 0xD800) << 10) + (next - 0xDC00);
+				i++;
+			}
+		}
+
+		/* unpaired surrogate */
+		if (cp >= 0xD800 && cp <= 0xDFFF)
+			cp = 0xFFFD;
+
+		len = _put_utf8(tmp, cp);
+		if (end - d < len)
+			break;
+
+		memcpy(d, tmp, len);
+		d += len;
 	}
-	*out_len = in_len*3-dest_len;
-	dbg("out_len[%d], output[%s]", *out_len, out);
-	iconv_close(cd);
-	return 0;
+
+	*d = '\0';
+
+	return d - (unsigned char *)dest;
 }
 
-void sat_mgr_convert_string(unsigned char *dest, unsigned short *dest_len,
+/*
+ * Converts a SIM string in dcs to UTF-8. dest_size is the capacity of
+ * dest: the result is cut at a character boundary to fit and is always
+ * NUL terminated.
+ */
+void sat_mgr_convert_string(unsigned char *dest, int dest_size, unsigned short *dest_len,
 		enum alphabet_format dcs, unsigned char *src, unsigned short src_len)
 {
-	int tmp_str_len = 0;
+	int tmp_str_len = 0, ucs2_len = 0;
 	unsigned char* tmp_dest_str = dest;
 	unsigned short* in_buf = NULL;
 
 	/*get string length*/
 	/* 0xFF is the end of string */
-	while (src[tmp_str_len] != 0xFF && tmp_str_len < src_len) {
+	while (tmp_str_len < src_len && src[tmp_str_len] != 0xFF) {
 		tmp_str_len++;
 	}
 	/* last space character must be deleted */
-	while (src[tmp_str_len - 1] == 0x20 && tmp_str_len > 0) {
+	while (tmp_str_len > 0 && src[tmp_str_len - 1] == 0x20) {
 		tmp_str_len--;
 	}
 
@@ -427,17 +519,23 @@ void sat_mgr_convert_string(unsigned char *dest, unsigned short *dest_len,
 	switch (dcs) {
 		case ALPHABET_FROMAT_SMS_DEFAULT:
 			tmp_dest_str = (unsigned char*)tcore_util_unpack_gsm7bit((const unsigned char *)src, src_len);
-			_convert_gsm_to_utf8(dest, dest_len, tmp_dest_str, strlen((const char*)tmp_dest_str));
+			if (!tmp_dest_str) {
+				dbg( "[SAT] Error:unpack failed");
+				return;
+			}
+			_convert_gsm_to_utf8(dest, dest_size, dest_len, tmp_dest_str, strlen((const char*)tmp_dest_str));
+			free(tmp_dest_str);
 			break;
 
 		case ALPHABET_FROMAT_8BIT_DATA:
-			_convert_gsm_to_utf8(dest, dest_len, src, tmp_str_len);
+			_convert_gsm_to_utf8(dest, dest_size, dest_len, src, tmp_str_len);
 			break;
 
 		case ALPHABET_FROMAT_UCS2:{
 			if (src[0] == 0x80) {
 				dbg("UCS2:[0x%2x] prefix case", src[0]);
-				_convert_ucs2_to_utf8((char*) dest, dest_len, (char*) (src + 1), src_len - 1);
+				*dest_len = _convert_ucs2_to_utf8((char*) dest, dest_size,
+						src + 1, (src_len - 1) / 2, G_BIG_ENDIAN);
 			} else if (src[0] == 0x81 || src[0] == 0x82) {
 				dbg("UCS2:[0x%2x] prefix case", src[0]);
 				*dest_len = tmp_str_len;
@@ -448,27 +546,18 @@ void sat_mgr_convert_string(unsigned char *dest, unsigned short *dest_len,
 				}
 				_convert_process_unicode(in_buf, (tmp_str_len * sizeof(unsigned short) + 1), src,
 						tmp_str_len);
-				dest = (unsigned char*) _convert_ucs_to_utf8((unsigned char *) in_buf, tmp_str_len);
-				if (in_buf) free(in_buf);
-
-				if (!dest) {
-					dbg( "[SAT] WARNING: dest str is NULL");
-					return;
-				}
-				memcpy(tmp_dest_str, dest, SAT_TEXT_STRING_LEN_MAX);
+				for (ucs2_len = 0; ucs2_len < tmp_str_len && in_buf[ucs2_len]; ucs2_len++)
+					;
+				_convert_ucs2_to_utf8((char*) dest, dest_size, (unsigned char *) in_buf,
+						ucs2_len, G_BYTE_ORDER);
+				free(in_buf);
 
-				if (tmp_dest_str != dest) {
-					dbg( "[SAT] destination string address changed hence freeing");
-					free(dest);
-					dest = NULL;
-				}
-				dbg( "[SAT] string[%s]", dest);
-				dbg( "[SAT] out put string[%s]", tmp_dest_str);
-				dbg( "[SAT] string pointer after parsing dcs[0x%x]", dest);
+				dbg( "[SAT] out put string[%s]", dest);
 				dbg( "[SAT] string length[%d]", *dest_len);
 			} else {
 				dbg("UCS2: no prefix case");
-				_convert_ucs2_to_utf8((char*) dest, dest_len, (char*) src, src_len);
+				*dest_len = _convert_ucs2_to_utf8((char*) dest, dest_size,
+						src, src_len / 2, G_BIG_ENDIAN);
 			}
 		}
 			break;
@@ -480,65 +569,14 @@ void sat_mgr_convert_string(unsigned char *dest, unsigned short *dest_len,
 
 }
 
-static int _convert_gsm_to_ucs2(unsigned short* dest, unsigned char* src, unsigned int src_len)
-{
-	int index;
-	unsigned short* org;
-
-	org = dest;
-
-	for(index=0; index < (int)src_len; index++){
-		int table_index=0;
-		gboolean b_tabled = FALSE;
-
-		/*
-		 * if the first byte is 0x1B, it is the escape character.
-		 * The byte value shoulbe be changed to unicode.
-		 */
-		if(*src == 0x1B){
-			src++; index++;//move to next byte
-			for(table_index=0; table_index < tabGsmUniMax2; table_index++){
-				if(*src == gsm_unicode2_table[table_index].gsm){
-					*dest = gsm_unicode2_table[table_index].unicode;
-					b_tabled = TRUE;
-					break;
-				}
-			}
-
-			//if matched data is not in table, it should be changed to NULL;
-			if(!b_tabled){
-				*dest = 0x0020;
-			}
-		}
-		else{
-			for(table_index=0; table_index < tabGsmUniMax; table_index++){
-				if(*src == gsm_unicode_table[table_index].gsm){
-					*dest = gsm_unicode_table[table_index].unicode;
-					b_tabled = TRUE;
-					break;
-				}
-			}
-
-			//if matched data is not in table, it is using original value;
-			if(!b_tabled){
-				*dest = *src;
-			}
-		}
-
-		//move to next position
-		src++; dest++;
-	}
-
-	dbg("[SAT] cvt sr(%s), the size of data (%d) ", org, dest - org);
-	return (dest - org);
-}
-
 static gboolean _convert_gsm_to_unicode(unsigned short *dest, int dest_len, unsigned char *src, unsigned int src_len)
 {
-	int index, tmp_len;
+	int tmp_len;
+	int chars = 0;
+	unsigned int i = 0;
 
-	if(!dest || !src) {
-		dbg( "[SAT] dest(%p) or src(%p) is null",dest, src);
+	if(!dest || !src || dest_len < 1) {
+		dbg( "[SAT] dest(%p), src(%p) or dest_len(%d) is invalid",dest, src, dest_len);
 		return FALSE;
 	}
 
@@ -549,84 +587,38 @@ static gboolean _convert_gsm_to_unicode(unsigned short *dest, int dest_len, unsi
 
 	dbg("[SAT] source string (%s) len(%d)", src, src_len);
 
-	for(index = 0; index < (int)src_len; index++){
-		if(src[index] == 0x1B)
-			src_len--;
+	/* cut src at a character boundary so at most dest_len - 1 are written */
+	while (i < src_len && chars < dest_len - 1) {
+		i += (src[i] == GSM_ESCAPE) ? 2 : 1;
+		chars++;
+	}
+	if (i < src_len) {
+		dbg("[SAT] truncated to %d characters", chars);
+		src_len = i;
 	}
-	dbg("[SAT] strlen excluding escape character (%d)", src_len);
 
-	tmp_len = _convert_gsm_to_ucs2(dest, src, src_len);
+	tmp_len = sat_mgr_convert_gsm_to_ucs2(dest, src, src_len);
 	dest[tmp_len] = '\0';
 
 	return TRUE;
 }
 
-static char* _convert_ucs_to_utf8(unsigned char* src, int src_len)
-{
-	char* utf_str = NULL;
-	iconv_t cd = NULL;
-	size_t ileft = 0;
-	size_t oleft = 0;
-	int err = 0;
-
-	char* pIn = NULL;
-	char* in_buf = NULL;
-	char* out_buf = NULL;
-
-	if (!src) {
-		dbg("src is null");
-		return NULL;
-	}
-
-	ileft = src_len * 2;//over allocate as utf-8 may occupy 3 bytes
-	oleft = src_len * 3;//over allocate as utf-8 may occupy 3 bytes
-	pIn = in_buf = (char*) malloc(ileft + 2);
-	utf_str = out_buf = (char *) malloc(oleft + 1);
-
-	memset(in_buf, 0x00, ileft + 2);
-	memset(out_buf, 0x00, oleft + 1);
-	memcpy(in_buf, src, ileft);
-
-	in_buf[ileft] = '\0';
-
-	cd = iconv_open("UTF-8", "UCS-2");
-	err = iconv(cd, (char**) &in_buf, &ileft, &out_buf, &oleft);
-
-	utf_str[src_len * 2 - ileft] = '\0';
-	iconv_close(cd);
-	free(pIn);
-	return utf_str;
-}
-
-static void _convert_gsm_to_utf8(unsigned char* dest, unsigned short* dest_len, unsigned char* src, unsigned int src_len)
+static void _convert_gsm_to_utf8(unsigned char* dest, int dest_size, unsigned short* dest_len, unsigned char* src, unsigned int src_len)
 {
 	int tmp_len = 0;
-	char *target_tmp = NULL;
-	unsigned char *raw_unicode = NULL;
 	unsigned short tmp_dest[SAT_TEXT_STRING_LEN_MAX];
 
-	memset(tmp_dest, 0 , SAT_TEXT_STRING_LEN_MAX);
+	memset(tmp_dest, 0 , sizeof(tmp_dest));
 
-	_convert_gsm_to_unicode(tmp_dest, SAT_TEXT_STRING_LEN_MAX, src, src_len);
+	/* the 7-bit unpack can be longer than tmp_dest, it is cut to fit */
+	_convert_gsm_to_unicode(tmp_dest, G_N_ELEMENTS(tmp_dest), src, src_len);
 	while(tmp_dest[tmp_len] != '\0')
 		tmp_len++;
-	tmp_len++; // add null character
-
-	tmp_len = tmp_len*2; //for byte align
-	raw_unicode = (unsigned char*)malloc(tmp_len);
-	memset(raw_unicode, 0, tmp_len);
-
-	memcpy(raw_unicode, (unsigned char*)tmp_dest, tmp_len);
 
-	*dest_len = tmp_len;
-	target_tmp = _convert_ucs_to_utf8(raw_unicode, tmp_len);
-	if(!target_tmp){
-		dbg( "str is NULL");
-		return;
-	}
+	_convert_ucs2_to_utf8((char*) dest, dest_size, (unsigned char*) tmp_dest, tmp_len, G_BYTE_ORDER);
 
-	memcpy(dest, target_tmp, strlen((const char*)target_tmp));
-	dbg("final utf8 str (%s), length (%d)", dest, tmp_len);
+	*dest_len = (tmp_len + 1) * 2; //for byte align
+	dbg("final utf8 str (%s), length (%d)", dest, *dest_len);
 	return;
 }
 
@@ -63,7 +63,7 @@ static gboolean dbus_sim_data_request(struct custom_data *ctx, enum tel_sim_stat
 				dbg("req - TREQ_SIM_GET_ECC ");
 				ur = tcore_user_request_new(ctx->comm, tcore_plugin_get_description(plugin)->name);
 				tcore_user_request_set_command(ur, TREQ_SIM_GET_ECC);
-				tcore_communicator_dispatch_request(ctx->comm, ur);
+				dbus_plugin_dispatch_request(ctx, ur);
 				ctx->sim_recv_first_status = TRUE;
 			}
 			break;
@@ -74,6 +74,239 @@ static gboolean dbus_sim_data_request(struct custom_data *ctx, enum tel_sim_stat
 	return TRUE;
 }
 
+static const enum tcore_request_command sim_cache_requests[DBUS_SIM_CACHE_MAX] = {
+	TREQ_SIM_GET_ICCID,
+	TREQ_SIM_GET_MSISDN,
+	TREQ_SIM_GET_SPN,
+	TREQ_SIM_GET_CPHS_INFO,
+	TREQ_SIM_GET_ATR,
+};
+
+static void _sim_complete_cached(TelephonySim *sim, GDBusMethodInvocation *invocation,
+		enum dbus_sim_cache_item item, const void *data)
+{
+	const struct tresp_sim_read *resp_read = data;
+	const struct tresp_sim_get_atr *resp_get_atr = data;
+	int i;
+
+	switch (item) {
+		case DBUS_SIM_CACHE_ICCID:
+			dbg("result[%d], iccid[%s]", resp_read->result, resp_read->data.iccid.iccid);
+			telephony_sim_complete_get_iccid(sim, invocation,
+					resp_read->result,
+					resp_read->data.iccid.iccid);
+			break;
+
+		case DBUS_SIM_CACHE_MSISDN: {
+			GVariant *gv = NULL;
+			GVariantBuilder b;
+			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+
+			for(i=0;i < resp_read->data.msisdn_list.count; i++){
+				g_variant_builder_open(&b,G_VARIANT_TYPE("a{sv}"));
+				g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string((const gchar *)resp_read->data.msisdn_list.msisdn[i].name));
+				g_variant_builder_add(&b, "{sv}", "number", g_variant_new_string((const gchar *)resp_read->data.msisdn_list.msisdn[i].num));
+				g_variant_builder_close(&b);
+			}
+			gv = g_variant_builder_end(&b);
+
+			telephony_sim_complete_get_msisdn (sim, invocation,
+					resp_read->result,
+					gv);
+			g_variant_unref(gv);
+		}
+			break;
+
+		case DBUS_SIM_CACHE_SPN:
+			telephony_sim_complete_get_spn (sim, invocation,
+					resp_read->result,
+					resp_read->data.spn.display_condition, (const gchar *)resp_read->data.spn.spn);
+			break;
+
+		case DBUS_SIM_CACHE_CPHS_INFO:
+			telephony_sim_complete_get_cphsinfo (sim, invocation,
+					resp_read->result,
+					resp_read->data.cphs.CphsPhase,
+					resp_read->data.cphs.CphsServiceTable.bOperatorNameShortForm,
+					resp_read->data.cphs.CphsServiceTable.bMailBoxNumbers,
+					resp_read->data.cphs.CphsServiceTable.bServiceStringTable,
+					resp_read->data.cphs.CphsServiceTable.bCustomerServiceProfile,
+					resp_read->data.cphs.CphsServiceTable.bInformationNumbers);
+			break;
+
+		case DBUS_SIM_CACHE_ATR: {
+			GVariantBuilder *builder = NULL;
+			GVariant * atr_gv = NULL;
+			GVariant *inner_gv = NULL;
+
+			builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
+			for(i = 0; i < (int)resp_get_atr->atr_length; i++) {
+				g_variant_builder_add (builder, "y", resp_get_atr->atr[i]);
+			}
+			inner_gv = g_variant_builder_end(builder);
+			g_variant_builder_unref (builder);
+			atr_gv = g_variant_new("v", inner_gv);
+
+			telephony_sim_complete_get_atr(sim, invocation,
+					resp_get_atr->result,
+					atr_gv);
+		}
+			break;
+
+		default:
+			break;
+	}
+}
+
+static void _sim_cache_fail_waiters(struct dbus_sim_cache *cache, enum dbus_sim_cache_item item)
+{
+	GSList *l;
+
+	for (l = cache->waiters[item]; l; l = l->next)
+		g_dbus_method_invocation_return_error(l->data, G_DBUS_ERROR, G_DBUS_ERROR_FAILED,
+				"request (0x%x) failed", sim_cache_requests[item]);
+
+	g_slist_free(cache->waiters[item]);
+	cache->waiters[item] = NULL;
+}
+
+/* the request still completes its own caller, but no longer feeds the cache */
+static void _sim_cache_detach(struct dbus_sim_cache *cache, enum dbus_sim_cache_item item)
+{
+	if (cache->in_flight[item]) {
+		cache->in_flight[item]->batch = NULL;
+		cache->in_flight[item] = NULL;
+	}
+
+	_sim_cache_fail_waiters(cache, item);
+}
+
+/* free hook: the request went away without a response */
+static void _sim_cache_abort(struct dbus_request_info *dbus_info)
+{
+	struct dbus_sim_cache *cache = dbus_info->batch;
+
+	err("sim cache item[%u] request freed without a response", dbus_info->batch_index);
+	_sim_cache_detach(cache, dbus_info->batch_index);
+}
+
+/*
+ * Serve a static SIM item from the per-modem cache. On a miss only the
+ * first caller goes to the modem, later callers wait for its response.
+ */
+static gboolean _sim_cache_request(struct custom_data *ctx, TelephonySim *sim,
+		GDBusMethodInvocation *invocation, enum dbus_sim_cache_item item)
+{
+	struct dbus_modem_context *modem = dbus_plugin_ref_modem_by_interface(sim);
+	struct dbus_sim_cache *cache = modem ? &modem->sim_cache : NULL;
+	struct dbus_request_info *dbus_info;
+	UserRequest *ur = NULL;
+	TReturn ret;
+
+	if (cache) {
+		if (cache->data[item]) {
+			cache->hit++;
+			dbg("sim cache hit item[%d] (hit[%lu] miss[%lu])", item, cache->hit, cache->miss);
+			_sim_complete_cached(sim, invocation, item, cache->data[item]);
+			return TRUE;
+		}
+
+		cache->miss++;
+
+		if (cache->in_flight[item]) {
+			cache->coalesced++;
+			dbg("sim cache item[%d] in flight, waiting (coalesced[%lu])", item, cache->coalesced);
+			cache->waiters[item] = g_slist_append(cache->waiters[item], invocation);
+			return TRUE;
+		}
+	}
+
+	ur = MAKE_UR(ctx, sim, invocation);
+	dbus_info = dbus_plugin_ref_request_info(ur);
+
+	if (cache) {
+		dbus_info->batch = cache;
+		dbus_info->batch_index = item;
+		dbus_info->batch_abort = _sim_cache_abort;
+		cache->in_flight[item] = dbus_info;
+	}
+
+	tcore_user_request_set_command(ur, sim_cache_requests[item]);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
+	if (ret != TCORE_RETURN_SUCCESS) {
+		err("dispatch failed for sim cache item[%d] (ret: 0x%x)", item, ret);
+		if (cache)
+			_sim_cache_detach(cache, item);
+		tcore_user_request_unref(ur);
+
+		g_dbus_method_invocation_return_error(invocation, G_DBUS_ERROR, G_DBUS_ERROR_FAILED,
+				"request (0x%x) dispatch failed", sim_cache_requests[item]);
+	}
+
+	return TRUE;
+}
+
+static void _sim_cache_response(struct dbus_modem_context *modem, struct dbus_request_info *dbus_info,
+		enum dbus_sim_cache_item item, gint result, const void *data, unsigned int data_len)
+{
+	struct dbus_sim_cache *cache = modem ? &modem->sim_cache : NULL;
+	GSList *waiters = NULL;
+	GSList *l;
+
+	/* detached by a status change while the request was out: the answer is stale */
+	if (cache && dbus_info->batch == cache) {
+		dbus_info->batch = NULL;
+
+		if (result == SIM_ACCESS_SUCCESS) {
+			g_free(cache->data[item]);
+			cache->data[item] = g_memdup(data, data_len);
+		}
+
+		cache->in_flight[item] = NULL;
+		waiters = cache->waiters[item];
+		cache->waiters[item] = NULL;
+	}
+
+	_sim_complete_cached(dbus_info->interface_object, dbus_info->invocation, item, data);
+
+	for (l = waiters; l; l = l->next)
+		_sim_complete_cached(dbus_info->interface_object, l->data, item, data);
+
+	g_slist_free(waiters);
+}
+
+static void _sim_cache_clear(struct dbus_sim_cache *cache)
+{
+	unsigned int i;
+
+	for (i = 0; i < DBUS_SIM_CACHE_MAX; i++) {
+		_sim_cache_detach(cache, i);
+		g_free(cache->data[i]);
+		cache->data[i] = NULL;
+	}
+}
+
+static void _sim_cache_invalidate(struct dbus_modem_context *modem, gint sim_status)
+{
+	struct dbus_sim_cache *cache;
+
+	if (!modem)
+		return;
+
+	cache = &modem->sim_cache;
+	if (cache->status == sim_status)
+		return;
+
+	dbg("sim status [%d] -> [%d], drop cached sim data", cache->status, sim_status);
+	cache->status = sim_status;
+	_sim_cache_clear(cache);
+}
+
+void dbus_plugin_sim_cache_free(struct dbus_modem_context *modem)
+{
+	_sim_cache_clear(&modem->sim_cache);
+}
+
 static gboolean on_sim_get_init_status(TelephonySim *sim, GDBusMethodInvocation *invocation,
 		gpointer user_data)
 {
@@ -199,15 +432,10 @@ static gboolean on_sim_get_iccid(TelephonySim *sim, GDBusMethodInvocation *invoc
 		gpointer user_data)
 {
 	struct custom_data *ctx = user_data;
-	UserRequest *ur = NULL;
 
 	dbg("Func Entrance");
-	ur = MAKE_UR(ctx, sim, invocation);
 
-	tcore_user_request_set_command(ur, TREQ_SIM_GET_ICCID);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
-
-	return TRUE;
+	return _sim_cache_request(ctx, sim, invocation, DBUS_SIM_CACHE_ICCID);
 }
 
 static gboolean on_sim_get_language(TelephonySim *sim, GDBusMethodInvocation *invocation,
@@ -219,7 +447,7 @@ static gboolean on_sim_get_language(TelephonySim *sim, GDBusMethodInvocation *in
 	ur = MAKE_UR(ctx, sim, invocation);
 
 	tcore_user_request_set_command(ur, TREQ_SIM_GET_LANGUAGE);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -239,7 +467,7 @@ static gboolean on_sim_set_language(TelephonySim *sim, GDBusMethodInvocation *in
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_sim_set_language), &set_language);
 	tcore_user_request_set_command(ur, TREQ_SIM_SET_LANGUAGE);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -253,7 +481,7 @@ static gboolean on_sim_get_callforwarding(TelephonySim *sim, GDBusMethodInvocati
 	ur = MAKE_UR(ctx, sim, invocation);
 
 	tcore_user_request_set_command(ur, TREQ_SIM_GET_CALLFORWARDING);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -267,7 +495,7 @@ static gboolean on_sim_get_message_waiting(TelephonySim *sim, GDBusMethodInvocat
 	ur = MAKE_UR(ctx, sim, invocation);
 
 	tcore_user_request_set_command(ur, TREQ_SIM_GET_MESSAGEWAITING);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -281,7 +509,7 @@ static gboolean on_sim_get_mailbox(TelephonySim *sim, GDBusMethodInvocation *inv
 	ur = MAKE_UR(ctx, sim, invocation);
 
 	tcore_user_request_set_command(ur, TREQ_SIM_GET_MAILBOX);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -291,28 +519,20 @@ static gboolean on_sim_get_cphsinfo(TelephonySim *sim, GDBusMethodInvocation *in
 		gpointer user_data)
 {
 	struct custom_data *ctx = user_data;
-	UserRequest *ur = NULL;
-
-	ur = MAKE_UR(ctx, sim, invocation);
 
-	tcore_user_request_set_command(ur, TREQ_SIM_GET_CPHS_INFO);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbg("Func Entrance");
 
-	return TRUE;
+	return _sim_cache_request(ctx, sim, invocation, DBUS_SIM_CACHE_CPHS_INFO);
 }
 
 static gboolean on_sim_get_msisdn(TelephonySim *sim, GDBusMethodInvocation *invocation,
 		gpointer user_data)
 {
 	struct custom_data *ctx = user_data;
-	UserRequest *ur = NULL;
 
-	ur = MAKE_UR(ctx, sim, invocation);
-
-	tcore_user_request_set_command(ur, TREQ_SIM_GET_MSISDN);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbg("Func Entrance");
 
-	return TRUE;
+	return _sim_cache_request(ctx, sim, invocation, DBUS_SIM_CACHE_MSISDN);
 }
 
 static gboolean on_sim_get_oplmnwact(TelephonySim *sim, GDBusMethodInvocation *invocation,
@@ -324,7 +544,7 @@ static gboolean on_sim_get_oplmnwact(TelephonySim *sim, GDBusMethodInvocation *i
 	ur = MAKE_UR(ctx, sim, invocation);
 
 	tcore_user_request_set_command(ur, TREQ_SIM_GET_OPLMNWACT);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 
 	return TRUE;
@@ -334,14 +554,10 @@ static gboolean on_sim_get_spn(TelephonySim *sim, GDBusMethodInvocation *invocat
 		gpointer user_data)
 {
 	struct custom_data *ctx = user_data;
-	UserRequest *ur = NULL;
-
-	ur = MAKE_UR(ctx, sim, invocation);
 
-	tcore_user_request_set_command(ur, TREQ_SIM_GET_SPN);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbg("Func Entrance");
 
-	return TRUE;
+	return _sim_cache_request(ctx, sim, invocation, DBUS_SIM_CACHE_SPN);
 }
 
 static gboolean on_sim_get_cphs_netname(TelephonySim *sim, GDBusMethodInvocation *invocation,
@@ -353,7 +569,7 @@ static gboolean on_sim_get_cphs_netname(TelephonySim *sim, GDBusMethodInvocation
 	ur = MAKE_UR(ctx, sim, invocation);
 
 	tcore_user_request_set_command(ur, TREQ_SIM_GET_CPHS_NETNAME);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -397,7 +613,7 @@ static gboolean on_sim_authentication(TelephonySim *sim, GDBusMethodInvocation *
 	ur = MAKE_UR(ctx, sim, invocation);
 	tcore_user_request_set_data(ur, sizeof(struct treq_sim_req_authentication), &req_auth);
 	tcore_user_request_set_command(ur, TREQ_SIM_REQ_AUTHENTICATION);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -420,7 +636,7 @@ static gboolean on_sim_verify_sec(TelephonySim *sim, GDBusMethodInvocation *invo
 	ur = MAKE_UR(ctx, sim, invocation);
 	tcore_user_request_set_data(ur, sizeof(struct treq_sim_verify_pins), &verify_pins);
 	tcore_user_request_set_command(ur, TREQ_SIM_VERIFY_PINS);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -446,7 +662,7 @@ static gboolean on_sim_verify_puk(TelephonySim *sim, GDBusMethodInvocation *invo
 	ur = MAKE_UR(ctx, sim, invocation);
 	tcore_user_request_set_data(ur, sizeof(struct treq_sim_verify_puks), &verify_puks);
 	tcore_user_request_set_command(ur, TREQ_SIM_VERIFY_PUKS);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -472,7 +688,7 @@ static gboolean on_sim_change_pin(TelephonySim *sim, GDBusMethodInvocation *invo
 	ur = MAKE_UR(ctx, sim, invocation);
 	tcore_user_request_set_data(ur, sizeof(struct treq_sim_change_pins), &change_pins);
 	tcore_user_request_set_command(ur, TREQ_SIM_CHANGE_PINS);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -521,7 +737,7 @@ static gboolean on_sim_disable_facility(TelephonySim *sim, GDBusMethodInvocation
 	ur = MAKE_UR(ctx, sim, invocation);
 	tcore_user_request_set_data(ur, sizeof(struct treq_sim_disable_facility), &dis_facility);
 	tcore_user_request_set_command(ur, TREQ_SIM_DISABLE_FACILITY);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -570,7 +786,7 @@ static gboolean on_sim_enable_facility(TelephonySim *sim, GDBusMethodInvocation
 	ur = MAKE_UR(ctx, sim, invocation);
 	tcore_user_request_set_data(ur, sizeof(struct treq_sim_enable_facility), &en_facility);
 	tcore_user_request_set_command(ur, TREQ_SIM_ENABLE_FACILITY);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -616,7 +832,7 @@ static gboolean on_sim_get_facility(TelephonySim *sim, GDBusMethodInvocation *in
 	ur = MAKE_UR(ctx, sim, invocation);
 	tcore_user_request_set_data(ur, sizeof(struct treq_sim_get_facility_status), &facility);
 	tcore_user_request_set_command(ur, TREQ_SIM_GET_FACILITY_STATUS);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -662,7 +878,7 @@ static gboolean on_sim_get_lock_info(TelephonySim *sim, GDBusMethodInvocation *i
 	ur = MAKE_UR(ctx, sim, invocation);
 	tcore_user_request_set_data(ur, sizeof(struct treq_sim_get_lock_info), &lock_info);
 	tcore_user_request_set_command(ur, TREQ_SIM_GET_LOCK_INFO);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -685,15 +901,23 @@ static gboolean on_sim_transfer_apdu(TelephonySim *sim, GDBusMethodInvocation *i
 
 	inner_gv = g_variant_get_variant(arg_apdu);
 
+	/* a truncated APDU would be a different command to the card */
+	if (!g_variant_is_of_type(inner_gv, G_VARIANT_TYPE_BYTESTRING)
+			|| g_variant_n_children(inner_gv) > sizeof(send_apdu.apdu)) {
+		g_variant_unref(inner_gv);
+		g_dbus_method_invocation_return_error(invocation, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS,
+				"apdu must be an ay of at most %u bytes", (unsigned int)sizeof(send_apdu.apdu));
+		return TRUE;
+	}
+
 	g_variant_get(inner_gv, "ay", &iter);
-	while ( g_variant_iter_loop (iter, "y", &rt_i)) {
+	while (g_variant_iter_loop (iter, "y", &rt_i)) {
 		send_apdu.apdu[i] = rt_i;
 		i++;
 	}
 	send_apdu.apdu_length = (unsigned int)i;
 	g_variant_iter_free(iter);
 	g_variant_unref(inner_gv);
-	g_variant_unref(arg_apdu);
 
 	for(i=0; i < (int)send_apdu.apdu_length; i++)
 		dbg("apdu[%d][0x%02x]",i, send_apdu.apdu[i]);
@@ -701,7 +925,7 @@ static gboolean on_sim_transfer_apdu(TelephonySim *sim, GDBusMethodInvocation *i
 	ur = MAKE_UR(ctx, sim, invocation);
 	tcore_user_request_set_data(ur, sizeof(struct treq_sim_transmit_apdu), &send_apdu);
 	tcore_user_request_set_command(ur, TREQ_SIM_TRANSMIT_APDU);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -710,14 +934,10 @@ static gboolean on_sim_get_atr(TelephonySim *sim, GDBusMethodInvocation *invocat
 		gpointer user_data)
 {
 	struct custom_data *ctx = user_data;
-	UserRequest *ur = NULL;
-
-	ur = MAKE_UR(ctx, sim, invocation);
 
-	tcore_user_request_set_command(ur, TREQ_SIM_GET_ATR);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbg("Func Entrance");
 
-	return TRUE;
+	return _sim_cache_request(ctx, sim, invocation, DBUS_SIM_CACHE_ATR);
 }
 
 gboolean dbus_plugin_setup_sim_interface(TelephonyObjectSkeleton *object, struct custom_data *ctx)
@@ -858,515 +1078,618 @@ gboolean dbus_plugin_setup_sim_interface(TelephonyObjectSkeleton *object, struct
 	return TRUE;
 }
 
-gboolean dbus_plugin_sim_response(struct custom_data *ctx, UserRequest *ur,
+static gboolean _sim_get_ecc_response(struct custom_data *ctx, UserRequest *ur,
 		struct dbus_request_info *dbus_info, enum tcore_response_command command,
 		unsigned int data_len, const void *data)
 {
-	const struct tresp_sim_verify_pins *resp_verify_pins = data;
-	const struct tresp_sim_verify_puks *resp_verify_puks = data;
-	const struct tresp_sim_change_pins *resp_change_pins = data;
-	const struct tresp_sim_get_facility_status *resp_get_facility = data;
-	const struct tresp_sim_disable_facility *resp_dis_facility = data;
-	const struct tresp_sim_enable_facility *resp_en_facility = data;
-	const struct tresp_sim_transmit_apdu *resp_apdu = data;
-	const struct tresp_sim_get_atr *resp_get_atr = data;
 	const struct tresp_sim_read *resp_read = data;
-	const struct tresp_sim_req_authentication *resp_auth = data;
-	const struct tresp_sim_set_language *resp_set_language = data;
-	const struct tresp_sim_get_lock_info *resp_lock = data;
-	gint f_type =0;
-	int i =0;
-	dbg("Command = [0x%x], data_len = %d", command, data_len);
 
-	switch (command) {
-		case TRESP_SIM_GET_ECC: {
-			dbg("resp comm - TRESP_SIM_GET_ECC");
-			/*			GVariant *gv = NULL;
-			GVariantBuilder b;
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+	dbg("resp comm - TRESP_SIM_GET_ECC");
+	/*			GVariant *gv = NULL;
+	GVariantBuilder b;
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
 
-			for (i = 0; i < resp_read->data.ecc.ecc_count; i++) {
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(resp_read->data.ecc.ecc[i].ecc_string));
-				g_variant_builder_add(&b, "{sv}", "number", g_variant_new_string(resp_read->data.ecc.ecc[i].ecc_num));
-				g_variant_builder_add(&b, "{sv}", "category", g_variant_new_int32(resp_read->data.ecc.ecc[i].ecc_category));
-				g_variant_builder_close(&b);
-			}
-			gv = g_variant_builder_end(&b);
-			ctx->cached_sim_ecc = gv;*/
-			memcpy((void*)&ctx->cached_sim_ecc, (const void*)&resp_read->data.ecc, sizeof(struct tel_sim_ecc_list));
-		}
-			break;
+	for (i = 0; i < resp_read->data.ecc.ecc_count; i++) {
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(resp_read->data.ecc.ecc[i].ecc_string));
+		g_variant_builder_add(&b, "{sv}", "number", g_variant_new_string(resp_read->data.ecc.ecc[i].ecc_num));
+		g_variant_builder_add(&b, "{sv}", "category", g_variant_new_int32(resp_read->data.ecc.ecc[i].ecc_category));
+		g_variant_builder_close(&b);
+	}
+	gv = g_variant_builder_end(&b);
+	ctx->cached_sim_ecc = gv;*/
+	memcpy((void*)&ctx->cached_sim_ecc, (const void*)&resp_read->data.ecc, sizeof(struct tel_sim_ecc_list));
 
-		case TRESP_SIM_GET_ICCID:
-			dbg("resp comm - TRESP_SIM_GET_ICCID");
-			dbg("dbus_info->interface_object[%p], dbus_info->invocation[%p],dbus_info->interface_object, dbus_info->invocation");
-			dbg("result[%d], iccid[%s]", resp_read->result, resp_read->data.iccid.iccid);
-			telephony_sim_complete_get_iccid(dbus_info->interface_object, dbus_info->invocation,
-					resp_read->result,
-					resp_read->data.iccid.iccid);
-			break;
+	return TRUE;
+}
 
-		case TRESP_SIM_GET_LANGUAGE:
-			dbg("resp comm - TRESP_SIM_GET_LANGUAGE");
-			telephony_sim_complete_get_language(dbus_info->interface_object, dbus_info->invocation,
-					resp_read->result,
-					resp_read->data.language.language[0]);
-			break;
+static gboolean _sim_get_iccid_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_read *resp_read = data;
 
-		case TRESP_SIM_SET_LANGUAGE:
-			dbg("resp comm - TRESP_SIM_SET_LANGUAGE");
-			telephony_sim_complete_set_language(dbus_info->interface_object, dbus_info->invocation,
-					resp_set_language->result);
-			break;
+	dbg("resp comm - TRESP_SIM_GET_ICCID");
+	_sim_cache_response(dbus_plugin_ref_modem_by_request(ctx, ur, dbus_info), dbus_info,
+			DBUS_SIM_CACHE_ICCID, resp_read->result, data, sizeof(struct tresp_sim_read));
 
-		case TRESP_SIM_GET_CALLFORWARDING:
-			dbg("resp comm - TRESP_SIM_GET_CALLFORWARDING");
-			telephony_sim_complete_get_callforwarding (dbus_info->interface_object, dbus_info->invocation,
-					resp_read->result,
-					resp_read->data.cf.voice1,
-					resp_read->data.cf.voice2);
-			break;
-
-		case TRESP_SIM_GET_MESSAGEWAITING:
-			dbg("resp comm - TRESP_SIM_GET_MESSAGEWAITING");
-			if (resp_read->data.mw.b_cphs) {
-				telephony_sim_complete_get_message_waiting(dbus_info->interface_object,	dbus_info->invocation,
-						resp_read->result,
-						resp_read->data.mw.mw_data_u.cphs_mw.b_voice1,
-						resp_read->data.mw.mw_data_u.cphs_mw.b_voice2,
-						resp_read->data.mw.mw_data_u.cphs_mw.b_fax,
-						resp_read->data.mw.mw_data_u.cphs_mw.b_data);
-			} else {
-				telephony_sim_complete_get_message_waiting(dbus_info->interface_object,	dbus_info->invocation,
-						resp_read->result,
-						resp_read->data.mw.mw_data_u.mw.voice_count,
-						0,
-						resp_read->data.mw.mw_data_u.mw.fax_count,
-						resp_read->data.mw.mw_data_u.mw.video_count);
-			}
-			break;
+	return TRUE;
+}
 
-		case TRESP_SIM_GET_MAILBOX: {
-			GVariant *gv = NULL;
-			GVariantBuilder b;
-			dbg("resp comm - TRESP_SIM_GET_MAILBOX");
+static gboolean _sim_get_language_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_read *resp_read = data;
 
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+	dbg("resp comm - TRESP_SIM_GET_LANGUAGE");
+	telephony_sim_complete_get_language(dbus_info->interface_object, dbus_info->invocation,
+			resp_read->result,
+			resp_read->data.language.language[0]);
 
-			if(resp_read->data.mailbox.voice1.DiallingnumLength){
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "type", g_variant_new_string("voice1"));
-				g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(resp_read->data.mailbox.voice1.AlphaId));
-				g_variant_builder_add(&b, "{sv}", "number", g_variant_new_string(resp_read->data.mailbox.voice1.DiallingNum));
-				g_variant_builder_add(&b, "{sv}", "ton", g_variant_new_int32(resp_read->data.mailbox.voice1.TypeOfNumber));
-				g_variant_builder_close(&b);
-			}
+	return TRUE;
+}
 
-			if(resp_read->data.mailbox.voice2.DiallingnumLength){
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "type", g_variant_new_string("voice2"));
-				g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(resp_read->data.mailbox.voice2.AlphaId));
-				g_variant_builder_add(&b, "{sv}", "number", g_variant_new_string(resp_read->data.mailbox.voice2.DiallingNum));
-				g_variant_builder_add(&b, "{sv}", "ton", g_variant_new_int32(resp_read->data.mailbox.voice2.TypeOfNumber));
-				g_variant_builder_close(&b);
-			}
+static gboolean _sim_set_language_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_set_language *resp_set_language = data;
 
-			if(resp_read->data.mailbox.fax.DiallingnumLength){
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "type", g_variant_new_string("fax"));
-				g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(resp_read->data.mailbox.fax.AlphaId));
-				g_variant_builder_add(&b, "{sv}", "number", g_variant_new_string(resp_read->data.mailbox.fax.DiallingNum));
-				g_variant_builder_add(&b, "{sv}", "ton", g_variant_new_int32(resp_read->data.mailbox.fax.TypeOfNumber));
-				g_variant_builder_close(&b);
-			}
+	dbg("resp comm - TRESP_SIM_SET_LANGUAGE");
+	telephony_sim_complete_set_language(dbus_info->interface_object, dbus_info->invocation,
+			resp_set_language->result);
 
-			if(resp_read->data.mailbox.video.DiallingnumLength){
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "type", g_variant_new_string("video"));
-				g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(resp_read->data.mailbox.video.AlphaId));
-				g_variant_builder_add(&b, "{sv}", "number", g_variant_new_string(resp_read->data.mailbox.video.DiallingNum));
-				g_variant_builder_add(&b, "{sv}", "ton", g_variant_new_int32(resp_read->data.mailbox.video.TypeOfNumber));
-				g_variant_builder_close(&b);
-			}
-			gv = g_variant_builder_end(&b);
-			telephony_sim_complete_get_mailbox (dbus_info->interface_object, dbus_info->invocation,
-					resp_read->result,
-					gv);
-			g_variant_unref(gv);
-		}
-			break;
+	return TRUE;
+}
 
-		case TRESP_SIM_GET_CPHS_INFO:
-			dbg("resp comm - TRESP_SIM_GET_CPHS_INFO");
-			telephony_sim_complete_get_cphsinfo (dbus_info->interface_object, dbus_info->invocation,
-					resp_read->result,
-					resp_read->data.cphs.CphsPhase,
-					resp_read->data.cphs.CphsServiceTable.bOperatorNameShortForm,
-					resp_read->data.cphs.CphsServiceTable.bMailBoxNumbers,
-					resp_read->data.cphs.CphsServiceTable.bServiceStringTable,
-					resp_read->data.cphs.CphsServiceTable.bCustomerServiceProfile,
-					resp_read->data.cphs.CphsServiceTable.bInformationNumbers);
-			break;
+static gboolean _sim_get_callforwarding_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_read *resp_read = data;
 
-		case TRESP_SIM_GET_SPN:
-			dbg("resp comm - TRESP_SIM_GET_SPN");
-			telephony_sim_complete_get_spn (dbus_info->interface_object, dbus_info->invocation,
-					resp_read->result,
-					resp_read->data.spn.display_condition, (const gchar *)resp_read->data.spn.spn);
-			break;
+	dbg("resp comm - TRESP_SIM_GET_CALLFORWARDING");
+	telephony_sim_complete_get_callforwarding (dbus_info->interface_object, dbus_info->invocation,
+			resp_read->result,
+			resp_read->data.cf.voice1,
+			resp_read->data.cf.voice2);
 
-		case TRESP_SIM_GET_CPHS_NETNAME:
-			dbg("resp comm - TRESP_SIM_GET_CPHS_NETNAME");
-			telephony_sim_complete_get_cphs_net_name (dbus_info->interface_object, dbus_info->invocation,
-					resp_read->result,
-					(const gchar *)resp_read->data.cphs_net.full_name, (const gchar *)resp_read->data.cphs_net.short_name);
-			break;
+	return TRUE;
+}
 
-		case TRESP_SIM_GET_MSISDN:{
-			GVariant *gv = NULL;
-			GVariantBuilder b;
-			dbg("resp comm - TRESP_SIM_GET_MSISDN");
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+static gboolean _sim_get_messagewaiting_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_read *resp_read = data;
 
-			for(i=0;i < resp_read->data.msisdn_list.count; i++){
-				g_variant_builder_open(&b,G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string((const gchar *)resp_read->data.msisdn_list.msisdn[i].name));
-				g_variant_builder_add(&b, "{sv}", "number", g_variant_new_string((const gchar *)resp_read->data.msisdn_list.msisdn[i].num));
-				g_variant_builder_close(&b);
-			}
-			gv = g_variant_builder_end(&b);
+	dbg("resp comm - TRESP_SIM_GET_MESSAGEWAITING");
+	if (resp_read->data.mw.b_cphs) {
+		telephony_sim_complete_get_message_waiting(dbus_info->interface_object,	dbus_info->invocation,
+				resp_read->result,
+				resp_read->data.mw.mw_data_u.cphs_mw.b_voice1,
+				resp_read->data.mw.mw_data_u.cphs_mw.b_voice2,
+				resp_read->data.mw.mw_data_u.cphs_mw.b_fax,
+				resp_read->data.mw.mw_data_u.cphs_mw.b_data);
+	} else {
+		telephony_sim_complete_get_message_waiting(dbus_info->interface_object,	dbus_info->invocation,
+				resp_read->result,
+				resp_read->data.mw.mw_data_u.mw.voice_count,
+				0,
+				resp_read->data.mw.mw_data_u.mw.fax_count,
+				resp_read->data.mw.mw_data_u.mw.video_count);
+	}
 
-			telephony_sim_complete_get_msisdn (dbus_info->interface_object, dbus_info->invocation,
-					resp_read->result,
-					gv);
-			g_variant_unref(gv);
-		}
-			break;
+	return TRUE;
+}
 
-		case TRESP_SIM_GET_OPLMNWACT:{
-			GVariant *gv = NULL;
-			GVariantBuilder b;
-			dbg("resp comm - TRESP_SIM_GET_OPLMNWACT");
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+static gboolean _sim_get_mailbox_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_read *resp_read = data;
+	GVariant *gv = NULL;
+	GVariantBuilder b;
 
-			for(i=0;i < resp_read->data.opwa.opwa_count; i++){
-				g_variant_builder_open(&b,G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "plmn", g_variant_new_string((const gchar *)resp_read->data.opwa.opwa[i].plmn));
-				g_variant_builder_add(&b, "{sv}", "b_umts", g_variant_new_boolean(resp_read->data.opwa.opwa[i].b_umts));
-				g_variant_builder_add(&b, "{sv}", "b_gsm", g_variant_new_boolean(resp_read->data.opwa.opwa[i].b_gsm));
-				g_variant_builder_close(&b);
-			}
-			gv = g_variant_builder_end(&b);
+	dbg("resp comm - TRESP_SIM_GET_MAILBOX");
 
-			telephony_sim_complete_get_oplmnwact (dbus_info->interface_object, dbus_info->invocation,
-					resp_read->result,
-					gv);
-			g_variant_unref(gv);
-		}
-			break;
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
 
-		case TRESP_SIM_REQ_AUTHENTICATION: {
-			GVariantBuilder *builder = NULL;
-			GVariant *ak = NULL;
-			GVariant *cp = NULL;
-			GVariant *it = NULL;
-			GVariant *resp = NULL;
-			GVariant *ak_gv = NULL;
-			GVariant *cp_gv = NULL;
-			GVariant *it_gv = NULL;
-			GVariant *resp_gv = NULL;
-			int i =0;
-
-			dbg("resp comm - TRESP_SIM_REQ_AUTHENTICATION");
+	if(resp_read->data.mailbox.voice1.DiallingnumLength){
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "type", g_variant_new_string("voice1"));
+		g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(resp_read->data.mailbox.voice1.AlphaId));
+		g_variant_builder_add(&b, "{sv}", "number", g_variant_new_string(resp_read->data.mailbox.voice1.DiallingNum));
+		g_variant_builder_add(&b, "{sv}", "ton", g_variant_new_int32(resp_read->data.mailbox.voice1.TypeOfNumber));
+		g_variant_builder_close(&b);
+	}
 
-			builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
-			for(i = 0; i < (int)resp_auth->authentication_key_length; i++) {
-				dbg("resp_auth->authentication_key[%d][0x%02x]", i,resp_auth->authentication_key[i]);
-				g_variant_builder_add (builder, "y", resp_auth->authentication_key[i]);
-			}
-			ak = g_variant_builder_end(builder);
-			ak_gv = g_variant_new("v", ak);
+	if(resp_read->data.mailbox.voice2.DiallingnumLength){
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "type", g_variant_new_string("voice2"));
+		g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(resp_read->data.mailbox.voice2.AlphaId));
+		g_variant_builder_add(&b, "{sv}", "number", g_variant_new_string(resp_read->data.mailbox.voice2.DiallingNum));
+		g_variant_builder_add(&b, "{sv}", "ton", g_variant_new_int32(resp_read->data.mailbox.voice2.TypeOfNumber));
+		g_variant_builder_close(&b);
+	}
 
-			builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
-			for(i = 0; i < (int)resp_auth->cipher_length; i++) {
-				dbg("resp_auth->cipher_data[%d][0x%02x]", i,resp_auth->cipher_data[i]);
-				g_variant_builder_add (builder, "y", resp_auth->cipher_data[i]);
-			}
-			cp = g_variant_builder_end(builder);
-			cp_gv = g_variant_new("v", cp);
+	if(resp_read->data.mailbox.fax.DiallingnumLength){
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "type", g_variant_new_string("fax"));
+		g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(resp_read->data.mailbox.fax.AlphaId));
+		g_variant_builder_add(&b, "{sv}", "number", g_variant_new_string(resp_read->data.mailbox.fax.DiallingNum));
+		g_variant_builder_add(&b, "{sv}", "ton", g_variant_new_int32(resp_read->data.mailbox.fax.TypeOfNumber));
+		g_variant_builder_close(&b);
+	}
 
-			builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
-			for(i = 0; i < (int)resp_auth->integrity_length; i++) {
-				dbg("resp_auth->integrity_data[%d][0x%02x]", i,resp_auth->integrity_data[i]);
-				g_variant_builder_add (builder, "y", resp_auth->integrity_data[i]);
-			}
-			it = g_variant_builder_end(builder);
-			it_gv = g_variant_new("v", it);
+	if(resp_read->data.mailbox.video.DiallingnumLength){
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "type", g_variant_new_string("video"));
+		g_variant_builder_add(&b, "{sv}", "name", g_variant_new_string(resp_read->data.mailbox.video.AlphaId));
+		g_variant_builder_add(&b, "{sv}", "number", g_variant_new_string(resp_read->data.mailbox.video.DiallingNum));
+		g_variant_builder_add(&b, "{sv}", "ton", g_variant_new_int32(resp_read->data.mailbox.video.TypeOfNumber));
+		g_variant_builder_close(&b);
+	}
+	gv = g_variant_builder_end(&b);
+	telephony_sim_complete_get_mailbox (dbus_info->interface_object, dbus_info->invocation,
+			resp_read->result,
+			gv);
+	g_variant_unref(gv);
 
-			builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
-			for(i = 0; i < (int)resp_auth->resp_length; i++) {
-				dbg("resp_auth->resp_data[%d][0x%02x]", i,resp_auth->resp_data[i]);
-				g_variant_builder_add (builder, "y", resp_auth->resp_data[i]);
-			}
-			resp = g_variant_builder_end(builder);
-			resp_gv = g_variant_new("v", resp);
-
-			telephony_sim_complete_authentication (dbus_info->interface_object, dbus_info->invocation,
-					resp_auth->result,
-					resp_auth->auth_type,
-					resp_auth->auth_result,
-					ak_gv,
-					cp_gv,
-					it_gv,
-					resp_gv);
-		}
-			break;
+	return TRUE;
+}
 
-		case TRESP_SIM_VERIFY_PINS:
-			dbg("resp comm - TRESP_SIM_VERIFY_PINS");
-			telephony_sim_complete_verify_sec(dbus_info->interface_object, dbus_info->invocation,
-					resp_verify_pins->result,
-					resp_verify_pins->pin_type,
-					resp_verify_pins->retry_count);
-			break;
-
-		case TRESP_SIM_VERIFY_PUKS:
-			dbg("resp comm - TRESP_SIM_VERIFY_PUKS");
-			telephony_sim_complete_verify_puk (dbus_info->interface_object, dbus_info->invocation,
-					resp_verify_puks->result,
-					resp_verify_puks->pin_type,
-					resp_verify_puks->retry_count);
-			break;
-
-		case TRESP_SIM_CHANGE_PINS:
-			dbg("resp comm - TRESP_SIM_CHANGE_PINS");
-			telephony_sim_complete_change_pin(dbus_info->interface_object, dbus_info->invocation,
-					resp_change_pins->result,
-					resp_change_pins->pin_type,
-					resp_change_pins->retry_count);
-			break;
-
-		case TRESP_SIM_DISABLE_FACILITY:
-			dbg("resp comm - TRESP_SIM_DISABLE_FACILITY");
-			dbg("resp_dis_facility->type[%d]", resp_dis_facility->type);
-			switch (resp_dis_facility->type) {
-				case SIM_FACILITY_PS:
-					f_type = 1;
-					break;
-				case SIM_FACILITY_SC:
-					f_type = 3;
-					break;
-				case SIM_FACILITY_FD:
-					f_type = 4;
-					break;
-				case SIM_FACILITY_PN:
-					f_type = 5;
-					break;
-				case SIM_FACILITY_PU:
-					f_type = 6;
-					break;
-				case SIM_FACILITY_PP:
-					f_type = 7;
-					break;
-				case SIM_FACILITY_PC:
-					f_type = 8;
-					break;
-				default:
-					dbg("error - not handled type[%d]", resp_dis_facility->type);
-					break;
-			}
-			telephony_sim_complete_disable_facility(dbus_info->interface_object, dbus_info->invocation,
-					resp_dis_facility->result,
-					f_type,
-					resp_dis_facility->retry_count);
-			break;
-
-		case TRESP_SIM_ENABLE_FACILITY:
-			dbg("resp comm - TRESP_SIM_ENABLE_FACILITY");
-			dbg("resp_en_facility->type[%d]", resp_en_facility->type);
-			switch (resp_en_facility->type) {
-				case SIM_FACILITY_PS:
-					f_type = 1;
-					break;
-				case SIM_FACILITY_SC:
-					f_type = 3;
-					break;
-				case SIM_FACILITY_FD:
-					f_type = 4;
-					break;
-				case SIM_FACILITY_PN:
-					f_type = 5;
-					break;
-				case SIM_FACILITY_PU:
-					f_type = 6;
-					break;
-				case SIM_FACILITY_PP:
-					f_type = 7;
-					break;
-				case SIM_FACILITY_PC:
-					f_type = 8;
-					break;
-				default:
-					dbg("error - not handled type[%d]", resp_en_facility->type);
-					break;
-			}
-			telephony_sim_complete_enable_facility(dbus_info->interface_object, dbus_info->invocation,
-					resp_en_facility->result,
-					f_type,
-					resp_en_facility->retry_count);
-			break;
-
-		case TRESP_SIM_GET_FACILITY_STATUS:
-			dbg("resp comm - TRESP_SIM_GET_FACILITY_STATUS");
-			dbg("resp_get_facility->type[%d]", resp_get_facility->type);
-			switch (resp_get_facility->type) {
-				case SIM_FACILITY_PS:
-					f_type = 1;
-					break;
-				case SIM_FACILITY_SC:
-					f_type = 3;
-					break;
-				case SIM_FACILITY_FD:
-					f_type = 4;
-					break;
-				case SIM_FACILITY_PN:
-					f_type = 5;
-					break;
-				case SIM_FACILITY_PU:
-					f_type = 6;
-					break;
-				case SIM_FACILITY_PP:
-					f_type = 7;
-					break;
-				case SIM_FACILITY_PC:
-					f_type = 8;
-					break;
-				default:
-					dbg("error - not handled type[%d]", resp_get_facility->type);
-					break;
-			}
-			telephony_sim_complete_get_facility(dbus_info->interface_object, dbus_info->invocation,
-					resp_get_facility->result,
-					f_type,
-					resp_get_facility->b_enable);
-			break;
-
-		case TRESP_SIM_GET_LOCK_INFO:
-			dbg("resp comm - TRESP_SIM_GET_LOCK_INFO");
-			dbg("resp_lock->type[%d]", resp_lock->type);
-			switch (resp_lock->type) {
-				case SIM_FACILITY_PS:
-					f_type = 1;
-					break;
-				case SIM_FACILITY_SC:
-					f_type = 3;
-					break;
-				case SIM_FACILITY_FD:
-					f_type = 4;
-					break;
-				case SIM_FACILITY_PN:
-					f_type = 5;
-					break;
-				case SIM_FACILITY_PU:
-					f_type = 6;
-					break;
-				case SIM_FACILITY_PP:
-					f_type = 7;
-					break;
-				case SIM_FACILITY_PC:
-					f_type = 8;
-					break;
-				default:
-					dbg("error - not handled type[%d]", resp_lock->type);
-					break;
-			}
-			telephony_sim_complete_get_lock_info(dbus_info->interface_object, dbus_info->invocation,
-					resp_lock->result,
-					f_type,
-					resp_lock->lock_status,
-					resp_lock->retry_count);
-			break;
+static gboolean _sim_get_cphs_info_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_read *resp_read = data;
 
-		case TRESP_SIM_TRANSMIT_APDU: {
-			GVariantBuilder *builder = NULL;
-			GVariant * apdu_gv = NULL;
-			GVariant *inner_gv = NULL;
-			int i =0;
+	dbg("resp comm - TRESP_SIM_GET_CPHS_INFO");
+	_sim_cache_response(dbus_plugin_ref_modem_by_request(ctx, ur, dbus_info), dbus_info,
+			DBUS_SIM_CACHE_CPHS_INFO, resp_read->result, data, sizeof(struct tresp_sim_read));
 
-			dbg("resp comm - TRESP_SIM_TRANSMIT_APDU");
-			builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
-			for(i = 0; i < (int)resp_apdu->apdu_resp_length; i++) {
-				dbg("resp_apdu->apdu_resp[%d][0x%02x]", i,resp_apdu->apdu_resp[i]);
-				g_variant_builder_add (builder, "y", resp_apdu->apdu_resp[i]);
-			}
-			inner_gv = g_variant_builder_end(builder);
-/*			g_variant_builder_unref (builder);*/
-			apdu_gv = g_variant_new("v", inner_gv);
+	return TRUE;
+}
 
-			telephony_sim_complete_transfer_apdu(dbus_info->interface_object, dbus_info->invocation,
-					resp_apdu->result,
-					apdu_gv);
-		}
-			break;
+static gboolean _sim_get_spn_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_read *resp_read = data;
 
-		case TRESP_SIM_GET_ATR:{
-			GVariantBuilder *builder = NULL;
-			GVariant * atr_gv = NULL;
-			GVariant *inner_gv = NULL;
-			int i =0;
+	dbg("resp comm - TRESP_SIM_GET_SPN");
+	_sim_cache_response(dbus_plugin_ref_modem_by_request(ctx, ur, dbus_info), dbus_info,
+			DBUS_SIM_CACHE_SPN, resp_read->result, data, sizeof(struct tresp_sim_read));
 
-			dbg("resp comm - TRESP_SIM_GET_ATR");
-			builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
-			for(i = 0; i < (int)resp_get_atr->atr_length; i++) {
-				dbg("resp_apdu->apdu_resp[%d][0x%02x]", i,resp_get_atr->atr[i]);
-				g_variant_builder_add (builder, "y", resp_get_atr->atr[i]);
-			}
-			inner_gv = g_variant_builder_end(builder);
-/*			g_variant_builder_unref (builder);*/
-			atr_gv = g_variant_new("v", inner_gv);
+	return TRUE;
+}
 
-			telephony_sim_complete_get_atr(dbus_info->interface_object, dbus_info->invocation,
-					resp_get_atr->result,
-					atr_gv);
-		}
-			break;
+static gboolean _sim_get_cphs_netname_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_read *resp_read = data;
 
+	dbg("resp comm - TRESP_SIM_GET_CPHS_NETNAME");
+	telephony_sim_complete_get_cphs_net_name (dbus_info->interface_object, dbus_info->invocation,
+			resp_read->result,
+			(const gchar *)resp_read->data.cphs_net.full_name, (const gchar *)resp_read->data.cphs_net.short_name);
+
+	return TRUE;
+}
+
+static gboolean _sim_get_msisdn_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_read *resp_read = data;
+
+	dbg("resp comm - TRESP_SIM_GET_MSISDN");
+	_sim_cache_response(dbus_plugin_ref_modem_by_request(ctx, ur, dbus_info), dbus_info,
+			DBUS_SIM_CACHE_MSISDN, resp_read->result, data, sizeof(struct tresp_sim_read));
+
+	return TRUE;
+}
+
+static gboolean _sim_get_oplmnwact_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_read *resp_read = data;
+	int i =0;
+	GVariant *gv = NULL;
+	GVariantBuilder b;
+
+	dbg("resp comm - TRESP_SIM_GET_OPLMNWACT");
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+
+	for(i=0;i < resp_read->data.opwa.opwa_count; i++){
+		g_variant_builder_open(&b,G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "plmn", g_variant_new_string((const gchar *)resp_read->data.opwa.opwa[i].plmn));
+		g_variant_builder_add(&b, "{sv}", "b_umts", g_variant_new_boolean(resp_read->data.opwa.opwa[i].b_umts));
+		g_variant_builder_add(&b, "{sv}", "b_gsm", g_variant_new_boolean(resp_read->data.opwa.opwa[i].b_gsm));
+		g_variant_builder_close(&b);
+	}
+	gv = g_variant_builder_end(&b);
+
+	telephony_sim_complete_get_oplmnwact (dbus_info->interface_object, dbus_info->invocation,
+			resp_read->result,
+			gv);
+	g_variant_unref(gv);
+
+	return TRUE;
+}
+
+static gboolean _sim_req_authentication_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_req_authentication *resp_auth = data;
+	GVariantBuilder *builder = NULL;
+	GVariant *ak = NULL;
+	GVariant *cp = NULL;
+	GVariant *it = NULL;
+	GVariant *resp = NULL;
+	GVariant *ak_gv = NULL;
+	GVariant *cp_gv = NULL;
+	GVariant *it_gv = NULL;
+	GVariant *resp_gv = NULL;
+	int i =0;
+
+	dbg("resp comm - TRESP_SIM_REQ_AUTHENTICATION");
+
+	builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
+	for(i = 0; i < (int)resp_auth->authentication_key_length; i++) {
+		dbg("resp_auth->authentication_key[%d][0x%02x]", i,resp_auth->authentication_key[i]);
+		g_variant_builder_add (builder, "y", resp_auth->authentication_key[i]);
+	}
+	ak = g_variant_builder_end(builder);
+	ak_gv = g_variant_new("v", ak);
+
+	builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
+	for(i = 0; i < (int)resp_auth->cipher_length; i++) {
+		dbg("resp_auth->cipher_data[%d][0x%02x]", i,resp_auth->cipher_data[i]);
+		g_variant_builder_add (builder, "y", resp_auth->cipher_data[i]);
+	}
+	cp = g_variant_builder_end(builder);
+	cp_gv = g_variant_new("v", cp);
+
+	builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
+	for(i = 0; i < (int)resp_auth->integrity_length; i++) {
+		dbg("resp_auth->integrity_data[%d][0x%02x]", i,resp_auth->integrity_data[i]);
+		g_variant_builder_add (builder, "y", resp_auth->integrity_data[i]);
+	}
+	it = g_variant_builder_end(builder);
+	it_gv = g_variant_new("v", it);
+
+	builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
+	for(i = 0; i < (int)resp_auth->resp_length; i++) {
+		dbg("resp_auth->resp_data[%d][0x%02x]", i,resp_auth->resp_data[i]);
+		g_variant_builder_add (builder, "y", resp_auth->resp_data[i]);
+	}
+	resp = g_variant_builder_end(builder);
+	resp_gv = g_variant_new("v", resp);
+
+	telephony_sim_complete_authentication (dbus_info->interface_object, dbus_info->invocation,
+			resp_auth->result,
+			resp_auth->auth_type,
+			resp_auth->auth_result,
+			ak_gv,
+			cp_gv,
+			it_gv,
+			resp_gv);
+
+	return TRUE;
+}
+
+static gboolean _sim_verify_pins_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_verify_pins *resp_verify_pins = data;
+
+	dbg("resp comm - TRESP_SIM_VERIFY_PINS");
+	telephony_sim_complete_verify_sec(dbus_info->interface_object, dbus_info->invocation,
+			resp_verify_pins->result,
+			resp_verify_pins->pin_type,
+			resp_verify_pins->retry_count);
+
+	return TRUE;
+}
+
+static gboolean _sim_verify_puks_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_verify_puks *resp_verify_puks = data;
+
+	dbg("resp comm - TRESP_SIM_VERIFY_PUKS");
+	telephony_sim_complete_verify_puk (dbus_info->interface_object, dbus_info->invocation,
+			resp_verify_puks->result,
+			resp_verify_puks->pin_type,
+			resp_verify_puks->retry_count);
+
+	return TRUE;
+}
+
+static gboolean _sim_change_pins_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_change_pins *resp_change_pins = data;
+
+	dbg("resp comm - TRESP_SIM_CHANGE_PINS");
+	telephony_sim_complete_change_pin(dbus_info->interface_object, dbus_info->invocation,
+			resp_change_pins->result,
+			resp_change_pins->pin_type,
+			resp_change_pins->retry_count);
+
+	return TRUE;
+}
+
+static gboolean _sim_disable_facility_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_disable_facility *resp_dis_facility = data;
+	gint f_type =0;
+
+	dbg("resp comm - TRESP_SIM_DISABLE_FACILITY");
+	dbg("resp_dis_facility->type[%d]", resp_dis_facility->type);
+	switch (resp_dis_facility->type) {
+		case SIM_FACILITY_PS:
+			f_type = 1;
+			break;
+		case SIM_FACILITY_SC:
+			f_type = 3;
+			break;
+		case SIM_FACILITY_FD:
+			f_type = 4;
+			break;
+		case SIM_FACILITY_PN:
+			f_type = 5;
+			break;
+		case SIM_FACILITY_PU:
+			f_type = 6;
+			break;
+		case SIM_FACILITY_PP:
+			f_type = 7;
+			break;
+		case SIM_FACILITY_PC:
+			f_type = 8;
+			break;
 		default:
-			dbg("not handled TRESP type[%d]", command);
+			dbg("error - not handled type[%d]", resp_dis_facility->type);
 			break;
 	}
+	telephony_sim_complete_disable_facility(dbus_info->interface_object, dbus_info->invocation,
+			resp_dis_facility->result,
+			f_type,
+			resp_dis_facility->retry_count);
+
 	return TRUE;
 }
 
-gboolean dbus_plugin_sim_notification(struct custom_data *ctx, const char *plugin_name,
-		TelephonyObjectSkeleton *object, enum tcore_notification_command command,
+static gboolean _sim_enable_facility_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
 		unsigned int data_len, const void *data)
 {
-	TelephonySim *sim;
-	const struct tnoti_sim_status *n_sim_status = data;
+	const struct tresp_sim_enable_facility *resp_en_facility = data;
+	gint f_type =0;
 
-	if (!object) {
-		dbg("object is NULL");
-		return FALSE;
+	dbg("resp comm - TRESP_SIM_ENABLE_FACILITY");
+	dbg("resp_en_facility->type[%d]", resp_en_facility->type);
+	switch (resp_en_facility->type) {
+		case SIM_FACILITY_PS:
+			f_type = 1;
+			break;
+		case SIM_FACILITY_SC:
+			f_type = 3;
+			break;
+		case SIM_FACILITY_FD:
+			f_type = 4;
+			break;
+		case SIM_FACILITY_PN:
+			f_type = 5;
+			break;
+		case SIM_FACILITY_PU:
+			f_type = 6;
+			break;
+		case SIM_FACILITY_PP:
+			f_type = 7;
+			break;
+		case SIM_FACILITY_PC:
+			f_type = 8;
+			break;
+		default:
+			dbg("error - not handled type[%d]", resp_en_facility->type);
+			break;
 	}
+	telephony_sim_complete_enable_facility(dbus_info->interface_object, dbus_info->invocation,
+			resp_en_facility->result,
+			f_type,
+			resp_en_facility->retry_count);
 
-	sim = telephony_object_peek_sim(TELEPHONY_OBJECT(object));
-	dbg("sim = %p", sim);
+	return TRUE;
+}
 
-	dbg("notification !!! (command = 0x%x, data_len = %d)", command, data_len);
+static gboolean _sim_get_facility_status_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_get_facility_status *resp_get_facility = data;
+	gint f_type =0;
 
-	switch (command) {
-		case TNOTI_SIM_STATUS:
-			dbg("notified sim_status[%d]", n_sim_status->sim_status);
-			dbus_sim_data_request(ctx, n_sim_status->sim_status);
-			telephony_sim_emit_status (sim, n_sim_status->sim_status);
+	dbg("resp comm - TRESP_SIM_GET_FACILITY_STATUS");
+	dbg("resp_get_facility->type[%d]", resp_get_facility->type);
+	switch (resp_get_facility->type) {
+		case SIM_FACILITY_PS:
+			f_type = 1;
+			break;
+		case SIM_FACILITY_SC:
+			f_type = 3;
+			break;
+		case SIM_FACILITY_FD:
+			f_type = 4;
+			break;
+		case SIM_FACILITY_PN:
+			f_type = 5;
+			break;
+		case SIM_FACILITY_PU:
+			f_type = 6;
 			break;
+		case SIM_FACILITY_PP:
+			f_type = 7;
+			break;
+		case SIM_FACILITY_PC:
+			f_type = 8;
+			break;
+		default:
+			dbg("error - not handled type[%d]", resp_get_facility->type);
+			break;
+	}
+	telephony_sim_complete_get_facility(dbus_info->interface_object, dbus_info->invocation,
+			resp_get_facility->result,
+			f_type,
+			resp_get_facility->b_enable);
+
+	return TRUE;
+}
 
+static gboolean _sim_get_lock_info_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_get_lock_info *resp_lock = data;
+	gint f_type =0;
+
+	dbg("resp comm - TRESP_SIM_GET_LOCK_INFO");
+	dbg("resp_lock->type[%d]", resp_lock->type);
+	switch (resp_lock->type) {
+		case SIM_FACILITY_PS:
+			f_type = 1;
+			break;
+		case SIM_FACILITY_SC:
+			f_type = 3;
+			break;
+		case SIM_FACILITY_FD:
+			f_type = 4;
+			break;
+		case SIM_FACILITY_PN:
+			f_type = 5;
+			break;
+		case SIM_FACILITY_PU:
+			f_type = 6;
+			break;
+		case SIM_FACILITY_PP:
+			f_type = 7;
+			break;
+		case SIM_FACILITY_PC:
+			f_type = 8;
+			break;
 		default:
-		dbg("not handled command[%d]", command);
-		break;
+			dbg("error - not handled type[%d]", resp_lock->type);
+			break;
+	}
+	telephony_sim_complete_get_lock_info(dbus_info->interface_object, dbus_info->invocation,
+			resp_lock->result,
+			f_type,
+			resp_lock->lock_status,
+			resp_lock->retry_count);
+
+	return TRUE;
+}
+
+static gboolean _sim_transmit_apdu_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_transmit_apdu *resp_apdu = data;
+	GVariantBuilder *builder = NULL;
+	GVariant * apdu_gv = NULL;
+	GVariant *inner_gv = NULL;
+	int i =0;
+
+	dbg("resp comm - TRESP_SIM_TRANSMIT_APDU");
+	builder = g_variant_builder_new (G_VARIANT_TYPE ("ay"));
+	for(i = 0; i < (int)resp_apdu->apdu_resp_length; i++) {
+		dbg("resp_apdu->apdu_resp[%d][0x%02x]", i,resp_apdu->apdu_resp[i]);
+		g_variant_builder_add (builder, "y", resp_apdu->apdu_resp[i]);
 	}
+	inner_gv = g_variant_builder_end(builder);
+	g_variant_builder_unref (builder);
+	apdu_gv = g_variant_new("v", inner_gv);
+
+	telephony_sim_complete_transfer_apdu(dbus_info->interface_object, dbus_info->invocation,
+			resp_apdu->result,
+			apdu_gv);
 
 	return TRUE;
 }
+
+static gboolean _sim_get_atr_response(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum tcore_response_command command,
+		unsigned int data_len, const void *data)
+{
+	const struct tresp_sim_get_atr *resp_get_atr = data;
+
+	dbg("resp comm - TRESP_SIM_GET_ATR");
+	_sim_cache_response(dbus_plugin_ref_modem_by_request(ctx, ur, dbus_info), dbus_info,
+			DBUS_SIM_CACHE_ATR, resp_get_atr->result, data, sizeof(struct tresp_sim_get_atr));
+
+	return TRUE;
+}
+
+static const struct dbus_plugin_response_handler sim_response_handlers[] = {
+	{ TRESP_SIM_GET_ECC, _sim_get_ecc_response },
+	{ TRESP_SIM_GET_ICCID, _sim_get_iccid_response },
+	{ TRESP_SIM_GET_LANGUAGE, _sim_get_language_response },
+	{ TRESP_SIM_SET_LANGUAGE, _sim_set_language_response },
+	{ TRESP_SIM_GET_CALLFORWARDING, _sim_get_callforwarding_response },
+	{ TRESP_SIM_GET_MESSAGEWAITING, _sim_get_messagewaiting_response },
+	{ TRESP_SIM_GET_MAILBOX, _sim_get_mailbox_response },
+	{ TRESP_SIM_GET_CPHS_INFO, _sim_get_cphs_info_response },
+	{ TRESP_SIM_GET_SPN, _sim_get_spn_response },
+	{ TRESP_SIM_GET_CPHS_NETNAME, _sim_get_cphs_netname_response },
+	{ TRESP_SIM_GET_MSISDN, _sim_get_msisdn_response },
+	{ TRESP_SIM_GET_OPLMNWACT, _sim_get_oplmnwact_response },
+	{ TRESP_SIM_REQ_AUTHENTICATION, _sim_req_authentication_response },
+	{ TRESP_SIM_VERIFY_PINS, _sim_verify_pins_response },
+	{ TRESP_SIM_VERIFY_PUKS, _sim_verify_puks_response },
+	{ TRESP_SIM_CHANGE_PINS, _sim_change_pins_response },
+	{ TRESP_SIM_DISABLE_FACILITY, _sim_disable_facility_response },
+	{ TRESP_SIM_ENABLE_FACILITY, _sim_enable_facility_response },
+	{ TRESP_SIM_GET_FACILITY_STATUS, _sim_get_facility_status_response },
+	{ TRESP_SIM_GET_LOCK_INFO, _sim_get_lock_info_response },
+	{ TRESP_SIM_TRANSMIT_APDU, _sim_transmit_apdu_response },
+	{ TRESP_SIM_GET_ATR, _sim_get_atr_response },
+};
+
+static gboolean _sim_status_notification(struct custom_data *ctx, const char *plugin_name,
+		TelephonyObjectSkeleton *object, enum tcore_notification_command command,
+		unsigned int data_len, const void *data)
+{
+	TelephonySim *sim = telephony_object_peek_sim(TELEPHONY_OBJECT(object));
+	const struct tnoti_sim_status *n_sim_status = data;
+
+	dbg("notified sim_status[%d]", n_sim_status->sim_status);
+	_sim_cache_invalidate(dbus_plugin_ref_modem_by_object(object), n_sim_status->sim_status);
+	dbus_sim_data_request(ctx, n_sim_status->sim_status);
+	telephony_sim_emit_status (sim, n_sim_status->sim_status);
+
+	return TRUE;
+}
+
+static const struct dbus_plugin_notification_handler sim_notification_handlers[] = {
+	{ TNOTI_SIM_STATUS, _sim_status_notification },
+};
+
+void dbus_plugin_register_sim_handlers(struct custom_data *ctx)
+{
+	dbus_plugin_register_responses(ctx, sim_response_handlers,
+			G_N_ELEMENTS(sim_response_handlers));
+	dbus_plugin_register_notifications(ctx, sim_notification_handlers,
+			G_N_ELEMENTS(sim_notification_handlers));
+}
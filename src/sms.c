@@ -43,6 +43,55 @@
 
 TReturn	ret = TCORE_RETURN_SUCCESS;
 
+/*
+ * IncommingMsg (base64) is deprecated in favour of IncommingMsgRaw. It is
+ * still emitted by default; build with -DSMS_LEGACY_INCOM_MSG=OFF once no
+ * client listens to it any more, which also drops the two base64 encodes
+ * of every incoming message.
+ */
+#ifndef DBUS_SMS_LEGACY_INCOM_MSG
+#define DBUS_SMS_LEGACY_INCOM_MSG 1
+#endif
+
+static gboolean _sms_copy_raw(GVariant *v, unsigned char *dst, gsize max_len, gsize *out_len)
+{
+	const guchar *src;
+	gsize len = 0;
+
+	src = g_variant_get_fixed_array(v, &len, sizeof(guchar));
+	if (len > max_len) {
+		err("[tcore_SMS] raw data too long (%u > %u)", (unsigned int)len, (unsigned int)max_len);
+		return FALSE;
+	}
+
+	if (len)
+		memcpy(dst, src, len);
+
+	if (out_len)
+		*out_len = len;
+
+	return TRUE;
+}
+
+static GVariant *_sms_new_raw(const unsigned char *data, int len, int max_len)
+{
+	if (len < 0)
+		len = 0;
+	else if (len > max_len)
+		len = max_len;
+
+	return g_variant_new_fixed_array(G_VARIANT_TYPE_BYTE, data, len, sizeof(guchar));
+}
+
+/* the handler has consumed the invocation either way, so always TRUE */
+static gboolean _sms_return_invalid_raw(GDBusMethodInvocation *invocation)
+{
+	g_dbus_method_invocation_return_error(invocation, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS,
+			"sca is limited to %d bytes and tpdu to %d bytes", SMS_SMSP_ADDRESS_LEN, SMS_SMDATA_SIZE_MAX + 1);
+
+	return TRUE;
+}
+
 static gboolean
 on_sms_send_msg(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	const gchar *sca,
@@ -62,13 +111,13 @@ on_sms_send_msg(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	memset(&sendUmtsMsg, 0 , sizeof(struct treq_sms_send_umts_msg));
 
 	decoded_sca = g_base64_decode(sca, &length);
-	memcpy(&(sendUmtsMsg.msgDataPackage.sca[0]), decoded_sca, SMS_SMSP_ADDRESS_LEN);
+	memcpy(&(sendUmtsMsg.msgDataPackage.sca[0]), decoded_sca, MIN(length, SMS_SMSP_ADDRESS_LEN));
 
 	sendUmtsMsg.msgDataPackage.msgLength = tpdu_length;
 	dbg("tpdu_length = 0x%x", tpdu_length);
 
 	decoded_tpdu = g_base64_decode(tpdu_data, &length);
-	memcpy(&(sendUmtsMsg.msgDataPackage.tpduData[0]), decoded_tpdu, SMS_SMDATA_SIZE_MAX + 1);
+	memcpy(&(sendUmtsMsg.msgDataPackage.tpduData[0]), decoded_tpdu, MIN(length, SMS_SMDATA_SIZE_MAX + 1));
 	sendUmtsMsg.more = moreMsg;
 
 	ur = MAKE_UR(ctx, sms, invocation);
@@ -81,7 +130,7 @@ on_sms_send_msg(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	if(decoded_tpdu)
 		g_free(decoded_tpdu);
 
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		// api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
@@ -90,6 +139,174 @@ on_sms_send_msg(TelephonySms *sms, GDBusMethodInvocation *invocation,
 		
 	return  TRUE;
 }
+static gboolean
+on_sms_send_msg_raw(TelephonySms *sms, GDBusMethodInvocation *invocation,
+	GVariant *sca,
+	GVariant *tpdu_data,
+	gint moreMsg,
+	gpointer user_data)
+{
+	struct treq_sms_send_umts_msg sendUmtsMsg;
+	struct custom_data *ctx = user_data;
+	UserRequest *ur = NULL;
+	struct dbus_request_info *dbus_info;
+	gsize length = 0;
+
+	memset(&sendUmtsMsg, 0 , sizeof(struct treq_sms_send_umts_msg));
+
+	if (!_sms_copy_raw(sca, sendUmtsMsg.msgDataPackage.sca, SMS_SMSP_ADDRESS_LEN, NULL)
+			|| !_sms_copy_raw(tpdu_data, sendUmtsMsg.msgDataPackage.tpduData, SMS_SMDATA_SIZE_MAX + 1, &length))
+		return _sms_return_invalid_raw(invocation);
+
+	sendUmtsMsg.msgDataPackage.msgLength = length;
+	sendUmtsMsg.more = moreMsg;
+
+	ur = MAKE_UR(ctx, sms, invocation);
+	dbus_info = dbus_plugin_ref_request_info(ur);
+	dbus_info->raw = TRUE;
+	tcore_user_request_set_data(ur, sizeof(struct treq_sms_send_umts_msg), &sendUmtsMsg);
+	tcore_user_request_set_command(ur, TREQ_SMS_SEND_UMTS_MSG);
+
+	ret = dbus_plugin_dispatch_request(ctx, ur);
+	if (ret != TCORE_RETURN_SUCCESS) {
+		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
+		return  FALSE;
+	}
+
+	return  TRUE;
+}
+
+#define SMS_BATCH_DISPATCH_FAILED (-1)
+
+struct sms_send_batch {
+	TelephonySms *sms;
+	GDBusMethodInvocation *invocation;
+	guint count;
+	guint pending;
+	gint32 results[];
+};
+
+static void _sms_send_batch_complete(struct sms_send_batch *batch)
+{
+	telephony_sms_complete_send_msg_batch(batch->sms, batch->invocation,
+			g_variant_new_fixed_array(G_VARIANT_TYPE_INT32, batch->results, batch->count, sizeof(gint32)));
+
+	g_free(batch);
+}
+
+static void _sms_send_batch_response(struct dbus_request_info *dbus_info, gint result)
+{
+	struct sms_send_batch *batch = dbus_info->batch;
+
+	dbus_info->batch = NULL;
+	batch->results[dbus_info->batch_index] = result;
+
+	if (--batch->pending == 0)
+		_sms_send_batch_complete(batch);
+}
+
+/* free hook: the request went away without a TRESP_SMS_SEND_UMTS_MSG */
+static void _sms_send_batch_abort(struct dbus_request_info *dbus_info)
+{
+	_sms_send_batch_response(dbus_info, SMS_BATCH_DISPATCH_FAILED);
+}
+
+static gboolean _sms_batch_entry_valid(GVariant *sca, GVariant *tpdu_data)
+{
+	return g_variant_get_size(sca) <= SMS_SMSP_ADDRESS_LEN
+			&& g_variant_get_size(tpdu_data) <= SMS_SMDATA_SIZE_MAX + 1;
+}
+
+static gboolean
+on_sms_send_msg_batch(TelephonySms *sms, GDBusMethodInvocation *invocation,
+	GVariant *msgs,
+	gpointer user_data)
+{
+	struct treq_sms_send_umts_msg sendUmtsMsg;
+	struct custom_data *ctx = user_data;
+	struct sms_send_batch *batch;
+	struct dbus_request_info *dbus_info;
+	UserRequest *ur = NULL;
+	GVariantIter iter;
+	GVariant *sca;
+	GVariant *tpdu_data;
+	gsize length;
+	guint count;
+	guint i = 0;
+	gint last_valid = -1;
+
+	count = g_variant_n_children(msgs);
+	if (count == 0) {
+		telephony_sms_complete_send_msg_batch(sms, invocation,
+				g_variant_new_fixed_array(G_VARIANT_TYPE_INT32, NULL, 0, sizeof(gint32)));
+		return TRUE;
+	}
+
+	batch = g_malloc0(sizeof(struct sms_send_batch) + count * sizeof(gint32));
+	batch->sms = sms;
+	batch->invocation = invocation;
+	batch->count = count;
+
+	/* hold off completion until every message has been queued */
+	batch->pending = 1;
+
+	/* more=0 must go out with the last message actually sent, not the last entry */
+	g_variant_iter_init(&iter, msgs);
+	while (g_variant_iter_next(&iter, "(@ay@ay)", &sca, &tpdu_data)) {
+		if (_sms_batch_entry_valid(sca, tpdu_data))
+			last_valid = i;
+
+		g_variant_unref(sca);
+		g_variant_unref(tpdu_data);
+		i++;
+	}
+
+	i = 0;
+	g_variant_iter_init(&iter, msgs);
+	while (g_variant_iter_next(&iter, "(@ay@ay)", &sca, &tpdu_data)) {
+		memset(&sendUmtsMsg, 0 , sizeof(struct treq_sms_send_umts_msg));
+		length = 0;
+
+		if (!_sms_copy_raw(sca, sendUmtsMsg.msgDataPackage.sca, SMS_SMSP_ADDRESS_LEN, NULL)
+				|| !_sms_copy_raw(tpdu_data, sendUmtsMsg.msgDataPackage.tpduData, SMS_SMDATA_SIZE_MAX + 1, &length)) {
+			batch->results[i] = SMS_BATCH_DISPATCH_FAILED;
+			goto NEXT;
+		}
+
+		sendUmtsMsg.msgDataPackage.msgLength = length;
+		sendUmtsMsg.more = ((gint)i < last_valid);
+
+		ur = MAKE_UR(ctx, sms, invocation);
+		dbus_info = dbus_plugin_ref_request_info(ur);
+		dbus_info->batch = batch;
+		dbus_info->batch_index = i;
+		dbus_info->batch_abort = _sms_send_batch_abort;
+
+		tcore_user_request_set_data(ur, sizeof(struct treq_sms_send_umts_msg), &sendUmtsMsg);
+		tcore_user_request_set_command(ur, TREQ_SMS_SEND_UMTS_MSG);
+
+		batch->pending++;
+		ret = dbus_plugin_dispatch_request(ctx, ur);
+		if (ret != TCORE_RETURN_SUCCESS) {
+			err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
+			dbus_info->batch = NULL;
+			tcore_user_request_unref(ur);
+			batch->pending--;
+			batch->results[i] = SMS_BATCH_DISPATCH_FAILED;
+		}
+
+NEXT:
+		g_variant_unref(sca);
+		g_variant_unref(tpdu_data);
+		i++;
+	}
+
+	if (--batch->pending == 0)
+		_sms_send_batch_complete(batch);
+
+	return TRUE;
+}
+
 /*
 
 static gboolean
@@ -258,25 +475,264 @@ on_sms_send_cdma_msg(TelephonySms *sms, GDBusMethodInvocation *invocation,
 
 */
 
+static gboolean _sms_read_msg(struct custom_data *ctx, TelephonySms *sms, GDBusMethodInvocation *invocation,
+	gint arg_index, gboolean raw)
+{
+	struct treq_sms_read_msg readMsg = {0,};
+	UserRequest *ur = NULL;
+	struct dbus_request_info *dbus_info;
+
+	readMsg.index = arg_index;
+
+	ur = MAKE_UR(ctx, sms, invocation);
+	dbus_info = dbus_plugin_ref_request_info(ur);
+	dbus_info->raw = raw;
+	tcore_user_request_set_data(ur, sizeof(struct treq_sms_read_msg), &readMsg);
+	tcore_user_request_set_command(ur, TREQ_SMS_READ_MSG);
+
+	ret = dbus_plugin_dispatch_request(ctx, ur);
+	if (ret != TCORE_RETURN_SUCCESS) {
+		// api_err = TAPI_API_OPERATION_FAILED;
+		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
+	}
+
+	return TRUE;
+}
+
 static gboolean
 on_sms_read_msg(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	gint arg_index,
 	gpointer user_data)
+{
+	return _sms_read_msg(user_data, sms, invocation, arg_index, FALSE);
+}
+
+static gboolean
+on_sms_read_msg_raw(TelephonySms *sms, GDBusMethodInvocation *invocation,
+	gint arg_index,
+	gpointer user_data)
+{
+	return _sms_read_msg(user_data, sms, invocation, arg_index, TRUE);
+}
+
+#define SMS_READ_RANGE_DEFAULT_IN_FLIGHT 4
+
+struct sms_read_range {
+	struct custom_data *ctx;
+	TelephonySms *sms;
+	GDBusMethodInvocation *invocation;
+	gboolean read_all;
+
+	GVariantBuilder msgs;
+	gint *indexes;
+	guint count;
+	guint next;
+	guint in_flight;
+	guint max_in_flight;
+	gboolean filling;
+
+	/* set once a read went away unanswered, the range then ends early */
+	gint result;
+};
+
+static struct sms_read_range *_sms_read_range_new(struct custom_data *ctx, TelephonySms *sms,
+		GDBusMethodInvocation *invocation, gint max_in_flight)
+{
+	struct sms_read_range *range;
+
+	range = g_new0(struct sms_read_range, 1);
+	range->ctx = ctx;
+	range->sms = sms;
+	range->invocation = invocation;
+	range->max_in_flight = (max_in_flight > 0) ? max_in_flight : SMS_READ_RANGE_DEFAULT_IN_FLIGHT;
+	g_variant_builder_init(&range->msgs, G_VARIANT_TYPE("a(iiiayay)"));
+
+	return range;
+}
+
+static void _sms_read_range_complete(struct sms_read_range *range, gint result)
+{
+	if (range->read_all)
+		telephony_sms_complete_read_all_msg(range->sms, range->invocation, result,
+				g_variant_builder_end(&range->msgs));
+	else
+		telephony_sms_complete_read_msg_range(range->sms, range->invocation, result,
+				g_variant_builder_end(&range->msgs));
+
+	g_free(range->indexes);
+	g_free(range);
+}
+
+static void _sms_read_range_add(struct sms_read_range *range, gint index, gint result, gint msg_status,
+		const unsigned char *sca, const unsigned char *tpdu, gint tpdu_length)
+{
+	g_variant_builder_add(&range->msgs, "(iii@ay@ay)", index, result, msg_status,
+			_sms_new_raw(sca, sca ? SMS_SMSP_ADDRESS_LEN : 0, SMS_SMSP_ADDRESS_LEN),
+			_sms_new_raw(tpdu, tpdu_length, SMS_SMDATA_SIZE_MAX + 1));
+}
+
+static void _sms_read_range_fill(struct sms_read_range *range)
 {
 	struct treq_sms_read_msg readMsg = {0,};
+	struct dbus_request_info *dbus_info;
+	UserRequest *ur = NULL;
+	guint position;
+
+	/* a response delivered from inside dispatch_request() lands here */
+	if (range->filling)
+		return;
+
+	range->filling = TRUE;
+
+	while (range->next < range->count && range->in_flight < range->max_in_flight) {
+		position = range->next++;
+		readMsg.index = range->indexes[position];
+
+		ur = MAKE_UR(range->ctx, range->sms, range->invocation);
+		dbus_info = dbus_plugin_ref_request_info(ur);
+		dbus_info->batch = range;
+		dbus_info->batch_index = position;
+		dbus_info->batch_abort = _sms_read_range_abort;
+
+		tcore_user_request_set_data(ur, sizeof(struct treq_sms_read_msg), &readMsg);
+		tcore_user_request_set_command(ur, TREQ_SMS_READ_MSG);
+
+		range->in_flight++;
+		ret = dbus_plugin_dispatch_request(range->ctx, ur);
+		if (ret != TCORE_RETURN_SUCCESS) {
+			err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
+			dbus_info->batch = NULL;
+			tcore_user_request_unref(ur);
+			range->in_flight--;
+			_sms_read_range_add(range, readMsg.index, SMS_BATCH_DISPATCH_FAILED, 0, NULL, NULL, 0);
+		}
+	}
+
+	range->filling = FALSE;
+
+	if (range->in_flight == 0 && range->next >= range->count)
+		_sms_read_range_complete(range, range->result);
+}
+
+static void _sms_read_range_response(struct dbus_request_info *dbus_info, const struct tresp_sms_read_msg *resp)
+{
+	struct sms_read_range *range = dbus_info->batch;
+
+	dbus_info->batch = NULL;
+	_sms_read_range_add(range, range->indexes[dbus_info->batch_index], resp->result,
+			resp->dataInfo.msgStatus,
+			resp->dataInfo.smsData.sca,
+			resp->dataInfo.smsData.tpduData,
+			resp->dataInfo.smsData.msgLength);
+
+	range->in_flight--;
+	_sms_read_range_fill(range);
+}
+
+/*
+ * free hook: a read went away without a response. Stop issuing new reads
+ * and, once the ones still in flight are back, complete with the rows read
+ * so far and an error result.
+ */
+static void _sms_read_range_abort(struct dbus_request_info *dbus_info)
+{
+	struct sms_read_range *range = dbus_info->batch;
+
+	dbus_info->batch = NULL;
+	_sms_read_range_add(range, range->indexes[dbus_info->batch_index], SMS_BATCH_DISPATCH_FAILED, 0, NULL, NULL, 0);
+
+	range->result = SMS_BATCH_DISPATCH_FAILED;
+	range->next = range->count;
+	range->in_flight--;
+	_sms_read_range_fill(range);
+}
+
+static void _sms_read_all_response(struct dbus_request_info *dbus_info, const struct tresp_sms_get_storedMsgCnt *resp)
+{
+	struct sms_read_range *range = dbus_info->batch;
+	gint used = resp->storedMsgCnt.usedCount;
+	guint i;
+
+	dbus_info->batch = NULL;
+
+	if (resp->result != 0) {
+		_sms_read_range_complete(range, resp->result);
+		return;
+	}
+
+	if (used < 0)
+		used = 0;
+
+	range->count = MIN((guint)used, G_N_ELEMENTS(resp->storedMsgCnt.indexList));
+	range->indexes = g_new0(gint, range->count + 1);
+	for (i = 0; i < range->count; i++)
+		range->indexes[i] = resp->storedMsgCnt.indexList[i];
+
+	_sms_read_range_fill(range);
+}
+
+/* free hook: the TREQ_SMS_GET_COUNT went away, nothing has been read yet */
+static void _sms_read_all_abort(struct dbus_request_info *dbus_info)
+{
+	struct sms_read_range *range = dbus_info->batch;
+
+	dbus_info->batch = NULL;
+	_sms_read_range_complete(range, SMS_BATCH_DISPATCH_FAILED);
+}
+
+static gboolean
+on_sms_read_msg_range(TelephonySms *sms, GDBusMethodInvocation *invocation,
+	GVariant *arg_indexes,
+	gint arg_max_in_flight,
+	gpointer user_data)
+{
 	struct custom_data *ctx = user_data;
+	struct sms_read_range *range;
+	const gint32 *indexes;
+	gsize count = 0;
+
+	range = _sms_read_range_new(ctx, sms, invocation, arg_max_in_flight);
+
+	indexes = g_variant_get_fixed_array(arg_indexes, &count, sizeof(gint32));
+	range->count = count;
+	range->indexes = g_new0(gint, count + 1);
+	if (count)
+		memcpy(range->indexes, indexes, count * sizeof(gint32));
+
+	_sms_read_range_fill(range);
+
+	return TRUE;
+}
+
+static gboolean
+on_sms_read_all_msg(TelephonySms *sms, GDBusMethodInvocation *invocation,
+	gint arg_max_in_flight,
+	gpointer user_data)
+{
+	struct treq_sms_get_msg_count getMsgCnt;
+	struct custom_data *ctx = user_data;
+	struct sms_read_range *range;
+	struct dbus_request_info *dbus_info;
 	UserRequest *ur = NULL;
 
-	readMsg.index = arg_index;
+	range = _sms_read_range_new(ctx, sms, invocation, arg_max_in_flight);
+	range->read_all = TRUE;
+
+	memset(&getMsgCnt, 0, sizeof(struct treq_sms_get_msg_count));
 
 	ur = MAKE_UR(ctx, sms, invocation);
-	tcore_user_request_set_data(ur, sizeof(struct treq_sms_read_msg), &readMsg);
-	tcore_user_request_set_command(ur, TREQ_SMS_READ_MSG);
+	dbus_info = dbus_plugin_ref_request_info(ur);
+	dbus_info->batch = range;
+	dbus_info->batch_abort = _sms_read_all_abort;
+
+	tcore_user_request_set_data(ur, sizeof(struct treq_sms_get_msg_count), &getMsgCnt);
+	tcore_user_request_set_command(ur, TREQ_SMS_GET_COUNT);
 
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
-		// api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
+		dbus_info->batch = NULL;
+		_sms_read_range_complete(range, SMS_BATCH_DISPATCH_FAILED);
 	}
 
 	return TRUE;
@@ -318,7 +774,7 @@ on_sms_save_msg(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	if(decoded_tpdu)
 		g_free(decoded_tpdu);
 	
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		// api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
@@ -327,6 +783,41 @@ on_sms_save_msg(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	return TRUE;
 }
 
+static gboolean
+on_sms_save_msg_raw(TelephonySms *sms, GDBusMethodInvocation *invocation,
+	gint arg_msg_status,
+	GVariant *arg_sca,
+	GVariant *arg_tpdu_data,
+	gpointer user_data)
+{
+	struct treq_sms_save_msg saveMsg = {0,};
+	struct custom_data *ctx = user_data;
+	UserRequest *ur = NULL;
+	struct dbus_request_info *dbus_info;
+	gsize length = 0;
+
+	saveMsg.msgStatus = arg_msg_status;
+
+	if (!_sms_copy_raw(arg_sca, saveMsg.msgDataPackage.sca, SMS_SMSP_ADDRESS_LEN, NULL)
+			|| !_sms_copy_raw(arg_tpdu_data, saveMsg.msgDataPackage.tpduData, SMS_SMDATA_SIZE_MAX + 1, &length))
+		return _sms_return_invalid_raw(invocation);
+
+	saveMsg.msgDataPackage.msgLength = length;
+
+	ur = MAKE_UR(ctx, sms, invocation);
+	dbus_info = dbus_plugin_ref_request_info(ur);
+	dbus_info->raw = TRUE;
+	tcore_user_request_set_data(ur, sizeof(struct treq_sms_save_msg), &saveMsg);
+	tcore_user_request_set_command(ur, TREQ_SMS_SAVE_MSG);
+
+	ret = dbus_plugin_dispatch_request(ctx, ur);
+	if (ret != TCORE_RETURN_SUCCESS) {
+		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
+	}
+
+	return TRUE;
+}
+
 static gboolean
 on_sms_delete_msg(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	gint arg_index,
@@ -342,7 +833,7 @@ on_sms_delete_msg(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	tcore_user_request_set_data(ur, sizeof(struct treq_sms_delete_msg), &deleteMsg);
 	tcore_user_request_set_command(ur, TREQ_SMS_DELETE_MSG);
 
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		// api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
@@ -363,7 +854,7 @@ on_sms_get_msg_count(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	tcore_user_request_set_data(ur, sizeof(struct treq_sms_get_msg_count), &getMsgCnt);
 	tcore_user_request_set_command(ur, TREQ_SMS_GET_COUNT);
 
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		// api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
@@ -383,15 +874,17 @@ on_sms_get_sca(TelephonySms *sms, GDBusMethodInvocation *invocation,
 
 	getSca.index = arg_index;
 
-	ur = MAKE_UR(ctx, sms, invocation);
-	tcore_user_request_set_data(ur, sizeof(struct treq_sms_get_sca), &getSca);
-	tcore_user_request_set_command(ur, TREQ_SMS_GET_SCA);
+	ur = MAKE_SHARED_UR(ctx, sms, invocation, TREQ_SMS_GET_SCA, &getSca, sizeof(struct treq_sms_get_sca));
+	if (!ur)
+		return TRUE;
 
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		// api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
-		return  FALSE;
+		g_dbus_method_invocation_return_error(invocation, G_DBUS_ERROR, G_DBUS_ERROR_FAILED,
+				"request (0x%x) dispatch failed", TREQ_SMS_GET_SCA);
+		tcore_user_request_unref(ur);
 	}
 
 	return TRUE;
@@ -443,7 +936,7 @@ on_sms_set_sca(TelephonySms *sms, GDBusMethodInvocation *invocation,
 		if(decoded_sca)
 			g_free(decoded_sca);
 		
-		ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+		ret = dbus_plugin_dispatch_request(ctx, ur);
 		if (ret != TCORE_RETURN_SUCCESS) {
 			//api_err = TAPI_API_OPERATION_FAILED;
 			err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
@@ -466,7 +959,7 @@ on_sms_get_cb_config(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	tcore_user_request_set_data(ur, sizeof(struct treq_sms_get_cb_config), &getCbConfig);
 	tcore_user_request_set_command(ur, TREQ_SMS_GET_CB_CONFIG);
 
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		//api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
@@ -507,7 +1000,7 @@ on_sms_set_cb_config(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	if(decoded_msgId)
 		g_free(decoded_msgId);
 	
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		//api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
@@ -532,7 +1025,7 @@ on_sms_set_mem_status(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	tcore_user_request_set_data(ur, sizeof(struct treq_sms_set_mem_status), &memStatus);
 	tcore_user_request_set_command(ur, TREQ_SMS_SET_MEM_STATUS);
 
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		//api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
@@ -554,7 +1047,7 @@ on_sms_get_pref_bearer(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	tcore_user_request_set_data(ur, sizeof(struct treq_sms_get_pref_bearer), &getPrefBearer);
 	tcore_user_request_set_command(ur, TREQ_SMS_GET_PREF_BEARER);
 
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		//api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
@@ -578,7 +1071,7 @@ on_sms_set_pref_bearer(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	tcore_user_request_set_data(ur, sizeof(struct treq_sms_set_pref_bearer), &setPrefBearer);
 	tcore_user_request_set_command(ur, TREQ_SMS_SET_PREF_BEARER);
 
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		//api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
@@ -626,7 +1119,7 @@ on_sms_set_delivery_report(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	if(decoded_tpdu)
 		g_free(decoded_tpdu);
 
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		//api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
@@ -636,6 +1129,43 @@ on_sms_set_delivery_report(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	return TRUE;
 }
 
+static gboolean
+on_sms_set_delivery_report_raw(TelephonySms *sms, GDBusMethodInvocation *invocation,
+	GVariant *arg_sca,
+	GVariant *arg_tpdu_data,
+	gint arg_rpCause,
+	gpointer user_data)
+{
+	struct treq_sms_set_delivery_report deliveryReport;
+	struct custom_data *ctx = user_data;
+	UserRequest *ur = NULL;
+	struct dbus_request_info *dbus_info;
+	gsize length = 0;
+
+	memset(&deliveryReport, 0, sizeof(struct treq_sms_set_delivery_report));
+
+	if (!_sms_copy_raw(arg_sca, deliveryReport.dataInfo.sca, SMS_SMSP_ADDRESS_LEN, NULL)
+			|| !_sms_copy_raw(arg_tpdu_data, deliveryReport.dataInfo.tpduData, SMS_SMDATA_SIZE_MAX + 1, &length))
+		return _sms_return_invalid_raw(invocation);
+
+	deliveryReport.dataInfo.msgLength = length;
+	deliveryReport.rspType = arg_rpCause;
+
+	ur = MAKE_UR(ctx, sms, invocation);
+	dbus_info = dbus_plugin_ref_request_info(ur);
+	dbus_info->raw = TRUE;
+	tcore_user_request_set_data(ur, sizeof(struct treq_sms_set_delivery_report), &deliveryReport);
+	tcore_user_request_set_command(ur, TREQ_SMS_SET_DELIVERY_REPORT);
+
+	ret = dbus_plugin_dispatch_request(ctx, ur);
+	if (ret != TCORE_RETURN_SUCCESS) {
+		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
+		return  FALSE;
+	}
+
+	return TRUE;
+}
+
 static gboolean
 on_sms_set_msg_status(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	gint arg_index,
@@ -653,7 +1183,7 @@ on_sms_set_msg_status(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	tcore_user_request_set_data(ur, sizeof(struct treq_sms_set_msg_status), &msgStatus);
 	tcore_user_request_set_command(ur, TREQ_SMS_SET_MSG_STATUS);
 
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		//api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
@@ -678,7 +1208,7 @@ on_sms_get_sms_params(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	tcore_user_request_set_data(ur, sizeof(struct treq_sms_get_params), &getParams);
 	tcore_user_request_set_command(ur, TREQ_SMS_GET_PARAMS);
 
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		//api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
@@ -755,7 +1285,7 @@ on_sms_set_sms_params(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	if(decoded_scaDialNum)
 		g_free(decoded_scaDialNum);
 
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		//api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
@@ -777,7 +1307,7 @@ on_sms_get_sms_param_cnt(TelephonySms *sms, GDBusMethodInvocation *invocation,
 	tcore_user_request_set_data(ur, sizeof(struct treq_sms_get_paramcnt), &getParamCnt);
 	tcore_user_request_set_command(ur, TREQ_SMS_GET_PARAMCNT);
 
-	ret = tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
 	if (ret != TCORE_RETURN_SUCCESS) {
 		//api_err = TAPI_API_OPERATION_FAILED;
 		err("[tcore_SMS] communicator_dispatch_request is fail [0x%x] !!!", ret);
@@ -827,8 +1357,14 @@ gboolean dbus_plugin_setup_sms_interface(TelephonyObjectSkeleton *object, struct
 	g_object_unref(sms);
 
 	g_signal_connect(sms, "handle-send-msg", G_CALLBACK (on_sms_send_msg), ctx);
+	g_signal_connect(sms, "handle-send-msg-raw", G_CALLBACK (on_sms_send_msg_raw), ctx);
+	g_signal_connect(sms, "handle-send-msg-batch", G_CALLBACK (on_sms_send_msg_batch), ctx);
 	g_signal_connect(sms, "handle-read-msg", G_CALLBACK (on_sms_read_msg), ctx);
+	g_signal_connect(sms, "handle-read-msg-raw", G_CALLBACK (on_sms_read_msg_raw), ctx);
+	g_signal_connect(sms, "handle-read-msg-range", G_CALLBACK (on_sms_read_msg_range), ctx);
+	g_signal_connect(sms, "handle-read-all-msg", G_CALLBACK (on_sms_read_all_msg), ctx);
 	g_signal_connect(sms, "handle-save-msg", G_CALLBACK (on_sms_save_msg), ctx);
+	g_signal_connect(sms, "handle-save-msg-raw", G_CALLBACK (on_sms_save_msg_raw), ctx);
 	g_signal_connect(sms, "handle-delete-msg", G_CALLBACK (on_sms_delete_msg), ctx);
 	g_signal_connect(sms, "handle-get-msg-count", G_CALLBACK (on_sms_get_msg_count), ctx);
 	g_signal_connect(sms, "handle-get-sca", G_CALLBACK (on_sms_get_sca), ctx);
@@ -839,6 +1375,7 @@ gboolean dbus_plugin_setup_sms_interface(TelephonyObjectSkeleton *object, struct
 	g_signal_connect(sms, "handle-get-pref-bearer", G_CALLBACK (on_sms_get_pref_bearer), ctx);
 	g_signal_connect(sms, "handle-set-pref-bearer", G_CALLBACK (on_sms_set_pref_bearer), ctx);
 	g_signal_connect(sms, "handle-set-delivery-report", G_CALLBACK (on_sms_set_delivery_report), ctx);
+	g_signal_connect(sms, "handle-set-delivery-report-raw", G_CALLBACK (on_sms_set_delivery_report_raw), ctx);
 	g_signal_connect(sms, "handle-set-msg-status", G_CALLBACK (on_sms_set_msg_status), ctx);
 	g_signal_connect(sms, "handle-get-sms-params", G_CALLBACK (on_sms_get_sms_params), ctx);
 	g_signal_connect(sms, "handle-set-sms-params", G_CALLBACK (on_sms_set_sms_params), ctx);
@@ -848,688 +1385,727 @@ gboolean dbus_plugin_setup_sms_interface(TelephonyObjectSkeleton *object, struct
 	return TRUE;
 }
 
-gboolean dbus_plugin_sms_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+static gboolean _sms_send_umts_msg_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
 {
-	GSList *co_list;
-	CoreObject *co_sms;
-	char *modem_name = NULL;
-	TcorePlugin *p = NULL;
-	int i;
-
-	modem_name = tcore_user_request_get_modem_name(ur);
-	if (!modem_name)
-		return FALSE;
-
-	p = tcore_server_find_plugin(ctx->server, modem_name);
-	free(modem_name);
-	if (!p)
-		return FALSE;
-
-	co_list = tcore_plugin_get_core_objects_bytype(p, CORE_OBJECT_TYPE_SMS);
-	if (!co_list) {
-		return FALSE;
-	}
-
-	co_sms = (CoreObject *)co_list->data;
-	g_slist_free(co_list);
-
-	if (!co_sms) {
-		return FALSE;
-	}
-
-	switch (command) {
-		case TRESP_SMS_SEND_UMTS_MSG: {
-			const struct tresp_sms_send_umts_msg *resp = data;
+	const struct tresp_sms_send_umts_msg *resp = data;
 
+	dbg("receive TRESP_SMS_SEND_UMTS_MSG");
+	dbg("resp->result = 0x%x", resp->result);
 
-			dbg("receive TRESP_SMS_SEND_UMTS_MSG");
-			dbg("resp->result = 0x%x", resp->result);
-
-			telephony_sms_complete_send_msg(dbus_info->interface_object, dbus_info->invocation, resp->result);
+	if (dbus_info->batch)
+		_sms_send_batch_response(dbus_info, resp->result);
+	else if (dbus_info->raw)
+		telephony_sms_complete_send_msg_raw(dbus_info->interface_object, dbus_info->invocation, resp->result);
+	else
+		telephony_sms_complete_send_msg(dbus_info->interface_object, dbus_info->invocation, resp->result);
 
-			}
-			break;
+	return TRUE;
+}
 
-		case TRESP_SMS_SEND_CDMA_MSG: {
-			const struct tresp_sms_send_cdma_msg *resp = data;
+static gboolean _sms_send_cdma_msg_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_sms_send_cdma_msg *resp = data;
 
-			dbg("receive TRESP_SMS_SEND_CDMA_MSG");
-			dbg("resp->result = 0x%x", resp->result);
+	dbg("receive TRESP_SMS_SEND_CDMA_MSG");
+	dbg("resp->result = 0x%x", resp->result);
 #if 0
-			resp->result
-			resp->causeCode.ReplySeqNumber
-			resp->causeCode.ErrClass
-			resp->causeCode.Cause
+	resp->result
+	resp->causeCode.ReplySeqNumber
+	resp->causeCode.ErrClass
+	resp->causeCode.Cause
 #endif
-			}
-			break;
 
-		case TRESP_SMS_READ_MSG: {
-			const struct tresp_sms_read_msg *resp = data;
-			gchar *sca = NULL;
-			gchar *tpdu = NULL;			
+	return TRUE;
+}
 
-			dbg("receive TRESP_SMS_READ_MSG");
-			dbg("resp->result = 0x%x", resp->result);
+static gboolean _sms_read_msg_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_sms_read_msg *resp = data;
+	gchar *sca = NULL;
+	gchar *tpdu = NULL;			
 
-			sca = g_base64_encode((const guchar *)&(resp->dataInfo.smsData.sca[0]), SMS_SMSP_ADDRESS_LEN);
-			if (sca == NULL) {
-				dbg("g_base64_encode: Failed to Enocde the SCA.");
-				sca = "";
-			}
+	dbg("receive TRESP_SMS_READ_MSG");
+	dbg("resp->result = 0x%x", resp->result);
 
-			tpdu = g_base64_encode((const guchar *)&(resp->dataInfo.smsData.tpduData[0]), SMS_SMDATA_SIZE_MAX + 1);
-			if (sca == NULL) {
-				dbg("g_base64_encode: Failed to Enocde the SCA.");
-				tpdu = "";
-			}
+	if (dbus_info->batch) {
+		_sms_read_range_response(dbus_info, resp);
+		return TRUE;
+	}
 
-			telephony_sms_complete_read_msg(dbus_info->interface_object, dbus_info->invocation, 
-				resp->result, 
-				resp->dataInfo.msgStatus, 
-				sca, 
-				resp->dataInfo.smsData.msgLength, 
-				tpdu);
+	if (dbus_info->raw) {
+		telephony_sms_complete_read_msg_raw(dbus_info->interface_object, dbus_info->invocation,
+			resp->result,
+			resp->dataInfo.msgStatus,
+			_sms_new_raw(resp->dataInfo.smsData.sca, SMS_SMSP_ADDRESS_LEN, SMS_SMSP_ADDRESS_LEN),
+			_sms_new_raw(resp->dataInfo.smsData.tpduData, resp->dataInfo.smsData.msgLength, SMS_SMDATA_SIZE_MAX + 1));
+		return TRUE;
+	}
 
-			if (sca)
-				g_free(sca);
+	sca = g_base64_encode((const guchar *)&(resp->dataInfo.smsData.sca[0]), SMS_SMSP_ADDRESS_LEN);
+	if (sca == NULL) {
+		dbg("g_base64_encode: Failed to Enocde the SCA.");
+		sca = "";
+	}
 
-			if (tpdu)
-				g_free(tpdu);
+	tpdu = g_base64_encode((const guchar *)&(resp->dataInfo.smsData.tpduData[0]), SMS_SMDATA_SIZE_MAX + 1);
+	if (sca == NULL) {
+		dbg("g_base64_encode: Failed to Enocde the SCA.");
+		tpdu = "";
+	}
 
-			}
-			break;
+	telephony_sms_complete_read_msg(dbus_info->interface_object, dbus_info->invocation, 
+		resp->result, 
+		resp->dataInfo.msgStatus, 
+		sca, 
+		resp->dataInfo.smsData.msgLength, 
+		tpdu);
 
-		case TRESP_SMS_SAVE_MSG: {
-			const struct tresp_sms_save_msg *resp = data;
+	if (sca)
+		g_free(sca);
 
-			dbg("receive TRESP_SMS_SAVE_MSG");
-			dbg("resp->result = 0x%x", resp->result);
+	if (tpdu)
+		g_free(tpdu);
 
-			telephony_sms_complete_save_msg (dbus_info->interface_object, dbus_info->invocation,
-				resp->result,
-				resp->index);
-			}
-			break;
+	return TRUE;
+}
 
-		case TRESP_SMS_DELETE_MSG: {
-			const struct tresp_sms_delete_msg *resp = data;
+static gboolean _sms_save_msg_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_sms_save_msg *resp = data;
 
-			dbg("receive TRESP_SMS_DELETE_MSG");
-			dbg("resp->result = 0x%x", resp->result);
+	dbg("receive TRESP_SMS_SAVE_MSG");
+	dbg("resp->result = 0x%x", resp->result);
 
-			telephony_sms_complete_delete_msg(dbus_info->interface_object, dbus_info->invocation,
-				resp->result);
+	if (dbus_info->raw)
+		telephony_sms_complete_save_msg_raw(dbus_info->interface_object, dbus_info->invocation,
+			resp->result,
+			resp->index);
+	else
+		telephony_sms_complete_save_msg (dbus_info->interface_object, dbus_info->invocation,
+			resp->result,
+			resp->index);
 
-			}
-			break;
+	return TRUE;
+}
 
-		case TRESP_SMS_GET_STORED_MSG_COUNT: {
-			const struct tresp_sms_get_storedMsgCnt *resp = data;
-			gchar *msgCnt = NULL;
+static gboolean _sms_delete_msg_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_sms_delete_msg *resp = data;
 
-			dbg("receive TRESP_SMS_GET_STORED_MSG_COUNT");
-			dbg("resp->result = 0x%x", resp->result);
+	dbg("receive TRESP_SMS_DELETE_MSG");
+	dbg("resp->result = 0x%x", resp->result);
 
-			msgCnt = g_base64_encode((const guchar *)&(resp->storedMsgCnt.indexList[0]), SMS_GSM_SMS_MSG_NUM_MAX + 1);
-			if (msgCnt == NULL) {
-				dbg("g_base64_encode: Failed to Enocde storedMsgCnt.indexList");
-				msgCnt = "";
-			}
+	telephony_sms_complete_delete_msg(dbus_info->interface_object, dbus_info->invocation,
+		resp->result);
 
-			telephony_sms_complete_get_msg_count(dbus_info->interface_object, dbus_info->invocation,
-				resp->result,
-				resp->storedMsgCnt.totalCount,
-				resp->storedMsgCnt.usedCount,
-				msgCnt);
+	return TRUE;
+}
 
-			if (msgCnt)
-				g_free(msgCnt);
-			}
+static gboolean _sms_get_stored_msg_count_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_sms_get_storedMsgCnt *resp = data;
+	gchar *msgCnt = NULL;
 
-			break;
+	dbg("receive TRESP_SMS_GET_STORED_MSG_COUNT");
+	dbg("resp->result = 0x%x", resp->result);
 
-		case TRESP_SMS_GET_SCA: {
-			const struct tresp_sms_get_sca *resp = data;
-			gchar *sca = NULL;
+	if (dbus_info->batch) {
+		_sms_read_all_response(dbus_info, resp);
+		return TRUE;
+	}
 
-			dbg("receive TRESP_SMS_GET_SCA");
-			dbg("resp->result = 0x%x", resp->result);
+	msgCnt = g_base64_encode((const guchar *)&(resp->storedMsgCnt.indexList[0]), SMS_GSM_SMS_MSG_NUM_MAX + 1);
+	if (msgCnt == NULL) {
+		dbg("g_base64_encode: Failed to Enocde storedMsgCnt.indexList");
+		msgCnt = "";
+	}
 
-			sca = g_base64_encode((const guchar *)&(resp->scaAddress.diallingNum[0]), SMS_SMSP_ADDRESS_LEN + 1);
-			if (sca == NULL) {
-				dbg("g_base64_encode: Failed to Enocde scaAddress.diallingNum");
-				sca = "";
-			}
-			
-			telephony_sms_complete_get_sca(dbus_info->interface_object, dbus_info->invocation,
-				resp->result,
-				resp->scaAddress.typeOfNum,
-				resp->scaAddress.numPlanId,
-				resp->scaAddress.dialNumLen,
-				sca);
+	telephony_sms_complete_get_msg_count(dbus_info->interface_object, dbus_info->invocation,
+		resp->result,
+		resp->storedMsgCnt.totalCount,
+		resp->storedMsgCnt.usedCount,
+		msgCnt);
 
-			if (sca)
-				g_free(sca);
+	if (msgCnt)
+		g_free(msgCnt);
 
-			}
-			break;
+	return TRUE;
+}
 
-		case TRESP_SMS_SET_SCA: {
-			const struct tresp_sms_set_sca *resp = data;
+static gboolean _sms_get_sca_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_sms_get_sca *resp = data;
+	gchar *sca = NULL;
 
-			dbg("receive TRESP_SMS_SET_SCA");
-			dbg("resp->result = 0x%x", resp->result);
+	dbg("receive TRESP_SMS_GET_SCA");
+	dbg("resp->result = 0x%x", resp->result);
 
-			telephony_sms_complete_set_sca(dbus_info->interface_object, dbus_info->invocation,
-				resp->result);
+	sca = g_base64_encode((const guchar *)&(resp->scaAddress.diallingNum[0]), SMS_SMSP_ADDRESS_LEN + 1);
+	if (sca == NULL) {
+		dbg("g_base64_encode: Failed to Enocde scaAddress.diallingNum");
+		sca = "";
+	}
 
-			}
-			break;
+	telephony_sms_complete_get_sca(dbus_info->interface_object, dbus_info->invocation,
+		resp->result,
+		resp->scaAddress.typeOfNum,
+		resp->scaAddress.numPlanId,
+		resp->scaAddress.dialNumLen,
+		sca);
 
-		case TRESP_SMS_GET_CB_CONFIG: {
-			const struct tresp_sms_get_cb_config *resp = data;
-			GVariant *result = NULL;
-			GVariantBuilder b;
-
-			dbg("receive TRESP_SMS_GET_CB_CONFIG");
-			dbg("resp->result = 0x%x", resp->result);
-
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
-
-			for (i = 0; i < resp->cbConfig.msgIdRangeCount; i++) {
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-
-				if( resp->cbConfig.net3gppType == SMS_NETTYPE_3GPP ) {
-					g_variant_builder_add(&b, "{sv}", "FromMsgId", g_variant_new_uint16(resp->cbConfig.msgIDs[i].net3gpp.fromMsgId));
-					g_variant_builder_add(&b, "{sv}", "ToMsgId", g_variant_new_uint16(resp->cbConfig.msgIDs[i].net3gpp.toMsgId));
-				} else if( resp->cbConfig.net3gppType == SMS_NETTYPE_3GPP2) {
-					g_variant_builder_add(&b, "{sv}", "CBCategory", g_variant_new_uint16(resp->cbConfig.msgIDs[i].net3gpp2.cbCategory));
-					g_variant_builder_add(&b, "{sv}", "CBLanguage", g_variant_new_uint16(resp->cbConfig.msgIDs[i].net3gpp2.cbLanguage));				
-				} else {
-					dbg("Unknown 3gpp type");
-					return FALSE;
-				}
-			
-				g_variant_builder_add(&b, "{sv}", "Selected", g_variant_new_byte(resp->cbConfig.msgIDs[i].net3gpp.selected));
-			
-				g_variant_builder_close(&b);
-			}
-			
-			result = g_variant_builder_end(&b);
-
-			telephony_sms_complete_get_cb_config(dbus_info->interface_object, dbus_info->invocation,
-				resp->result,
-				resp->cbConfig.net3gppType,
-				resp->cbConfig.cbEnabled,
-				resp->cbConfig.msgIdMaxCount,
-				resp->cbConfig.msgIdRangeCount,
-				result);
-			}
-			break;
+	if (sca)
+		g_free(sca);
 
-		case TRESP_SMS_SET_CB_CONFIG: {
-			const struct tresp_sms_set_cb_config *resp = data;
+	return TRUE;
+}
 
-			dbg("receive TRESP_SMS_SET_CB_CONFIG");
-			dbg("resp->result = 0x%x", resp->result);
+static gboolean _sms_set_sca_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_sms_set_sca *resp = data;
 
-			telephony_sms_complete_set_cb_config(dbus_info->interface_object, dbus_info->invocation,
-				resp->result);
+	dbg("receive TRESP_SMS_SET_SCA");
+	dbg("resp->result = 0x%x", resp->result);
 
-			}
-			break;
+	telephony_sms_complete_set_sca(dbus_info->interface_object, dbus_info->invocation,
+		resp->result);
 
-		case TRESP_SMS_SET_MEM_STATUS: {
-			const struct tresp_sms_set_mem_status *resp = data;
+	return TRUE;
+}
 
-			dbg("receive TRESP_SMS_SET_MEM_STATUS");
-			dbg("resp->result = 0x%x", resp->result);
+static gboolean _sms_get_cb_config_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	int i;
+	const struct tresp_sms_get_cb_config *resp = data;
+	GVariant *result = NULL;
+	GVariantBuilder b;
+
+	dbg("receive TRESP_SMS_GET_CB_CONFIG");
+	dbg("resp->result = 0x%x", resp->result);
+
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+
+	for (i = 0; i < resp->cbConfig.msgIdRangeCount; i++) {
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+
+		if( resp->cbConfig.net3gppType == SMS_NETTYPE_3GPP ) {
+			g_variant_builder_add(&b, "{sv}", "FromMsgId", g_variant_new_uint16(resp->cbConfig.msgIDs[i].net3gpp.fromMsgId));
+			g_variant_builder_add(&b, "{sv}", "ToMsgId", g_variant_new_uint16(resp->cbConfig.msgIDs[i].net3gpp.toMsgId));
+		} else if( resp->cbConfig.net3gppType == SMS_NETTYPE_3GPP2) {
+			g_variant_builder_add(&b, "{sv}", "CBCategory", g_variant_new_uint16(resp->cbConfig.msgIDs[i].net3gpp2.cbCategory));
+			g_variant_builder_add(&b, "{sv}", "CBLanguage", g_variant_new_uint16(resp->cbConfig.msgIDs[i].net3gpp2.cbLanguage));				
+		} else {
+			dbg("Unknown 3gpp type");
+			return FALSE;
+		}
 
-			telephony_sms_complete_set_mem_status(dbus_info->interface_object, dbus_info->invocation,
-				resp->result);
+		g_variant_builder_add(&b, "{sv}", "Selected", g_variant_new_byte(resp->cbConfig.msgIDs[i].net3gpp.selected));
 
-			}
-			break;
-		case TRESP_SMS_GET_PREF_BEARER: {
-			const struct tresp_sms_get_pref_bearer *resp = data;
+		g_variant_builder_close(&b);
+	}
 
-			dbg("receive TRESP_SMS_GET_PREF_BEARER");
-			dbg("resp->result = 0x%x", resp->result);
+	result = g_variant_builder_end(&b);
 
-			telephony_sms_complete_get_pref_bearer(dbus_info->interface_object, dbus_info->invocation,
-				resp->result);
+	telephony_sms_complete_get_cb_config(dbus_info->interface_object, dbus_info->invocation,
+		resp->result,
+		resp->cbConfig.net3gppType,
+		resp->cbConfig.cbEnabled,
+		resp->cbConfig.msgIdMaxCount,
+		resp->cbConfig.msgIdRangeCount,
+		result);
 
-			}
-			break;
+	return TRUE;
+}
 
-		case TRESP_SMS_SET_PREF_BEARER: {
-			const struct tresp_sms_set_pref_bearer *resp = data;
+static gboolean _sms_set_cb_config_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_sms_set_cb_config *resp = data;
 
-			dbg("receive TRESP_SMS_SET_PREF_BEARER");
-			dbg("resp->result = 0x%x", resp->result);
+	dbg("receive TRESP_SMS_SET_CB_CONFIG");
+	dbg("resp->result = 0x%x", resp->result);
 
-			telephony_sms_complete_set_pref_bearer(dbus_info->interface_object, dbus_info->invocation,
-				resp->result);
+	telephony_sms_complete_set_cb_config(dbus_info->interface_object, dbus_info->invocation,
+		resp->result);
 
-			}
-			break;
+	return TRUE;
+}
 
-		case TRESP_SMS_SET_DELIVERY_REPORT: {
-			const struct tresp_sms_set_delivery_report *resp = data;
+static gboolean _sms_set_mem_status_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_sms_set_mem_status *resp = data;
 
-			dbg("receive TRESP_SMS_SET_DELIVERY_REPORT");
-			dbg("resp->result = 0x%x", resp->result);
+	dbg("receive TRESP_SMS_SET_MEM_STATUS");
+	dbg("resp->result = 0x%x", resp->result);
 
-			telephony_sms_complete_set_delivery_report(dbus_info->interface_object, dbus_info->invocation,
-				resp->result);
+	telephony_sms_complete_set_mem_status(dbus_info->interface_object, dbus_info->invocation,
+		resp->result);
 
-			}
-			break;
+	return TRUE;
+}
 
-		case TRESP_SMS_SET_MSG_STATUS: {
-			const struct tresp_sms_set_mem_status *resp = data;
+static gboolean _sms_get_pref_bearer_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_sms_get_pref_bearer *resp = data;
 
-			dbg("receive TRESP_SMS_SET_MSG_STATUS");
-			dbg("resp->result = 0x%x", resp->result);
+	dbg("receive TRESP_SMS_GET_PREF_BEARER");
+	dbg("resp->result = 0x%x", resp->result);
 
-			telephony_sms_complete_set_msg_status(dbus_info->interface_object, dbus_info->invocation,
-				resp->result);
+	telephony_sms_complete_get_pref_bearer(dbus_info->interface_object, dbus_info->invocation,
+		resp->result);
 
-			}
-			break;
+	return TRUE;
+}
 
-		case TRESP_SMS_GET_PARAMS: {
-			const struct tresp_sms_get_params *resp = data;
-			gchar *alphaId = NULL;
-			gchar *destDialNum = NULL;
-			gchar *scaDialNum = NULL;
+static gboolean _sms_set_pref_bearer_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_sms_set_pref_bearer *resp = data;
 
-			dbg("receive TRESP_SMS_GET_PARAMS");
-			dbg("resp->result = 0x%x", resp->result);
+	dbg("receive TRESP_SMS_SET_PREF_BEARER");
+	dbg("resp->result = 0x%x", resp->result);
 
-			alphaId = g_base64_encode((const guchar *)&(resp->paramsInfo.szAlphaId[0]), SMS_SMSP_ALPHA_ID_LEN_MAX + 1);
-			if (alphaId == NULL) {
-				dbg("g_base64_encode: Failed to Enocde paramsInfo.szAlphaId");
-				alphaId = "";
-			}
+	telephony_sms_complete_set_pref_bearer(dbus_info->interface_object, dbus_info->invocation,
+		resp->result);
 
-			destDialNum = g_base64_encode((const guchar *)&(resp->paramsInfo.tpDestAddr.diallingNum[0]), SMS_SMSP_ADDRESS_LEN + 1);
-			if (alphaId == NULL) {
-				dbg("g_base64_encode: Failed to Enocde paramsInfo.tpDestAddr.diallingNum");
-				alphaId = "";
-			}
+	return TRUE;
+}
 
-			scaDialNum = g_base64_encode((const guchar *)&(resp->paramsInfo.tpSvcCntrAddr.diallingNum[0]), SMS_SMSP_ADDRESS_LEN + 1);
-			if (alphaId == NULL) {
-				dbg("g_base64_encode: Failed to Enocde paramsInfo.tpSvcCntrAddr.diallingNum");
-				alphaId = "";
-			}
+static gboolean _sms_set_delivery_report_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_sms_set_delivery_report *resp = data;
 
-			telephony_sms_complete_get_sms_params(dbus_info->interface_object, dbus_info->invocation,
-				resp->result,
-				resp->paramsInfo.recordIndex,
-				resp->paramsInfo.recordLen,
-				resp->paramsInfo.alphaIdLen,
-				alphaId,
-				resp->paramsInfo.paramIndicator,
-				resp->paramsInfo.tpDestAddr.dialNumLen,
-				resp->paramsInfo.tpDestAddr.typeOfNum,
-				resp->paramsInfo.tpDestAddr.numPlanId,
-				destDialNum,
-				resp->paramsInfo.tpSvcCntrAddr.dialNumLen,
-				resp->paramsInfo.tpSvcCntrAddr.typeOfNum,
-				resp->paramsInfo.tpSvcCntrAddr.numPlanId,
-				scaDialNum,
-				resp->paramsInfo.tpProtocolId,
-				resp->paramsInfo.tpDataCodingScheme,
-				resp->paramsInfo.tpValidityPeriod);
-
-			if(alphaId)
-				g_free(alphaId);
-
-			if(destDialNum)
-				g_free(destDialNum);
-
-			if(scaDialNum)
-				g_free(scaDialNum);
-			
-			}
-			break;
+	dbg("receive TRESP_SMS_SET_DELIVERY_REPORT");
+	dbg("resp->result = 0x%x", resp->result);
 
-		case TRESP_SMS_SET_PARAMS:{
-			const struct tresp_sms_set_params *resp = data;
+	if (dbus_info->raw)
+		telephony_sms_complete_set_delivery_report_raw(dbus_info->interface_object, dbus_info->invocation,
+			resp->result);
+	else
+		telephony_sms_complete_set_delivery_report(dbus_info->interface_object, dbus_info->invocation,
+			resp->result);
 
-			dbg("receive TRESP_SMS_SET_PARAMS");
-			dbg("resp->result = 0x%x", resp->result);
+	return TRUE;
+}
 
-			telephony_sms_complete_set_sms_params(dbus_info->interface_object, dbus_info->invocation,
-				resp->result);
+static gboolean _sms_set_msg_status_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_sms_set_mem_status *resp = data;
 
-			}
-			break;
+	dbg("receive TRESP_SMS_SET_MSG_STATUS");
+	dbg("resp->result = 0x%x", resp->result);
 
-		case TRESP_SMS_GET_PARAMCNT: {
-			const struct tresp_sms_get_paramcnt *resp = data;
+	telephony_sms_complete_set_msg_status(dbus_info->interface_object, dbus_info->invocation,
+		resp->result);
 
-			dbg("receive TRESP_SMS_GET_PARAMCNT");
-			dbg("resp->result = 0x%x", resp->result);
+	return TRUE;
+}
 
-			telephony_sms_complete_get_sms_param_cnt(dbus_info->interface_object, dbus_info->invocation,
-				resp->result,
-				resp->recordCount);
+static gboolean _sms_get_params_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_sms_get_params *resp = data;
+	gchar *alphaId = NULL;
+	gchar *destDialNum = NULL;
+	gchar *scaDialNum = NULL;
+
+	dbg("receive TRESP_SMS_GET_PARAMS");
+	dbg("resp->result = 0x%x", resp->result);
+
+	alphaId = g_base64_encode((const guchar *)&(resp->paramsInfo.szAlphaId[0]), SMS_SMSP_ALPHA_ID_LEN_MAX + 1);
+	if (alphaId == NULL) {
+		dbg("g_base64_encode: Failed to Enocde paramsInfo.szAlphaId");
+		alphaId = "";
+	}
 
-			}
-			break;
+	destDialNum = g_base64_encode((const guchar *)&(resp->paramsInfo.tpDestAddr.diallingNum[0]), SMS_SMSP_ADDRESS_LEN + 1);
+	if (alphaId == NULL) {
+		dbg("g_base64_encode: Failed to Enocde paramsInfo.tpDestAddr.diallingNum");
+		alphaId = "";
+	}
 
-		default:
-			break;
+	scaDialNum = g_base64_encode((const guchar *)&(resp->paramsInfo.tpSvcCntrAddr.diallingNum[0]), SMS_SMSP_ADDRESS_LEN + 1);
+	if (alphaId == NULL) {
+		dbg("g_base64_encode: Failed to Enocde paramsInfo.tpSvcCntrAddr.diallingNum");
+		alphaId = "";
 	}
 
+	telephony_sms_complete_get_sms_params(dbus_info->interface_object, dbus_info->invocation,
+		resp->result,
+		resp->paramsInfo.recordIndex,
+		resp->paramsInfo.recordLen,
+		resp->paramsInfo.alphaIdLen,
+		alphaId,
+		resp->paramsInfo.paramIndicator,
+		resp->paramsInfo.tpDestAddr.dialNumLen,
+		resp->paramsInfo.tpDestAddr.typeOfNum,
+		resp->paramsInfo.tpDestAddr.numPlanId,
+		destDialNum,
+		resp->paramsInfo.tpSvcCntrAddr.dialNumLen,
+		resp->paramsInfo.tpSvcCntrAddr.typeOfNum,
+		resp->paramsInfo.tpSvcCntrAddr.numPlanId,
+		scaDialNum,
+		resp->paramsInfo.tpProtocolId,
+		resp->paramsInfo.tpDataCodingScheme,
+		resp->paramsInfo.tpValidityPeriod);
+
+	if(alphaId)
+		g_free(alphaId);
+
+	if(destDialNum)
+		g_free(destDialNum);
+
+	if(scaDialNum)
+		g_free(scaDialNum);
+
 	return TRUE;
 }
 
-gboolean dbus_plugin_sms_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+static gboolean _sms_set_params_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
 {
-	TelephonySms *sms;
-
-	if (!object)
-	{
-		dbg("object is NULL");
-		return FALSE;
-	}
+	const struct tresp_sms_set_params *resp = data;
 
-	sms = telephony_object_peek_sms(TELEPHONY_OBJECT(object));
-	dbg("sms = %p", sms);
+	dbg("receive TRESP_SMS_SET_PARAMS");
+	dbg("resp->result = 0x%x", resp->result);
 
-	dbg("[tcore_SMS]notification !!! (command = 0x%x, data_len = %d)", command, data_len);
+	telephony_sms_complete_set_sms_params(dbus_info->interface_object, dbus_info->invocation,
+		resp->result);
 
-	switch (command) {
-		case TNOTI_SMS_INCOM_MSG: {
-			const struct tnoti_sms_umts_msg *noti = data;
+	return TRUE;
+}
 
-			gchar *sca = NULL;
-			gchar *tpdu = NULL;			
+static gboolean _sms_get_paramcnt_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_sms_get_paramcnt *resp = data;
 
-			sca = g_base64_encode((const guchar *)&(noti->msgInfo.sca[0]), SMS_SMSP_ADDRESS_LEN);
-			if (sca == NULL) {
-				dbg("g_base64_encode: Failed to Enocde msgInfo.sca");
-				sca = "";
-			}
+	dbg("receive TRESP_SMS_GET_PARAMCNT");
+	dbg("resp->result = 0x%x", resp->result);
 
-			tpdu = g_base64_encode((const guchar *)&(noti->msgInfo.tpduData[0]), SMS_SMDATA_SIZE_MAX + 1);
-			if (tpdu == NULL) {
-				dbg("g_base64_encode: Failed to Enocde msgInfo.tpduData");
-				tpdu = "";
-			}
-			
-			telephony_sms_emit_incomming_msg(sms,
-				sca,
-				noti->msgInfo.msgLength,
-				tpdu);
+	telephony_sms_complete_get_sms_param_cnt(dbus_info->interface_object, dbus_info->invocation,
+		resp->result,
+		resp->recordCount);
 
-			if(sca)
-				g_free(sca);
+	return TRUE;
+}
 
-			if(tpdu)
-				g_free(tpdu);
+static const struct dbus_plugin_response_handler sms_response_handlers[] = {
+	{ TRESP_SMS_SEND_UMTS_MSG, _sms_send_umts_msg_response },
+	{ TRESP_SMS_SEND_CDMA_MSG, _sms_send_cdma_msg_response },
+	{ TRESP_SMS_READ_MSG, _sms_read_msg_response },
+	{ TRESP_SMS_SAVE_MSG, _sms_save_msg_response },
+	{ TRESP_SMS_DELETE_MSG, _sms_delete_msg_response },
+	{ TRESP_SMS_GET_STORED_MSG_COUNT, _sms_get_stored_msg_count_response },
+	{ TRESP_SMS_GET_SCA, _sms_get_sca_response },
+	{ TRESP_SMS_SET_SCA, _sms_set_sca_response },
+	{ TRESP_SMS_GET_CB_CONFIG, _sms_get_cb_config_response },
+	{ TRESP_SMS_SET_CB_CONFIG, _sms_set_cb_config_response },
+	{ TRESP_SMS_SET_MEM_STATUS, _sms_set_mem_status_response },
+	{ TRESP_SMS_GET_PREF_BEARER, _sms_get_pref_bearer_response },
+	{ TRESP_SMS_SET_PREF_BEARER, _sms_set_pref_bearer_response },
+	{ TRESP_SMS_SET_DELIVERY_REPORT, _sms_set_delivery_report_response },
+	{ TRESP_SMS_SET_MSG_STATUS, _sms_set_msg_status_response },
+	{ TRESP_SMS_GET_PARAMS, _sms_get_params_response },
+	{ TRESP_SMS_SET_PARAMS, _sms_set_params_response },
+	{ TRESP_SMS_GET_PARAMCNT, _sms_get_paramcnt_response },
+};
+
+static gboolean _sms_incom_msg_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonySms *sms = telephony_object_peek_sms(TELEPHONY_OBJECT(object));
+	const struct tnoti_sms_umts_msg *noti = data;
+#if DBUS_SMS_LEGACY_INCOM_MSG
+	gchar *sca = NULL;
+	gchar *tpdu = NULL;
+
+	sca = g_base64_encode((const guchar *)&(noti->msgInfo.sca[0]), SMS_SMSP_ADDRESS_LEN);
+	tpdu = g_base64_encode((const guchar *)&(noti->msgInfo.tpduData[0]), SMS_SMDATA_SIZE_MAX + 1);
+
+	telephony_sms_emit_incomming_msg(sms,
+		sca ? sca : "",
+		noti->msgInfo.msgLength,
+		tpdu ? tpdu : "");
+
+	g_free(sca);
+	g_free(tpdu);
+#endif
+	telephony_sms_emit_incomming_msg_raw(sms,
+		_sms_new_raw(noti->msgInfo.sca, SMS_SMSP_ADDRESS_LEN, SMS_SMSP_ADDRESS_LEN),
+		_sms_new_raw(noti->msgInfo.tpduData, noti->msgInfo.msgLength, SMS_SMDATA_SIZE_MAX + 1));
 
-			}
-			break;
+	return TRUE;
+}
 
-		case TNOTI_SMS_CB_INCOM_MSG: {
-			const struct tnoti_sms_cellBroadcast_msg *noti = data;
-			gchar *msgData = NULL;
-			
-			msgData = g_base64_encode((const guchar *)&(noti->cbMsg.msgData[0]), SMS_SMSP_ADDRESS_LEN);
-			if (msgData == NULL) {
-				dbg("g_base64_encode: Failed to Enocde cbMsg.msgData");
-				msgData = "";
-			}
+static gboolean _sms_cb_incom_msg_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonySms *sms = telephony_object_peek_sms(TELEPHONY_OBJECT(object));
+	const struct tnoti_sms_cellBroadcast_msg *noti = data;
+	gchar *msgData = NULL;
+
+	msgData = g_base64_encode((const guchar *)&(noti->cbMsg.msgData[0]), SMS_SMSP_ADDRESS_LEN);
+	if (msgData == NULL) {
+		dbg("g_base64_encode: Failed to Enocde cbMsg.msgData");
+		msgData = "";
+	}
 
-			telephony_sms_emit_incomming_cb_msg(sms,
-				noti->cbMsg.cbMsgType,
-				noti->cbMsg.length,
-				msgData);
+	telephony_sms_emit_incomming_cb_msg(sms,
+		noti->cbMsg.cbMsgType,
+		noti->cbMsg.length,
+		msgData);
 
-			if(msgData)
-				g_free(msgData);
+	if(msgData)
+		g_free(msgData);
 
-			}
-			break;
+	return TRUE;
+}
 
-		case TNOTI_SMS_ETWS_INCOM_MSG: {
-			const struct tnoti_sms_etws_msg *noti = data;
-			gchar *msgData = NULL;
-			
-			msgData = g_base64_encode((const guchar *)&(noti->etwsMsg.msgData[0]), SMS_SMSP_ADDRESS_LEN);
-			if (msgData == NULL) {
-				dbg("g_base64_encode: Failed to Enocde etwsMsg.msgData");
-				msgData = "";
-			}
+static gboolean _sms_etws_incom_msg_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonySms *sms = telephony_object_peek_sms(TELEPHONY_OBJECT(object));
+	const struct tnoti_sms_etws_msg *noti = data;
+	gchar *msgData = NULL;
+
+	msgData = g_base64_encode((const guchar *)&(noti->etwsMsg.msgData[0]), SMS_SMSP_ADDRESS_LEN);
+	if (msgData == NULL) {
+		dbg("g_base64_encode: Failed to Enocde etwsMsg.msgData");
+		msgData = "";
+	}
 
-			telephony_sms_emit_incomming_etws_msg(sms,
-				noti->etwsMsg.etwsMsgType,
-				noti->etwsMsg.length,
-				msgData);
+	telephony_sms_emit_incomming_etws_msg(sms,
+		noti->etwsMsg.etwsMsgType,
+		noti->etwsMsg.length,
+		msgData);
 
-			if(msgData)
-				g_free(msgData);
-			}
-			break;
+	if(msgData)
+		g_free(msgData);
 
-		case TNOTI_SMS_INCOM_EX_MSG: {
-#if 0
-			noti->cdmaMsg.ParamMask), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgType), SIPC_MARSHAL_DATA_INT_TYPE);
-
-			switch(noti->cdmaMsg.MsgType)
-			{
-				case SMS_MESSAGETYPE_DELIVER:
-					/* Origination address */
-					noti->cdmaMsg.MsgData.inDeliver.OrigAddr.Digit), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.OrigAddr.NumberMode), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.OrigAddr.NumberType), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.OrigAddr.NumberPlan), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.OrigAddr.szAddrLength), SIPC_MARSHAL_DATA_CHAR_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.OrigAddr.szAddress[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
-
-					/* Origination subaddress */
-					noti->cdmaMsg.MsgData.inDeliver.OrigSubAddr.SubType), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.OrigSubAddr.Odd), SIPC_MARSHAL_DATA_CHAR_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.OrigSubAddr.szAddrLength), SIPC_MARSHAL_DATA_CHAR_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.OrigSubAddr.szAddress[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
-
-					noti->cdmaMsg.MsgData.inDeliver.TeleService), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.bBearerReplySeqRequest), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.ReplySeqNumber), SIPC_MARSHAL_DATA_CHAR_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.MsgId), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.MsgEncoding), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.MsgLength), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.szData[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
-
-					/* Message center time stamp */
-					void *)&(noti->cdmaMsg.MsgData.inDeliver.MessageCenterTimeStamp.year), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.MessageCenterTimeStamp.month), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.MessageCenterTimeStamp.day), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.MessageCenterTimeStamp.hours), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.MessageCenterTimeStamp.minutes), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.MessageCenterTimeStamp.seconds), SIPC_MARSHAL_DATA_INT_TYPE);
-
-					/* Validity period - Absolute */
-					noti->cdmaMsg.MsgData.inDeliver.ValidityPeriodAbs.year), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.ValidityPeriodAbs.month), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.ValidityPeriodAbs.day), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.ValidityPeriodAbs.hours), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.ValidityPeriodAbs.minutes), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.ValidityPeriodAbs.seconds), SIPC_MARSHAL_DATA_INT_TYPE);
-
-					noti->cdmaMsg.MsgData.inDeliver.ValidityPeriodRel), SIPC_MARSHAL_DATA_CHAR_TYPE);
-
-					/* Deferred delivery time - Absolute (not supported) */
-					noti->cdmaMsg.MsgData.inDeliver.DeferredDelTimeAbs.year), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.DeferredDelTimeAbs.month), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.DeferredDelTimeAbs.day), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.DeferredDelTimeAbs.hours), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.DeferredDelTimeAbs.minutes), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.DeferredDelTimeAbs.seconds), SIPC_MARSHAL_DATA_INT_TYPE);
-
-					/* Deferred delivery time - Relative (not supported) */
-					noti->cdmaMsg.MsgData.inDeliver.DeferredDelTimeRel), SIPC_MARSHAL_DATA_CHAR_TYPE);
-
-					noti->cdmaMsg.MsgData.inDeliver.Priority), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.Privacy), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.NumMsg), SIPC_MARSHAL_DATA_CHAR_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.bUserAckRequest), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.bDeliveryAckRequest), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.AlertPriority), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.MsgLang), SIPC_MARSHAL_DATA_INT_TYPE);
-
-					/* Callback number address */
-					noti->cdmaMsg.MsgData.inDeliver.CallBackNumer.Digit), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.CallBackNumer.NumberMode), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.CallBackNumer.NumberType), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.CallBackNumer.NumberPlan), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.CallBackNumer.szAddrLength), SIPC_MARSHAL_DATA_CHAR_TYPE);
-					noti->cdmaMsg.MsgData.inDeliver.CallBackNumer.szAddress[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
-
-					noti->cdmaMsg.MsgData.inDeliver.Display), SIPC_MARSHAL_DATA_INT_TYPE);
-
-					break;
-
-				case SMS_MESSAGETYPE_DELIVERY_ACK:
-					/* Origination address */
-					noti->cdmaMsg.MsgData.inAck.OrigAddr.Digit), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inAck.OrigAddr.NumberMode), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inAck.OrigAddr.NumberType), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inAck.OrigAddr.NumberPlan), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inAck.OrigAddr.szAddrLength), SIPC_MARSHAL_DATA_CHAR_TYPE);
-					noti->cdmaMsg.MsgData.inAck.OrigAddr.szAddress[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
-
-					/* Origination subaddress */
-					noti->cdmaMsg.MsgData.inAck.OrigSubAddr.SubType), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inAck.OrigSubAddr.Odd), SIPC_MARSHAL_DATA_CHAR_TYPE);
-					noti->cdmaMsg.MsgData.inAck.OrigSubAddr.szAddrLength), SIPC_MARSHAL_DATA_CHAR_TYPE);
-					noti->cdmaMsg.MsgData.inAck.OrigSubAddr.szAddress), SIPC_MARSHAL_DATA_CHAR_TYPE);
-
-					noti->cdmaMsg.MsgData.inAck.TeleService), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inAck.bBearerReplySeqRequest), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inAck.ReplySeqNumber), SIPC_MARSHAL_DATA_CHAR_TYPE);
-					noti->cdmaMsg.MsgData.inAck.MsgId), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inAck.MsgEncoding), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inAck.MsgLength), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inAck.szData[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
-
-					noti->cdmaMsg.MsgData.inAck.UserResponseCode), SIPC_MARSHAL_DATA_CHAR_TYPE);
-
-					/* Message center time stamp */
-					noti->cdmaMsg.MsgData.inAck.MessageCenterTimeStamp.year), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inAck.MessageCenterTimeStamp.month), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inAck.MessageCenterTimeStamp.day), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inAck.MessageCenterTimeStamp.hours), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inAck.MessageCenterTimeStamp.minutes), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inAck.MessageCenterTimeStamp.seconds), SIPC_MARSHAL_DATA_INT_TYPE);
-
-					break;
-
-				case SMS_MESSAGETYPE_USER_ACK:
-					/* Origination address */
-					noti->cdmaMsg.MsgData.inDeliverAck.OrigAddr.Digit), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.OrigAddr.NumberMode), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.OrigAddr.NumberType), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.OrigAddr.NumberPlan), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.OrigAddr.szAddrLength), SIPC_MARSHAL_DATA_CHAR_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.OrigAddr.szAddress[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
-
-					/* Origination subaddress */
-					noti->cdmaMsg.MsgData.inDeliverAck.OrigSubAddr.SubType), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.OrigSubAddr.Odd), SIPC_MARSHAL_DATA_CHAR_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.OrigSubAddr.szAddrLength), SIPC_MARSHAL_DATA_CHAR_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.OrigSubAddr.szAddress), SIPC_MARSHAL_DATA_CHAR_TYPE);
-
-					noti->cdmaMsg.MsgData.inDeliverAck.TeleService), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.bBearerReplySeqRequest), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.ReplySeqNumber), SIPC_MARSHAL_DATA_CHAR_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.MsgId), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.MsgEncoding), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.MsgLength), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.szData[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
-
-					/* Message center time stamp */
-					noti->cdmaMsg.MsgData.inDeliverAck.MessageCenterTimeStamp.year), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.MessageCenterTimeStamp.month), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.MessageCenterTimeStamp.day), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.MessageCenterTimeStamp.hours), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.MessageCenterTimeStamp.minutes), SIPC_MARSHAL_DATA_INT_TYPE);
-					noti->cdmaMsg.MsgData.inDeliverAck.MessageCenterTimeStamp.seconds), SIPC_MARSHAL_DATA_INT_TYPE);
-
-					break;
-				default:
-					break;
-			}
-#endif
-			}
-			break;
+	return TRUE;
+}
 
-		case TNOTI_SMS_CB_INCOM_EX_MSG: {
+static gboolean _sms_incom_ex_msg_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
 #if 0
-			noti->cdmaMsg.MsgData.inBc.ServiceCategory), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.ParamMask), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgType), SIPC_MARSHAL_DATA_INT_TYPE);
 
-			noti->cdmaMsg.MsgData.inBc.MsgId), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.bBearerReplySeqRequest), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.ReplySeqNumber), SIPC_MARSHAL_DATA_CHAR_TYPE);
-			noti->cdmaMsg.MsgData.inBc.MsgEncoding), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.MsgLength), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.szData[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
+	switch(noti->cdmaMsg.MsgType)
+	{
+		case SMS_MESSAGETYPE_DELIVER:
+			/* Origination address */
+			noti->cdmaMsg.MsgData.inDeliver.OrigAddr.Digit), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.OrigAddr.NumberMode), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.OrigAddr.NumberType), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.OrigAddr.NumberPlan), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.OrigAddr.szAddrLength), SIPC_MARSHAL_DATA_CHAR_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.OrigAddr.szAddress[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
+
+			/* Origination subaddress */
+			noti->cdmaMsg.MsgData.inDeliver.OrigSubAddr.SubType), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.OrigSubAddr.Odd), SIPC_MARSHAL_DATA_CHAR_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.OrigSubAddr.szAddrLength), SIPC_MARSHAL_DATA_CHAR_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.OrigSubAddr.szAddress[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
+
+			noti->cdmaMsg.MsgData.inDeliver.TeleService), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.bBearerReplySeqRequest), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.ReplySeqNumber), SIPC_MARSHAL_DATA_CHAR_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.MsgId), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.MsgEncoding), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.MsgLength), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.szData[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
 
 			/* Message center time stamp */
-			noti->cdmaMsg.MsgData.inBc.MessageCenterTimeStamp.year), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.MessageCenterTimeStamp.month), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.MessageCenterTimeStamp.day), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.MessageCenterTimeStamp.hours), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.MessageCenterTimeStamp.minutes), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.MessageCenterTimeStamp.seconds), SIPC_MARSHAL_DATA_INT_TYPE);
+			void *)&(noti->cdmaMsg.MsgData.inDeliver.MessageCenterTimeStamp.year), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.MessageCenterTimeStamp.month), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.MessageCenterTimeStamp.day), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.MessageCenterTimeStamp.hours), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.MessageCenterTimeStamp.minutes), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.MessageCenterTimeStamp.seconds), SIPC_MARSHAL_DATA_INT_TYPE);
 
 			/* Validity period - Absolute */
-			noti->cdmaMsg.MsgData.inBc.ValidityPeriodAbs.year), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.ValidityPeriodAbs.month), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.ValidityPeriodAbs.day), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.ValidityPeriodAbs.hours), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.ValidityPeriodAbs.minutes), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.ValidityPeriodAbs.seconds), SIPC_MARSHAL_DATA_INT_TYPE);
-
-			noti->cdmaMsg.MsgData.inBc.ValidityPeriodRel), SIPC_MARSHAL_DATA_CHAR_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.ValidityPeriodAbs.year), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.ValidityPeriodAbs.month), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.ValidityPeriodAbs.day), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.ValidityPeriodAbs.hours), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.ValidityPeriodAbs.minutes), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.ValidityPeriodAbs.seconds), SIPC_MARSHAL_DATA_INT_TYPE);
+
+			noti->cdmaMsg.MsgData.inDeliver.ValidityPeriodRel), SIPC_MARSHAL_DATA_CHAR_TYPE);
+
+			/* Deferred delivery time - Absolute (not supported) */
+			noti->cdmaMsg.MsgData.inDeliver.DeferredDelTimeAbs.year), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.DeferredDelTimeAbs.month), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.DeferredDelTimeAbs.day), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.DeferredDelTimeAbs.hours), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.DeferredDelTimeAbs.minutes), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.DeferredDelTimeAbs.seconds), SIPC_MARSHAL_DATA_INT_TYPE);
+
+			/* Deferred delivery time - Relative (not supported) */
+			noti->cdmaMsg.MsgData.inDeliver.DeferredDelTimeRel), SIPC_MARSHAL_DATA_CHAR_TYPE);
+
+			noti->cdmaMsg.MsgData.inDeliver.Priority), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.Privacy), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.NumMsg), SIPC_MARSHAL_DATA_CHAR_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.bUserAckRequest), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.bDeliveryAckRequest), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.AlertPriority), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.MsgLang), SIPC_MARSHAL_DATA_INT_TYPE);
+
+			/* Callback number address */
+			noti->cdmaMsg.MsgData.inDeliver.CallBackNumer.Digit), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.CallBackNumer.NumberMode), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.CallBackNumer.NumberType), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.CallBackNumer.NumberPlan), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.CallBackNumer.szAddrLength), SIPC_MARSHAL_DATA_CHAR_TYPE);
+			noti->cdmaMsg.MsgData.inDeliver.CallBackNumer.szAddress[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
+
+			noti->cdmaMsg.MsgData.inDeliver.Display), SIPC_MARSHAL_DATA_INT_TYPE);
 
-			noti->cdmaMsg.MsgData.inBc.Priority), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.AlertPriority), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.MsgLang), SIPC_MARSHAL_DATA_INT_TYPE);
-			noti->cdmaMsg.MsgData.inBc.Display), SIPC_MARSHAL_DATA_INT_TYPE);
-
-#endif
-			}
 			break;
 
-		case TNOTI_SMS_MEMORY_STATUS: {
-			const struct tnoti_sms_memory_status *noti = data;
+		case SMS_MESSAGETYPE_DELIVERY_ACK:
+			/* Origination address */
+			noti->cdmaMsg.MsgData.inAck.OrigAddr.Digit), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inAck.OrigAddr.NumberMode), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inAck.OrigAddr.NumberType), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inAck.OrigAddr.NumberPlan), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inAck.OrigAddr.szAddrLength), SIPC_MARSHAL_DATA_CHAR_TYPE);
+			noti->cdmaMsg.MsgData.inAck.OrigAddr.szAddress[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
+
+			/* Origination subaddress */
+			noti->cdmaMsg.MsgData.inAck.OrigSubAddr.SubType), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inAck.OrigSubAddr.Odd), SIPC_MARSHAL_DATA_CHAR_TYPE);
+			noti->cdmaMsg.MsgData.inAck.OrigSubAddr.szAddrLength), SIPC_MARSHAL_DATA_CHAR_TYPE);
+			noti->cdmaMsg.MsgData.inAck.OrigSubAddr.szAddress), SIPC_MARSHAL_DATA_CHAR_TYPE);
+
+			noti->cdmaMsg.MsgData.inAck.TeleService), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inAck.bBearerReplySeqRequest), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inAck.ReplySeqNumber), SIPC_MARSHAL_DATA_CHAR_TYPE);
+			noti->cdmaMsg.MsgData.inAck.MsgId), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inAck.MsgEncoding), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inAck.MsgLength), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inAck.szData[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
+
+			noti->cdmaMsg.MsgData.inAck.UserResponseCode), SIPC_MARSHAL_DATA_CHAR_TYPE);
 
-			telephony_sms_emit_memory_status(sms, noti->status);
+			/* Message center time stamp */
+			noti->cdmaMsg.MsgData.inAck.MessageCenterTimeStamp.year), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inAck.MessageCenterTimeStamp.month), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inAck.MessageCenterTimeStamp.day), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inAck.MessageCenterTimeStamp.hours), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inAck.MessageCenterTimeStamp.minutes), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inAck.MessageCenterTimeStamp.seconds), SIPC_MARSHAL_DATA_INT_TYPE);
 
-			}
 			break;
 
-		case TNOTI_SMS_DEVICE_READY: {
-			const struct tnoti_sms_ready_status *noti = data;
+		case SMS_MESSAGETYPE_USER_ACK:
+			/* Origination address */
+			noti->cdmaMsg.MsgData.inDeliverAck.OrigAddr.Digit), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.OrigAddr.NumberMode), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.OrigAddr.NumberType), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.OrigAddr.NumberPlan), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.OrigAddr.szAddrLength), SIPC_MARSHAL_DATA_CHAR_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.OrigAddr.szAddress[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
+
+			/* Origination subaddress */
+			noti->cdmaMsg.MsgData.inDeliverAck.OrigSubAddr.SubType), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.OrigSubAddr.Odd), SIPC_MARSHAL_DATA_CHAR_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.OrigSubAddr.szAddrLength), SIPC_MARSHAL_DATA_CHAR_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.OrigSubAddr.szAddress), SIPC_MARSHAL_DATA_CHAR_TYPE);
+
+			noti->cdmaMsg.MsgData.inDeliverAck.TeleService), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.bBearerReplySeqRequest), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.ReplySeqNumber), SIPC_MARSHAL_DATA_CHAR_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.MsgId), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.MsgEncoding), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.MsgLength), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.szData[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
 
-			telephony_sms_emit_sms_ready(sms, noti->status);
+			/* Message center time stamp */
+			noti->cdmaMsg.MsgData.inDeliverAck.MessageCenterTimeStamp.year), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.MessageCenterTimeStamp.month), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.MessageCenterTimeStamp.day), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.MessageCenterTimeStamp.hours), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.MessageCenterTimeStamp.minutes), SIPC_MARSHAL_DATA_INT_TYPE);
+			noti->cdmaMsg.MsgData.inDeliverAck.MessageCenterTimeStamp.seconds), SIPC_MARSHAL_DATA_INT_TYPE);
 
-			}
 			break;
-
 		default:
-			dbg("unknown notification");
-			return FALSE;
 			break;
 	}
+#endif
+
+	return TRUE;
+}
+
+static gboolean _sms_cb_incom_ex_msg_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+#if 0
+	noti->cdmaMsg.MsgData.inBc.ServiceCategory), SIPC_MARSHAL_DATA_INT_TYPE);
+
+	noti->cdmaMsg.MsgData.inBc.MsgId), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.bBearerReplySeqRequest), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.ReplySeqNumber), SIPC_MARSHAL_DATA_CHAR_TYPE);
+	noti->cdmaMsg.MsgData.inBc.MsgEncoding), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.MsgLength), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.szData[0]), SIPC_MARSHAL_DATA_STRING_TYPE);
+
+	/* Message center time stamp */
+	noti->cdmaMsg.MsgData.inBc.MessageCenterTimeStamp.year), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.MessageCenterTimeStamp.month), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.MessageCenterTimeStamp.day), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.MessageCenterTimeStamp.hours), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.MessageCenterTimeStamp.minutes), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.MessageCenterTimeStamp.seconds), SIPC_MARSHAL_DATA_INT_TYPE);
+
+	/* Validity period - Absolute */
+	noti->cdmaMsg.MsgData.inBc.ValidityPeriodAbs.year), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.ValidityPeriodAbs.month), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.ValidityPeriodAbs.day), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.ValidityPeriodAbs.hours), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.ValidityPeriodAbs.minutes), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.ValidityPeriodAbs.seconds), SIPC_MARSHAL_DATA_INT_TYPE);
+
+	noti->cdmaMsg.MsgData.inBc.ValidityPeriodRel), SIPC_MARSHAL_DATA_CHAR_TYPE);
+
+	noti->cdmaMsg.MsgData.inBc.Priority), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.AlertPriority), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.MsgLang), SIPC_MARSHAL_DATA_INT_TYPE);
+	noti->cdmaMsg.MsgData.inBc.Display), SIPC_MARSHAL_DATA_INT_TYPE);
+
+#endif
+
+	return TRUE;
+}
+
+static gboolean _sms_memory_status_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonySms *sms = telephony_object_peek_sms(TELEPHONY_OBJECT(object));
+	const struct tnoti_sms_memory_status *noti = data;
+
+	telephony_sms_emit_memory_status(sms, noti->status);
+
+	return TRUE;
+}
+
+static gboolean _sms_device_ready_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+{
+	TelephonySms *sms = telephony_object_peek_sms(TELEPHONY_OBJECT(object));
+	const struct tnoti_sms_ready_status *noti = data;
+
+	telephony_sms_emit_sms_ready(sms, noti->status);
 
 	return TRUE;
 }
+
+static const struct dbus_plugin_notification_handler sms_notification_handlers[] = {
+	{ TNOTI_SMS_INCOM_MSG, _sms_incom_msg_notification },
+	{ TNOTI_SMS_CB_INCOM_MSG, _sms_cb_incom_msg_notification },
+	{ TNOTI_SMS_ETWS_INCOM_MSG, _sms_etws_incom_msg_notification },
+	{ TNOTI_SMS_INCOM_EX_MSG, _sms_incom_ex_msg_notification },
+	{ TNOTI_SMS_CB_INCOM_EX_MSG, _sms_cb_incom_ex_msg_notification },
+	{ TNOTI_SMS_MEMORY_STATUS, _sms_memory_status_notification },
+	{ TNOTI_SMS_DEVICE_READY, _sms_device_ready_notification },
+};
+
+void dbus_plugin_register_sms_handlers(struct custom_data *ctx)
+{
+	dbus_plugin_register_responses(ctx, sms_response_handlers,
+			G_N_ELEMENTS(sms_response_handlers));
+	dbus_plugin_register_notifications(ctx, sms_notification_handlers,
+			G_N_ELEMENTS(sms_notification_handlers));
+}
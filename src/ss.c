@@ -55,7 +55,7 @@ on_ss_activate_barring (TelephonySs *ss,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_ss_barring), &req);
 	tcore_user_request_set_command(ur, TREQ_SS_BARRING_ACTIVATE);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -89,7 +89,7 @@ on_ss_deactivate_barring (TelephonySs *ss,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_ss_barring), &req);
 	tcore_user_request_set_command(ur, TREQ_SS_BARRING_DEACTIVATE);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -128,7 +128,7 @@ on_ss_change_barring_password (TelephonySs *ss,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_ss_barring_change_password), &req);
 	tcore_user_request_set_command(ur, TREQ_SS_BARRING_CHANGE_PASSWORD);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -155,7 +155,7 @@ on_ss_get_barring_status (TelephonySs *ss,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_ss_barring), &req);
 	tcore_user_request_set_command(ur, TREQ_SS_BARRING_GET_STATUS);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 
 	return TRUE;
@@ -188,7 +188,7 @@ on_ss_register_forwarding (TelephonySs *ss,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_ss_forwarding), &req);
 	tcore_user_request_set_command(ur, TREQ_SS_FORWARDING_REGISTER);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -220,7 +220,7 @@ on_ss_deregister_forwarding (TelephonySs *ss,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_ss_forwarding), &req);
 	tcore_user_request_set_command(ur, TREQ_SS_FORWARDING_DEREGISTER);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -252,7 +252,7 @@ on_ss_activate_forwarding (TelephonySs *ss,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_ss_forwarding), &req);
 	tcore_user_request_set_command(ur, TREQ_SS_FORWARDING_ACTIVATE);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -284,7 +284,7 @@ on_ss_deactivate_forwarding (TelephonySs *ss,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_ss_forwarding), &req);
 	tcore_user_request_set_command(ur, TREQ_SS_FORWARDING_DEACTIVATE);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -312,7 +312,7 @@ on_ss_get_forwarding_status (TelephonySs *ss,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_ss_forwarding), &req);
 	tcore_user_request_set_command(ur, TREQ_SS_FORWARDING_GET_STATUS);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -337,7 +337,7 @@ on_ss_activate_waiting (TelephonySs *ss,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_ss_waiting), &req);
 	tcore_user_request_set_command(ur, TREQ_SS_WAITING_ACTIVATE);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -362,7 +362,7 @@ on_ss_deactivate_waiting (TelephonySs *ss,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_ss_waiting), &req);
 	tcore_user_request_set_command(ur, TREQ_SS_WAITING_DEACTIVATE);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -387,7 +387,7 @@ on_ss_get_waiting_status (TelephonySs *ss,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_ss_waiting), &req);
 	tcore_user_request_set_command(ur, TREQ_SS_WAITING_GET_STATUS);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -401,6 +401,7 @@ on_ss_get_cli_status (TelephonySs *ss,
 	struct treq_ss_cli req;
 	struct custom_data *ctx = user_data;
 	UserRequest *ur = NULL;
+	TReturn ret;
 
 	memset(&req, 0, sizeof(struct treq_ss_cli));
 
@@ -408,11 +409,17 @@ on_ss_get_cli_status (TelephonySs *ss,
 
 	dbg("type = %d", req.type);
 
-	ur = MAKE_UR(ctx, ss, invocation);
+	ur = MAKE_SHARED_UR(ctx, ss, invocation, TREQ_SS_CLI_GET_STATUS, &req, sizeof(struct treq_ss_cli));
+	if (!ur)
+		return TRUE;
 
-	tcore_user_request_set_data(ur, sizeof(struct treq_ss_cli), &req);
-	tcore_user_request_set_command(ur, TREQ_SS_CLI_GET_STATUS);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	ret = dbus_plugin_dispatch_request(ctx, ur);
+	if (ret != TCORE_RETURN_SUCCESS) {
+		err("dispatch failed (ret: 0x%x)", ret);
+		g_dbus_method_invocation_return_error(invocation, G_DBUS_ERROR, G_DBUS_ERROR_FAILED,
+				"request (0x%x) dispatch failed", TREQ_SS_CLI_GET_STATUS);
+		tcore_user_request_unref(ur);
+	}
 
 	return TRUE;
 }
@@ -440,7 +447,7 @@ on_ss_send_ussd (TelephonySs *ss,
 
 	tcore_user_request_set_data(ur, sizeof(struct treq_ss_ussd), &req);
 	tcore_user_request_set_command(ur, TREQ_SS_SEND_USSD);
-	tcore_communicator_dispatch_request(ctx->comm, ur);
+	dbus_plugin_dispatch_request(ctx, ur);
 
 	return TRUE;
 }
@@ -526,376 +533,399 @@ gboolean dbus_plugin_setup_ss_interface(TelephonyObjectSkeleton *object, struct
 	return TRUE;
 }
 
-gboolean dbus_plugin_ss_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+static gboolean _ss_barring_activate_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
 {
 	GVariant *result = 0;
 	GVariantBuilder b;
 	int i = 0;
+	const struct tresp_ss_barring *resp = data;
 
-	switch (command) {
-		case TRESP_SS_BARRING_ACTIVATE: {
-
-			const struct tresp_ss_barring *resp = data;
-
-			dbg("receive TRESP_SS_BARRING_ACTIVATE");
-			dbg("resp->err = 0x%x", resp->err);
-
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
-
-			for (i=0; i<resp->record_num; i++) {
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
-				g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
-				g_variant_builder_add(&b, "{sv}", "barring_mode", g_variant_new_int32( resp->record[i].mode ));
-				g_variant_builder_close(&b);
-			}
-
-			result = g_variant_builder_end(&b);
-
-			telephony_ss_complete_activate_barring(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
-
-			g_variant_unref(result);
-
-		} break;
-
-		case TRESP_SS_BARRING_DEACTIVATE: {
-
-			const struct tresp_ss_barring *resp = data;
-
-			dbg("receive TRESP_SS_BARRING_DEACTIVATE");
-			dbg("resp->err = 0x%x", resp->err);
-
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
-
-			for (i=0; i<resp->record_num; i++) {
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
-				g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
-				g_variant_builder_add(&b, "{sv}", "barring_mode", g_variant_new_int32( resp->record[i].mode ));
-				g_variant_builder_close(&b);
-			}
-
-			result = g_variant_builder_end(&b);
-
-			telephony_ss_complete_deactivate_barring(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
-
-			g_variant_unref(result);
-
-		} break;
-
-		case TRESP_SS_BARRING_CHANGE_PASSWORD: {
-
-			const struct tresp_ss_general *resp = data;
-
-			dbg("receive TRESP_SS_BARRING_CHANGE_PASSWORD");
-			dbg("resp->err = 0x%x", resp->err);
-
-			telephony_ss_complete_change_barring_password(dbus_info->interface_object, dbus_info->invocation, resp->err);
-
-		} break;
-
-		case TRESP_SS_BARRING_GET_STATUS: {
-
-			const struct tresp_ss_barring *resp = data;
-
-			dbg("receive TRESP_SS_BARRING_GET_STATUS");
-			dbg("resp->err = 0x%x", resp->err);
-
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
-
-			for (i=0; i<resp->record_num; i++) {
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
-				g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
-				g_variant_builder_add(&b, "{sv}", "barring_mode", g_variant_new_int32( resp->record[i].mode ));
-				g_variant_builder_close(&b);
-			}
-
-			result = g_variant_builder_end(&b);
-
-			telephony_ss_complete_get_barring_status(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
-
-			g_variant_unref(result);
-
-		} break;
-
-		case TRESP_SS_FORWARDING_ACTIVATE: {
-			const struct tresp_ss_forwarding *resp = data;
+	dbg("receive TRESP_SS_BARRING_ACTIVATE");
+	dbg("resp->err = 0x%x", resp->err);
 
-			dbg("receive TRESP_SS_FORWARDING_ACTIVATE");
-			dbg("resp->err = 0x%x", resp->err);
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
 
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
-
-			for (i=0; i<resp->record_num; i++) {
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
-				g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
-				g_variant_builder_add(&b, "{sv}", "forwarding_mode", g_variant_new_int32( resp->record[i].mode ));
-				g_variant_builder_add(&b, "{sv}", "no_reply_time", g_variant_new_int32( resp->record[i].time ));
-				g_variant_builder_add(&b, "{sv}", "number_present", g_variant_new_int32( resp->record[i].number_present ));
-				g_variant_builder_add(&b, "{sv}", "forwarding_number", g_variant_new_string( resp->record[i].number ));
-				g_variant_builder_close(&b);
-			}
-
-			result = g_variant_builder_end(&b);
-
-			telephony_ss_complete_activate_forwarding(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
-
-			g_variant_unref(result);
-
-		} break;
-
-		case TRESP_SS_FORWARDING_DEACTIVATE: {
-
-			const struct tresp_ss_forwarding *resp = data;
-
-			dbg("receive TRESP_SS_FORWARDING_DEACTIVATE");
-			dbg("resp->err = 0x%x", resp->err);
-
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
-
-			for (i=0; i<resp->record_num; i++) {
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
-				g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
-				g_variant_builder_add(&b, "{sv}", "forwarding_mode", g_variant_new_int32( resp->record[i].mode ));
-				g_variant_builder_add(&b, "{sv}", "no_reply_time", g_variant_new_int32( resp->record[i].time ));
-				g_variant_builder_add(&b, "{sv}", "number_present", g_variant_new_int32( resp->record[i].number_present ));
-				g_variant_builder_add(&b, "{sv}", "forwarding_number", g_variant_new_string( resp->record[i].number ));
-				g_variant_builder_close(&b);
-			}
+	for (i=0; i<resp->record_num; i++) {
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
+		g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
+		g_variant_builder_add(&b, "{sv}", "barring_mode", g_variant_new_int32( resp->record[i].mode ));
+		g_variant_builder_close(&b);
+	}
 
-			result = g_variant_builder_end(&b);
+	result = g_variant_builder_end(&b);
 
-			telephony_ss_complete_deactivate_forwarding(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
+	telephony_ss_complete_activate_barring(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
 
-			g_variant_unref(result);
+	return TRUE;
+}
 
-		} break;
+static gboolean _ss_barring_deactivate_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	GVariant *result = 0;
+	GVariantBuilder b;
+	int i = 0;
+	const struct tresp_ss_barring *resp = data;
 
-		case TRESP_SS_FORWARDING_REGISTER: {
+	dbg("receive TRESP_SS_BARRING_DEACTIVATE");
+	dbg("resp->err = 0x%x", resp->err);
 
-			const struct tresp_ss_forwarding *resp = data;
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
 
-			dbg("receive TRESP_SS_FORWARDING_REGISTER");
-			dbg("resp->err = 0x%x", resp->err);
+	for (i=0; i<resp->record_num; i++) {
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
+		g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
+		g_variant_builder_add(&b, "{sv}", "barring_mode", g_variant_new_int32( resp->record[i].mode ));
+		g_variant_builder_close(&b);
+	}
 
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+	result = g_variant_builder_end(&b);
 
-			for (i=0; i<resp->record_num; i++) {
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
-				g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
-				g_variant_builder_add(&b, "{sv}", "forwarding_mode", g_variant_new_int32( resp->record[i].mode ));
-				g_variant_builder_add(&b, "{sv}", "no_reply_time", g_variant_new_int32( resp->record[i].time ));
-				g_variant_builder_add(&b, "{sv}", "number_present", g_variant_new_int32( resp->record[i].number_present ));
-				g_variant_builder_add(&b, "{sv}", "forwarding_number", g_variant_new_string( resp->record[i].number ));
-				g_variant_builder_close(&b);
-			}
+	telephony_ss_complete_deactivate_barring(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
 
-			result = g_variant_builder_end(&b);
+	return TRUE;
+}
 
-			telephony_ss_complete_register_forwarding(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
+static gboolean _ss_barring_change_password_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_ss_general *resp = data;
 
-			g_variant_unref(result);
+	dbg("receive TRESP_SS_BARRING_CHANGE_PASSWORD");
+	dbg("resp->err = 0x%x", resp->err);
 
-	    } break;
+	telephony_ss_complete_change_barring_password(dbus_info->interface_object, dbus_info->invocation, resp->err);
 
-		case TRESP_SS_FORWARDING_DEREGISTER: {
+	return TRUE;
+}
 
-			const struct tresp_ss_forwarding *resp = data;
+static gboolean _ss_barring_get_status_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	GVariant *result = 0;
+	GVariantBuilder b;
+	int i = 0;
+	const struct tresp_ss_barring *resp = data;
 
-			dbg("receive TRESP_SS_FORWARDING_DEREGISTER");
-			dbg("resp->err = 0x%x", resp->err);
+	dbg("receive TRESP_SS_BARRING_GET_STATUS");
+	dbg("resp->err = 0x%x", resp->err);
 
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
 
-			for (i=0; i<resp->record_num; i++) {
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
-				g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
-				g_variant_builder_add(&b, "{sv}", "forwarding_mode", g_variant_new_int32( resp->record[i].mode ));
-				g_variant_builder_add(&b, "{sv}", "no_reply_time", g_variant_new_int32( resp->record[i].time ));
-				g_variant_builder_add(&b, "{sv}", "number_present", g_variant_new_int32( resp->record[i].number_present ));
-				g_variant_builder_add(&b, "{sv}", "forwarding_number", g_variant_new_string( resp->record[i].number ));
-				g_variant_builder_close(&b);
-			}
+	for (i=0; i<resp->record_num; i++) {
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
+		g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
+		g_variant_builder_add(&b, "{sv}", "barring_mode", g_variant_new_int32( resp->record[i].mode ));
+		g_variant_builder_close(&b);
+	}
 
-			result = g_variant_builder_end(&b);
+	result = g_variant_builder_end(&b);
 
-			telephony_ss_complete_deregister_forwarding(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
+	telephony_ss_complete_get_barring_status(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
 
-			g_variant_unref(result);
+	return TRUE;
+}
 
-		} break;
+static gboolean _ss_forwarding_activate_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	GVariant *result = 0;
+	GVariantBuilder b;
+	int i = 0;
+	const struct tresp_ss_forwarding *resp = data;
+
+	dbg("receive TRESP_SS_FORWARDING_ACTIVATE");
+	dbg("resp->err = 0x%x", resp->err);
+
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+
+	for (i=0; i<resp->record_num; i++) {
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
+		g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
+		g_variant_builder_add(&b, "{sv}", "forwarding_mode", g_variant_new_int32( resp->record[i].mode ));
+		g_variant_builder_add(&b, "{sv}", "no_reply_time", g_variant_new_int32( resp->record[i].time ));
+		g_variant_builder_add(&b, "{sv}", "number_present", g_variant_new_int32( resp->record[i].number_present ));
+		g_variant_builder_add(&b, "{sv}", "forwarding_number", g_variant_new_string( resp->record[i].number ));
+		g_variant_builder_close(&b);
+	}
 
-		case TRESP_SS_FORWARDING_GET_STATUS: {
+	result = g_variant_builder_end(&b);
 
-			const struct tresp_ss_forwarding *resp = data;
+	telephony_ss_complete_activate_forwarding(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
 
-			dbg("receive TRESP_SS_FORWARDING_GET_STATUS");
-			dbg("resp->err = 0x%x", resp->err);
+	return TRUE;
+}
 
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+static gboolean _ss_forwarding_deactivate_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	GVariant *result = 0;
+	GVariantBuilder b;
+	int i = 0;
+	const struct tresp_ss_forwarding *resp = data;
+
+	dbg("receive TRESP_SS_FORWARDING_DEACTIVATE");
+	dbg("resp->err = 0x%x", resp->err);
+
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+
+	for (i=0; i<resp->record_num; i++) {
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
+		g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
+		g_variant_builder_add(&b, "{sv}", "forwarding_mode", g_variant_new_int32( resp->record[i].mode ));
+		g_variant_builder_add(&b, "{sv}", "no_reply_time", g_variant_new_int32( resp->record[i].time ));
+		g_variant_builder_add(&b, "{sv}", "number_present", g_variant_new_int32( resp->record[i].number_present ));
+		g_variant_builder_add(&b, "{sv}", "forwarding_number", g_variant_new_string( resp->record[i].number ));
+		g_variant_builder_close(&b);
+	}
 
-			for (i=0; i<resp->record_num; i++) {
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
-				g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
-				g_variant_builder_add(&b, "{sv}", "forwarding_mode", g_variant_new_int32( resp->record[i].mode ));
-				g_variant_builder_add(&b, "{sv}", "no_reply_time", g_variant_new_int32( resp->record[i].time ));
-				g_variant_builder_add(&b, "{sv}", "number_present", g_variant_new_int32( resp->record[i].number_present ));
-				g_variant_builder_add(&b, "{sv}", "forwarding_number", g_variant_new_string( resp->record[i].number ));
-				g_variant_builder_close(&b);
-			}
+	result = g_variant_builder_end(&b);
 
-			result = g_variant_builder_end(&b);
+	telephony_ss_complete_deactivate_forwarding(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
 
-			telephony_ss_complete_get_forwarding_status(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
+	return TRUE;
+}
 
-			g_variant_unref(result);
+static gboolean _ss_forwarding_register_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	GVariant *result = 0;
+	GVariantBuilder b;
+	int i = 0;
+	const struct tresp_ss_forwarding *resp = data;
+
+	dbg("receive TRESP_SS_FORWARDING_REGISTER");
+	dbg("resp->err = 0x%x", resp->err);
+
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+
+	for (i=0; i<resp->record_num; i++) {
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
+		g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
+		g_variant_builder_add(&b, "{sv}", "forwarding_mode", g_variant_new_int32( resp->record[i].mode ));
+		g_variant_builder_add(&b, "{sv}", "no_reply_time", g_variant_new_int32( resp->record[i].time ));
+		g_variant_builder_add(&b, "{sv}", "number_present", g_variant_new_int32( resp->record[i].number_present ));
+		g_variant_builder_add(&b, "{sv}", "forwarding_number", g_variant_new_string( resp->record[i].number ));
+		g_variant_builder_close(&b);
+	}
 
-		} break;
+	result = g_variant_builder_end(&b);
 
-		case TRESP_SS_WAITING_ACTIVATE: {
+	telephony_ss_complete_register_forwarding(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
 
-			const struct tresp_ss_waiting *resp = data;
+	return TRUE;
+}
 
-			dbg("receive TRESP_SS_WAITING_ACTIVATE");
-			dbg("resp->err = 0x%x", resp->err);
+static gboolean _ss_forwarding_deregister_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	GVariant *result = 0;
+	GVariantBuilder b;
+	int i = 0;
+	const struct tresp_ss_forwarding *resp = data;
+
+	dbg("receive TRESP_SS_FORWARDING_DEREGISTER");
+	dbg("resp->err = 0x%x", resp->err);
+
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+
+	for (i=0; i<resp->record_num; i++) {
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
+		g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
+		g_variant_builder_add(&b, "{sv}", "forwarding_mode", g_variant_new_int32( resp->record[i].mode ));
+		g_variant_builder_add(&b, "{sv}", "no_reply_time", g_variant_new_int32( resp->record[i].time ));
+		g_variant_builder_add(&b, "{sv}", "number_present", g_variant_new_int32( resp->record[i].number_present ));
+		g_variant_builder_add(&b, "{sv}", "forwarding_number", g_variant_new_string( resp->record[i].number ));
+		g_variant_builder_close(&b);
+	}
 
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+	result = g_variant_builder_end(&b);
 
-			for (i=0; i<resp->record_num; i++) {
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
-				g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
-				g_variant_builder_close(&b);
-			}
+	telephony_ss_complete_deregister_forwarding(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
 
-			result = g_variant_builder_end(&b);
+	return TRUE;
+}
 
-			telephony_ss_complete_activate_waiting(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
+static gboolean _ss_forwarding_get_status_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	GVariant *result = 0;
+	GVariantBuilder b;
+	int i = 0;
+	const struct tresp_ss_forwarding *resp = data;
+
+	dbg("receive TRESP_SS_FORWARDING_GET_STATUS");
+	dbg("resp->err = 0x%x", resp->err);
+
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+
+	for (i=0; i<resp->record_num; i++) {
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
+		g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
+		g_variant_builder_add(&b, "{sv}", "forwarding_mode", g_variant_new_int32( resp->record[i].mode ));
+		g_variant_builder_add(&b, "{sv}", "no_reply_time", g_variant_new_int32( resp->record[i].time ));
+		g_variant_builder_add(&b, "{sv}", "number_present", g_variant_new_int32( resp->record[i].number_present ));
+		g_variant_builder_add(&b, "{sv}", "forwarding_number", g_variant_new_string( resp->record[i].number ));
+		g_variant_builder_close(&b);
+	}
 
-			g_variant_unref(result);
+	result = g_variant_builder_end(&b);
 
-		} break;
+	telephony_ss_complete_get_forwarding_status(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
 
-		case TRESP_SS_WAITING_DEACTIVATE: {
+	return TRUE;
+}
 
-			const struct tresp_ss_waiting *resp = data;
+static gboolean _ss_waiting_activate_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	GVariant *result = 0;
+	GVariantBuilder b;
+	int i = 0;
+	const struct tresp_ss_waiting *resp = data;
 
-			dbg("receive TRESP_SS_WAITING_DEACTIVATE");
-			dbg("resp->err = 0x%x", resp->err);
+	dbg("receive TRESP_SS_WAITING_ACTIVATE");
+	dbg("resp->err = 0x%x", resp->err);
 
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
 
-			for (i=0; i<resp->record_num; i++) {
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
-				g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
-				g_variant_builder_close(&b);
-			}
+	for (i=0; i<resp->record_num; i++) {
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
+		g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
+		g_variant_builder_close(&b);
+	}
 
-			result = g_variant_builder_end(&b);
+	result = g_variant_builder_end(&b);
 
-			telephony_ss_complete_deactivate_waiting(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
+	telephony_ss_complete_activate_waiting(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
 
-			g_variant_unref(result);
+	return TRUE;
+}
 
-		} break;
+static gboolean _ss_waiting_deactivate_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	GVariant *result = 0;
+	GVariantBuilder b;
+	int i = 0;
+	const struct tresp_ss_waiting *resp = data;
 
-		case TRESP_SS_WAITING_GET_STATUS: {
+	dbg("receive TRESP_SS_WAITING_DEACTIVATE");
+	dbg("resp->err = 0x%x", resp->err);
 
-			const struct tresp_ss_waiting *resp = data;
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
 
-			dbg("receive TRESP_SS_WAITING_GET_STATUS");
-			dbg("resp->err = 0x%x", resp->err);
+	for (i=0; i<resp->record_num; i++) {
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
+		g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
+		g_variant_builder_close(&b);
+	}
 
-			g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+	result = g_variant_builder_end(&b);
 
-			for (i=0; i<resp->record_num; i++) {
-				g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
-				g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
-				g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
-				g_variant_builder_close(&b);
-			}
+	telephony_ss_complete_deactivate_waiting(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
 
-			result = g_variant_builder_end(&b);
+	return TRUE;
+}
 
-			telephony_ss_complete_get_waiting_status(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
+static gboolean _ss_waiting_get_status_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	GVariant *result = 0;
+	GVariantBuilder b;
+	int i = 0;
+	const struct tresp_ss_waiting *resp = data;
 
-			g_variant_unref(result);
+	dbg("receive TRESP_SS_WAITING_GET_STATUS");
+	dbg("resp->err = 0x%x", resp->err);
 
-		} break;
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
 
-		case TRESP_SS_CLI_GET_STATUS: {
+	for (i=0; i<resp->record_num; i++) {
+		g_variant_builder_open(&b, G_VARIANT_TYPE("a{sv}"));
+		g_variant_builder_add(&b, "{sv}", "ss_class", g_variant_new_int32( resp->record[i].class ));
+		g_variant_builder_add(&b, "{sv}", "ss_status", g_variant_new_int32( resp->record[i].status ));
+		g_variant_builder_close(&b);
+	}
 
-			const struct tresp_ss_cli *resp = data;
+	result = g_variant_builder_end(&b);
 
-			dbg("receive TRESP_SS_CLI_GET_STATUS");
-			dbg("resp->err = 0x%x", resp->err);
+	telephony_ss_complete_get_waiting_status(dbus_info->interface_object, dbus_info->invocation, result, resp->err);
 
-			telephony_ss_complete_get_clistatus(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->type, resp->status);
+	return TRUE;
+}
 
-		} break;
+static gboolean _ss_cli_get_status_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_ss_cli *resp = data;
 
-		case TRESP_SS_SEND_USSD: {
+	dbg("receive TRESP_SS_CLI_GET_STATUS");
+	dbg("resp->err = 0x%x", resp->err);
 
-			const struct tresp_ss_ussd *resp = data;
+	telephony_ss_complete_get_clistatus(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->type, resp->status);
 
-			dbg("receive TRESP_SS_SEND_USSD");
-			dbg("resp->err = 0x%x", resp->err);
+	return TRUE;
+}
 
-			if ( resp->err ) {
-				dbg("USSD Request is failed");
-				telephony_ss_complete_send_ussd(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->type, resp->status, -1, 0);
+static gboolean _ss_send_ussd_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info, enum tcore_response_command command, unsigned int data_len, const void *data)
+{
+	const struct tresp_ss_ussd *resp = data;
 
-			} else {
-				int ussd_len = strlen(resp->str);
-				dbg("USSD Request is Success");
-				dbg("USSD : %s (%d)", resp->str, ussd_len);
-				telephony_ss_complete_send_ussd(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->type, resp->status, ussd_len, resp->str);
+	dbg("receive TRESP_SS_SEND_USSD");
+	dbg("resp->err = 0x%x", resp->err);
 
-			}
+	if ( resp->err ) {
+		dbg("USSD Request is failed");
+		telephony_ss_complete_send_ussd(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->type, resp->status, -1, 0);
 
-		} break;
+	} else {
+		int ussd_len = strlen(resp->str);
+		dbg("USSD Request is Success");
+		dbg("USSD : %s (%d)", resp->str, ussd_len);
+		telephony_ss_complete_send_ussd(dbus_info->interface_object, dbus_info->invocation, resp->err, resp->type, resp->status, ussd_len, resp->str);
 
-		default:
-			dbg("not handled command[%d]", command);
-		break;
 	}
 
 	return TRUE;
 }
 
-gboolean dbus_plugin_ss_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
+static const struct dbus_plugin_response_handler ss_response_handlers[] = {
+	{ TRESP_SS_BARRING_ACTIVATE, _ss_barring_activate_response },
+	{ TRESP_SS_BARRING_DEACTIVATE, _ss_barring_deactivate_response },
+	{ TRESP_SS_BARRING_CHANGE_PASSWORD, _ss_barring_change_password_response },
+	{ TRESP_SS_BARRING_GET_STATUS, _ss_barring_get_status_response },
+	{ TRESP_SS_FORWARDING_ACTIVATE, _ss_forwarding_activate_response },
+	{ TRESP_SS_FORWARDING_DEACTIVATE, _ss_forwarding_deactivate_response },
+	{ TRESP_SS_FORWARDING_REGISTER, _ss_forwarding_register_response },
+	{ TRESP_SS_FORWARDING_DEREGISTER, _ss_forwarding_deregister_response },
+	{ TRESP_SS_FORWARDING_GET_STATUS, _ss_forwarding_get_status_response },
+	{ TRESP_SS_WAITING_ACTIVATE, _ss_waiting_activate_response },
+	{ TRESP_SS_WAITING_DEACTIVATE, _ss_waiting_deactivate_response },
+	{ TRESP_SS_WAITING_GET_STATUS, _ss_waiting_get_status_response },
+	{ TRESP_SS_CLI_GET_STATUS, _ss_cli_get_status_response },
+	{ TRESP_SS_SEND_USSD, _ss_send_ussd_response },
+};
+
+static gboolean _ss_ussd_notification(struct custom_data *ctx, const char *plugin_name, TelephonyObjectSkeleton *object, enum tcore_notification_command command, unsigned int data_len, const void *data)
 {
-	TelephonySs *ss;
+	TelephonySs *ss = telephony_object_peek_ss(TELEPHONY_OBJECT(object));
 	const struct tnoti_ss_ussd *ussd = data;
 
-	if (!object) {
-		dbg("object is NULL");
-		return FALSE;
-	}
-
-	ss = telephony_object_peek_ss(TELEPHONY_OBJECT(object));
-	dbg("ss = %p", ss);
-
-	switch (command) {
-		case TNOTI_SS_USSD:
-			telephony_ss_emit_notify_ussd(ss,
-					ussd->status,
-					strlen(ussd->str),
-					ussd->str );
-			break;
-
-		default:
-			dbg("not handled command[%d]", command);
-		break;
-	}
+	telephony_ss_emit_notify_ussd(ss,
+			ussd->status,
+			strlen(ussd->str),
+			ussd->str );
 
 	return TRUE;
 }
 
+static const struct dbus_plugin_notification_handler ss_notification_handlers[] = {
+	{ TNOTI_SS_USSD, _ss_ussd_notification },
+};
+
+void dbus_plugin_register_ss_handlers(struct custom_data *ctx)
+{
+	dbus_plugin_register_responses(ctx, ss_response_handlers,
+			G_N_ELEMENTS(ss_response_handlers));
+	dbus_plugin_register_notifications(ctx, ss_notification_handlers,
+			G_N_ELEMENTS(ss_notification_handlers));
+}
@@ -0,0 +1,366 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Contact: Ja-young Gu <jygu@samsung.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <glib.h>
+
+#include <tcore.h>
+#include <plugin.h>
+#include <communicator.h>
+#include <server.h>
+#include <user_request.h>
+
+#include "generated-code.h"
+#include "common.h"
+
+
+/* number of bits needed to hold v, the 64-bit g_bit_storage() */
+static unsigned int _bit_width64(guint64 v)
+{
+	unsigned int width = 0;
+
+	if (v >> 32) {
+		width = 32;
+		v >>= 32;
+	}
+
+	return width + g_bit_storage((gulong)(guint32)v);
+}
+
+/*
+ * Latency buckets, in microseconds: values below 8 get a bucket each,
+ * above that every power of two is split in 4, so a bucket is at most
+ * 25% wide. The last bucket also takes everything beyond ~64s.
+ */
+static unsigned int _bucket_index(guint64 us)
+{
+	unsigned int msb;
+	unsigned int index;
+
+	if (us < 8)
+		return (unsigned int)us;
+
+	msb = _bit_width64(us) - 1;
+	index = 8 + (msb - 3) * 4 + ((us >> (msb - 2)) & 3);
+
+	return MIN(index, DBUS_STATS_BUCKETS - 1);
+}
+
+static guint64 _bucket_upper(unsigned int index)
+{
+	unsigned int msb;
+	unsigned int sub;
+
+	if (index < 8)
+		return index;
+
+	msb = 3 + (index - 8) / 4;
+	sub = (index - 8) % 4;
+
+	return ((guint64)(5 + sub) << (msb - 2)) - 1;
+}
+
+static guint64 _percentile(const struct dbus_stats_hist *hist, unsigned int percent)
+{
+	unsigned long target;
+	unsigned long seen = 0;
+	unsigned int i;
+
+	if (!hist->count)
+		return 0;
+
+	target = (hist->count * percent + 99) / 100;
+
+	for (i = 0; i < DBUS_STATS_BUCKETS; i++) {
+		seen += hist->buckets[i];
+		if (seen >= target)
+			return MIN(_bucket_upper(i), hist->max_us);
+	}
+
+	return hist->max_us;
+}
+
+static struct dbus_stats_hist *_hist_ref(struct dbus_plugin_stats *stats, unsigned int command)
+{
+	unsigned int group = DBUS_PLUGIN_TYPE_INDEX(command);
+	unsigned int sub = DBUS_PLUGIN_CMD_INDEX(command);
+
+	if (sub >= DBUS_PLUGIN_CMD_INDEX_MAX)
+		return NULL;
+
+	if (!stats->hist[group])
+		stats->hist[group] = g_new0(struct dbus_stats_hist *, DBUS_PLUGIN_CMD_INDEX_MAX);
+
+	if (!stats->hist[group][sub])
+		stats->hist[group][sub] = g_new0(struct dbus_stats_hist, 1);
+
+	return stats->hist[group][sub];
+}
+
+/*
+ * Called once per MAKE_UR() request: on its first response, from
+ * dbus_plugin_dispatch_request() when tcore refuses it, or from the free
+ * hook when it goes away without a response (timeout, cancel).
+ */
+void dbus_plugin_stats_request_done(struct custom_data *ctx, UserRequest *ur,
+		struct dbus_request_info *dbus_info, enum dbus_stats_result result)
+{
+	struct dbus_stats_hist *hist;
+	guint64 elapsed;
+
+	dbus_info->responded = TRUE;
+
+	hist = _hist_ref(&ctx->stats, tcore_user_request_get_command(ur));
+	if (!hist)
+		return;
+
+	switch (result) {
+	case DBUS_STATS_NO_RESPONSE:
+		hist->no_response++;
+		return;
+
+	case DBUS_STATS_DISPATCH_FAILED:
+		hist->dispatch_failed++;
+		return;
+
+	default:
+		break;
+	}
+
+	elapsed = g_get_monotonic_time() - dbus_info->start_time;
+
+	hist->count++;
+	hist->sum_us += elapsed;
+	if (elapsed > hist->max_us)
+		hist->max_us = elapsed;
+	hist->buckets[_bucket_index(elapsed)]++;
+}
+
+/* a response no handler could deliver, its latency is already counted */
+void dbus_plugin_stats_request_error(struct custom_data *ctx, UserRequest *ur)
+{
+	struct dbus_stats_hist *hist;
+
+	hist = _hist_ref(&ctx->stats, tcore_user_request_get_command(ur));
+	if (hist)
+		hist->errors++;
+}
+
+void dbus_plugin_stats_reset(struct custom_data *ctx)
+{
+	unsigned int i;
+	unsigned int j;
+
+	for (i = 0; i < DBUS_PLUGIN_TYPE_INDEX_MAX; i++) {
+		if (!ctx->stats.hist[i])
+			continue;
+
+		for (j = 0; j < DBUS_PLUGIN_CMD_INDEX_MAX; j++) {
+			if (ctx->stats.hist[i][j])
+				memset(ctx->stats.hist[i][j], 0, sizeof(struct dbus_stats_hist));
+		}
+	}
+
+	ctx->stats.reset_time = g_get_monotonic_time();
+}
+
+void dbus_plugin_stats_free(struct custom_data *ctx)
+{
+	unsigned int i;
+	unsigned int j;
+
+	for (i = 0; i < DBUS_PLUGIN_TYPE_INDEX_MAX; i++) {
+		if (!ctx->stats.hist[i])
+			continue;
+
+		for (j = 0; j < DBUS_PLUGIN_CMD_INDEX_MAX; j++)
+			g_free(ctx->stats.hist[i][j]);
+
+		g_free(ctx->stats.hist[i]);
+	}
+
+	memset(&ctx->stats, 0, sizeof(ctx->stats));
+}
+
+static GVariant *_hist_to_variant(unsigned int command, const struct dbus_stats_hist *hist)
+{
+	GVariantBuilder b;
+	GVariantBuilder buckets;
+	unsigned int last = 0;
+	unsigned int i;
+
+	/* trailing empty buckets are left out */
+	for (i = 0; i < DBUS_STATS_BUCKETS; i++) {
+		if (hist->buckets[i])
+			last = i + 1;
+	}
+
+	g_variant_builder_init(&buckets, G_VARIANT_TYPE("at"));
+	for (i = 0; i < last; i++)
+		g_variant_builder_add(&buckets, "t", (guint64)hist->buckets[i]);
+
+	g_variant_builder_init(&b, G_VARIANT_TYPE("a{sv}"));
+	g_variant_builder_add(&b, "{sv}", "command", g_variant_new_uint32(command));
+	g_variant_builder_add(&b, "{sv}", "count", g_variant_new_uint64(hist->count));
+	g_variant_builder_add(&b, "{sv}", "errors", g_variant_new_uint64(hist->errors));
+	g_variant_builder_add(&b, "{sv}", "no_response", g_variant_new_uint64(hist->no_response));
+	g_variant_builder_add(&b, "{sv}", "dispatch_failed", g_variant_new_uint64(hist->dispatch_failed));
+	g_variant_builder_add(&b, "{sv}", "mean_us", g_variant_new_uint64(hist->count ? hist->sum_us / hist->count : 0));
+	g_variant_builder_add(&b, "{sv}", "p50_us", g_variant_new_uint64(_percentile(hist, 50)));
+	g_variant_builder_add(&b, "{sv}", "p99_us", g_variant_new_uint64(_percentile(hist, 99)));
+	g_variant_builder_add(&b, "{sv}", "max_us", g_variant_new_uint64(hist->max_us));
+	g_variant_builder_add(&b, "{sv}", "buckets", g_variant_builder_end(&buckets));
+
+	return g_variant_builder_end(&b);
+}
+
+static GVariant *_counters_to_variant(struct custom_data *ctx)
+{
+	GVariantBuilder b;
+	GHashTableIter iter;
+	gpointer value;
+	struct dbus_modem_context *modem;
+	guint64 pb_hit = 0, pb_miss = 0;
+	guint64 sim_hit = 0, sim_miss = 0, sim_coalesced = 0;
+	guint64 info_emitted = 0, info_suppressed = 0, info_trailing = 0, cell_emitted = 0, cell_suppressed = 0;
+	guint64 plmn_hit = 0, plmn_miss = 0;
+
+	g_hash_table_iter_init(&iter, ctx->modems);
+	while (g_hash_table_iter_next(&iter, NULL, &value)) {
+		modem = value;
+
+		pb_hit += modem->pb_cache_hit;
+		pb_miss += modem->pb_cache_miss;
+		sim_hit += modem->sim_cache.hit;
+		sim_miss += modem->sim_cache.miss;
+		sim_coalesced += modem->sim_cache.coalesced;
+		info_emitted += modem->net_publish.info_emitted;
+		info_suppressed += modem->net_publish.info_suppressed;
+		info_trailing += modem->net_publish.info_trailing;
+		cell_emitted += modem->net_publish.cell_emitted;
+		cell_suppressed += modem->net_publish.cell_suppressed;
+		plmn_hit += modem->plmn_name_hit;
+		plmn_miss += modem->plmn_name_miss;
+	}
+
+	g_variant_builder_init(&b, G_VARIANT_TYPE("a{sv}"));
+	g_variant_builder_add(&b, "{sv}", "since_reset_us",
+			g_variant_new_uint64(g_get_monotonic_time() - ctx->stats.reset_time));
+	g_variant_builder_add(&b, "{sv}", "request_pool_in_use", g_variant_new_uint32(ctx->request_pool.in_use));
+	g_variant_builder_add(&b, "{sv}", "request_pool_high_water", g_variant_new_uint32(ctx->request_pool.high_water));
+	g_variant_builder_add(&b, "{sv}", "request_pool_overflow", g_variant_new_uint64(ctx->request_pool.overflow));
+	g_variant_builder_add(&b, "{sv}", "unhandled_responses", g_variant_new_uint64(ctx->dispatch.unhandled_response_total));
+	g_variant_builder_add(&b, "{sv}", "unhandled_notifications", g_variant_new_uint64(ctx->dispatch.unhandled_notification_total));
+	g_variant_builder_add(&b, "{sv}", "shared_request_joined", g_variant_new_uint64(ctx->flight_joined));
+	g_variant_builder_add(&b, "{sv}", "launch_dropped", g_variant_new_uint64(ctx->launcher.dropped));
+	g_variant_builder_add(&b, "{sv}", "sat_queue_overflow", g_variant_new_uint64(ctx->sat_queue_overflow));
+	g_variant_builder_add(&b, "{sv}", "pb_cache_hit", g_variant_new_uint64(pb_hit));
+	g_variant_builder_add(&b, "{sv}", "pb_cache_miss", g_variant_new_uint64(pb_miss));
+	g_variant_builder_add(&b, "{sv}", "sim_cache_hit", g_variant_new_uint64(sim_hit));
+	g_variant_builder_add(&b, "{sv}", "sim_cache_miss", g_variant_new_uint64(sim_miss));
+	g_variant_builder_add(&b, "{sv}", "sim_cache_coalesced", g_variant_new_uint64(sim_coalesced));
+	g_variant_builder_add(&b, "{sv}", "net_info_emitted", g_variant_new_uint64(info_emitted));
+	g_variant_builder_add(&b, "{sv}", "net_info_suppressed", g_variant_new_uint64(info_suppressed));
+	g_variant_builder_add(&b, "{sv}", "net_info_trailing", g_variant_new_uint64(info_trailing));
+	g_variant_builder_add(&b, "{sv}", "net_cell_info_emitted", g_variant_new_uint64(cell_emitted));
+	g_variant_builder_add(&b, "{sv}", "net_cell_info_suppressed", g_variant_new_uint64(cell_suppressed));
+	g_variant_builder_add(&b, "{sv}", "plmn_name_hit", g_variant_new_uint64(plmn_hit));
+	g_variant_builder_add(&b, "{sv}", "plmn_name_miss", g_variant_new_uint64(plmn_miss));
+
+	return g_variant_builder_end(&b);
+}
+
+static gboolean on_stats_get_snapshot(TelephonyStats *stats, GDBusMethodInvocation *invocation,
+		gpointer user_data)
+{
+	struct custom_data *ctx = user_data;
+	GVariantBuilder b;
+	struct dbus_stats_hist *hist;
+	unsigned int i;
+	unsigned int j;
+
+	g_variant_builder_init(&b, G_VARIANT_TYPE("aa{sv}"));
+
+	for (i = 0; i < DBUS_PLUGIN_TYPE_INDEX_MAX; i++) {
+		if (!ctx->stats.hist[i])
+			continue;
+
+		for (j = 0; j < DBUS_PLUGIN_CMD_INDEX_MAX; j++) {
+			hist = ctx->stats.hist[i][j];
+			if (!hist || (!hist->count && !hist->no_response && !hist->dispatch_failed))
+				continue;
+
+			g_variant_builder_add_value(&b, _hist_to_variant(TCORE_REQUEST | (i << 20) | j, hist));
+		}
+	}
+
+	telephony_stats_complete_get_snapshot(stats, invocation,
+			g_variant_builder_end(&b), _counters_to_variant(ctx));
+
+	return TRUE;
+}
+
+static gboolean on_stats_get_trace(TelephonyStats *stats, GDBusMethodInvocation *invocation,
+		gpointer user_data)
+{
+	struct custom_data *ctx = user_data;
+
+	telephony_stats_complete_get_trace(stats, invocation, dbus_plugin_trace_snapshot(ctx));
+
+	return TRUE;
+}
+
+static gboolean on_stats_reset(TelephonyStats *stats, GDBusMethodInvocation *invocation,
+		gpointer user_data)
+{
+	struct custom_data *ctx = user_data;
+
+	dbus_plugin_stats_reset(ctx);
+	telephony_stats_complete_reset(stats, invocation, 0);
+
+	return TRUE;
+}
+
+gboolean dbus_plugin_setup_stats_interface(GDBusConnection *conn, struct custom_data *ctx)
+{
+	TelephonyStats *stats;
+
+	stats = telephony_stats_skeleton_new();
+
+	g_signal_connect (stats,
+			"handle-get-snapshot",
+			G_CALLBACK (on_stats_get_snapshot),
+			ctx);
+
+	g_signal_connect (stats,
+			"handle-get-trace",
+			G_CALLBACK (on_stats_get_trace),
+			ctx);
+
+	g_signal_connect (stats,
+			"handle-reset",
+			G_CALLBACK (on_stats_reset),
+			ctx);
+
+	/* lives on the manager path next to org.tizen.telephony.Manager */
+	return g_dbus_interface_skeleton_export(G_DBUS_INTERFACE_SKELETON(stats), conn, MY_DBUS_PATH, NULL);
+}
@@ -0,0 +1,229 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Contact: Ja-young Gu <jygu@samsung.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <glib.h>
+#include <glib-unix.h>
+
+#include <tcore.h>
+#include <plugin.h>
+#include <communicator.h>
+#include <server.h>
+#include <user_request.h>
+
+#include "generated-code.h"
+#include "common.h"
+
+/* SIGUSR2 dump, build with -DTRACE_SIGNAL_DUMP=ON: the daemon may use the signal itself */
+#ifndef DBUS_TRACE_SIGNAL_DUMP
+#define DBUS_TRACE_SIGNAL_DUMP 0
+#endif
+
+/*
+ * Binary trace of requests, responses and notifications. Events are
+ * fixed size records written into a ring by the main loop only, no
+ * formatting or allocation on the recording path. The ring is read
+ * back through Stats.GetTrace or, when built with TRACE_SIGNAL_DUMP,
+ * written to DBUS_TRACE_DUMP_PATH on SIGUSR2;
+ * tools/tapi-trace-decode.c prints either.
+ */
+
+#define TRACE_MASK (DBUS_TRACE_RING_SIZE - 1)
+#define TRACE_NO_MODEM 0xff
+
+static struct dbus_trace_event *_trace_next(struct dbus_trace *trace, guint8 kind, guint8 modem,
+		guint32 command, guint32 data_len)
+{
+	struct dbus_trace_event *ev;
+
+	ev = &trace->events[trace->head & TRACE_MASK];
+	trace->head++;
+
+	ev->time_us = g_get_monotonic_time();
+	ev->command = command;
+	ev->data_len = data_len;
+	ev->kind = kind;
+	ev->modem = modem;
+	ev->reserved = 0;
+	ev->sender[0] = '\0';
+
+	return ev;
+}
+
+static guint8 _trace_modem(struct dbus_request_info *dbus_info)
+{
+	struct dbus_modem_context *modem;
+
+	modem = dbus_plugin_ref_modem_by_interface(dbus_info->interface_object);
+
+	return modem ? (guint8)modem->index : TRACE_NO_MODEM;
+}
+
+static void _trace_sender(struct dbus_trace_event *ev, GDBusMethodInvocation *invocation)
+{
+	const gchar *sender;
+
+	if (!invocation)
+		return;
+
+	sender = g_dbus_method_invocation_get_sender(invocation);
+	if (sender)
+		g_strlcpy(ev->sender, sender, DBUS_TRACE_SENDER_LEN);
+}
+
+/* MAKE_UR() time; the command is not set yet and is filled in later */
+void dbus_plugin_trace_request(struct custom_data *ctx, struct dbus_request_info *dbus_info)
+{
+	struct dbus_trace_event *ev;
+
+	if (!ctx->trace.events)
+		return;
+
+	dbus_info->trace_seq = ctx->trace.head;
+
+	ev = _trace_next(&ctx->trace, DBUS_TRACE_REQUEST, _trace_modem(dbus_info), 0, 0);
+	_trace_sender(ev, dbus_info->invocation);
+}
+
+/* command 0: request freed without a response, only complete its request event */
+void dbus_plugin_trace_response(struct custom_data *ctx, UserRequest *ur, struct dbus_request_info *dbus_info,
+		enum tcore_response_command command, unsigned int data_len)
+{
+	struct dbus_trace_event *ev;
+	unsigned int req_len = 0;
+
+	if (!ctx->trace.events)
+		return;
+
+	/* request event still in the ring and not filled in yet */
+	if (ctx->trace.head - dbus_info->trace_seq <= DBUS_TRACE_RING_SIZE) {
+		ev = &ctx->trace.events[dbus_info->trace_seq & TRACE_MASK];
+		if (ev->kind == DBUS_TRACE_REQUEST && ev->command == 0) {
+			tcore_user_request_ref_data(ur, &req_len);
+			ev->command = tcore_user_request_get_command(ur);
+			ev->data_len = req_len;
+		}
+	}
+
+	if (!command)
+		return;
+
+	ev = _trace_next(&ctx->trace, DBUS_TRACE_RESPONSE, _trace_modem(dbus_info), command, data_len);
+	_trace_sender(ev, dbus_info->invocation);
+}
+
+void dbus_plugin_trace_notification(struct custom_data *ctx, struct dbus_modem_context *modem,
+		enum tcore_notification_command command, unsigned int data_len)
+{
+	if (!ctx->trace.events)
+		return;
+
+	_trace_next(&ctx->trace, DBUS_TRACE_NOTIFICATION,
+			modem ? (guint8)modem->index : TRACE_NO_MODEM, command, data_len);
+}
+
+/* header + events, oldest first; caller owns the returned buffer */
+static guint8 *_trace_serialize(struct dbus_trace *trace, gsize *len)
+{
+	struct dbus_trace_header header;
+	guint8 *buf;
+	guint64 first;
+	guint32 count;
+	guint32 i;
+
+	count = (guint32)MIN(trace->head, (guint64)DBUS_TRACE_RING_SIZE);
+	first = trace->head - count;
+
+	memset(&header, 0, sizeof(struct dbus_trace_header));
+	memcpy(header.magic, DBUS_TRACE_MAGIC, sizeof(header.magic));
+	header.event_size = sizeof(struct dbus_trace_event);
+	header.count = count;
+	header.total = trace->head;
+
+	*len = sizeof(struct dbus_trace_header) + (gsize)count * sizeof(struct dbus_trace_event);
+	buf = g_malloc(*len);
+
+	memcpy(buf, &header, sizeof(struct dbus_trace_header));
+	for (i = 0; i < count; i++) {
+		memcpy(buf + sizeof(struct dbus_trace_header) + i * sizeof(struct dbus_trace_event),
+				&trace->events[(first + i) & TRACE_MASK], sizeof(struct dbus_trace_event));
+	}
+
+	return buf;
+}
+
+GVariant *dbus_plugin_trace_snapshot(struct custom_data *ctx)
+{
+	guint8 *buf;
+	gsize len;
+
+	if (!ctx->trace.events)
+		return g_variant_new_fixed_array(G_VARIANT_TYPE_BYTE, NULL, 0, 1);
+
+	buf = _trace_serialize(&ctx->trace, &len);
+
+	return g_variant_new_from_data(G_VARIANT_TYPE("ay"), buf, len, TRUE, g_free, buf);
+}
+
+#if DBUS_TRACE_SIGNAL_DUMP
+static gboolean on_trace_signal(gpointer user_data)
+{
+	struct custom_data *ctx = user_data;
+	GError *error = NULL;
+	guint8 *buf;
+	gsize len;
+
+	buf = _trace_serialize(&ctx->trace, &len);
+
+	if (!g_file_set_contents(DBUS_TRACE_DUMP_PATH, (const gchar *)buf, len, &error)) {
+		err("trace dump failed: %s", error->message);
+		g_error_free(error);
+	}
+	else {
+		info("trace dumped to %s (%u bytes)", DBUS_TRACE_DUMP_PATH, (unsigned int)len);
+	}
+
+	g_free(buf);
+
+	return TRUE;
+}
+#endif
+
+void dbus_plugin_trace_init(struct custom_data *ctx)
+{
+	memset(&ctx->trace, 0, sizeof(struct dbus_trace));
+
+	ctx->trace.events = g_new0(struct dbus_trace_event, DBUS_TRACE_RING_SIZE);
+#if DBUS_TRACE_SIGNAL_DUMP
+	ctx->trace.signal_source = g_unix_signal_add(SIGUSR2, on_trace_signal, ctx);
+#endif
+}
+
+void dbus_plugin_trace_free(struct custom_data *ctx)
+{
+	if (ctx->trace.signal_source)
+		g_source_remove(ctx->trace.signal_source);
+
+	g_free(ctx->trace.events);
+	memset(&ctx->trace, 0, sizeof(struct dbus_trace));
+}
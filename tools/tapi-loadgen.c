@@ -0,0 +1,596 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Closed loop D-Bus load against org.tizen.telephony: every client is
+ * its own bus connection with one call in flight, picking the next call
+ * from a weighted mix.
+ *
+ *   tapi-loadgen --address unix:path=/tmp/bus -c 16 -t 10 --mix sms=1,network=4
+ *
+ * Prints throughput, p50 / p99 / p999 latency per call and the CPU time
+ * the dbus-daemon and the plugin process used during the measured window
+ * (from /proc, pids asked from the bus unless given). Works against
+ * telephony-daemon as well as bench/tapi-stub-host; see
+ * bench/run-loadgen.sh for a self contained run.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <glib.h>
+#include <gio/gio.h>
+
+#define LOADGEN_SERVICE "org.tizen.telephony"
+#define LOADGEN_PATH "/org/tizen/telephony"
+#define LOADGEN_MODEM "loadgen0"
+#define LOADGEN_NAME_TIMEOUT_MS 10000
+#define LOADGEN_DIAL_NUMBER "0100000000"
+
+enum loadgen_op_type {
+	LOADGEN_OP_DIAL,
+	LOADGEN_OP_END,
+	LOADGEN_OP_SMS,
+	LOADGEN_OP_PHONEBOOK,
+	LOADGEN_OP_NETWORK,
+	LOADGEN_OP_APDU,
+	LOADGEN_OP_MAX
+};
+
+struct loadgen_op {
+	const char *name;
+	const char *interface;
+	const char *method;
+	guint weight;
+
+	/* completed in the measured window, microseconds */
+	GArray *latency;
+	unsigned long errors;
+};
+
+struct loadgen_cpu {
+	const char *name;
+	int pid;
+	unsigned long start;
+	unsigned long end;
+};
+
+struct loadgen;
+
+struct loadgen_client {
+	struct loadgen *lg;
+	GDBusConnection *conn;
+	enum loadgen_op_type op;
+	gint64 start;
+};
+
+struct loadgen {
+	struct loadgen_op ops[LOADGEN_OP_MAX];
+	struct loadgen_client *clients;
+	struct loadgen_cpu cpu[2];
+	guint client_count;
+	guint total_weight;
+	gint timeout_ms;
+	gint pb_records;
+	gchar *path;
+	gchar *sca;
+	gchar *tpdu;
+	GRand *rand;
+	GMainLoop *loop;
+	gboolean verbose;
+
+	gboolean running;
+	gboolean measuring;
+	gint64 window_start;
+	gint64 window_end;
+	guint inflight;
+};
+
+static const struct loadgen_op loadgen_ops[LOADGEN_OP_MAX] = {
+	{ "dial", "org.tizen.telephony.Call", "Dial", 1, NULL, 0 },
+	{ "end", "org.tizen.telephony.Call", "End", 1, NULL, 0 },
+	{ "sms", "org.tizen.telephony.sms", "SendMsg", 2, NULL, 0 },
+	{ "phonebook", "org.tizen.telephony.Phonebook", "ReadRecord", 4, NULL, 0 },
+	{ "network", "org.tizen.telephony.Network", "GetServingNetwork", 4, NULL, 0 },
+	{ "apdu", "org.tizen.telephony.Sim", "TransferAPDU", 2, NULL, 0 },
+};
+
+/* SMSC +82 10 0000 0000, an SMS-SUBMIT of "loadgen" to 0100000000 */
+static const guchar loadgen_sca[] = {
+	0x07, 0x91, 0x28, 0x01, 0x00, 0x00, 0x00, 0xF0,
+};
+static const guchar loadgen_tpdu[] = {
+	0x01, 0x00, 0x0A, 0x81, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0xEC, 0xB7, 0x38, 0x2C, 0x7E, 0x97, 0x01,
+};
+
+/* SELECT MF */
+static const guchar loadgen_apdu[] = {
+	0x00, 0xA4, 0x00, 0x04, 0x02, 0x3F, 0x00,
+};
+
+static void _issue(struct loadgen_client *c);
+
+static GVariant *_op_parameters(struct loadgen *lg, enum loadgen_op_type op)
+{
+	GVariant *apdu;
+
+	switch (op) {
+		case LOADGEN_OP_DIAL:
+			return g_variant_new("(is)", 0, LOADGEN_DIAL_NUMBER);
+
+		case LOADGEN_OP_END:
+			return g_variant_new("(ii)", 1, 0);
+
+		case LOADGEN_OP_SMS:
+			return g_variant_new("(sisi)", lg->sca, (gint)sizeof(loadgen_tpdu), lg->tpdu, 0);
+
+		case LOADGEN_OP_PHONEBOOK:
+			return g_variant_new("(ii)", 0, g_rand_int_range(lg->rand, 1, lg->pb_records + 1));
+
+		case LOADGEN_OP_APDU:
+			apdu = g_variant_new_fixed_array(G_VARIANT_TYPE_BYTE, loadgen_apdu, sizeof(loadgen_apdu), 1);
+			return g_variant_new("(v)", apdu);
+
+		default:
+			return NULL;
+	}
+}
+
+static enum loadgen_op_type _pick(struct loadgen *lg)
+{
+	guint32 n;
+	int i;
+
+	n = g_rand_int_range(lg->rand, 0, (gint32)lg->total_weight);
+	for (i = 0; i < LOADGEN_OP_MAX; i++) {
+		if (n < lg->ops[i].weight)
+			return i;
+		n -= lg->ops[i].weight;
+	}
+
+	return LOADGEN_OP_NETWORK;
+}
+
+static void _call_done(GObject *source, GAsyncResult *res, gpointer user_data)
+{
+	struct loadgen_client *c = user_data;
+	struct loadgen *lg = c->lg;
+	struct loadgen_op *op = &lg->ops[c->op];
+	GVariant *result;
+	GError *error = NULL;
+	guint64 us;
+
+	result = g_dbus_connection_call_finish(G_DBUS_CONNECTION(source), res, &error);
+	us = (guint64)(g_get_monotonic_time() - c->start);
+
+	if (lg->measuring && c->start >= lg->window_start) {
+		if (result)
+			g_array_append_val(op->latency, us);
+		else
+			op->errors++;
+	}
+
+	if (error) {
+		if (lg->verbose)
+			fprintf(stderr, "%s: %s\n", op->method, error->message);
+		g_error_free(error);
+	}
+	if (result)
+		g_variant_unref(result);
+
+	lg->inflight--;
+	if (lg->running)
+		_issue(c);
+	else if (!lg->inflight)
+		g_main_loop_quit(lg->loop);
+}
+
+static void _issue(struct loadgen_client *c)
+{
+	struct loadgen *lg = c->lg;
+	struct loadgen_op *op;
+
+	c->op = _pick(lg);
+	op = &lg->ops[c->op];
+	c->start = g_get_monotonic_time();
+	lg->inflight++;
+
+	g_dbus_connection_call(c->conn, LOADGEN_SERVICE, lg->path, op->interface, op->method,
+			_op_parameters(lg, c->op), NULL, G_DBUS_CALL_FLAGS_NONE, lg->timeout_ms, NULL,
+			_call_done, c);
+}
+
+/* utime + stime in clock ticks, fields 14 and 15 of /proc/<pid>/stat */
+static gboolean _cpu_ticks(int pid, unsigned long *ticks)
+{
+	gchar *path;
+	gchar *contents = NULL;
+	const char *p;
+	unsigned long utime;
+	unsigned long stime;
+	gboolean ok = FALSE;
+
+	if (pid <= 0)
+		return FALSE;
+
+	path = g_strdup_printf("/proc/%d/stat", pid);
+	if (!g_file_get_contents(path, &contents, NULL, NULL))
+		goto out;
+
+	/* the command name may contain anything, skip past its closing paren */
+	p = strrchr(contents, ')');
+	if (p && sscanf(p + 1, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu", &utime, &stime) == 2) {
+		*ticks = utime + stime;
+		ok = TRUE;
+	}
+
+out:
+	g_free(contents);
+	g_free(path);
+	return ok;
+}
+
+static void _cpu_snapshot(struct loadgen *lg, gboolean start)
+{
+	unsigned long ticks;
+	guint i;
+
+	for (i = 0; i < G_N_ELEMENTS(lg->cpu); i++) {
+		if (!_cpu_ticks(lg->cpu[i].pid, &ticks))
+			continue;
+
+		if (start)
+			lg->cpu[i].start = ticks;
+		else
+			lg->cpu[i].end = ticks;
+	}
+}
+
+static int _connection_pid(GDBusConnection *conn, const char *name)
+{
+	GVariant *result;
+	guint32 pid = 0;
+
+	result = g_dbus_connection_call_sync(conn, "org.freedesktop.DBus", "/org/freedesktop/DBus",
+			"org.freedesktop.DBus", "GetConnectionUnixProcessID", g_variant_new("(s)", name),
+			G_VARIANT_TYPE("(u)"), G_DBUS_CALL_FLAGS_NONE, -1, NULL, NULL);
+	if (!result)
+		return 0;
+
+	g_variant_get(result, "(u)", &pid);
+	g_variant_unref(result);
+
+	return (int)pid;
+}
+
+static gboolean _start_window(gpointer user_data)
+{
+	struct loadgen *lg = user_data;
+
+	_cpu_snapshot(lg, TRUE);
+	lg->window_start = g_get_monotonic_time();
+	lg->measuring = TRUE;
+
+	return FALSE;
+}
+
+static gboolean _stop(gpointer user_data)
+{
+	struct loadgen *lg = user_data;
+
+	lg->window_end = g_get_monotonic_time();
+	_cpu_snapshot(lg, FALSE);
+	lg->measuring = FALSE;
+	lg->running = FALSE;
+
+	if (!lg->inflight)
+		g_main_loop_quit(lg->loop);
+
+	return FALSE;
+}
+
+static void _name_appeared(GDBusConnection *conn, const gchar *name, const gchar *owner, gpointer user_data)
+{
+	*(gboolean *)user_data = TRUE;
+}
+
+static gboolean _timeout(gpointer user_data)
+{
+	*(gboolean *)user_data = TRUE;
+
+	return FALSE;
+}
+
+static gboolean _wait_for_service(GDBusConnection *conn)
+{
+	gboolean owned = FALSE;
+	gboolean expired = FALSE;
+	guint watch;
+	guint timer;
+
+	watch = g_bus_watch_name_on_connection(conn, LOADGEN_SERVICE, G_BUS_NAME_WATCHER_FLAGS_NONE,
+			_name_appeared, NULL, &owned, NULL);
+	timer = g_timeout_add(LOADGEN_NAME_TIMEOUT_MS, _timeout, &expired);
+
+	while (!owned && !expired)
+		g_main_context_iteration(NULL, TRUE);
+
+	g_bus_unwatch_name(watch);
+	if (!expired)
+		g_source_remove(timer);
+
+	return owned;
+}
+
+/* "dial=1,end=1,sms=0" changes those weights, the others keep theirs */
+static gboolean _parse_mix(struct loadgen *lg, const char *mix)
+{
+	gchar **items;
+	gchar **kv;
+	gchar *end;
+	guint64 weight;
+	gboolean ok = TRUE;
+	int i;
+	int j;
+
+	items = g_strsplit(mix, ",", -1);
+	for (i = 0; ok && items[i]; i++) {
+		kv = g_strsplit(items[i], "=", 2);
+		ok = FALSE;
+
+		if (kv[0] && kv[1]) {
+			weight = g_ascii_strtoull(kv[1], &end, 10);
+			if (*end || end == kv[1] || weight > 1000)
+				j = LOADGEN_OP_MAX;
+			else
+				j = 0;
+
+			for (; j < LOADGEN_OP_MAX; j++) {
+				if (g_strcmp0(kv[0], lg->ops[j].name) == 0) {
+					lg->ops[j].weight = (guint)weight;
+					ok = TRUE;
+					break;
+				}
+			}
+		}
+
+		if (!ok)
+			fprintf(stderr, "bad --mix entry %s\n", items[i]);
+		g_strfreev(kv);
+	}
+	g_strfreev(items);
+
+	return ok;
+}
+
+static gint _compare_u64(gconstpointer a, gconstpointer b)
+{
+	guint64 x = *(const guint64 *)a;
+	guint64 y = *(const guint64 *)b;
+
+	return x < y ? -1 : x > y;
+}
+
+static guint64 _percentile(GArray *sorted, double p)
+{
+	guint index;
+
+	if (!sorted->len)
+		return 0;
+
+	index = (guint)(p * sorted->len + 0.999999);
+	if (index > 0)
+		index--;
+	if (index >= sorted->len)
+		index = sorted->len - 1;
+
+	return g_array_index(sorted, guint64, index);
+}
+
+static void _report_line(const char *name, GArray *latency, unsigned long errors)
+{
+	g_array_sort(latency, _compare_u64);
+
+	printf("%-10s %9u %7lu %9" G_GUINT64_FORMAT " %9" G_GUINT64_FORMAT " %9" G_GUINT64_FORMAT "\n",
+			name, latency->len, errors,
+			_percentile(latency, 0.50), _percentile(latency, 0.99), _percentile(latency, 0.999));
+}
+
+static unsigned long _report(struct loadgen *lg)
+{
+	GArray *all;
+	unsigned long errors = 0;
+	double seconds;
+	double cpu;
+	long hz;
+	guint i;
+
+	seconds = (double)(lg->window_end - lg->window_start) / G_USEC_PER_SEC;
+	all = g_array_new(FALSE, FALSE, sizeof(guint64));
+
+	for (i = 0; i < LOADGEN_OP_MAX; i++) {
+		g_array_append_vals(all, lg->ops[i].latency->data, lg->ops[i].latency->len);
+		errors += lg->ops[i].errors;
+	}
+
+	printf("%u clients, %.2f s, %u calls, %.1f calls/s, %lu errors\n",
+			lg->client_count, seconds, all->len, seconds > 0 ? all->len / seconds : 0.0, errors);
+	printf("%-10s %9s %7s %9s %9s %9s\n", "call", "ok", "errors", "p50 us", "p99 us", "p999 us");
+
+	for (i = 0; i < LOADGEN_OP_MAX; i++) {
+		if (lg->ops[i].weight)
+			_report_line(lg->ops[i].name, lg->ops[i].latency, lg->ops[i].errors);
+	}
+	_report_line("all", all, errors);
+
+	hz = sysconf(_SC_CLK_TCK);
+	for (i = 0; i < G_N_ELEMENTS(lg->cpu); i++) {
+		if (lg->cpu[i].pid <= 0 || hz <= 0) {
+			printf("cpu %-12s unknown\n", lg->cpu[i].name);
+			continue;
+		}
+
+		cpu = (double)(lg->cpu[i].end - lg->cpu[i].start) / hz;
+		printf("cpu %-12s pid %d, %.2f s, %.1f%% of a core, %.1f us/call\n",
+				lg->cpu[i].name, lg->cpu[i].pid, cpu,
+				seconds > 0 ? 100.0 * cpu / seconds : 0.0,
+				all->len ? cpu * G_USEC_PER_SEC / all->len : 0.0);
+	}
+
+	if (!all->len)
+		errors++;
+	g_array_free(all, TRUE);
+
+	return errors;
+}
+
+int main(int argc, char **argv)
+{
+	struct loadgen lg;
+	GOptionContext *options;
+	GError *error = NULL;
+	gchar *address = NULL;
+	gchar *modem = NULL;
+	gchar *mix = NULL;
+	gint clients = 8;
+	gint duration = 10;
+	gint warmup = 1;
+	gint daemon_pid = 0;
+	gint plugin_pid = 0;
+	gboolean verbose = FALSE;
+	unsigned long failed;
+	guint i;
+
+	GOptionEntry entries[] = {
+		{ "address", 'a', 0, G_OPTION_ARG_STRING, &address, "Bus address (DBUS_SYSTEM_BUS_ADDRESS, else the system bus)", "ADDRESS" },
+		{ "modem", 'm', 0, G_OPTION_ARG_STRING, &modem, "Modem name (" LOADGEN_MODEM ")", "NAME" },
+		{ "clients", 'c', 0, G_OPTION_ARG_INT, &clients, "Concurrent clients (8)", "N" },
+		{ "duration", 't', 0, G_OPTION_ARG_INT, &duration, "Measured seconds (10)", "S" },
+		{ "warmup", 'w', 0, G_OPTION_ARG_INT, &warmup, "Unmeasured seconds first (1)", "S" },
+		{ "mix", 0, 0, G_OPTION_ARG_STRING, &mix, "Call weights, dial=1,end=1,sms=2,phonebook=4,network=4,apdu=2", "MIX" },
+		{ "pb-records", 0, 0, G_OPTION_ARG_INT, &lg.pb_records, "Phonebook indexes read (250)", "N" },
+		{ "timeout-ms", 0, 0, G_OPTION_ARG_INT, &lg.timeout_ms, "Per call timeout (5000)", "MS" },
+		{ "daemon-pid", 0, 0, G_OPTION_ARG_INT, &daemon_pid, "dbus-daemon pid (asked from the bus)", "PID" },
+		{ "plugin-pid", 0, 0, G_OPTION_ARG_INT, &plugin_pid, "Plugin process pid (owner of " LOADGEN_SERVICE ")", "PID" },
+		{ "verbose", 'v', 0, G_OPTION_ARG_NONE, &verbose, "Print failed calls", NULL },
+		{ NULL }
+	};
+
+	memset(&lg, 0, sizeof(struct loadgen));
+	lg.pb_records = 250;
+	lg.timeout_ms = 5000;
+
+	options = g_option_context_new("- D-Bus load against the telephony plugin");
+	g_option_context_add_main_entries(options, entries, NULL);
+	if (!g_option_context_parse(options, &argc, &argv, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		return 2;
+	}
+	g_option_context_free(options);
+
+	memcpy(lg.ops, loadgen_ops, sizeof(loadgen_ops));
+	if (mix && !_parse_mix(&lg, mix))
+		return 2;
+
+	for (i = 0; i < LOADGEN_OP_MAX; i++)
+		lg.total_weight += lg.ops[i].weight;
+
+	if (clients <= 0 || duration <= 0 || warmup < 0 || lg.pb_records <= 0 || !lg.total_weight) {
+		fprintf(stderr, "nothing to do\n");
+		return 2;
+	}
+
+	if (!address)
+		address = g_strdup(g_getenv("DBUS_SYSTEM_BUS_ADDRESS"));
+	if (!address)
+		address = g_dbus_address_get_for_bus_sync(G_BUS_TYPE_SYSTEM, NULL, NULL);
+	if (!address) {
+		fprintf(stderr, "no bus, use --address\n");
+		return 2;
+	}
+
+	lg.client_count = (guint)clients;
+	lg.clients = g_new0(struct loadgen_client, lg.client_count);
+	lg.verbose = verbose;
+	lg.rand = g_rand_new();
+	lg.loop = g_main_loop_new(NULL, FALSE);
+	lg.path = g_strdup_printf("%s/%s", LOADGEN_PATH, modem ? modem : LOADGEN_MODEM);
+	lg.sca = g_base64_encode(loadgen_sca, sizeof(loadgen_sca));
+	lg.tpdu = g_base64_encode(loadgen_tpdu, sizeof(loadgen_tpdu));
+
+	for (i = 0; i < LOADGEN_OP_MAX; i++)
+		lg.ops[i].latency = g_array_new(FALSE, FALSE, sizeof(guint64));
+
+	for (i = 0; i < lg.client_count; i++) {
+		lg.clients[i].lg = &lg;
+		lg.clients[i].conn = g_dbus_connection_new_for_address_sync(address,
+				G_DBUS_CONNECTION_FLAGS_AUTHENTICATION_CLIENT | G_DBUS_CONNECTION_FLAGS_MESSAGE_BUS_CONNECTION,
+				NULL, NULL, &error);
+		if (!lg.clients[i].conn) {
+			fprintf(stderr, "client %u: %s\n", i, error->message);
+			g_error_free(error);
+			return 1;
+		}
+	}
+
+	if (!_wait_for_service(lg.clients[0].conn)) {
+		fprintf(stderr, "%s did not show up on %s\n", LOADGEN_SERVICE, address);
+		return 1;
+	}
+
+	lg.cpu[0].name = "dbus-daemon";
+	lg.cpu[0].pid = daemon_pid ? daemon_pid : _connection_pid(lg.clients[0].conn, "org.freedesktop.DBus");
+	lg.cpu[1].name = "plugin";
+	lg.cpu[1].pid = plugin_pid ? plugin_pid : _connection_pid(lg.clients[0].conn, LOADGEN_SERVICE);
+
+	lg.running = TRUE;
+	for (i = 0; i < lg.client_count; i++)
+		_issue(&lg.clients[i]);
+
+	if (warmup)
+		g_timeout_add_seconds((guint)warmup, _start_window, &lg);
+	else
+		_start_window(&lg);
+	g_timeout_add_seconds((guint)(warmup + duration), _stop, &lg);
+
+	g_main_loop_run(lg.loop);
+
+	failed = _report(&lg);
+
+	for (i = 0; i < lg.client_count; i++) {
+		g_dbus_connection_close_sync(lg.clients[i].conn, NULL, NULL);
+		g_object_unref(lg.clients[i].conn);
+	}
+	for (i = 0; i < LOADGEN_OP_MAX; i++)
+		g_array_free(lg.ops[i].latency, TRUE);
+
+	g_main_loop_unref(lg.loop);
+	g_rand_free(lg.rand);
+	g_free(lg.clients);
+	g_free(lg.path);
+	g_free(lg.sca);
+	g_free(lg.tpdu);
+	g_free(mix);
+	g_free(modem);
+	g_free(address);
+
+	return failed ? 1 : 0;
+}
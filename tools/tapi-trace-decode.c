@@ -0,0 +1,123 @@
+/*
+ * tel-plugin-dbus-tapi
+ *
+ * Copyright (c) 2012 Samsung Electronics Co., Ltd. All rights reserved.
+ *
+ * Contact: Ja-young Gu <jygu@samsung.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Prints a trace written by the dbus-tapi plugin, either the file
+ * dumped on SIGUSR2 or the bytes returned by Stats.GetTrace.
+ *
+ * Built and installed with the plugin; the SIGUSR2 dump needs a plugin
+ * built with -DTRACE_SIGNAL_DUMP=ON.
+ *
+ *   kill -USR2 <telephony-daemon pid>
+ *   tapi-trace-decode /tmp/dbus-tapi-trace.bin
+ *
+ * Must match struct dbus_trace_header / struct dbus_trace_event in
+ * src/common.h, and be run on the machine (endianness) that wrote it.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <inttypes.h>
+
+#define TRACE_MAGIC "TAPITRC1"
+#define TRACE_SENDER_LEN 20
+
+struct trace_header {
+	char magic[8];
+	uint32_t event_size;
+	uint32_t count;
+	uint64_t total;
+};
+
+struct trace_event {
+	int64_t time_us;
+	uint32_t command;
+	uint32_t data_len;
+	uint8_t kind;
+	uint8_t modem;
+	uint16_t reserved;
+	char sender[TRACE_SENDER_LEN];
+};
+
+static const char *kind_name(uint8_t kind)
+{
+	switch (kind) {
+		case 1:
+			return "REQ ";
+		case 2:
+			return "RESP";
+		case 3:
+			return "NOTI";
+		default:
+			return "????";
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	struct trace_header header;
+	struct trace_event ev;
+	int64_t first = 0;
+	uint32_t i;
+	FILE *fp;
+
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s <trace file>\n", argv[0]);
+		return 1;
+	}
+
+	fp = fopen(argv[1], "rb");
+	if (!fp) {
+		perror(argv[1]);
+		return 1;
+	}
+
+	if (fread(&header, sizeof(header), 1, fp) != 1
+			|| memcmp(header.magic, TRACE_MAGIC, sizeof(header.magic)) != 0
+			|| header.event_size != sizeof(struct trace_event)) {
+		fprintf(stderr, "%s: not a dbus-tapi trace\n", argv[1]);
+		fclose(fp);
+		return 1;
+	}
+
+	printf("# %" PRIu32 " events (%" PRIu64 " recorded in total)\n", header.count, header.total);
+	printf("# %12s %4s %5s %10s %8s %s\n", "+us", "kind", "modem", "command", "len", "sender");
+
+	for (i = 0; i < header.count; i++) {
+		if (fread(&ev, sizeof(ev), 1, fp) != 1) {
+			fprintf(stderr, "%s: truncated at event %" PRIu32 "\n", argv[1], i);
+			break;
+		}
+
+		if (i == 0)
+			first = ev.time_us;
+
+		ev.sender[TRACE_SENDER_LEN - 1] = '\0';
+
+		printf("%14" PRId64 " %s %5u 0x%08" PRIx32 " %8" PRIu32 " %s\n",
+				ev.time_us - first, kind_name(ev.kind), ev.modem,
+				ev.command, ev.data_len, ev.sender);
+	}
+
+	fclose(fp);
+
+	return 0;
+}